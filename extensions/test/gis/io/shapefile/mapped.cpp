@@ -0,0 +1,392 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/extensions/gis/io/shapefile/mapped.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+typedef std::vector<std::vector<point_type> > parts_type;
+
+
+// Writer of the little parts of the shapefile format used by the test
+struct shapefile_writer
+{
+    explicit shapefile_writer(int type)
+        : m_type(type)
+    {}
+
+    static void put_big(std::string & s, int v)
+    {
+        s += char((v >> 24) & 0xff);
+        s += char((v >> 16) & 0xff);
+        s += char((v >> 8) & 0xff);
+        s += char(v & 0xff);
+    }
+
+    static void put_little(std::string & s, int v)
+    {
+        s += char(v & 0xff);
+        s += char((v >> 8) & 0xff);
+        s += char((v >> 16) & 0xff);
+        s += char((v >> 24) & 0xff);
+    }
+
+    static void put_double(std::string & s, double v)
+    {
+        boost::int64_t i;
+        std::memcpy(&i, &v, sizeof(v));
+        for (int b = 0; b < 8; ++b)
+        {
+            s += char((i >> (8 * b)) & 0xff);
+        }
+    }
+
+    void add_null()
+    {
+        std::string content;
+        put_little(content, 0);
+        m_records.push_back(content);
+    }
+
+    void add_point(point_type const& p)
+    {
+        std::string content;
+        put_little(content, m_type);
+        put_double(content, bg::get<0>(p));
+        put_double(content, bg::get<1>(p));
+        m_records.push_back(content);
+    }
+
+    // Polyline, polygon (with parts) or multipoint (one part)
+    void add(parts_type const& parts)
+    {
+        multi_point_type points;
+        for (std::size_t i = 0; i < parts.size(); ++i)
+        {
+            points.insert(points.end(), parts[i].begin(), parts[i].end());
+        }
+        box_type const box = bg::return_envelope<box_type>(points);
+
+        std::string content;
+        put_little(content, m_type);
+        put_double(content, bg::get<bg::min_corner, 0>(box));
+        put_double(content, bg::get<bg::min_corner, 1>(box));
+        put_double(content, bg::get<bg::max_corner, 0>(box));
+        put_double(content, bg::get<bg::max_corner, 1>(box));
+        if (m_type != 8)
+        {
+            put_little(content, int(parts.size()));
+        }
+        put_little(content, int(points.size()));
+        if (m_type != 8)
+        {
+            int first = 0;
+            for (std::size_t i = 0; i < parts.size(); ++i)
+            {
+                put_little(content, first);
+                first += int(parts[i].size());
+            }
+        }
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            put_double(content, bg::get<0>(points[i]));
+            put_double(content, bg::get<1>(points[i]));
+        }
+        m_records.push_back(content);
+    }
+
+    std::string header(std::size_t size) const
+    {
+        std::string s;
+        put_big(s, 9994);
+        for (int i = 0; i < 5; ++i)
+        {
+            put_big(s, 0);
+        }
+        put_big(s, int(size / 2));
+        put_little(s, 1000);
+        put_little(s, m_type);
+        for (int i = 0; i < 8; ++i)
+        {
+            put_double(s, 0);
+        }
+        return s;
+    }
+
+    std::string shp() const
+    {
+        std::string records;
+        for (std::size_t i = 0; i < m_records.size(); ++i)
+        {
+            put_big(records, int(i + 1));
+            put_big(records, int(m_records[i].size() / 2));
+            records += m_records[i];
+        }
+        return header(100 + records.size()) + records;
+    }
+
+    std::string shx() const
+    {
+        std::string index;
+        std::size_t offset = 100;
+        for (std::size_t i = 0; i < m_records.size(); ++i)
+        {
+            put_big(index, int(offset / 2));
+            put_big(index, int(m_records[i].size() / 2));
+            offset += 8 + m_records[i].size();
+        }
+        return header(100 + index.size()) + index;
+    }
+
+    int m_type;
+    std::vector<std::string> m_records;
+};
+
+std::vector<point_type> square(double x, double y, double size, bool cw)
+{
+    std::vector<point_type> result;
+    result.push_back(point_type(x, y));
+    if (cw)
+    {
+        result.push_back(point_type(x, y + size));
+        result.push_back(point_type(x + size, y + size));
+        result.push_back(point_type(x + size, y));
+    }
+    else
+    {
+        result.push_back(point_type(x + size, y));
+        result.push_back(point_type(x + size, y + size));
+        result.push_back(point_type(x, y + size));
+    }
+    result.push_back(point_type(x, y));
+    return result;
+}
+
+template <typename Range>
+std::string to_string(Range const& range)
+{
+    std::ostringstream out;
+    for (typename Range::const_iterator it = range.begin(); it != range.end(); ++it)
+    {
+        out << bg::wkt(*it) << ";";
+    }
+    return out.str();
+}
+
+void write_file(std::string const& path, std::string const& data)
+{
+    std::ofstream out(path.c_str(), std::ios::binary);
+    out.write(data.data(), data.size());
+}
+
+void test_polygons()
+{
+    // The stream reader does not support null shapes
+    shapefile_writer writer(5);
+    shapefile_writer reference(5);
+    for (int i = 0; i < 20; ++i)
+    {
+        if (i % 7 == 3)
+        {
+            writer.add_null();
+            continue;
+        }
+
+        parts_type parts;
+        parts.push_back(square(i * 10, 0, 8, true));
+        if (i % 2 == 0)
+        {
+            parts.push_back(square(i * 10 + 2, 2, 2, false));
+        }
+        if (i % 3 == 0)
+        {
+            parts.push_back(square(i * 10, 20, 4, true));
+        }
+        writer.add(parts);
+        reference.add(parts);
+    }
+
+    std::string const shp = writer.shp();
+    std::string const shx = writer.shx();
+    write_file("test_mapped_polygons.shp", shp);
+    write_file("test_mapped_polygons.shx", shx);
+
+    // Reference, read from a stream
+    std::vector<polygon_type> expected;
+    std::vector<multi_polygon_type> expected_multi;
+    {
+        std::istringstream in(reference.shp());
+        bg::read_shapefile(in, expected);
+        std::istringstream in_multi(reference.shp());
+        bg::read_shapefile(in_multi, expected_multi);
+    }
+    BOOST_CHECK_EQUAL(expected.size(), 17u + 6u);
+    BOOST_CHECK_EQUAL(expected_multi.size(), 17u);
+
+    bg::mapped_shapefile const file("test_mapped_polygons.shp");
+    BOOST_CHECK_EQUAL(file.size(), 20u);
+    BOOST_CHECK_EQUAL(file.type(), 5);
+
+    {
+        std::vector<polygon_type> polygons;
+        bg::read_mapped_shapefile(file, polygons);
+        BOOST_CHECK_EQUAL(to_string(polygons), to_string(expected));
+
+        std::vector<multi_polygon_type> multi_polygons;
+        bg::read_mapped_shapefile(file, multi_polygons);
+        BOOST_CHECK_EQUAL(to_string(multi_polygons), to_string(expected_multi));
+
+        bg::shapefile_view<polygon_type> const view(file);
+        std::vector<polygon_type> streamed(view.begin(), view.end());
+        BOOST_CHECK_EQUAL(to_string(streamed), to_string(expected));
+    }
+
+    // Records intersecting a box, records 3 and 10 are null shapes
+    box_type const box(point_type(25, 1), point_type(105, 30));
+    std::vector<std::size_t> records;
+    std::vector<multi_polygon_type> filtered;
+    {
+        bg::shapefile_view<multi_polygon_type> const view(file, box);
+        for (bg::shapefile_view<multi_polygon_type>::iterator it = view.begin();
+                it != view.end(); ++it)
+        {
+            records.push_back(it.record());
+            filtered.push_back(*it);
+        }
+    }
+    BOOST_CHECK_EQUAL(records.size(), 7u);
+    BOOST_CHECK_EQUAL(records.front(), 2u);
+    BOOST_CHECK_EQUAL(records.back(), 9u);
+
+    // In parallel, in small chunks, also without index and from memory
+    {
+        std::vector<multi_polygon_type> result;
+        bg::read_mapped_shapefile(file, result, box,
+                                  bg::execution::parallel_policy(3, 1));
+        BOOST_CHECK_EQUAL(to_string(result), to_string(filtered));
+
+        std::vector<polygon_type> all;
+        box_type const everything(point_type(-1000, -1000), point_type(1000, 1000));
+        bg::read_mapped_shapefile(file, all, everything,
+                                  bg::execution::parallel_policy(4, 2));
+        BOOST_CHECK_EQUAL(to_string(all), to_string(expected));
+
+        bg::mapped_shapefile const memory(shp.data(), shp.size());
+        BOOST_CHECK_EQUAL(memory.size(), 20u);
+        result.clear();
+        bg::read_mapped_shapefile(memory, result, box,
+                                  bg::execution::sequenced_policy());
+        BOOST_CHECK_EQUAL(to_string(result), to_string(filtered));
+    }
+
+    std::remove("test_mapped_polygons.shp");
+    std::remove("test_mapped_polygons.shx");
+}
+
+void test_lines_and_points()
+{
+    shapefile_writer lines(3);
+    parts_type parts;
+    parts.push_back(square(0, 0, 1, true));
+    lines.add(parts);
+    parts.push_back(square(5, 5, 1, true));
+    lines.add(parts);
+
+    std::string const shp = lines.shp();
+    bg::mapped_shapefile const file(shp.data(), shp.size());
+
+    std::vector<linestring_type> linestrings;
+    bg::read_mapped_shapefile(file, linestrings);
+    BOOST_CHECK_EQUAL(linestrings.size(), 3u);
+
+    std::vector<multi_linestring_type> multi_linestrings;
+    bg::read_mapped_shapefile(file, multi_linestrings,
+                              box_type(point_type(4, 4), point_type(10, 10)),
+                              bg::execution::sequenced_policy());
+    BOOST_CHECK_EQUAL(multi_linestrings.size(), 1u);
+    BOOST_CHECK_EQUAL(multi_linestrings.front().size(), 2u);
+
+    // Not readable as polygons
+    BOOST_CHECK_THROW(bg::shapefile_view<polygon_type> view(file), bg::read_shapefile_exception);
+
+    shapefile_writer points(1);
+    for (int i = 0; i < 10; ++i)
+    {
+        points.add_point(point_type(i, 2 * i));
+    }
+    std::string const shp_points = points.shp();
+    std::string const shx_points = points.shx();
+    bg::mapped_shapefile const file_points(shp_points.data(), shp_points.size(),
+                                           shx_points.data(), shx_points.size());
+
+    bg::shapefile_view<point_type> const view(file_points,
+        box_type(point_type(2, 0), point_type(5, 8)));
+    std::vector<point_type> result(view.begin(), view.end());
+    BOOST_CHECK_EQUAL(to_string(result), "POINT(2 4);POINT(3 6);POINT(4 8);");
+
+    std::vector<multi_point_type> multi_points;
+    bg::read_mapped_shapefile(file_points, multi_points);
+    BOOST_CHECK_EQUAL(multi_points.size(), 10u);
+
+    // A non-const file, which must not be taken for a stream
+    bg::mapped_shapefile mutable_file(shp_points.data(), shp_points.size());
+    std::vector<point_type> all_points;
+    bg::read_mapped_shapefile(mutable_file, all_points);
+    BOOST_CHECK_EQUAL(all_points.size(), 10u);
+}
+
+void test_invalid()
+{
+    shapefile_writer writer(3);
+    parts_type parts;
+    parts.push_back(square(0, 0, 1, true));
+    writer.add(parts);
+
+    std::string shp = writer.shp();
+
+    // Number of points larger than the record
+    std::string corrupted = shp;
+    corrupted[100 + 8 + 40] = char(0x7f);
+    bg::mapped_shapefile const file(corrupted.data(), corrupted.size());
+    std::vector<linestring_type> linestrings;
+    BOOST_CHECK_THROW(bg::read_mapped_shapefile(file, linestrings), bg::read_shapefile_exception);
+
+    // Record longer than the file
+    BOOST_CHECK_THROW(bg::mapped_shapefile(shp.data(), shp.size() - 1),
+                      bg::read_shapefile_exception);
+
+    BOOST_CHECK_THROW(bg::mapped_shapefile("test_mapped_missing.shp"),
+                      bg::read_shapefile_exception);
+}
+
+int test_main(int, char*[])
+{
+    test_polygons();
+    test_lines_and_points();
+    test_invalid();
+
+    return 0;
+}
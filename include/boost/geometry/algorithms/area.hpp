@@ -19,10 +19,14 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_AREA_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_AREA_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include <boost/concept_check.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/functions.hpp>
 #include <boost/range/metafunctions.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/static_visitor.hpp>
@@ -38,10 +42,12 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/algorithms/detail/block_sum.hpp>
 #include <boost/geometry/algorithms/detail/calculate_null.hpp>
 #include <boost/geometry/algorithms/detail/calculate_sum.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/numbered_ranges.hpp>
 
 #include <boost/geometry/strategies/area.hpp>
 #include <boost/geometry/strategies/area_result.hpp>
@@ -50,6 +56,7 @@
 
 #include <boost/geometry/strategies/concepts/area_concept.hpp>
 
+#include <boost/geometry/util/execution.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/order_as_direction.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
@@ -59,6 +66,11 @@
 namespace boost { namespace geometry
 {
 
+namespace strategy { namespace area
+{
+template <typename CalculationType> class cartesian;
+}} // namespace strategy::area
+
 
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace area
@@ -76,6 +88,13 @@ struct box_area
         return (get<max_corner, 0>(box) - get<min_corner, 0>(box))
              * (get<max_corner, 1>(box) - get<min_corner, 1>(box));
     }
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline typename coordinate_type<Box>::type
+    apply(Box const& box, Strategy const& strategy, ExecutionPolicy const& )
+    {
+        return apply(box, strategy);
+    }
 };
 
 
@@ -130,6 +149,143 @@ struct ring_area
 };
 
 
+template <typename Strategy>
+struct is_cartesian
+    : boost::false_type
+{};
+
+template <typename CalculationType>
+struct is_cartesian<strategy::area::cartesian<CalculationType> >
+    : boost::true_type
+{};
+
+template <typename Ring>
+struct ring_collector
+{
+    inline void apply(Ring const& ring)
+    {
+        rings.push_back(&ring);
+    }
+
+    std::vector<Ring const*> rings;
+};
+
+template
+<
+    iterate_direction Direction,
+    closure_selector Closure,
+    typename Ring, typename Strategy, typename Result
+>
+struct ring_area_worker
+{
+    inline ring_area_worker(std::vector<Ring const*> const& rings,
+                            Strategy const& strategy,
+                            std::vector<Result>& areas)
+        : m_rings(rings)
+        , m_strategy(strategy)
+        , m_areas(areas)
+    {}
+
+    inline void operator()(std::size_t , std::size_t first,
+                           std::size_t last) const
+    {
+        for (std::size_t i = first; i < last; ++i)
+        {
+            m_areas[i] = ring_area<Direction, Closure>::apply(*m_rings[i],
+                                                              m_strategy);
+        }
+    }
+
+    std::vector<Ring const*> const& m_rings;
+    Strategy const& m_strategy;
+    std::vector<Result>& m_areas;
+};
+
+/*!
+    \brief Calculates the area of a ring, polygon or multi polygon
+        according to an execution policy
+    \details With the cartesian strategy the segments of all rings are
+        summed in blocks, otherwise the rings are processed in chunks. The
+        results are added pairwise, so the result does not depend on the
+        policy, but might differ slightly from the area calculated without
+        a policy.
+*/
+template
+<
+    iterate_direction Direction,
+    closure_selector Closure
+>
+struct areal_area
+{
+    template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return apply(geometry, strategy, policy, is_cartesian<Strategy>());
+    }
+
+private :
+
+    template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& ,
+          ExecutionPolicy const& policy, boost::true_type)
+    {
+        typedef typename area_result<Geometry, Strategy>::type result_type;
+        typedef geometry::detail::block_sum::segment_sum
+            <
+                result_type,
+                geometry::detail::block_sum::cartesian_area_term<result_type>
+            > kernel_type;
+
+        geometry::detail::numbered_segments
+            <
+                typename ring_type<Geometry>::type, Closure
+            > segments(core_detail::closure::minimum_ring_size<Closure>::value);
+        geometry::detail::for_each_segment_range<Geometry>::apply(geometry,
+                                                                  segments);
+
+        result_type const sum = geometry::detail::block_sum::apply(segments,
+            kernel_type(geometry::detail::block_sum::cartesian_area_term
+                <
+                    result_type
+                >()), policy);
+
+        result_type const two = 2;
+        return Direction == iterate_forward ? sum / two : -sum / two;
+    }
+
+    template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy, boost::false_type)
+    {
+        typedef typename area_result<Geometry, Strategy>::type result_type;
+        typedef typename ring_type<Geometry>::type ring_type;
+
+        ring_collector<ring_type> collector;
+        geometry::detail::for_each_segment_range<Geometry>::apply(geometry,
+                                                                  collector);
+        if (collector.rings.empty())
+        {
+            return result_type();
+        }
+
+        std::vector<result_type> areas(collector.rings.size());
+        geometry::detail::execution::for_each_chunk(areas.size(), policy,
+            ring_area_worker
+                <
+                    Direction, Closure, ring_type, Strategy, result_type
+                >(collector.rings, strategy, areas));
+        return geometry::detail::block_sum::merge_pairwise
+            <
+                geometry::detail::block_sum::add_results
+            >(areas);
+    }
+};
+
+
 }} // namespace detail::area
 
 
@@ -156,6 +312,14 @@ struct area : detail::calculate_null
                 typename area_result<Geometry, Strategy>::type
             >(geometry, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Geometry, Strategy>::type
+        apply(Geometry const& geometry, Strategy const& strategy,
+              ExecutionPolicy const& )
+    {
+        return apply(geometry, strategy);
+    }
 };
 
 
@@ -171,7 +335,27 @@ struct area<Ring, ring_tag>
             order_as_direction<geometry::point_order<Ring>::value>::value,
             geometry::closure<Ring>::value
         >
-{};
+{
+    typedef detail::area::ring_area
+        <
+            order_as_direction<geometry::point_order<Ring>::value>::value,
+            geometry::closure<Ring>::value
+        > base_type;
+
+    using base_type::apply;
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Ring, Strategy>::type
+        apply(Ring const& ring, Strategy const& strategy,
+              ExecutionPolicy const& policy)
+    {
+        return detail::area::areal_area
+            <
+                order_as_direction<geometry::point_order<Ring>::value>::value,
+                geometry::closure<Ring>::value
+            >::apply(ring, strategy, policy);
+    }
+};
 
 
 template <typename Polygon>
@@ -190,6 +374,18 @@ struct area<Polygon, polygon_tag> : detail::calculate_polygon_sum
                 >
             >(polygon, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Polygon, Strategy>::type
+        apply(Polygon const& polygon, Strategy const& strategy,
+              ExecutionPolicy const& policy)
+    {
+        return detail::area::areal_area
+            <
+                order_as_direction<geometry::point_order<Polygon>::value>::value,
+                geometry::closure<Polygon>::value
+            >::apply(polygon, strategy, policy);
+    }
 };
 
 
@@ -206,6 +402,18 @@ struct area<MultiGeometry, multi_polygon_tag> : detail::multi_sum
                    area<typename boost::range_value<MultiGeometry>::type>
                >(multi, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<MultiGeometry, Strategy>::type
+    apply(MultiGeometry const& multi, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return detail::area::areal_area
+            <
+                order_as_direction<geometry::point_order<MultiGeometry>::value>::value,
+                geometry::closure<MultiGeometry>::value
+            >::apply(multi, strategy, policy);
+    }
 };
 
 
@@ -225,6 +433,14 @@ struct area
     {
         return dispatch::area<Geometry>::apply(geometry, strategy);
     }
+
+    template <typename Geometry, typename ExecutionPolicy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return dispatch::area<Geometry>::apply(geometry, strategy, policy);
+    }
 };
 
 template <>
@@ -241,6 +457,20 @@ struct area<default_strategy>
 
         return dispatch::area<Geometry>::apply(geometry, strategy_type());
     }
+
+    template <typename Geometry, typename ExecutionPolicy>
+    static inline typename area_result<Geometry>::type
+    apply(Geometry const& geometry, default_strategy,
+          ExecutionPolicy const& policy)
+    {
+        typedef typename strategy::area::services::default_strategy
+            <
+                typename cs_tag<Geometry>::type
+            >::type strategy_type;
+
+        return dispatch::area<Geometry>::apply(geometry, strategy_type(),
+                                               policy);
+    }
 };
 
 
@@ -259,6 +489,15 @@ struct area
     {
         return resolve_strategy::area<Strategy>::apply(geometry, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<Geometry, Strategy>::type
+        apply(Geometry const& geometry, Strategy const& strategy,
+              ExecutionPolicy const& policy)
+    {
+        return resolve_strategy::area<Strategy>::apply(geometry, strategy,
+                                                       policy);
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
@@ -289,6 +528,38 @@ struct area<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
     {
         return boost::apply_visitor(visitor<Strategy>(strategy), geometry);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor
+        : boost::static_visitor<typename area_result<variant_type, Strategy>::type>
+    {
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(Strategy const& strategy, ExecutionPolicy const& policy)
+            : m_strategy(strategy)
+            , m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        typename area_result<variant_type, Strategy>::type
+        operator()(Geometry const& geometry) const
+        {
+            return area<Geometry>::apply(geometry, m_strategy, m_policy);
+        }
+    };
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename area_result<variant_type, Strategy>::type
+    apply(variant_type const& geometry,
+          Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return boost::apply_visitor(policy_visitor
+            <
+                Strategy, ExecutionPolicy
+            >(strategy, policy), geometry);
+    }
 };
 
 } // namespace resolve_variant
@@ -362,6 +633,33 @@ area(Geometry const& geometry, Strategy const& strategy)
     return resolve_variant::area<Geometry>::apply(geometry, strategy);
 }
 
+/*!
+\brief \brief_calc{area} \brief_strategy, according to an execution policy
+\ingroup area
+\details \details_calc{area} \brief_strategy. The rings (cartesian: the
+    segments) of the geometry are processed in chunks according to the
+    execution policy, sequenced or parallel. Partial sums are added
+    pairwise in a fixed order, so the result does not depend on the policy.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{Area}
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry \param_geometry
+\param strategy \param_strategy{area}
+\param policy Execution policy
+\return \return_calc{area}
+
+\qbk{distinguish,with strategy and execution policy}
+ */
+template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+inline typename area_result<Geometry, Strategy>::type
+area(Geometry const& geometry, Strategy const& strategy,
+     ExecutionPolicy const& policy)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_variant::area<Geometry>::apply(geometry, strategy, policy);
+}
+
 
 }} // namespace boost::geometry
 
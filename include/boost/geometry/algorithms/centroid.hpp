@@ -23,10 +23,12 @@
 
 
 #include <cstddef>
+#include <iterator>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range.hpp>
 #include <boost/throw_exception.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/static_visitor.hpp>
@@ -46,14 +48,18 @@
 
 #include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/block_sum.hpp>
 #include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/numbered_ranges.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
 #include <boost/geometry/strategies/centroid.hpp>
 #include <boost/geometry/strategies/concepts/centroid_concept.hpp>
 #include <boost/geometry/strategies/default_strategy.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
+#include <boost/geometry/views/detail/range_type.hpp>
 
+#include <boost/geometry/util/execution.hpp>
 #include <boost/geometry/util/for_each_coordinate.hpp>
 #include <boost/geometry/util/select_coordinate_type.hpp>
 
@@ -114,6 +120,14 @@ struct centroid_point
     {
         geometry::convert(point, centroid);
     }
+
+    template<typename Point, typename PointCentroid, typename Strategy,
+             typename ExecutionPolicy>
+    static inline void apply(Point const& point, PointCentroid& centroid,
+            Strategy const&, ExecutionPolicy const&)
+    {
+        geometry::convert(point, centroid);
+    }
 };
 
 template
@@ -167,6 +181,14 @@ struct centroid_indexed
                 Indexed, Point
             >::apply(indexed, centroid);
     }
+
+    template<typename Indexed, typename Point, typename Strategy,
+             typename ExecutionPolicy>
+    static inline void apply(Indexed const& indexed, Point& centroid,
+            Strategy const& strategy, ExecutionPolicy const&)
+    {
+        apply(indexed, centroid, strategy);
+    }
 };
 
 
@@ -198,12 +220,176 @@ inline bool range_ok(Range const& range, Point& centroid)
     //return true; // unreachable
 }
 
+/*!
+    \brief Kernel filling the state of a mergeable strategy with the
+        segments of a block
+*/
+template <typename PointTransformer, typename Strategy>
+class segments_state_kernel
+{
+public :
+    typedef typename Strategy::state_type result_type;
+
+    inline segments_state_kernel(PointTransformer const& transformer,
+                                 Strategy const& strategy)
+        : m_transformer(transformer)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Iterator>
+    inline void apply(Iterator first, Iterator last)
+    {
+        typedef typename std::iterator_traits<Iterator>::value_type point_type;
+
+        typename PointTransformer::result_type
+            previous_pt = m_transformer.apply(*first);
+
+        for (++first; first != last; ++first)
+        {
+            typename PointTransformer::result_type
+                pt = m_transformer.apply(*first);
+
+            m_strategy.apply(static_cast<point_type const&>(previous_pt),
+                             static_cast<point_type const&>(pt),
+                             m_state);
+
+            previous_pt = pt;
+        }
+    }
+
+    template <typename Point>
+    inline void apply_segment(Point const& p1, Point const& p2)
+    {
+        typename PointTransformer::result_type pt1 = m_transformer.apply(p1);
+        typename PointTransformer::result_type pt2 = m_transformer.apply(p2);
+        m_strategy.apply(static_cast<Point const&>(pt1),
+                         static_cast<Point const&>(pt2),
+                         m_state);
+    }
+
+    inline result_type result() const
+    {
+        return m_state;
+    }
+
+    static inline void merge(result_type& state, result_type const& other)
+    {
+        Strategy::merge(state, other);
+    }
+
+private :
+    PointTransformer const& m_transformer;
+    Strategy const& m_strategy;
+    result_type m_state;
+};
+
+/*!
+    \brief Kernel filling the state of a mergeable strategy with the
+        points of a block
+*/
+template <typename PointTransformer, typename Strategy>
+class points_state_kernel
+{
+public :
+    typedef typename Strategy::state_type result_type;
+
+    inline points_state_kernel(PointTransformer const& transformer,
+                               Strategy const& strategy)
+        : m_transformer(transformer)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Iterator>
+    inline void apply(Iterator first, Iterator last)
+    {
+        typedef typename std::iterator_traits<Iterator>::value_type point_type;
+
+        for (; first != last; ++first)
+        {
+            m_strategy.apply(static_cast<point_type const&>(
+                                 m_transformer.apply(*first)),
+                             m_state);
+        }
+    }
+
+    inline result_type result() const
+    {
+        return m_state;
+    }
+
+    static inline void merge(result_type& state, result_type const& other)
+    {
+        Strategy::merge(state, other);
+    }
+
+private :
+    PointTransformer const& m_transformer;
+    Strategy const& m_strategy;
+    result_type m_state;
+};
+
+/*!
+    \brief Calculates the state of all segments of a linear or areal
+        geometry, in blocks processed according to an execution policy
+*/
+struct segments_state_in_blocks
+{
+    template
+    <
+        typename Geometry, typename PointTransformer,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline typename Strategy::state_type
+    apply(Geometry const& geometry, PointTransformer const& transformer,
+          Strategy const& strategy, ExecutionPolicy const& policy)
+    {
+        geometry::detail::numbered_segments
+            <
+                typename geometry::detail::range_type<Geometry>::type,
+                geometry::closure<Geometry>::value
+            > segments;
+        geometry::detail::for_each_segment_range<Geometry>::apply(geometry,
+                                                                  segments);
+        return geometry::detail::block_sum::apply(segments,
+            segments_state_kernel<PointTransformer, Strategy>(transformer,
+                                                              strategy),
+            policy);
+    }
+};
+
+/*!
+    \brief Calculates the state of all points of a multi-point, in blocks
+        processed according to an execution policy
+*/
+struct points_state_in_blocks
+{
+    template
+    <
+        typename MultiPoint, typename PointTransformer,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline typename Strategy::state_type
+    apply(MultiPoint const& multi_point, PointTransformer const& transformer,
+          Strategy const& strategy, ExecutionPolicy const& policy)
+    {
+        geometry::detail::numbered_points<MultiPoint> points;
+        points.apply(multi_point);
+        return geometry::detail::block_sum::apply(points,
+            points_state_kernel<PointTransformer, Strategy>(transformer,
+                                                            strategy),
+            policy);
+    }
+};
+
+
 /*!
     \brief Calculate the centroid of a Ring or a Linestring.
 */
 template <closure_selector Closure>
 struct centroid_range_state
 {
+    typedef segments_state_in_blocks in_blocks;
+
     template<typename Ring, typename PointTransformer, typename Strategy>
     static inline void apply(Ring const& ring,
                              PointTransformer const& transformer,
@@ -267,6 +453,60 @@ struct centroid_range
 
         return false;
     }
+
+    template
+    <
+        typename Range, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Range const& range, Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        return apply(range, centroid, strategy, policy,
+            geometry::strategy::centroid::services::is_mergeable<Strategy>());
+    }
+
+private :
+
+    template
+    <
+        typename Range, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Range const& range, Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy, boost::true_type)
+    {
+        if (range_ok(range, centroid))
+        {
+            translating_transformer<Range> transformer(*boost::begin(range));
+
+            typename Strategy::state_type const state
+                = segments_state_in_blocks::apply(range, transformer,
+                                                  strategy, policy);
+
+            if ( strategy.result(state, centroid) )
+            {
+                transformer.apply_reverse(centroid);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template
+    <
+        typename Range, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Range const& range, Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& , boost::false_type)
+    {
+        return apply(range, centroid, strategy);
+    }
 };
 
 
@@ -277,6 +517,8 @@ struct centroid_range
 */
 struct centroid_polygon_state
 {
+    typedef segments_state_in_blocks in_blocks;
+
     template<typename Polygon, typename PointTransformer, typename Strategy>
     static inline void apply(Polygon const& poly,
                              PointTransformer const& transformer,
@@ -324,6 +566,61 @@ struct centroid_polygon
 
         return false;
     }
+
+    template
+    <
+        typename Polygon, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Polygon const& poly, Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        return apply(poly, centroid, strategy, policy,
+            geometry::strategy::centroid::services::is_mergeable<Strategy>());
+    }
+
+private :
+
+    template
+    <
+        typename Polygon, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Polygon const& poly, Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy, boost::true_type)
+    {
+        if (range_ok(exterior_ring(poly), centroid))
+        {
+            translating_transformer<Polygon>
+                transformer(*boost::begin(exterior_ring(poly)));
+
+            typename Strategy::state_type const state
+                = segments_state_in_blocks::apply(poly, transformer,
+                                                  strategy, policy);
+
+            if ( strategy.result(state, centroid) )
+            {
+                transformer.apply_reverse(centroid);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template
+    <
+        typename Polygon, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Polygon const& poly, Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& , boost::false_type)
+    {
+        return apply(poly, centroid, strategy);
+    }
 };
 
 
@@ -333,6 +630,8 @@ struct centroid_polygon
 */
 struct centroid_multi_point_state
 {
+    typedef points_state_in_blocks in_blocks;
+
     template <typename Point, typename PointTransformer, typename Strategy>
     static inline void apply(Point const& point,
                              PointTransformer const& transformer,
@@ -393,6 +692,66 @@ struct centroid_multi
         
         return false;
     }
+
+    template
+    <
+        typename Multi, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Multi const& multi,
+                             Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        return apply(multi, centroid, strategy, policy,
+            geometry::strategy::centroid::services::is_mergeable<Strategy>());
+    }
+
+private :
+
+    template
+    <
+        typename Multi, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Multi const& multi,
+                             Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy, boost::true_type)
+    {
+#if ! defined(BOOST_GEOMETRY_CENTROID_NO_THROW)
+        if (geometry::is_empty(multi))
+        {
+            BOOST_THROW_EXCEPTION(centroid_exception());
+        }
+#endif
+
+        translating_transformer<Multi> transformer(multi);
+
+        typename Strategy::state_type const state
+            = Policy::in_blocks::apply(multi, transformer, strategy, policy);
+
+        if ( strategy.result(state, centroid) )
+        {
+            transformer.apply_reverse(centroid);
+            return true;
+        }
+
+        return false;
+    }
+
+    template
+    <
+        typename Multi, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline bool apply(Multi const& multi,
+                             Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& , boost::false_type)
+    {
+        return apply(multi, centroid, strategy);
+    }
 };
 
 
@@ -409,6 +768,22 @@ struct centroid_linear_areal
             geometry::point_on_border(centroid, geom);
         }
     }
+
+    template
+    <
+        typename Geometry, typename Point, typename Strategy,
+        typename ExecutionPolicy
+    >
+    static inline void apply(Geometry const& geom,
+                             Point& centroid,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        if ( ! Algorithm::apply(geom, centroid, strategy, policy) )
+        {
+            geometry::point_on_border(centroid, geom);
+        }
+    }
 };
 
 
@@ -533,6 +908,38 @@ struct centroid
 
         dispatch::centroid<Geometry>::apply(geometry, out, strategy_type());
     }
+
+    template <typename Point, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, Point& out,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        dispatch::centroid<Geometry>::apply(geometry, out, strategy, policy);
+    }
+
+    template <typename Point, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, Point& out,
+                             default_strategy,
+                             ExecutionPolicy const& policy)
+    {
+        typedef typename strategy::centroid::services::default_strategy
+        <
+            typename cs_tag<Geometry>::type,
+            typename tag_cast
+                <
+                    typename tag<Geometry>::type,
+                    pointlike_tag,
+                    linear_tag,
+                    areal_tag
+                >::type,
+            dimension<Geometry>::type::value,
+            Point,
+            Geometry
+        >::type strategy_type;
+
+        dispatch::centroid<Geometry>::apply(geometry, out, strategy_type(),
+                                            policy);
+    }
 };
 
 } // namespace resolve_strategy
@@ -549,6 +956,16 @@ struct centroid
         concepts::check_concepts_and_equal_dimensions<Point, Geometry const>();
         resolve_strategy::centroid<Geometry>::apply(geometry, out, strategy);
     }
+
+    template <typename Point, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, Point& out,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        concepts::check_concepts_and_equal_dimensions<Point, Geometry const>();
+        resolve_strategy::centroid<Geometry>::apply(geometry, out, strategy,
+                                                    policy);
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
@@ -579,6 +996,38 @@ struct centroid<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
     {
         boost::apply_visitor(visitor<Point, Strategy>(out, strategy), geometry);
     }
+
+    template <typename Point, typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor: boost::static_visitor<void>
+    {
+        Point& m_out;
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(Point& out, Strategy const& strategy,
+                       ExecutionPolicy const& policy)
+        : m_out(out), m_strategy(strategy), m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        void operator()(Geometry const& geometry) const
+        {
+            centroid<Geometry>::apply(geometry, m_out, m_strategy, m_policy);
+        }
+    };
+
+    template <typename Point, typename Strategy, typename ExecutionPolicy>
+    static inline void
+    apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+          Point& out,
+          Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        boost::apply_visitor(policy_visitor
+            <
+                Point, Strategy, ExecutionPolicy
+            >(out, strategy, policy), geometry);
+    }
 };
 
 } // namespace resolve_variant
@@ -609,6 +1058,36 @@ inline void centroid(Geometry const& geometry, Point& c,
 }
 
 
+/*!
+\brief \brief_calc{centroid} \brief_strategy, according to an execution
+    policy
+\ingroup centroid
+\details \details_calc{centroid,geometric center (or: center of mass)}.
+    If the states of the strategy can be merged (as for the cartesian
+    strategies), the segments or points are processed in blocks, in chunks
+    according to the execution policy, sequenced or parallel. The states of
+    the blocks are merged pairwise, so the result does not depend on the
+    policy. Otherwise the centroid is calculated sequentially.
+\tparam Geometry \tparam_geometry
+\tparam Point \tparam_point
+\tparam Strategy \tparam_strategy{Centroid}
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry \param_geometry
+\param c \param_point \param_set{centroid}
+\param strategy \param_strategy{centroid}
+\param policy Execution policy
+
+\qbk{distinguish,with strategy and execution policy}
+\qbk{[include reference/algorithms/centroid.qbk]}
+*/
+template<typename Geometry, typename Point, typename Strategy, typename ExecutionPolicy>
+inline void centroid(Geometry const& geometry, Point& c,
+        Strategy const& strategy, ExecutionPolicy const& policy)
+{
+    resolve_variant::centroid<Geometry>::apply(geometry, c, strategy, policy);
+}
+
+
 /*!
 \brief \brief_calc{centroid}
 \ingroup centroid
@@ -70,6 +70,22 @@ struct hull_insert
         strategy.result(state, out, Order == clockwise, Closure != open);
         return out;
     }
+
+    template
+    <
+        typename Geometry, typename OutputIterator,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline OutputIterator apply(Geometry const& geometry,
+            OutputIterator out, Strategy const& strategy,
+            ExecutionPolicy const& policy)
+    {
+        typename Strategy::state_type state;
+
+        strategy.apply(geometry, state, policy);
+        strategy.result(state, out, Order == clockwise, Closure != open);
+        return out;
+    }
 };
 
 struct hull_to_geometry
@@ -90,6 +106,26 @@ struct hull_to_geometry
                             typename range_type<OutputGeometry>::type
                         >(out)), strategy);
     }
+
+    template
+    <
+        typename Geometry, typename OutputGeometry,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline void apply(Geometry const& geometry, OutputGeometry& out,
+            Strategy const& strategy, ExecutionPolicy const& policy)
+    {
+        hull_insert
+            <
+                geometry::point_order<OutputGeometry>::value,
+                geometry::closure<OutputGeometry>::value
+            >::apply(geometry,
+                range::back_inserter(
+                    detail::as_range
+                        <
+                            typename range_type<OutputGeometry>::type
+                        >(out)), strategy, policy);
+    }
 };
 
 }} // namespace detail::convex_hull
@@ -131,6 +167,13 @@ struct convex_hull<Box, box_tag>
             geometry::append(out, *boost::begin(range));
         }
     }
+
+    template <typename OutputGeometry, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Box const& box, OutputGeometry& out,
+            Strategy const& strategy, ExecutionPolicy const& )
+    {
+        apply(box, out, strategy);
+    }
 };
 
 
@@ -170,6 +213,34 @@ struct convex_hull
 
         apply(geometry, out, strategy_type());
     }
+
+    template
+    <
+        typename Geometry, typename OutputGeometry,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline void apply(Geometry const& geometry,
+                             OutputGeometry& out,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        BOOST_CONCEPT_ASSERT( (geometry::concepts::ConvexHullStrategy<Strategy>) );
+        dispatch::convex_hull<Geometry>::apply(geometry, out, strategy, policy);
+    }
+
+    template <typename Geometry, typename OutputGeometry, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry,
+                             OutputGeometry& out,
+                             default_strategy,
+                             ExecutionPolicy const& policy)
+    {
+        typedef typename strategy_convex_hull<
+            Geometry,
+            typename point_type<Geometry>::type
+        >::type strategy_type;
+
+        apply(geometry, out, strategy_type(), policy);
+    }
 };
 
 struct convex_hull_insert
@@ -219,6 +290,19 @@ struct convex_hull
 
         resolve_strategy::convex_hull::apply(geometry, out, strategy);
     }
+
+    template <typename OutputGeometry, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, OutputGeometry& out,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        concepts::check_concepts_and_equal_dimensions<
+            const Geometry,
+            OutputGeometry
+        >();
+
+        resolve_strategy::convex_hull::apply(geometry, out, strategy, policy);
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
@@ -249,6 +333,38 @@ struct convex_hull<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
     {
         boost::apply_visitor(visitor<OutputGeometry, Strategy>(out, strategy), geometry);
     }
+
+    template <typename OutputGeometry, typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor: boost::static_visitor<void>
+    {
+        OutputGeometry& m_out;
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(OutputGeometry& out, Strategy const& strategy,
+                       ExecutionPolicy const& policy)
+        : m_out(out), m_strategy(strategy), m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        void operator()(Geometry const& geometry) const
+        {
+            convex_hull<Geometry>::apply(geometry, m_out, m_strategy, m_policy);
+        }
+    };
+
+    template <typename OutputGeometry, typename Strategy, typename ExecutionPolicy>
+    static inline void
+    apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+          OutputGeometry& out,
+          Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        boost::apply_visitor(policy_visitor
+            <
+                OutputGeometry, Strategy, ExecutionPolicy
+            >(out, strategy, policy), geometry);
+    }
 };
 
 template <typename Geometry>
@@ -312,6 +428,41 @@ inline void convex_hull(Geometry const& geometry,
 }
 
 
+/*!
+\brief \brief_calc{convex hull} \brief_strategy, according to an execution policy
+\ingroup convex_hull
+\details \details_calc{convex_hull,convex hull}. The points of the geometry
+    are processed in chunks according to the execution policy, sequenced or
+    parallel. The result does not depend on the policy.
+\tparam Geometry the input geometry type
+\tparam OutputGeometry the output geometry type
+\tparam Strategy \tparam_strategy{ConvexHull}
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry \param_geometry,  input geometry
+\param out \param_geometry \param_set{convex hull}
+\param strategy \param_strategy{convex_hull}
+\param policy Execution policy
+
+\qbk{distinguish,with strategy and execution policy}
+ */
+template
+<
+    typename Geometry, typename OutputGeometry,
+    typename Strategy, typename ExecutionPolicy
+>
+inline void convex_hull(Geometry const& geometry, OutputGeometry& out,
+                        Strategy const& strategy, ExecutionPolicy const& policy)
+{
+    if (geometry::is_empty(geometry))
+    {
+        // Leave output empty
+        return;
+    }
+
+    resolve_variant::convex_hull<Geometry>::apply(geometry, out, strategy, policy);
+}
+
+
 /*!
 \brief \brief_calc{convex hull}
 \ingroup convex_hull
@@ -0,0 +1,217 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BLOCK_SUM_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BLOCK_SUM_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/execution.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace block_sum
+{
+
+
+// The number of points or segments of a block. The blocks do not depend on
+// the execution policy, so neither does the result
+static const std::size_t block_size = 1024;
+
+
+// Calculates the result of each block of which the first element is in
+// the chunk
+template <typename Numbered, typename Kernel>
+struct block_worker
+{
+    typedef typename Kernel::result_type result_type;
+
+    inline block_worker(Numbered const& numbered, Kernel const& kernel,
+                        std::vector<result_type>& results)
+        : m_numbered(numbered)
+        , m_kernel(kernel)
+        , m_results(results)
+    {}
+
+    inline void operator()(std::size_t , std::size_t first,
+                           std::size_t last) const
+    {
+        std::size_t const count = m_numbered.count();
+        for (std::size_t b = (first + block_size - 1) / block_size;
+             b * block_size < last; ++b)
+        {
+            Kernel kernel(m_kernel);
+            m_numbered.for_each_run(b * block_size,
+                (std::min)((b + 1) * block_size, count), kernel);
+            m_results[b] = kernel.result();
+        }
+    }
+
+    Numbered const& m_numbered;
+    Kernel const& m_kernel;
+    std::vector<result_type>& m_results;
+};
+
+
+// Merges results by adding them
+struct add_results
+{
+    template <typename Result>
+    static inline void merge(Result& total, Result const& other)
+    {
+        total += other;
+    }
+};
+
+
+// Merges the results pairwise, in a fixed order. The rounding error of a
+// sum then grows with the logarithm of the number of blocks
+template <typename Kernel, typename Result>
+inline Result merge_pairwise(std::vector<Result>& results)
+{
+    for (std::size_t step = 1; step < results.size(); step *= 2)
+    {
+        for (std::size_t i = 0; i + step < results.size(); i += 2 * step)
+        {
+            Kernel::merge(results[i], results[i + step]);
+        }
+    }
+    return results.front();
+}
+
+
+/*!
+    \brief Calculates the result of a kernel over numbered points or
+        segments, in blocks, processed according to an execution policy
+    \details A copy of the (empty) kernel visits the runs of each block,
+        and the results of the blocks are merged pairwise.
+*/
+template <typename Numbered, typename Kernel, typename ExecutionPolicy>
+inline typename Kernel::result_type apply(Numbered const& numbered,
+                                          Kernel const& kernel,
+                                          ExecutionPolicy const& policy)
+{
+    std::size_t const count = numbered.count();
+    if (count == 0)
+    {
+        return kernel.result();
+    }
+
+    std::vector<typename Kernel::result_type>
+        results((count + block_size - 1) / block_size);
+    geometry::detail::execution::for_each_chunk(count, policy,
+        block_worker<Numbered, Kernel>(numbered, kernel, results));
+    return merge_pairwise<Kernel>(results);
+}
+
+
+/*!
+    \brief Kernel summing a term over segments
+    \details Four independent sums are used, such that an addition does not
+        wait for the previous one, and the loop can be vectorized.
+*/
+template <typename Result, typename Term>
+class segment_sum : public add_results
+{
+public :
+    typedef Result result_type;
+
+    explicit inline segment_sum(Term const& term)
+        : m_term(term)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            m_sums[i] = Result();
+        }
+    }
+
+    template <typename Iterator>
+    inline void apply(Iterator first, Iterator last)
+    {
+        std::size_t const n = std::size_t(last - first) - 1;
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            m_sums[0] += m_term.apply(first[i], first[i + 1]);
+            m_sums[1] += m_term.apply(first[i + 1], first[i + 2]);
+            m_sums[2] += m_term.apply(first[i + 2], first[i + 3]);
+            m_sums[3] += m_term.apply(first[i + 3], first[i + 4]);
+        }
+        for (; i < n; ++i)
+        {
+            m_sums[0] += m_term.apply(first[i], first[i + 1]);
+        }
+    }
+
+    template <typename Point>
+    inline void apply_segment(Point const& p1, Point const& p2)
+    {
+        m_sums[0] += m_term.apply(p1, p2);
+    }
+
+    inline Result result() const
+    {
+        return (m_sums[0] + m_sums[1]) + (m_sums[2] + m_sums[3]);
+    }
+
+private :
+    Term m_term;
+    Result m_sums[4];
+};
+
+
+// Term of the length of a segment
+template <typename Strategy>
+struct distance_term
+{
+    explicit inline distance_term(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Point>
+    inline typename strategy::distance::services::return_type
+        <
+            Strategy, Point, Point
+        >::type apply(Point const& p1, Point const& p2) const
+    {
+        return m_strategy.apply(p1, p2);
+    }
+
+    Strategy m_strategy;
+};
+
+
+// Term of the trapezoid of a segment, the same as in the cartesian area
+// strategy: its sum is twice the area of a clockwise ring
+template <typename Result>
+struct cartesian_area_term
+{
+    template <typename Point>
+    inline Result apply(Point const& p1, Point const& p2) const
+    {
+        return (Result(geometry::get<0>(p1)) + Result(geometry::get<0>(p2)))
+             * (Result(geometry::get<1>(p1)) - Result(geometry::get<1>(p2)));
+    }
+};
+
+
+}} // namespace detail::block_sum
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BLOCK_SUM_HPP
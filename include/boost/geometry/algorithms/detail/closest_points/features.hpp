@@ -0,0 +1,264 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_FEATURES_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_FEATURES_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/core/addressof.hpp>
+#include <boost/type_traits/remove_const.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/closest_points/point_to_segment.hpp>
+#include <boost/geometry/algorithms/detail/distance/iterator_selector.hpp>
+#include <boost/geometry/algorithms/detail/overlay/segment_as_subrange.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/policies/relate/intersection_points.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/intersection_result.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace closest_points
+{
+
+
+/*!
+    \brief The features of a geometry between which the closest points are
+        searched: its points for pointlike geometries, its segments
+        otherwise
+    \details A point or segment is its own single feature.
+*/
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct features
+{
+    typedef geometry::detail::distance::iterator_selector
+        <
+            Geometry const
+        > selector_type;
+
+    typedef typename selector_type::iterator_type iterator_type;
+
+    static inline iterator_type begin(Geometry const& geometry)
+    {
+        return selector_type::begin(geometry);
+    }
+
+    static inline iterator_type end(Geometry const& geometry)
+    {
+        return selector_type::end(geometry);
+    }
+};
+
+template <typename Geometry>
+struct single_feature
+{
+    typedef Geometry const* iterator_type;
+
+    static inline iterator_type begin(Geometry const& geometry)
+    {
+        return boost::addressof(geometry);
+    }
+
+    static inline iterator_type end(Geometry const& geometry)
+    {
+        return boost::addressof(geometry) + 1;
+    }
+};
+
+template <typename Point>
+struct features<Point, point_tag>
+    : single_feature<Point>
+{};
+
+template <typename Segment>
+struct features<Segment, segment_tag>
+    : single_feature<Segment>
+{};
+
+
+// Calculates the closest points of two features, the first point of the
+// output segment is on the first feature
+template
+<
+    typename Feature1, typename Feature2,
+    typename Tag1 = typename tag<Feature1>::type,
+    typename Tag2 = typename tag<Feature2>::type
+>
+struct feature_to_feature
+{};
+
+template <typename Point1, typename Point2>
+struct feature_to_feature<Point1, Point2, point_tag, point_tag>
+{
+    template <typename Strategy, typename Segment>
+    static inline void apply(Point1 const& point1, Point2 const& point2,
+                             Strategy const& , Segment& shortest)
+    {
+        geometry::detail::assign_point_to_index<0>(point1, shortest);
+        geometry::detail::assign_point_to_index<1>(point2, shortest);
+    }
+};
+
+template <typename Point, typename Segment1>
+struct feature_to_feature<Point, Segment1, point_tag, segment_tag>
+{
+    template <typename Strategy, typename Segment>
+    static inline void apply(Point const& point, Segment1 const& segment,
+                             Strategy const& strategy, Segment& shortest)
+    {
+        typedef typename boost::remove_const
+            <
+                typename point_type<Segment1>::type
+            >::type segment_point_type;
+
+        segment_point_type p1, p2;
+        geometry::detail::assign_point_from_index<0>(segment, p1);
+        geometry::detail::assign_point_from_index<1>(segment, p2);
+
+        typename point_type<Segment>::type closest;
+        point_to_segment
+            <
+                typename cs_tag<Point>::type
+            >::apply(point, p1, p2, strategy, closest);
+
+        geometry::detail::assign_point_to_index<0>(point, shortest);
+        geometry::detail::assign_point_to_index<1>(closest, shortest);
+    }
+};
+
+template <typename Segment1, typename Point>
+struct feature_to_feature<Segment1, Point, segment_tag, point_tag>
+{
+    template <typename Strategy, typename Segment>
+    static inline void apply(Segment1 const& segment, Point const& point,
+                             Strategy const& strategy, Segment& shortest)
+    {
+        Segment reversed;
+        feature_to_feature
+            <
+                Point, Segment1
+            >::apply(point, segment, strategy, reversed);
+
+        typename point_type<Segment>::type p;
+        geometry::detail::assign_point_from_index<1>(reversed, p);
+        geometry::detail::assign_point_to_index<0>(p, shortest);
+        geometry::detail::assign_point_from_index<0>(reversed, p);
+        geometry::detail::assign_point_to_index<1>(p, shortest);
+    }
+};
+
+template <typename Segment1, typename Segment2>
+struct feature_to_feature<Segment1, Segment2, segment_tag, segment_tag>
+{
+    // Intersecting segments have an intersection point as closest points,
+    // otherwise an endpoint of one segment and its closest point on the
+    // other segment are the closest points, as in the segment_to_segment
+    // distance
+    template <typename Strategy, typename Segment>
+    static inline void apply(Segment1 const& segment1,
+                             Segment2 const& segment2,
+                             Strategy const& strategy, Segment& shortest)
+    {
+        typedef segment_intersection_points
+            <
+                typename point_type<Segment>::type
+            > intersection_return_type;
+        typedef policies::relate::segments_intersection_points
+            <
+                intersection_return_type
+            > policy_type;
+
+        geometry::detail::segment_as_subrange<Segment1> sub_range1(segment1);
+        geometry::detail::segment_as_subrange<Segment2> sub_range2(segment2);
+
+        intersection_return_type const is
+            = strategy.get_relate_segment_segment_strategy()
+                .apply(sub_range1, sub_range2, policy_type());
+        if (is.count > 0)
+        {
+            geometry::detail::assign_point_to_index<0>(is.intersections[0], shortest);
+            geometry::detail::assign_point_to_index<1>(is.intersections[0], shortest);
+            return;
+        }
+
+        typedef typename boost::remove_const
+            <
+                typename point_type<Segment1>::type
+            >::type point_type1;
+        typedef typename boost::remove_const
+            <
+                typename point_type<Segment2>::type
+            >::type point_type2;
+
+        point_type1 p[2];
+        geometry::detail::assign_point_from_index<0>(segment1, p[0]);
+        geometry::detail::assign_point_from_index<1>(segment1, p[1]);
+
+        point_type2 q[2];
+        geometry::detail::assign_point_from_index<0>(segment2, q[0]);
+        geometry::detail::assign_point_from_index<1>(segment2, q[1]);
+
+        typename geometry::strategy::distance::services::comparable_type
+            <
+                Strategy
+            >::type const cstrategy
+                = geometry::strategy::distance::services::get_comparable
+                    <
+                        Strategy
+                    >::apply(strategy);
+
+        typename geometry::strategy::distance::services::return_type
+            <
+                typename geometry::strategy::distance::services::comparable_type
+                    <
+                        Strategy
+                    >::type,
+                point_type1, point_type2
+            >::type d[4];
+        d[0] = cstrategy.apply(q[0], p[0], p[1]);
+        d[1] = cstrategy.apply(q[1], p[0], p[1]);
+        d[2] = cstrategy.apply(p[0], q[0], q[1]);
+        d[3] = cstrategy.apply(p[1], q[0], q[1]);
+
+        std::size_t const imin = std::min_element(d, d + 4) - d;
+        if (imin < 2)
+        {
+            feature_to_feature
+                <
+                    Segment1, point_type2
+                >::apply(segment1, q[imin], strategy, shortest);
+        }
+        else
+        {
+            feature_to_feature
+                <
+                    point_type1, Segment2
+                >::apply(p[imin - 2], segment2, strategy, shortest);
+        }
+    }
+};
+
+
+}} // namespace detail::closest_points
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_FEATURES_HPP
@@ -0,0 +1,367 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_IMPLEMENTATION_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_IMPLEMENTATION_HPP
+
+
+#include <iterator>
+#include <utility>
+
+#include <boost/range/empty.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/closest_feature/range_to_range.hpp>
+#include <boost/geometry/algorithms/detail/closest_points/features.hpp>
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/dispatch/closest_points.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace closest_points
+{
+
+
+// Boxes are handled as polygons
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct prepared
+{
+    typedef Geometry type;
+
+    static inline Geometry const& apply(Geometry const& geometry)
+    {
+        return geometry;
+    }
+};
+
+template <typename Box>
+struct prepared<Box, box_tag>
+{
+    typedef model::polygon<typename point_type<Box>::type> type;
+
+    static inline type apply(Box const& box)
+    {
+        type polygon;
+        geometry::convert(box, polygon);
+        return polygon;
+    }
+};
+
+
+template <typename Geometry>
+struct is_areal
+    : boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+            areal_tag
+        >
+{};
+
+
+// Finds a point of a geometry covered by an areal geometry, testing one
+// point of each linestring or (exterior) ring, or all points of pointlike
+// geometries. A linestring or ring having no point covered by the areal
+// geometry, while it is not disjoint from it, crosses its boundary, such
+// that a common point is found as the closest points of the segments.
+template <typename Areal, typename Strategy, typename Point>
+class covered_point_finder
+{
+public :
+    inline covered_point_finder(Areal const& areal, Strategy const& strategy,
+                                Point& point)
+        : m_areal(areal)
+        , m_strategy(strategy)
+        , m_point(point)
+        , m_found(false)
+    {}
+
+    template <typename Range>
+    inline void apply(Range const& range)
+    {
+        if (! boost::empty(range))
+        {
+            apply_point(range::front(range));
+        }
+    }
+
+    template <typename P>
+    inline void apply_point(P const& point)
+    {
+        if (! m_found
+            && geometry::detail::within::covered_by_point_geometry(point,
+                    m_areal, m_strategy.get_point_in_geometry_strategy()))
+        {
+            geometry::convert(point, m_point);
+            m_found = true;
+        }
+    }
+
+    inline bool found() const
+    {
+        return m_found;
+    }
+
+private :
+    Areal const& m_areal;
+    Strategy const& m_strategy;
+    Point& m_point;
+    bool m_found;
+};
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag_cast
+        <
+            typename tag<Geometry>::type, pointlike_tag
+        >::type
+>
+struct for_each_component_point
+{
+    template <typename Finder>
+    static inline void apply(Geometry const& geometry, Finder& finder)
+    {
+        geometry::detail::for_each_range(geometry, finder);
+    }
+};
+
+template <typename Pointlike>
+struct for_each_component_point<Pointlike, pointlike_tag>
+{
+    template <typename Finder>
+    static inline void apply(Pointlike const& pointlike, Finder& finder)
+    {
+        typedef features<Pointlike> features_type;
+        for (typename features_type::iterator_type
+                it = features_type::begin(pointlike);
+             it != features_type::end(pointlike) && ! finder.found(); ++it)
+        {
+            finder.apply_point(*it);
+        }
+    }
+};
+
+template <typename Segment>
+struct for_each_component_point<Segment, segment_tag>
+{
+    template <typename Finder>
+    static inline void apply(Segment const& segment, Finder& finder)
+    {
+        typename point_type<Segment>::type p;
+        geometry::detail::assign_point_from_index<0>(segment, p);
+        finder.apply_point(p);
+    }
+};
+
+template <typename Geometry, typename Areal, typename Strategy, typename Point>
+inline bool covered_point(Geometry const& geometry, Areal const& areal,
+                          Strategy const& strategy, Point& point,
+                          boost::true_type)
+{
+    covered_point_finder<Areal, Strategy, Point> finder(areal, strategy, point);
+    for_each_component_point<Geometry>::apply(geometry, finder);
+    return finder.found();
+}
+
+template <typename Geometry, typename Areal, typename Strategy, typename Point>
+inline bool covered_point(Geometry const& , Areal const& , Strategy const& ,
+                          Point& , boost::false_type)
+{
+    return false;
+}
+
+
+// Returns the feature of a range closest to a feature, by a linear search
+template <typename Feature, typename Iterator, typename Strategy>
+inline Iterator closest_of_range(Feature const& feature,
+                                 Iterator first, Iterator last,
+                                 Strategy const& strategy)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type value_type;
+    typedef dispatch::distance<Feature, value_type, Strategy> distance_type;
+    typedef typename geometry::strategy::distance::services::return_type
+        <
+            Strategy,
+            typename point_type<Feature>::type,
+            typename point_type<value_type>::type
+        >::type comparable_type;
+
+    comparable_type const zero = comparable_type(0);
+    comparable_type cd_min = distance_type::apply(feature, *first, strategy);
+    Iterator closest = first;
+
+    for (++first; first != last && ! math::equals(cd_min, zero); ++first)
+    {
+        comparable_type const cd = distance_type::apply(feature, *first, strategy);
+        if (cd < cd_min)
+        {
+            cd_min = cd;
+            closest = first;
+        }
+    }
+    return closest;
+}
+
+
+/*!
+    \brief Calculates the closest points of two geometries
+    \details If a point of one geometry is covered by the other (areal)
+        geometry, it is the closest point of both. Otherwise the closest
+        features (points or segments) are searched, using an rtree of the
+        features of the geometry having most of them, as the distance
+        algorithm does.
+*/
+template <typename Geometry1, typename Geometry2>
+struct geometry_to_geometry
+{
+    template <typename Segment, typename Strategy>
+    static inline void apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Segment& shortest,
+                             Strategy const& strategy)
+    {
+        typename prepared<Geometry1>::type const&
+            prepared1 = prepared<Geometry1>::apply(geometry1);
+        typename prepared<Geometry2>::type const&
+            prepared2 = prepared<Geometry2>::apply(geometry2);
+
+        typedef typename prepared<Geometry1>::type prepared_type1;
+        typedef typename prepared<Geometry2>::type prepared_type2;
+
+        typename point_type<Segment>::type point;
+        geometry::assign_zero(point);
+        if (covered_point(prepared1, prepared2, strategy, point,
+                          is_areal<prepared_type2>())
+            || covered_point(prepared2, prepared1, strategy, point,
+                             is_areal<prepared_type1>()))
+        {
+            geometry::detail::assign_point_to_index<0>(point, shortest);
+            geometry::detail::assign_point_to_index<1>(point, shortest);
+            return;
+        }
+
+        closest_features(prepared1, prepared2, shortest, strategy);
+    }
+
+private :
+
+    template
+    <
+        typename Prepared1, typename Prepared2,
+        typename Segment, typename Strategy
+    >
+    static inline void closest_features(Prepared1 const& prepared1,
+                                        Prepared2 const& prepared2,
+                                        Segment& shortest,
+                                        Strategy const& strategy)
+    {
+        typedef features<Prepared1> features1;
+        typedef features<Prepared2> features2;
+        typedef typename features1::iterator_type iterator1;
+        typedef typename features2::iterator_type iterator2;
+        typedef typename std::iterator_traits<iterator1>::value_type feature1;
+        typedef typename std::iterator_traits<iterator2>::value_type feature2;
+
+        typename geometry::strategy::distance::services::comparable_type
+            <
+                Strategy
+            >::type const cstrategy
+                = geometry::strategy::distance::services::get_comparable
+                    <
+                        Strategy
+                    >::apply(strategy);
+
+        iterator1 const first1 = features1::begin(prepared1);
+        iterator1 const last1 = features1::end(prepared1);
+        iterator2 const first2 = features2::begin(prepared2);
+        iterator2 const last2 = features2::end(prepared2);
+
+        std::size_t const count1 = std::distance(first1, last1);
+        std::size_t const count2 = std::distance(first2, last2);
+
+        if (count1 == 1)
+        {
+            iterator2 const it2 = closest_of_range(*first1, first2, last2,
+                                                   cstrategy);
+            feature_to_feature
+                <
+                    feature1, feature2
+                >::apply(*first1, *it2, strategy, shortest);
+        }
+        else if (count2 == 1)
+        {
+            iterator1 const it1 = closest_of_range(*first2, first1, last1,
+                                                   cstrategy);
+            feature_to_feature
+                <
+                    feature1, feature2
+                >::apply(*it1, *first2, strategy, shortest);
+        }
+        else if (count1 >= count2)
+        {
+            std::pair<feature1, iterator2> const closest
+                = geometry::detail::closest_feature::range_to_range_rtree
+                    ::apply(first1, last1, first2, last2, cstrategy);
+            feature_to_feature
+                <
+                    feature1, feature2
+                >::apply(closest.first, *closest.second, strategy, shortest);
+        }
+        else
+        {
+            std::pair<feature2, iterator1> const closest
+                = geometry::detail::closest_feature::range_to_range_rtree
+                    ::apply(first2, last2, first1, last1, cstrategy);
+            feature_to_feature
+                <
+                    feature1, feature2
+                >::apply(*closest.second, closest.first, strategy, shortest);
+        }
+    }
+};
+
+
+}} // namespace detail::closest_points
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+
+template <typename Geometry1, typename Geometry2, typename Tag1, typename Tag2>
+struct closest_points
+    : detail::closest_points::geometry_to_geometry<Geometry1, Geometry2>
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_IMPLEMENTATION_HPP
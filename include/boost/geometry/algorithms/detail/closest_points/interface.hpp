@@ -0,0 +1,291 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_INTERFACE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_INTERFACE_HPP
+
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/variant_fwd.hpp>
+
+#include <boost/geometry/algorithms/detail/closest_points/implementation.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/dispatch/closest_points.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace resolve_strategy
+{
+
+template <typename Strategy>
+struct closest_points
+{
+    template <typename Geometry1, typename Geometry2, typename Segment>
+    static inline void apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Segment& shortest,
+                             Strategy const& strategy)
+    {
+        dispatch::closest_points
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, shortest, strategy);
+    }
+};
+
+template <>
+struct closest_points<default_strategy>
+{
+    template <typename Geometry1, typename Geometry2, typename Segment>
+    static inline void apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Segment& shortest,
+                             default_strategy)
+    {
+        // The strategy of the distance, boxes are handled as polygons
+        typedef typename detail::distance::default_strategy
+            <
+                typename detail::closest_points::prepared<Geometry1>::type,
+                typename detail::closest_points::prepared<Geometry2>::type
+            >::type strategy_type;
+
+        dispatch::closest_points
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, shortest, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+namespace resolve_variant
+{
+
+template <typename Geometry1, typename Geometry2>
+struct closest_points
+{
+    template <typename Segment, typename Strategy>
+    static inline void apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Segment& shortest,
+                             Strategy const& strategy)
+    {
+        resolve_strategy::closest_points
+            <
+                Strategy
+            >::apply(geometry1, geometry2, shortest, strategy);
+    }
+};
+
+template <BOOST_VARIANT_ENUM_PARAMS(typename T), typename Geometry2>
+struct closest_points<variant<BOOST_VARIANT_ENUM_PARAMS(T)>, Geometry2>
+{
+    template <typename Segment, typename Strategy>
+    struct visitor: static_visitor<void>
+    {
+        Geometry2 const& m_geometry2;
+        Segment& m_shortest;
+        Strategy const& m_strategy;
+
+        visitor(Geometry2 const& geometry2, Segment& shortest,
+                Strategy const& strategy)
+            : m_geometry2(geometry2)
+            , m_shortest(shortest)
+            , m_strategy(strategy)
+        {}
+
+        template <typename Geometry1>
+        void operator()(Geometry1 const& geometry1) const
+        {
+            closest_points
+                <
+                    Geometry1, Geometry2
+                >::apply(geometry1, m_geometry2, m_shortest, m_strategy);
+        }
+    };
+
+    template <typename Segment, typename Strategy>
+    static inline void
+    apply(variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry1,
+          Geometry2 const& geometry2,
+          Segment& shortest,
+          Strategy const& strategy)
+    {
+        boost::apply_visitor(visitor<Segment, Strategy>(geometry2, shortest,
+                                                        strategy),
+                             geometry1);
+    }
+};
+
+template <typename Geometry1, BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct closest_points<Geometry1, variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
+{
+    template <typename Segment, typename Strategy>
+    struct visitor: static_visitor<void>
+    {
+        Geometry1 const& m_geometry1;
+        Segment& m_shortest;
+        Strategy const& m_strategy;
+
+        visitor(Geometry1 const& geometry1, Segment& shortest,
+                Strategy const& strategy)
+            : m_geometry1(geometry1)
+            , m_shortest(shortest)
+            , m_strategy(strategy)
+        {}
+
+        template <typename Geometry2>
+        void operator()(Geometry2 const& geometry2) const
+        {
+            closest_points
+                <
+                    Geometry1, Geometry2
+                >::apply(m_geometry1, geometry2, m_shortest, m_strategy);
+        }
+    };
+
+    template <typename Segment, typename Strategy>
+    static inline void
+    apply(Geometry1 const& geometry1,
+          variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry2,
+          Segment& shortest,
+          Strategy const& strategy)
+    {
+        boost::apply_visitor(visitor<Segment, Strategy>(geometry1, shortest,
+                                                        strategy),
+                             geometry2);
+    }
+};
+
+template
+<
+    BOOST_VARIANT_ENUM_PARAMS(typename T1),
+    BOOST_VARIANT_ENUM_PARAMS(typename T2)
+>
+struct closest_points
+    <
+        variant<BOOST_VARIANT_ENUM_PARAMS(T1)>,
+        variant<BOOST_VARIANT_ENUM_PARAMS(T2)>
+    >
+{
+    template <typename Segment, typename Strategy>
+    struct visitor: static_visitor<void>
+    {
+        Segment& m_shortest;
+        Strategy const& m_strategy;
+
+        visitor(Segment& shortest, Strategy const& strategy)
+            : m_shortest(shortest)
+            , m_strategy(strategy)
+        {}
+
+        template <typename Geometry1, typename Geometry2>
+        void operator()(Geometry1 const& geometry1,
+                        Geometry2 const& geometry2) const
+        {
+            closest_points
+                <
+                    Geometry1, Geometry2
+                >::apply(geometry1, geometry2, m_shortest, m_strategy);
+        }
+    };
+
+    template <typename Segment, typename Strategy>
+    static inline void
+    apply(variant<BOOST_VARIANT_ENUM_PARAMS(T1)> const& geometry1,
+          variant<BOOST_VARIANT_ENUM_PARAMS(T2)> const& geometry2,
+          Segment& shortest,
+          Strategy const& strategy)
+    {
+        boost::apply_visitor(visitor<Segment, Strategy>(shortest, strategy),
+                             geometry1, geometry2);
+    }
+};
+
+} // namespace resolve_variant
+
+
+/*!
+\brief Calculates the closest points of two geometries \brief_strategy
+\ingroup distance
+\details The free function closest_points calculates the shortest segment
+    between two geometries: its first point is a point of the first
+    geometry, its second point is a point of the second geometry, and its
+    length is the distance between the geometries. If the geometries
+    intersect, the segment is degenerate, at a common point. The closest
+    features of the geometries are searched using an rtree, as for the
+    distance.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Segment Any type fulfilling a Segment Concept
+\tparam Strategy \tparam_strategy{Distance}
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param shortest The shortest segment
+\param strategy \param_strategy{distance}, a point-point strategy for two
+    pointlike geometries and a point-segment strategy otherwise, as for
+    the distance
+\note Boxes are handled as polygons, having the edges of the coordinate
+    system as sides
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Geometry1, typename Geometry2, typename Segment, typename Strategy>
+inline void closest_points(Geometry1 const& geometry1,
+                           Geometry2 const& geometry2,
+                           Segment& shortest,
+                           Strategy const& strategy)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+    concepts::check<Segment>();
+
+    detail::throw_on_empty_input(geometry1);
+    detail::throw_on_empty_input(geometry2);
+
+    resolve_variant::closest_points
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, shortest, strategy);
+}
+
+
+/*!
+\brief Calculates the closest points of two geometries
+\ingroup distance
+\details The free function closest_points calculates the shortest segment
+    between two geometries: its first point is a point of the first
+    geometry, its second point is a point of the second geometry, and its
+    length is the distance between the geometries. \details_default_strategy
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Segment Any type fulfilling a Segment Concept
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param shortest The shortest segment
+*/
+template <typename Geometry1, typename Geometry2, typename Segment>
+inline void closest_points(Geometry1 const& geometry1,
+                           Geometry2 const& geometry2,
+                           Segment& shortest)
+{
+    geometry::closest_points(geometry1, geometry2, shortest,
+                             default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_INTERFACE_HPP
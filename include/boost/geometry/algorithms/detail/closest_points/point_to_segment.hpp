@@ -0,0 +1,204 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_POINT_TO_SEGMENT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_POINT_TO_SEGMENT_HPP
+
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/arithmetic/arithmetic.hpp>
+#include <boost/geometry/arithmetic/cross_product.hpp>
+#include <boost/geometry/arithmetic/dot_product.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/formulas/spherical.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/strategies/geographic/distance_cross_track.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace closest_points
+{
+
+
+/*!
+    \brief Calculates the point of a segment closest to a point
+    \details The point-segment distance strategy is passed for the
+        parameters of the coordinate system, which are only used in
+        geographic systems.
+*/
+template <typename CsTag>
+struct point_to_segment
+    : not_implemented<CsTag>
+{};
+
+template <>
+struct point_to_segment<cartesian_tag>
+{
+    // The same as in the projected_point distance strategy
+    template
+    <
+        typename Point, typename PointOfSegment,
+        typename Strategy, typename Result
+    >
+    static inline void apply(Point const& p,
+                             PointOfSegment const& p1,
+                             PointOfSegment const& p2,
+                             Strategy const& ,
+                             Result& result)
+    {
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                typename coordinate_type<PointOfSegment>::type,
+                double
+            >::type calculation_type;
+
+        typedef model::point
+            <
+                calculation_type,
+                dimension<PointOfSegment>::value,
+                typename coordinate_system<PointOfSegment>::type
+            > fp_point_type;
+
+        fp_point_type v, w, projected;
+        geometry::convert(p2, v);
+        geometry::convert(p, w);
+        geometry::convert(p1, projected);
+        subtract_point(v, projected);
+        subtract_point(w, projected);
+
+        calculation_type const zero = calculation_type();
+        calculation_type const c1 = geometry::dot_product(w, v);
+        if (c1 <= zero)
+        {
+            geometry::convert(p1, result);
+            return;
+        }
+        calculation_type const c2 = geometry::dot_product(v, v);
+        if (c2 <= c1)
+        {
+            geometry::convert(p2, result);
+            return;
+        }
+
+        multiply_value(v, c1 / c2);
+        add_point(projected, v);
+        geometry::convert(projected, result);
+    }
+};
+
+template <>
+struct point_to_segment<spherical_equatorial_tag>
+{
+    // The point is projected on the plane of the great circle of the
+    // segment, if the projection is on the arc of the segment it is the
+    // closest point, otherwise the closest endpoint is
+    template
+    <
+        typename Point, typename PointOfSegment,
+        typename Strategy, typename Result
+    >
+    static inline void apply(Point const& p,
+                             PointOfSegment const& p1,
+                             PointOfSegment const& p2,
+                             Strategy const& ,
+                             Result& result)
+    {
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                typename coordinate_type<PointOfSegment>::type,
+                double
+            >::type calculation_type;
+
+        typedef model::point<calculation_type, 3, cs::cartesian> vec3d_t;
+
+        vec3d_t const a = formula::sph_to_cart3d<vec3d_t>(p1);
+        vec3d_t const b = formula::sph_to_cart3d<vec3d_t>(p2);
+        vec3d_t const c = formula::sph_to_cart3d<vec3d_t>(p);
+
+        calculation_type const zero = calculation_type();
+        vec3d_t const n = geometry::cross_product(a, b);
+        calculation_type const n_sqr = geometry::dot_product(n, n);
+        if (n_sqr > zero)
+        {
+            vec3d_t n_c = n;
+            multiply_value(n_c, geometry::dot_product(c, n) / n_sqr);
+            vec3d_t projected = c;
+            subtract_point(projected, n_c);
+
+            calculation_type const projected_sqr
+                = geometry::dot_product(projected, projected);
+            if (projected_sqr > zero
+                && geometry::dot_product(geometry::cross_product(a, projected), n) >= zero
+                && geometry::dot_product(geometry::cross_product(projected, b), n) >= zero)
+            {
+                divide_value(projected, math::sqrt(projected_sqr));
+                result = formula::cart3d_to_sph<Result>(projected);
+                return;
+            }
+        }
+
+        // The endpoint with the smallest angle to the point
+        if (geometry::dot_product(a, c) >= geometry::dot_product(b, c))
+        {
+            geometry::convert(p1, result);
+        }
+        else
+        {
+            geometry::convert(p2, result);
+        }
+    }
+};
+
+template <>
+struct point_to_segment<geographic_tag>
+{
+    // The closest point is calculated by the geographic cross track
+    // strategy, along with the distance
+    template
+    <
+        typename Point, typename PointOfSegment,
+        typename FormulaPolicy, typename Spheroid, typename CalculationType,
+        bool Bisection, bool EnableClosestPoint,
+        typename Result
+    >
+    static inline void apply(Point const& p,
+                             PointOfSegment const& p1,
+                             PointOfSegment const& p2,
+                             strategy::distance::detail::geographic_cross_track
+                                <
+                                    FormulaPolicy, Spheroid, CalculationType,
+                                    Bisection, EnableClosestPoint
+                                > const& strategy,
+                             Result& result)
+    {
+        geometry::strategy::distance::detail::geographic_cross_track
+            <
+                FormulaPolicy, Spheroid, CalculationType, Bisection, true
+            > const closest_point_strategy(strategy.model());
+
+        closest_point_strategy.apply(p, p1, p2, result);
+    }
+};
+
+
+}} // namespace detail::closest_points
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_POINT_TO_SEGMENT_HPP
@@ -0,0 +1,237 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_ENVELOPE_CHUNKED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_ENVELOPE_CHUNKED_HPP
+
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+#include <boost/geometry/algorithms/detail/block_sum.hpp>
+#include <boost/geometry/algorithms/detail/envelope/initialize.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/numbered_ranges.hpp>
+#include <boost/geometry/algorithms/dispatch/envelope.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/strategies/cartesian/envelope_point.hpp>
+#include <boost/geometry/strategies/cartesian/expand_box.hpp>
+#include <boost/geometry/strategies/cartesian/expand_point.hpp>
+#include <boost/geometry/views/detail/range_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace envelope
+{
+template <typename CalculationType> class cartesian;
+class cartesian_multipoint;
+}} // namespace strategy::envelope
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace envelope
+{
+
+
+// Whether the envelope of a geometry is the envelope of its points, such
+// that it can be calculated in blocks of points (only in cartesian systems)
+template <typename Tag, typename Strategy>
+struct has_point_blocks : boost::false_type {};
+
+template <typename CalculationType>
+struct has_point_blocks<linestring_tag, strategy::envelope::cartesian<CalculationType> >
+    : boost::true_type {};
+
+template <typename CalculationType>
+struct has_point_blocks<ring_tag, strategy::envelope::cartesian<CalculationType> >
+    : boost::true_type {};
+
+template <typename CalculationType>
+struct has_point_blocks<polygon_tag, strategy::envelope::cartesian<CalculationType> >
+    : boost::true_type {};
+
+template <typename CalculationType>
+struct has_point_blocks<multi_linestring_tag, strategy::envelope::cartesian<CalculationType> >
+    : boost::true_type {};
+
+template <typename CalculationType>
+struct has_point_blocks<multi_polygon_tag, strategy::envelope::cartesian<CalculationType> >
+    : boost::true_type {};
+
+template <>
+struct has_point_blocks<multi_point_tag, strategy::envelope::cartesian_multipoint>
+    : boost::true_type {};
+
+
+// Calls actor.apply for the ranges of which the points are considered by
+// the envelope: all of them, except the interior rings of a polygon having
+// a non-empty exterior ring
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct for_each_envelope_range
+{
+    template <typename Actor>
+    static inline void apply(Geometry const& range, Actor& actor)
+    {
+        actor.apply(range);
+    }
+};
+
+template <typename Polygon>
+struct for_each_envelope_range<Polygon, polygon_tag>
+{
+    template <typename Actor>
+    static inline void apply(Polygon const& polygon, Actor& actor)
+    {
+        if (boost::size(exterior_ring(polygon)) > 0)
+        {
+            actor.apply(exterior_ring(polygon));
+            return;
+        }
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            actor.apply(*it);
+        }
+    }
+};
+
+template <typename Multi>
+struct for_each_envelope_multi_range
+{
+    template <typename Actor>
+    static inline void apply(Multi const& multi, Actor& actor)
+    {
+        for (typename boost::range_iterator<Multi const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            for_each_envelope_range
+                <
+                    typename boost::range_value<Multi>::type
+                >::apply(*it, actor);
+        }
+    }
+};
+
+template <typename MultiLinestring>
+struct for_each_envelope_range<MultiLinestring, multi_linestring_tag>
+    : for_each_envelope_multi_range<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct for_each_envelope_range<MultiPolygon, multi_polygon_tag>
+    : for_each_envelope_multi_range<MultiPolygon>
+{};
+
+
+// Envelope of the points of a block, in the same way as envelope_range
+template <typename Box>
+class points_envelope_kernel
+{
+public :
+    typedef Box result_type;
+
+    inline points_envelope_kernel()
+        : m_initialized(false)
+    {
+        initialize<Box, 0, dimension<Box>::value>::apply(m_box);
+    }
+
+    template <typename Iterator>
+    inline void apply(Iterator first, Iterator last)
+    {
+        if (first != last && ! m_initialized)
+        {
+            strategy::envelope::cartesian_point::apply(*first, m_box);
+            m_initialized = true;
+            ++first;
+        }
+        for (; first != last; ++first)
+        {
+            strategy::expand::cartesian_point::apply(m_box, *first);
+        }
+    }
+
+    inline Box result() const
+    {
+        return m_box;
+    }
+
+    static inline void merge(Box& total, Box const& other)
+    {
+        strategy::expand::cartesian_box::apply(total, other);
+    }
+
+private :
+    bool m_initialized;
+    Box m_box;
+};
+
+
+/*!
+    \brief Calculates the envelope according to an execution policy
+    \details In cartesian systems the points are processed in blocks, and
+        the envelopes of the blocks are combined. Otherwise the envelope is
+        calculated sequentially. The result is the same in both cases.
+*/
+template <typename Geometry>
+struct envelope_chunked
+{
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, Box& mbr,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        apply(geometry, mbr, strategy, policy,
+              has_point_blocks<typename tag<Geometry>::type, Strategy>());
+    }
+
+private :
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, Box& mbr,
+                             Strategy const& ,
+                             ExecutionPolicy const& policy, boost::true_type)
+    {
+        geometry::detail::numbered_points
+            <
+                typename geometry::detail::range_type<Geometry>::type
+            > points;
+        for_each_envelope_range<Geometry>::apply(geometry, points);
+
+        mbr = geometry::detail::block_sum::apply(points,
+                points_envelope_kernel<Box>(), policy);
+    }
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry, Box& mbr,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& , boost::false_type)
+    {
+        dispatch::envelope<Geometry>::apply(geometry, mbr, strategy);
+    }
+};
+
+
+}} // namespace detail::envelope
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_ENVELOPE_CHUNKED_HPP
@@ -26,6 +26,7 @@
 #include <boost/variant/static_visitor.hpp>
 #include <boost/variant/variant_fwd.hpp>
 
+#include <boost/geometry/algorithms/detail/envelope/chunked.hpp>
 #include <boost/geometry/algorithms/dispatch/envelope.hpp>
 
 #include <boost/geometry/core/coordinate_system.hpp>
@@ -75,6 +76,41 @@ struct envelope
 
         dispatch::envelope<Geometry>::apply(geometry, box, strategy_type());
     }
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        detail::envelope::envelope_chunked
+            <
+                Geometry
+            >::apply(geometry, box, strategy, policy);
+    }
+
+    template <typename Box, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             default_strategy,
+                             ExecutionPolicy const& policy)
+    {
+        typedef typename strategy::envelope::services::default_strategy
+            <
+                typename tag<Geometry>::type,
+                typename cs_tag<Geometry>::type,
+                typename select_most_precise
+                    <
+                        typename coordinate_type<Geometry>::type,
+                        typename coordinate_type<Box>::type
+                    >::type
+            >::type strategy_type;
+
+        detail::envelope::envelope_chunked
+            <
+                Geometry
+            >::apply(geometry, box, strategy_type(), policy);
+    }
 };
 
 } // namespace resolve_strategy
@@ -95,6 +131,19 @@ struct envelope
 
         resolve_strategy::envelope<Geometry>::apply(geometry, box, strategy);
     }
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        concepts::check<Geometry const>();
+        concepts::check<Box>();
+
+        resolve_strategy::envelope<Geometry>::apply(geometry, box, strategy,
+                                                    policy);
+    }
 };
 
 
@@ -127,6 +176,40 @@ struct envelope<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
     {
         boost::apply_visitor(visitor<Box, Strategy>(box, strategy), geometry);
     }
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor: boost::static_visitor<void>
+    {
+        Box& m_box;
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(Box& box, Strategy const& strategy,
+                       ExecutionPolicy const& policy)
+            : m_box(box)
+            , m_strategy(strategy)
+            , m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        void operator()(Geometry const& geometry) const
+        {
+            envelope<Geometry>::apply(geometry, m_box, m_strategy, m_policy);
+        }
+    };
+
+    template <typename Box, typename Strategy, typename ExecutionPolicy>
+    static inline void
+    apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+          Box& box,
+          Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        boost::apply_visitor(policy_visitor
+            <
+                Box, Strategy, ExecutionPolicy
+            >(box, strategy, policy), geometry);
+    }
 };
 
 } // namespace resolve_variant
@@ -155,6 +238,33 @@ inline void envelope(Geometry const& geometry, Box& mbr, Strategy const& strateg
     resolve_variant::envelope<Geometry>::apply(geometry, mbr, strategy);
 }
 
+/*!
+\brief \brief_calc{envelope (with strategy)}, according to an execution
+    policy
+\ingroup envelope
+\details \details_calc{envelope,\det_envelope}. In cartesian systems the
+    points of linestrings, rings, polygons and multi geometries are
+    processed in blocks, in chunks according to the execution policy,
+    sequenced or parallel. The result does not depend on the policy.
+\tparam Geometry \tparam_geometry
+\tparam Box \tparam_box
+\tparam Strategy \tparam_strategy{Envelope}
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry \param_geometry
+\param mbr \param_box \param_set{envelope}
+\param strategy \param_strategy{envelope}
+\param policy Execution policy
+
+\qbk{distinguish,with strategy and execution policy}
+\qbk{[include reference/algorithms/envelope.qbk]}
+*/
+template<typename Geometry, typename Box, typename Strategy, typename ExecutionPolicy>
+inline void envelope(Geometry const& geometry, Box& mbr,
+                     Strategy const& strategy, ExecutionPolicy const& policy)
+{
+    resolve_variant::envelope<Geometry>::apply(geometry, mbr, strategy, policy);
+}
+
 /*!
 \brief \brief_calc{envelope}
 \ingroup envelope
@@ -0,0 +1,270 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_NUMBERED_RANGES_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_NUMBERED_RANGES_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/views/box_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+template <typename Range>
+struct stored_range
+{
+    typedef Range const* type;
+
+    static inline type make(Range const& range) { return &range; }
+    static inline Range const& get(type const& stored) { return *stored; }
+};
+
+// Views on boxes are created on the fly by for_each_range, so they are copied
+template <typename Box, bool Clockwise>
+struct stored_range<box_view<Box, Clockwise> >
+{
+    typedef box_view<Box, Clockwise> type;
+
+    static inline type make(type const& range) { return range; }
+    static inline type const& get(type const& stored) { return stored; }
+};
+
+
+/*!
+    \brief The points of the non-empty ranges of a geometry, numbered
+        consecutively, such that they can be processed in chunks
+    \details Ranges are added by apply, such that it can be used with
+        for_each_range. The ranges should be random access.
+*/
+template <typename Range>
+class numbered_points
+{
+    typedef stored_range<Range> stored;
+
+public :
+    inline numbered_points()
+        : m_offsets(1, 0)
+    {}
+
+    inline void apply(Range const& range)
+    {
+        std::size_t const size = boost::size(range);
+        if (size > 0)
+        {
+            m_ranges.push_back(stored::make(range));
+            m_offsets.push_back(m_offsets.back() + size);
+        }
+    }
+
+    inline std::size_t count() const
+    {
+        return m_offsets.back();
+    }
+
+    //! Calls visitor.apply(first, last) for the runs of consecutive points
+    //! numbered [first, last)
+    template <typename Visitor>
+    inline void for_each_run(std::size_t first, std::size_t last,
+                             Visitor& visitor) const
+    {
+        std::size_t r = std::upper_bound(m_offsets.begin(), m_offsets.end(),
+                                         first) - m_offsets.begin() - 1;
+        while (first < last)
+        {
+            Range const& range = stored::get(m_ranges[r]);
+            std::size_t const end = (std::min)(last, m_offsets[r + 1]);
+            visitor.apply(range::pos(range, first - m_offsets[r]),
+                          range::pos(range, end - m_offsets[r]));
+            first = end;
+            ++r;
+        }
+    }
+
+private :
+    std::vector<typename stored::type> m_ranges;
+    std::vector<std::size_t> m_offsets;
+};
+
+
+/*!
+    \brief The segments of ranges, numbered consecutively, such that they
+        can be processed in chunks
+    \details An open range also has a segment from its last to its first
+        point. Ranges with less than the minimal size are skipped.
+        The ranges should be random access.
+*/
+template <typename Range, closure_selector Closure>
+class numbered_segments
+{
+public :
+    explicit inline numbered_segments(std::size_t minimal_size = 2)
+        : m_minimal_size(minimal_size < 2 ? 2 : minimal_size)
+        , m_offsets(1, 0)
+    {}
+
+    inline void apply(Range const& range)
+    {
+        std::size_t const size = boost::size(range);
+        if (size >= m_minimal_size)
+        {
+            m_ranges.push_back(&range);
+            m_offsets.push_back(m_offsets.back()
+                + (Closure == open ? size : size - 1));
+        }
+    }
+
+    inline std::size_t count() const
+    {
+        return m_offsets.back();
+    }
+
+    //! Calls visitor.apply(first, last) for the runs of consecutive points
+    //! of the segments numbered [first, last), and
+    //! visitor.apply_segment(p1, p2) for closing segments of open ranges
+    template <typename Visitor>
+    inline void for_each_run(std::size_t first, std::size_t last,
+                             Visitor& visitor) const
+    {
+        std::size_t r = std::upper_bound(m_offsets.begin(), m_offsets.end(),
+                                         first) - m_offsets.begin() - 1;
+        while (first < last)
+        {
+            Range const& range = *m_ranges[r];
+            std::size_t const size = boost::size(range);
+            std::size_t const end = (std::min)(last, m_offsets[r + 1]);
+            std::size_t const i1 = first - m_offsets[r];
+            std::size_t const i2 = end - m_offsets[r];
+
+            // Segment i is formed by the points i and i + 1
+            std::size_t const points_end = (std::min)(i2 + 1, size);
+            if (i1 + 1 < points_end)
+            {
+                visitor.apply(range::pos(range, i1),
+                              range::pos(range, points_end));
+            }
+            if (Closure == open && i2 == size)
+            {
+                visitor.apply_segment(range::back(range), range::front(range));
+            }
+
+            first = end;
+            ++r;
+        }
+    }
+
+private :
+    std::size_t m_minimal_size;
+    std::vector<Range const*> m_ranges;
+    std::vector<std::size_t> m_offsets;
+};
+
+
+/*!
+    \brief Calls actor.apply for all linestrings or rings of a linear or
+        areal geometry, including the interior rings
+*/
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct for_each_segment_range
+    : not_implemented<Tag>
+{};
+
+template <typename Linestring>
+struct for_each_segment_range<Linestring, linestring_tag>
+{
+    template <typename Actor>
+    static inline void apply(Linestring const& linestring, Actor& actor)
+    {
+        actor.apply(linestring);
+    }
+};
+
+template <typename Ring>
+struct for_each_segment_range<Ring, ring_tag>
+{
+    template <typename Actor>
+    static inline void apply(Ring const& ring, Actor& actor)
+    {
+        actor.apply(ring);
+    }
+};
+
+template <typename Polygon>
+struct for_each_segment_range<Polygon, polygon_tag>
+{
+    template <typename Actor>
+    static inline void apply(Polygon const& polygon, Actor& actor)
+    {
+        actor.apply(exterior_ring(polygon));
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            actor.apply(*it);
+        }
+    }
+};
+
+template <typename Multi>
+struct for_each_multi_segment_range
+{
+    template <typename Actor>
+    static inline void apply(Multi const& multi, Actor& actor)
+    {
+        for (typename boost::range_iterator<Multi const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            for_each_segment_range
+                <
+                    typename boost::range_value<Multi>::type
+                >::apply(*it, actor);
+        }
+    }
+};
+
+template <typename MultiLinestring>
+struct for_each_segment_range<MultiLinestring, multi_linestring_tag>
+    : for_each_multi_segment_range<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct for_each_segment_range<MultiPolygon, multi_polygon_tag>
+    : for_each_multi_segment_range<MultiPolygon>
+{};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_NUMBERED_RANGES_HPP
@@ -16,25 +16,31 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
 
 #include <algorithm>
-
-#ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-#include <iostream>
-#endif
-
+#include <cstddef>
 #include <iterator>
 #include <utility>
 #include <vector>
 #include <limits>
 
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
-#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
 
 
 namespace boost { namespace geometry
@@ -44,28 +50,118 @@ namespace boost { namespace geometry
 namespace detail { namespace discrete_frechet_distance
 {
 
-template <typename size_type1 , typename size_type2,typename result_type>
-class coup_mat
+/*!
+\brief Internal, fills a tile [i0, i1) x [j0, j1) of the coupling matrix.
+\details Only the boundaries of the tiles are stored: on input top[j] is the
+    value of the cell above the tile in column j, left[i] the value of the
+    cell left of the tile in row i and corner the value of the cell above
+    left of the tile. On output they are the values of the last row and
+    the last column of the tile. Cells outside of the matrix are infinite.
+    The value of the last cell of the tile is returned.
+*/
+template <typename Result, typename Linestring1, typename Linestring2, typename Strategy>
+inline Result fill_tile(Linestring1 const& ls1, Linestring2 const& ls2,
+                        std::size_t i0, std::size_t i1,
+                        std::size_t j0, std::size_t j1,
+                        Result* top, Result* left, Result corner,
+                        Strategy const& strategy)
+{
+    Result value = corner;
+    for (std::size_t i = i0; i < i1; ++i)
+    {
+        typename point_type<Linestring1>::type const& p = range::at(ls1, i);
+
+        Result diagonal = corner;
+        value = left[i];
+        for (std::size_t j = j0; j < j1; ++j)
+        {
+            Result const d = strategy.apply(p, range::at(ls2, j));
+            Result const up = top[j];
+            Result const reached = i == 0 && j == 0
+                ? Result(0)
+                : (std::min)((std::min)(value, up), diagonal);
+
+            value = (std::max)(reached, d);
+            diagonal = up;
+            top[j] = value;
+        }
+
+        // The cell left of this row is the diagonal of the next row
+        corner = left[i];
+        left[i] = value;
+    }
+
+    return value;
+}
+
+/*!
+\brief Internal, fills the tiles on anti-diagonals of tiles, the tiles of
+    an anti-diagonal do not depend on each other
+*/
+template
+<
+    typename Result,
+    typename Linestring1,
+    typename Linestring2,
+    typename Strategy
+>
+struct tile_worker
 {
-public:
-    coup_mat(size_type1 w, size_type2 h)
-        : m_data(w * h,-1), m_width(w), m_height(h)
+    tile_worker(Linestring1 const& ls1, Linestring2 const& ls2,
+                Strategy const& strategy,
+                std::size_t tile_size, std::size_t first_tile,
+                std::size_t diagonal,
+                std::vector<Result>& top, std::vector<Result>& left,
+                std::vector<Result> const& corners_in,
+                std::vector<Result>& corners_out)
+        : m_ls1(ls1), m_ls2(ls2), m_strategy(strategy)
+        , m_tile_size(tile_size), m_first_tile(first_tile)
+        , m_diagonal(diagonal)
+        , m_top(top), m_left(left)
+        , m_corners_in(corners_in), m_corners_out(corners_out)
     {}
 
-    result_type & operator()(size_type1 i, size_type2 j)
+    inline void operator()(std::size_t , std::size_t first, std::size_t last) const
     {
-        BOOST_GEOMETRY_ASSERT(i < m_width && j < m_height);
-        return m_data[j * m_width + i];
+        Result const infinite = (std::numeric_limits<Result>::max)();
+        std::size_t const a = boost::size(m_ls1);
+        std::size_t const b = boost::size(m_ls2);
+
+        for (std::size_t t = first; t < last; ++t)
+        {
+            std::size_t const ti = m_first_tile + t;
+            std::size_t const tj = m_diagonal - ti;
+            std::size_t const i0 = ti * m_tile_size;
+            std::size_t const j0 = tj * m_tile_size;
+
+            // The corner is the last cell of the tile (ti - 1, tj - 1)
+            Result const corner = ti > 0 && tj > 0
+                ? m_corners_in[ti - 1] : infinite;
+
+            m_corners_out[ti] = fill_tile<Result>(m_ls1, m_ls2,
+                    i0, (std::min)(i0 + m_tile_size, a),
+                    j0, (std::min)(j0 + m_tile_size, b),
+                    &m_top[0], &m_left[0], corner, m_strategy);
+        }
     }
 
-private:
-    std::vector<result_type> m_data;
-    size_type1 m_width;
-    size_type2 m_height;
+    Linestring1 const& m_ls1;
+    Linestring2 const& m_ls2;
+    Strategy const& m_strategy;
+    std::size_t m_tile_size;
+    std::size_t m_first_tile;
+    std::size_t m_diagonal;
+    std::vector<Result>& m_top;
+    std::vector<Result>& m_left;
+    std::vector<Result> const& m_corners_in;
+    std::vector<Result>& m_corners_out;
 };
 
 struct linestring_linestring
 {
+    //! Edge of the tiles of the coupling matrix filled concurrently
+    static const std::size_t tile_size = 512;
+
     template <typename Linestring1, typename Linestring2, typename Strategy>
     static inline typename distance_result
         <
@@ -73,6 +169,22 @@ struct linestring_linestring
             typename point_type<Linestring2>::type,
             Strategy
         >::type apply(Linestring1 const& ls1, Linestring2 const& ls2, Strategy const& strategy)
+    {
+        return apply(ls1, ls2, strategy, geometry::execution::sequenced_policy());
+    }
+
+    template
+    <
+        typename Linestring1, typename Linestring2,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline typename distance_result
+        <
+            typename point_type<Linestring1>::type,
+            typename point_type<Linestring2>::type,
+            Strategy
+        >::type apply(Linestring1 const& ls1, Linestring2 const& ls2,
+                      Strategy const& strategy, ExecutionPolicy const& policy)
     {
         typedef typename distance_result
             <
@@ -80,57 +192,334 @@ struct linestring_linestring
                 typename point_type<Linestring2>::type,
                 Strategy
             >::type result_type;
-        typedef typename boost::range_size<Linestring1>::type size_type1;
-        typedef typename boost::range_size<Linestring2>::type size_type2;
 
+        boost::geometry::detail::throw_on_empty_input(ls1);
+        boost::geometry::detail::throw_on_empty_input(ls2);
+
+        std::size_t const a = boost::size(ls1);
+        std::size_t const b = boost::size(ls2);
+
+        // Instead of the whole coupling matrix, only its last row and last
+        // column are kept
+        result_type const infinite = (std::numeric_limits<result_type>::max)();
+        std::vector<result_type> top(b, infinite);
+        std::vector<result_type> left(a, infinite);
+
+        std::size_t const threads = thread_count(policy);
+        if (threads <= 1 || a < 2 * tile_size || b < 2 * tile_size)
+        {
+            return fill_tile<result_type>(ls1, ls2, 0, a, 0, b,
+                                          &top[0], &left[0], infinite,
+                                          strategy);
+        }
+
+        // Wavefront of tiles: the tiles on an anti-diagonal are filled
+        // concurrently, then the next anti-diagonal
+        std::size_t const rows = (a + tile_size - 1) / tile_size;
+        std::size_t const columns = (b + tile_size - 1) / tile_size;
+
+        std::vector<result_type> corners[3];
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            corners[k].resize(rows, infinite);
+        }
+
+        for (std::size_t d = 0; d + 1 < rows + columns; ++d)
+        {
+            std::size_t const first = d < columns ? 0 : d - columns + 1;
+            std::size_t const last = (std::min)(d + 1, rows);
+
+            geometry::detail::execution::for_each_chunk(last - first,
+                geometry::execution::parallel_policy(threads, 1),
+                tile_worker
+                    <
+                        result_type, Linestring1, Linestring2, Strategy
+                    >(ls1, ls2, strategy, tile_size, first, d, top, left,
+                      corners[(d + 1) % 3], corners[d % 3]));
+        }
+
+        return corners[(rows + columns - 2) % 3][rows - 1];
+    }
+
+private :
+    static inline std::size_t thread_count(geometry::execution::sequenced_policy const& )
+    {
+        return 1;
+    }
+
+    static inline std::size_t thread_count(geometry::execution::parallel_policy const& policy)
+    {
+        return policy.threads();
+    }
+};
+
+
+// The differences of the coordinates are converted to the distances of
+// the strategy, e.g. squared for comparable::pythagoras
+template
+<
+    typename Box1, typename Box2, typename Distance, typename Strategy,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = dimension<Box1>::value
+>
+struct boxes_close
+{
+    typedef geometry::strategy::distance::services::result_from_distance
+        <
+            Strategy,
+            typename point_type<Box1>::type,
+            typename point_type<Box2>::type
+        > result_from_distance;
+
+    static inline bool apply(Box1 const& box1, Box2 const& box2,
+                             Distance const& max_distance,
+                             Strategy const& strategy)
+    {
+        return result_from_distance::apply(strategy,
+                    math::abs(get<min_corner, Dimension>(box1)
+                              - get<min_corner, Dimension>(box2))) <= max_distance
+            && result_from_distance::apply(strategy,
+                    math::abs(get<max_corner, Dimension>(box1)
+                              - get<max_corner, Dimension>(box2))) <= max_distance
+            && boxes_close
+                <
+                    Box1, Box2, Distance, Strategy, Dimension + 1, DimensionCount
+                >::apply(box1, box2, max_distance, strategy);
+    }
+};
+
+template
+<
+    typename Box1, typename Box2, typename Distance, typename Strategy,
+    std::size_t DimensionCount
+>
+struct boxes_close<Box1, Box2, Distance, Strategy, DimensionCount, DimensionCount>
+{
+    static inline bool apply(Box1 const& , Box2 const& , Distance const& ,
+                             Strategy const& )
+    {
+        return true;
+    }
+};
+
+// The point of one linestring having the lowest x has to be coupled with a
+// point of the other linestring, so in cartesian coordinates the sides of
+// the bounding boxes differ at most the maximal distance
+template
+<
+    typename Linestring1, typename Linestring2,
+    typename Distance, typename Strategy
+>
+inline bool bounding_boxes_close(Linestring1 const& ls1, Linestring2 const& ls2,
+                                 Distance const& max_distance,
+                                 Strategy const& strategy, cartesian_tag)
+{
+    typedef model::box<typename point_type<Linestring1>::type> box_type1;
+    typedef model::box<typename point_type<Linestring2>::type> box_type2;
+
+    box_type1 const box1 = geometry::return_envelope<box_type1>(ls1);
+    box_type2 const box2 = geometry::return_envelope<box_type2>(ls2);
+    return boxes_close
+        <
+            box_type1, box_type2, Distance, Strategy
+        >::apply(box1, box2, max_distance, strategy);
+}
+
+template
+<
+    typename Linestring1, typename Linestring2,
+    typename Distance, typename Strategy, typename CSTag
+>
+inline bool bounding_boxes_close(Linestring1 const& , Linestring2 const& ,
+                                 Distance const& , Strategy const& , CSTag)
+{
+    return true;
+}
+
+// Decides if two points are within the maximal distance
+template
+<
+    typename Point1, typename Point2,
+    typename Distance, typename Strategy
+>
+class within_distance
+{
+    typedef typename geometry::strategy::distance::services::comparable_type
+        <
+            Strategy
+        >::type comparable_strategy_type;
+    typedef typename distance_result
+        <
+            Point1, Point2, comparable_strategy_type
+        >::type comparable_type;
+
+public :
+    within_distance(Distance const& max_distance, Strategy const& strategy)
+        : m_max_distance(max_distance)
+        , m_strategy(strategy)
+        , m_comparable_strategy(geometry::strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy))
+        , m_lower(comparable(max_distance * (1 - tolerance())))
+        , m_upper(comparable(max_distance * (1 + tolerance())))
+    {}
+
+    // Comparable distances are compared, unless they are so close to the
+    // maximal distance that rounding matters
+    inline bool operator()(Point1 const& p1, Point2 const& p2) const
+    {
+        comparable_type const d = m_comparable_strategy.apply(p1, p2);
+        if (d < m_lower)
+        {
+            return true;
+        }
+        if (d > m_upper)
+        {
+            return false;
+        }
+        return m_strategy.apply(p1, p2) <= m_max_distance;
+    }
+
+private :
+    static inline Distance tolerance()
+    {
+        return Distance(1e-9);
+    }
+
+    // The distance of the strategy, which may already be comparable
+    inline comparable_type comparable(Distance const& distance) const
+    {
+        return comparable(distance,
+                          boost::is_same<Strategy, comparable_strategy_type>());
+    }
+
+    inline comparable_type comparable(Distance const& distance,
+                                      boost::false_type) const
+    {
+        return geometry::strategy::distance::services::result_from_distance
+            <
+                comparable_strategy_type, Point1, Point2
+            >::apply(m_comparable_strategy, distance);
+    }
+
+    inline comparable_type comparable(Distance const& distance,
+                                      boost::true_type) const
+    {
+        return comparable_type(distance);
+    }
+
+    Distance m_max_distance;
+    Strategy const& m_strategy;
+    comparable_strategy_type m_comparable_strategy;
+    comparable_type m_lower;
+    comparable_type m_upper;
+};
+
+/*!
+\brief Internal, decides if the discrete Frechet distance is at most a
+    given distance, keeping only the cells of the coupling matrix which can
+    be reached by couplings within that distance
+\details Comparable distances are compared, the first and last points and
+    the bounding boxes (cartesian only) are verified first. The reachable
+    cells of a row start at the first reachable cell of the previous row
+    and end after the last one, so for similar linestrings only a band
+    around the diagonal is visited. If no cell of a row is reachable the
+    answer is known.
+*/
+struct linestring_linestring_below
+{
+    template
+    <
+        typename Linestring1, typename Linestring2,
+        typename Distance, typename Strategy
+    >
+    static inline bool apply(Linestring1 const& ls1, Linestring2 const& ls2,
+                             Distance const& max_distance,
+                             Strategy const& strategy)
+    {
+        typedef typename point_type<Linestring1>::type point_type1;
+        typedef typename point_type<Linestring2>::type point_type2;
+        typedef typename select_most_precise<Distance, double>::type distance_type;
 
         boost::geometry::detail::throw_on_empty_input(ls1);
         boost::geometry::detail::throw_on_empty_input(ls2);
 
-        size_type1 const a = boost::size(ls1);
-        size_type2 const b = boost::size(ls2);
+        if (max_distance < 0)
+        {
+            return false;
+        }
 
+        within_distance
+            <
+                point_type1, point_type2, distance_type, Strategy
+            > const within(max_distance, strategy);
+
+        std::size_t const a = boost::size(ls1);
+        std::size_t const b = boost::size(ls2);
 
-        //Coupling Matrix CoupMat(a,b,-1);
-        coup_mat<size_type1,size_type2,result_type> coup_matrix(a,b);
+        // The first and the last points are always coupled
+        if (! within(range::front(ls1), range::front(ls2))
+            || ! within(range::back(ls1), range::back(ls2))
+            || ! bounding_boxes_close(ls1, ls2, max_distance, strategy,
+                        typename cs_tag<Linestring1>::type()))
+        {
+            return false;
+        }
 
-        result_type const not_feasible = -100;
-        //findin the Coupling Measure
-        for (size_type1 i = 0 ; i < a ; i++ )
+        // The first row is reachable up to the first point too far away
+        std::vector<char> reached(b, 0);
+        std::size_t begin = 0;
+        std::size_t end = 0;
         {
-            for(size_type2 j=0;j<b;j++)
+            point_type1 const& p = range::front(ls1);
+            while (end < b && within(p, range::at(ls2, end)))
             {
-                result_type dis = strategy.apply(range::at(ls1,i), range::at(ls2,j));
-                if(i==0 && j==0)
-                    coup_matrix(i,j) = dis;
-                else if(i==0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i,j-1), dis);
-                else if(i>0 && j==0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i-1,j), dis);
-                else if(i>0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)((std::min)(coup_matrix(i,j-1),
-                                              (std::min)(coup_matrix(i-1,j),
-                                                         coup_matrix(i-1,j-1))),
-                                   dis);
-                else
-                    coup_matrix(i,j) = not_feasible;
+                reached[end++] = 1;
             }
         }
 
-        #ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-        //Print CoupLing Matrix
-        for(size_type i = 0; i <a; i++)
+        for (std::size_t i = 1; i < a; ++i)
         {
-            for(size_type j = 0; j <b; j++)
-            std::cout << coup_matrix(i,j) << " ";
-            std::cout << std::endl;
+            point_type1 const& p = range::at(ls1, i);
+
+            bool left = false;
+            bool diagonal = false;
+            std::size_t new_begin = b;
+            std::size_t new_end = 0;
+            for (std::size_t j = begin; j < b; ++j)
+            {
+                bool const up = j < end && reached[j] != 0;
+                bool value = false;
+                if (left || up || diagonal)
+                {
+                    value = within(p, range::at(ls2, j));
+                }
+                else if (j >= end)
+                {
+                    // Nothing can be reached anymore in this row
+                    break;
+                }
+
+                reached[j] = value ? 1 : 0;
+                if (value)
+                {
+                    new_begin = (std::min)(new_begin, j);
+                    new_end = j + 1;
+                }
+                left = value;
+                diagonal = up;
+            }
+
+            if (new_end == 0)
+            {
+                return false;
+            }
+            begin = new_begin;
+            end = new_end;
         }
-        #endif
 
-        return coup_matrix(a-1,b-1);
+        return end == b;
     }
 };
 
@@ -161,6 +550,27 @@ struct discrete_frechet_distance
     : detail::discrete_frechet_distance::linestring_linestring
 {};
 
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Tag1 = typename tag<Geometry1>::type,
+    typename Tag2 = typename tag<Geometry2>::type
+>
+struct frechet_distance_below : not_implemented<Tag1, Tag2>
+{};
+
+template <typename Linestring1, typename Linestring2>
+struct frechet_distance_below
+    <
+        Linestring1,
+        Linestring2,
+        linestring_tag,
+        linestring_tag
+    >
+    : detail::discrete_frechet_distance::linestring_linestring_below
+{};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -207,6 +617,48 @@ discrete_frechet_distance(Geometry1 const& geometry1,
             >::apply(geometry1, geometry2, strategy);
 }
 
+/*!
+\brief Calculate discrete Frechet distance between two geometries (currently
+       works for LineString-LineString) using specified strategy and
+       execution policy.
+\details With a parallel policy the coupling matrix of long linestrings is
+       filled in tiles, the tiles on an anti-diagonal concurrently. The
+       result is the same as calculated sequentially.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\tparam ExecutionPolicy execution::sequenced_policy or
+       execution::parallel_policy
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\param policy Execution policy
+
+\qbk{distinguish,with strategy and execution policy}
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Strategy, typename ExecutionPolicy
+>
+inline typename distance_result
+        <
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type,
+            Strategy
+        >::type
+discrete_frechet_distance(Geometry1 const& geometry1,
+                          Geometry2 const& geometry2,
+                          Strategy const& strategy,
+                          ExecutionPolicy const& policy)
+{
+    return dispatch::discrete_frechet_distance
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, strategy, policy);
+}
+
 // Algorithm overload using default Pt-Pt distance strategy
 
 /*!
@@ -244,6 +696,70 @@ discrete_frechet_distance(Geometry1 const& geometry1, Geometry2 const& geometry2
     return discrete_frechet_distance(geometry1, geometry2, strategy_type());
 }
 
+/*!
+\brief Decide if the discrete Frechet distance between two geometries
+       (currently LineString-LineString) is at most a given distance,
+       using specified strategy.
+\details Cheaper than calculating the distance: it stops as soon as the
+       answer is known, compares comparable distances and visits only the
+       part of the coupling matrix reachable within the distance.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance \tparam_numeric
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance The distance to compare with
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\return true if the discrete Frechet distance is at most max_distance
+
+\qbk{distinguish,with strategy}
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Distance, typename Strategy
+>
+inline bool frechet_distance_below(Geometry1 const& geometry1,
+                                   Geometry2 const& geometry2,
+                                   Distance const& max_distance,
+                                   Strategy const& strategy)
+{
+    return dispatch::frechet_distance_below
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance, strategy);
+}
+
+/*!
+\brief Decide if the discrete Frechet distance between two geometries
+       (currently LineString-LineString) is at most a given distance.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance \tparam_numeric
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance The distance to compare with
+\return true if the discrete Frechet distance is at most max_distance
+*/
+template <typename Geometry1, typename Geometry2, typename Distance>
+inline bool frechet_distance_below(Geometry1 const& geometry1,
+                                   Geometry2 const& geometry2,
+                                   Distance const& max_distance)
+{
+    typedef typename strategy::distance::services::default_strategy
+              <
+                  point_tag, point_tag,
+                  typename point_type<Geometry1>::type,
+                  typename point_type<Geometry2>::type
+              >::type strategy_type;
+
+    return frechet_distance_below(geometry1, geometry2, max_distance,
+                                  strategy_type());
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
@@ -16,6 +16,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
 
 #include <algorithm>
+#include <cstddef>
 
 #ifdef BOOST_GEOMETRY_DEBUG_HAUSDORFF_DISTANCE
 #include <iostream>
@@ -26,19 +27,42 @@
 #include <vector>
 #include <limits>
 
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/utility/enable_if.hpp>
+
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/exception.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
+#include <boost/geometry/util/execution.hpp>
 #include <boost/geometry/util/range.hpp>
 
+#include <boost/geometry/index/predicates.hpp>
+
 #ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
 #include <boost/geometry/index/rtree.hpp>
 #endif // BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
 
+
+namespace boost { namespace geometry { namespace index
+{
+
+template
+<
+    typename Value, typename Options, typename IndexableGetter,
+    typename EqualTo, typename Allocator
+>
+class rtree;
+
+}}} // namespace boost::geometry::index
+
+
 namespace boost { namespace geometry
 {
 
@@ -81,8 +105,235 @@ struct point_range
         }
         return dis_min;
     }
+
+    template
+    <
+        typename Point, typename Range,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline
+    typename distance_result
+        <
+            typename point_type<Point>::type,
+            typename point_type<Range>::type,
+            Strategy
+        >::type
+    apply(Point const& pnt, Range const& rng, Strategy const& strategy,
+          ExecutionPolicy const& )
+    {
+        return apply(pnt, rng, strategy);
+    }
+};
+
+// Shuffles the indexes with a fixed seed, such that the result does not
+// depend on anything else than the input
+inline void shuffle(std::vector<std::size_t>& indexes)
+{
+    boost::uint32_t state = 2463534242u;
+    for (std::size_t i = indexes.size(); i > 1; --i)
+    {
+        // xorshift32
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        std::swap(indexes[i - 1], indexes[state % i]);
+    }
+}
+
+template <typename Comparable>
+struct farthest
+{
+    farthest()
+        : distance(0), index(0), is_set(false)
+    {}
+
+    // Equal distances are resolved by the index, so the result does not
+    // depend on the order or the chunks
+    inline void update(Comparable const& d, std::size_t i)
+    {
+        if (! is_set || d > distance || (d == distance && i < index))
+        {
+            distance = d;
+            index = i;
+            is_set = true;
+        }
+    }
+
+    Comparable distance;
+    std::size_t index;
+    bool is_set;
+};
+
+/*!
+\brief Internal, finds the point of the first range farthest from the
+    second range, with the early break of Taha and Hanbury: the points are
+    visited in random order and the search for the nearest point stops as
+    soon as a point is nearer than the farthest distance found so far
+*/
+template
+<
+    typename Range1, typename Points2,
+    typename ComparableStrategy, typename Comparable
+>
+struct early_break_worker
+{
+    early_break_worker(Range1 const& r1, Points2 const& points2,
+                       std::vector<std::size_t> const& order,
+                       ComparableStrategy const& strategy,
+                       std::vector<farthest<Comparable> >& results)
+        : m_r1(r1), m_points2(points2), m_order(order)
+        , m_strategy(strategy), m_results(results)
+    {}
+
+    inline void operator()(std::size_t chunk, std::size_t first, std::size_t last) const
+    {
+        farthest<Comparable> result;
+        std::size_t const n = m_points2.size();
+        for (std::size_t k = first; k < last; ++k)
+        {
+            std::size_t const i = m_order[k];
+            typename point_type<Range1>::type const& p = range::at(m_r1, i);
+
+            Comparable nearest = m_strategy.apply(p, m_points2[0]);
+            bool const can_break = result.is_set;
+            bool broken = can_break && nearest < result.distance;
+            for (std::size_t j = 1; j < n && ! broken; ++j)
+            {
+                Comparable const d = m_strategy.apply(p, m_points2[j]);
+                if (d < nearest)
+                {
+                    nearest = d;
+                    broken = can_break && nearest < result.distance;
+                }
+            }
+
+            if (! broken)
+            {
+                result.update(nearest, i);
+            }
+        }
+        m_results[chunk] = result;
+    }
+
+    Range1 const& m_r1;
+    Points2 const& m_points2;
+    std::vector<std::size_t> const& m_order;
+    ComparableStrategy const& m_strategy;
+    std::vector<farthest<Comparable> >& m_results;
+};
+
+/*!
+\brief Internal, finds the point of the range farthest from the points in
+    a spatial index, querying the nearest point of each
+*/
+template
+<
+    typename Range1, typename Index,
+    typename ComparableStrategy, typename Comparable
+>
+struct index_worker
+{
+    index_worker(Range1 const& r1, Index const& index,
+                 ComparableStrategy const& strategy,
+                 std::vector<farthest<Comparable> >& results)
+        : m_r1(r1), m_index(index), m_strategy(strategy), m_results(results)
+    {}
+
+    inline void operator()(std::size_t chunk, std::size_t first, std::size_t last) const
+    {
+        typedef typename Index::value_type value_type;
+
+        farthest<Comparable> result;
+        std::vector<value_type> found;
+        for (std::size_t i = first; i < last; ++i)
+        {
+            typename point_type<Range1>::type const& p = range::at(m_r1, i);
+
+            found.clear();
+            m_index.query(index::nearest(p, 1), std::back_inserter(found));
+            result.update(m_strategy.apply(p, m_index.indexable_get()(found.front())), i);
+        }
+        m_results[chunk] = result;
+    }
+
+    Range1 const& m_r1;
+    Index const& m_index;
+    ComparableStrategy const& m_strategy;
+    std::vector<farthest<Comparable> >& m_results;
 };
 
+template <typename Comparable>
+inline farthest<Comparable> merge(std::vector<farthest<Comparable> > const& results)
+{
+    farthest<Comparable> result;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        if (results[i].is_set)
+        {
+            result.update(results[i].distance, results[i].index);
+        }
+    }
+    return result;
+}
+
+struct range_index
+{
+    template
+    <
+        typename Range, typename Index,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline
+    typename distance_result
+        <
+            typename point_type<Range>::type,
+            typename Index::indexable_type,
+            Strategy
+        >::type
+    apply(Range const& r1, Index const& rtree, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        typedef typename geometry::strategy::distance::services::comparable_type
+            <
+                Strategy
+            >::type comparable_strategy_type;
+        typedef typename distance_result
+            <
+                typename point_type<Range>::type,
+                typename Index::indexable_type,
+                comparable_strategy_type
+            >::type comparable_type;
+
+        boost::geometry::detail::throw_on_empty_input(r1);
+        if (rtree.empty())
+        {
+            BOOST_THROW_EXCEPTION(empty_input_exception());
+        }
+
+        comparable_strategy_type const cstrategy
+            = geometry::strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy);
+
+        std::size_t const n1 = boost::size(r1);
+        std::vector<farthest<comparable_type> > results(
+            geometry::detail::execution::chunk_count(n1, policy));
+        geometry::detail::execution::for_each_chunk(n1, policy,
+            index_worker
+                <
+                    Range, Index, comparable_strategy_type, comparable_type
+                >(r1, rtree, cstrategy, results));
+
+        farthest<comparable_type> const result = merge(results);
+        typename point_type<Range>::type const& p = range::at(r1, result.index);
+        std::vector<typename Index::value_type> found;
+        rtree.query(index::nearest(p, 1), std::back_inserter(found));
+        return strategy.apply(p, rtree.indexable_get()(found.front()));
+    }
+};
+
+
 struct range_range
 {
     template <typename Range1, typename Range2, typename Strategy>
@@ -95,48 +346,89 @@ struct range_range
         >::type
     apply(Range1 const& r1, Range2 const& r2, Strategy const& strategy)
     {
+        return apply(r1, r2, strategy, geometry::execution::sequenced_policy());
+    }
 
-        typedef typename distance_result
-            <
-                typename point_type<Range1>::type,
-                typename point_type<Range2>::type,
-                Strategy
-            >::type result_type;
-
-        typedef typename boost::range_size<Range1>::type size_type;
-
+    template
+    <
+        typename Range1, typename Range2,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline
+    typename distance_result
+        <
+            typename point_type<Range1>::type,
+            typename point_type<Range2>::type,
+            Strategy
+        >::type
+    apply(Range1 const& r1, Range2 const& r2, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
         boost::geometry::detail::throw_on_empty_input(r1);
         boost::geometry::detail::throw_on_empty_input(r2);
 
-        size_type const n = boost::size(r1);
-        result_type dis_max = 0;
-
 #ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-        namespace bgi = boost::geometry::index;
-        typedef typename point_type<Range1>::type point_t;
-        typedef bgi::rtree<point_t, bgi::linear<4> > rtree_type;
-        rtree_type rtree(boost::begin(r2), boost::end(r2));
-        point_t res;
-#endif
+        typedef typename point_type<Range2>::type point_t;
+        typedef index::rtree<point_t, index::linear<4> > rtree_type;
+        rtree_type const rtree(boost::begin(r2), boost::end(r2));
+        return range_index::apply(r1, rtree, strategy, policy);
+#else
+        typedef typename point_type<Range2>::type point_type2;
+        typedef typename geometry::strategy::distance::services::comparable_type
+            <
+                Strategy
+            >::type comparable_strategy_type;
+        typedef typename distance_result
+            <
+                typename point_type<Range1>::type, point_type2,
+                comparable_strategy_type
+            >::type comparable_type;
+
+        comparable_strategy_type const cstrategy
+            = geometry::strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy);
+
+        // Both ranges are visited in random order
+        std::size_t const n1 = boost::size(r1);
+        std::vector<std::size_t> order(n1);
+        for (std::size_t i = 0; i < n1; ++i)
+        {
+            order[i] = i;
+        }
+        shuffle(order);
 
-        for (size_type i = 0 ; i < n ; i++)
+        std::size_t const n2 = boost::size(r2);
+        std::vector<std::size_t> order2(n2);
+        for (std::size_t j = 0; j < n2; ++j)
         {
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-            size_type found = rtree.query(bgi::nearest(range::at(r1, i), 1), &res);
-            result_type dis_min = strategy.apply(range::at(r1,i), res);
-#else
-            result_type dis_min = point_range::apply(range::at(r1, i), r2, strategy);
-#endif
-            if (dis_min > dis_max )
-            {
-                dis_max = dis_min;
-            }
+            order2[j] = j;
         }
-        return dis_max;
+        shuffle(order2);
+        std::vector<point_type2> points2;
+        points2.reserve(n2);
+        for (std::size_t j = 0; j < n2; ++j)
+        {
+            points2.push_back(range::at(r2, order2[j]));
+        }
+
+        std::vector<farthest<comparable_type> > results(
+            geometry::detail::execution::chunk_count(n1, policy));
+        geometry::detail::execution::for_each_chunk(n1, policy,
+            early_break_worker
+                <
+                    Range1, std::vector<point_type2>,
+                    comparable_strategy_type, comparable_type
+                >(r1, points2, order, cstrategy, results));
+
+        // The distance itself of the farthest point
+        farthest<comparable_type> const result = merge(results);
+        return point_range::apply(range::at(r1, result.index), r2, strategy);
+#endif
     }
 };
 
-
 struct range_multi_range
 {
     template <typename Range, typename Multi_range, typename Strategy>
@@ -148,6 +440,24 @@ struct range_multi_range
             Strategy
         >::type
     apply(Range const& rng, Multi_range const& mrng, Strategy const& strategy)
+    {
+        return apply(rng, mrng, strategy, geometry::execution::sequenced_policy());
+    }
+
+    template
+    <
+        typename Range, typename Multi_range,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline
+    typename distance_result
+        <
+            typename point_type<Range>::type,
+            typename point_type<Multi_range>::type,
+            Strategy
+        >::type
+    apply(Range const& rng, Multi_range const& mrng, Strategy const& strategy,
+          ExecutionPolicy const& policy)
     {
         typedef typename distance_result
             <
@@ -165,7 +475,7 @@ struct range_multi_range
 
         for (size_type j = 0 ; j < b ; j++)
         {
-            result_type dis_max = range_range::apply(rng, range::at(mrng, j), strategy);
+            result_type dis_max = range_range::apply(rng, range::at(mrng, j), strategy, policy);
             if (dis_max > haus_dis)
             {
                 haus_dis = dis_max;
@@ -188,6 +498,24 @@ struct multi_range_multi_range
             Strategy
         >::type
     apply(Multi_Range1 const& mrng1, Multi_range2 const& mrng2, Strategy const& strategy)
+    {
+        return apply(mrng1, mrng2, strategy, geometry::execution::sequenced_policy());
+    }
+
+    template
+    <
+        typename Multi_Range1, typename Multi_range2,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline
+    typename distance_result
+        <
+            typename point_type<Multi_Range1>::type,
+            typename point_type<Multi_range2>::type,
+            Strategy
+        >::type
+    apply(Multi_Range1 const& mrng1, Multi_range2 const& mrng2,
+          Strategy const& strategy, ExecutionPolicy const& policy)
     {
         typedef typename distance_result
             <
@@ -205,7 +533,7 @@ struct multi_range_multi_range
 
         for (size_type i = 0 ; i < n ; i++)
         {
-            result_type dis_max = range_multi_range::apply(range::at(mrng1, i), mrng2, strategy);
+            result_type dis_max = range_multi_range::apply(range::at(mrng1, i), mrng2, strategy, policy);
             if (dis_max > haus_dis)
             {
                 haus_dis = dis_max;
@@ -215,6 +543,35 @@ struct multi_range_multi_range
     }
 };
 
+// Result of the geometry overloads, evaluated only if the second argument
+// is not a spatial index
+template <typename Geometry1, typename Geometry2, typename Strategy = void>
+struct geometry_result
+    : distance_result
+        <
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type,
+            Strategy
+        >
+{};
+
+template <typename Geometry>
+struct is_index
+    : boost::false_type
+{};
+
+template
+<
+    typename Value, typename Parameters, typename IndexableGetter,
+    typename EqualTo, typename Allocator
+>
+struct is_index
+    <
+        index::rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>
+    >
+    : boost::true_type
+{};
+
 }} // namespace detail::hausdorff_distance
 #endif // DOXYGEN_NO_DETAIL
 
@@ -294,11 +651,13 @@ struct discrete_hausdorff_distance<MultiLinestring1, MultiLinestring2, multi_lin
 */
 template <typename Geometry1, typename Geometry2, typename Strategy>
 inline
-typename distance_result
+typename boost::lazy_enable_if_c
     <
-        typename point_type<Geometry1>::type,
-        typename point_type<Geometry2>::type,
-        Strategy
+        ! detail::discrete_hausdorff_distance::is_index<Geometry2>::value,
+        detail::discrete_hausdorff_distance::geometry_result
+            <
+                Geometry1, Geometry2, Strategy
+            >
     >::type
 discrete_hausdorff_distance(Geometry1 const& geometry1,
                             Geometry2 const& geometry2,
@@ -310,6 +669,52 @@ discrete_hausdorff_distance(Geometry1 const& geometry1,
         >::apply(geometry1, geometry2, strategy);
 }
 
+/*!
+\brief Calculate discrete Hausdorff distance between two geometries using
+    specified strategy, with the points of the first geometry processed
+    according to an execution policy
+\ingroup discrete_hausdorff_distance
+\details The points of the first geometry are visited in a fixed random
+    order, and the search for the nearest point of the second geometry stops
+    as soon as a point nearer than the largest distance found so far is met
+    (early break of Taha and Hanbury). The result does not depend on the
+    policy.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\param policy Execution policy, sequenced or parallel
+
+\qbk{distinguish,with strategy and execution policy}
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Strategy, typename ExecutionPolicy
+>
+inline
+typename boost::lazy_enable_if_c
+    <
+        ! detail::discrete_hausdorff_distance::is_index<Geometry2>::value,
+        detail::discrete_hausdorff_distance::geometry_result
+            <
+                Geometry1, Geometry2, Strategy
+            >
+    >::type
+discrete_hausdorff_distance(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2,
+                            Strategy const& strategy,
+                            ExecutionPolicy const& policy)
+{
+    return dispatch::discrete_hausdorff_distance
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, strategy, policy);
+}
+
 /*!
 \brief Calculate discrete Hausdorff distance between two geometries (currently
     works for LineString-LineString, MultiPoint-MultiPoint, Point-MultiPoint,
@@ -330,10 +735,13 @@ discrete_hausdorff_distance(Geometry1 const& geometry1,
 */
 template <typename Geometry1, typename Geometry2>
 inline
-typename distance_result
+typename boost::lazy_enable_if_c
     <
-        typename point_type<Geometry1>::type,
-        typename point_type<Geometry2>::type
+        ! detail::discrete_hausdorff_distance::is_index<Geometry2>::value,
+        detail::discrete_hausdorff_distance::geometry_result
+            <
+                Geometry1, Geometry2
+            >
     >::type
 discrete_hausdorff_distance(Geometry1 const& geometry1,
                             Geometry2 const& geometry2)
@@ -348,6 +756,142 @@ discrete_hausdorff_distance(Geometry1 const& geometry1,
     return discrete_hausdorff_distance(geometry1, geometry2, strategy_type());
 }
 
+/*!
+\brief Calculate directed discrete Hausdorff distance from the points of a
+    linestring or multi point to the points stored in a spatial index, using
+    specified strategy and execution policy
+\ingroup discrete_hausdorff_distance
+\details The index is built once and can be reused to compare many
+    geometries to the same reference set. The nearest value of each point
+    of the geometry is queried.
+\tparam Geometry \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry Input geometry
+\param rtree Spatial index of the points of the reference set
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\param policy Execution policy, sequenced or parallel
+
+\qbk{distinguish,with spatial index}
+*/
+template
+<
+    typename Geometry,
+    typename Value, typename Options, typename IndexableGetter,
+    typename EqualTo, typename Allocator,
+    typename Strategy, typename ExecutionPolicy
+>
+inline
+typename distance_result
+    <
+        typename point_type<Geometry>::type,
+        typename index::rtree
+            <
+                Value, Options, IndexableGetter, EqualTo, Allocator
+            >::indexable_type,
+        Strategy
+    >::type
+discrete_hausdorff_distance(Geometry const& geometry,
+                            index::rtree
+                                <
+                                    Value, Options, IndexableGetter,
+                                    EqualTo, Allocator
+                                > const& rtree,
+                            Strategy const& strategy,
+                            ExecutionPolicy const& policy)
+{
+    return detail::discrete_hausdorff_distance::range_index::apply(geometry,
+                rtree, strategy, policy);
+}
+
+/*!
+\brief Calculate directed discrete Hausdorff distance from the points of a
+    linestring or multi point to the points stored in a spatial index, using
+    specified strategy
+\ingroup discrete_hausdorff_distance
+\tparam Geometry \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param geometry Input geometry
+\param rtree Spatial index of the points of the reference set
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+
+\qbk{distinguish,with spatial index and strategy}
+*/
+template
+<
+    typename Geometry,
+    typename Value, typename Options, typename IndexableGetter,
+    typename EqualTo, typename Allocator,
+    typename Strategy
+>
+inline
+typename distance_result
+    <
+        typename point_type<Geometry>::type,
+        typename index::rtree
+            <
+                Value, Options, IndexableGetter, EqualTo, Allocator
+            >::indexable_type,
+        Strategy
+    >::type
+discrete_hausdorff_distance(Geometry const& geometry,
+                            index::rtree
+                                <
+                                    Value, Options, IndexableGetter,
+                                    EqualTo, Allocator
+                                > const& rtree,
+                            Strategy const& strategy)
+{
+    return detail::discrete_hausdorff_distance::range_index::apply(geometry,
+                rtree, strategy, execution::sequenced_policy());
+}
+
+/*!
+\brief Calculate directed discrete Hausdorff distance from the points of a
+    linestring or multi point to the points stored in a spatial index
+\ingroup discrete_hausdorff_distance
+\tparam Geometry \tparam_geometry
+\param geometry Input geometry
+\param rtree Spatial index of the points of the reference set
+
+\qbk{distinguish,with spatial index}
+*/
+template
+<
+    typename Geometry,
+    typename Value, typename Options, typename IndexableGetter,
+    typename EqualTo, typename Allocator
+>
+inline
+typename distance_result
+    <
+        typename point_type<Geometry>::type,
+        typename index::rtree
+            <
+                Value, Options, IndexableGetter, EqualTo, Allocator
+            >::indexable_type
+    >::type
+discrete_hausdorff_distance(Geometry const& geometry,
+                            index::rtree
+                                <
+                                    Value, Options, IndexableGetter,
+                                    EqualTo, Allocator
+                                > const& rtree)
+{
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag,
+            typename point_type<Geometry>::type,
+            typename index::rtree
+                <
+                    Value, Options, IndexableGetter, EqualTo, Allocator
+                >::indexable_type
+        >::type strategy_type;
+
+    return detail::discrete_hausdorff_distance::range_index::apply(geometry,
+                rtree, strategy_type(), execution::sequenced_policy());
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
@@ -0,0 +1,544 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/closest_points/point_to_segment.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+#include <boost/geometry/algorithms/detail/distance/iterator_selector.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/index.hpp>
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Spatial index of a geometry, answering repeated distance queries
+    of points to that geometry
+\ingroup distance
+\details The segments (or, for a multi-point, the points) of the geometry
+    are packed into an rtree once, on construction. Each query then finds
+    the nearest segment using the rtree, instead of building an rtree or
+    visiting all segments as the distance algorithm does for every call.
+    For areal geometries, points inside the geometry have distance zero.
+    In cartesian coordinate systems, this is also checked using the rtree.
+    Queries do not modify the index, so they can be issued concurrently,
+    and batches of points can be processed according to an execution
+    policy.
+\tparam Geometry \tparam_geometry, a linestring, ring, polygon,
+    multi-point, multi-linestring or multi-polygon
+\tparam Strategy \tparam_strategy{Distance}, the point-segment strategy
+    (or point-point strategy, for a multi-point). By default the strategy
+    of the distance algorithm is used.
+\note The geometry is referred to and should outlive the index, and should
+    not be modified while the index is used
+*/
+template <typename Geometry, typename Strategy = default_strategy>
+class distance_index
+{
+    typedef typename geometry::point_type<Geometry>::type geometry_point_type;
+
+    typedef detail::distance::iterator_selector<Geometry const> selector_type;
+
+    // A (pointing) segment, or a point for a multi-point
+    typedef typename std::iterator_traits
+        <
+            typename selector_type::iterator_type
+        >::value_type value_type;
+
+    typedef boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+            areal_tag
+        > is_areal;
+
+public :
+
+    typedef typename boost::mpl::if_
+        <
+            boost::is_same<Strategy, default_strategy>,
+            typename detail::distance::default_strategy
+                <
+                    geometry_point_type, Geometry
+                >::type,
+            Strategy
+        >::type strategy_type;
+
+    typedef typename strategy::distance::services::comparable_type
+        <
+            strategy_type
+        >::type comparable_strategy_type;
+
+    typedef model::segment<geometry_point_type> segment_type;
+
+    template <typename Point>
+    struct distance_type
+        : strategy::distance::services::return_type
+            <
+                strategy_type, Point, geometry_point_type
+            >
+    {};
+
+    template <typename Point>
+    struct comparable_distance_type
+        : strategy::distance::services::return_type
+            <
+                comparable_strategy_type, Point, geometry_point_type
+            >
+    {};
+
+private :
+
+    typedef strategy::index::services::from_strategy
+        <
+            strategy_type
+        > index_strategy_from;
+
+    typedef index::parameters
+        <
+            index::rstar<16>, typename index_strategy_from::type
+        > index_parameters_type;
+
+    typedef index::rtree<value_type, index_parameters_type> rtree_type;
+
+public :
+
+    /*!
+    \brief Builds the index of a geometry
+    \param geometry \param_geometry, which should outlive the index
+    \param strategy \param_strategy{distance}
+    \exception empty_input_exception if the geometry is empty
+    */
+    explicit inline distance_index(Geometry const& geometry,
+                                   Strategy const& strategy = Strategy())
+        : m_geometry(geometry)
+        , m_strategy(get_strategy(strategy))
+        , m_rtree(selector_type::begin(geometry), selector_type::end(geometry),
+                  index_parameters_type(index::rstar<16>(),
+                        index_strategy_from::get(m_strategy)))
+    {
+        concepts::check<Geometry const>();
+        detail::throw_on_empty_input(geometry);
+    }
+
+    //! Returns the distance of a point to the geometry
+    template <typename Point>
+    inline typename distance_type<Point>::type
+    distance(Point const& point) const
+    {
+        if (is_covered(point, is_areal()))
+        {
+            return typename distance_type<Point>::type(0);
+        }
+        return dispatch::distance
+            <
+                Point, value_type, strategy_type
+            >::apply(point, nearest(point), m_strategy);
+    }
+
+    //! Returns the comparable distance of a point to the geometry
+    template <typename Point>
+    inline typename comparable_distance_type<Point>::type
+    comparable_distance(Point const& point) const
+    {
+        if (is_covered(point, is_areal()))
+        {
+            return typename comparable_distance_type<Point>::type(0);
+        }
+        return dispatch::distance
+            <
+                Point, value_type, comparable_strategy_type
+            >::apply(point, nearest(point),
+                     strategy::distance::services::get_comparable
+                        <
+                            strategy_type
+                        >::apply(m_strategy));
+    }
+
+    /*!
+    \brief Calculates the shortest segment from a point to the geometry
+    \details The first point of the segment is the point, the second point
+        is the closest point of the geometry. A point inside an areal
+        geometry results in a degenerate segment.
+    */
+    template <typename Point, typename Segment>
+    inline void closest_points(Point const& point, Segment& segment) const
+    {
+        geometry::detail::assign_point_to_index<0>(point, segment);
+
+        typename geometry::point_type<Segment>::type closest;
+        if (is_covered(point, is_areal()))
+        {
+            geometry::convert(point, closest);
+        }
+        else
+        {
+            closest_point(point, nearest(point), closest,
+                          typename tag<value_type>::type());
+        }
+        geometry::detail::assign_point_to_index<1>(closest, segment);
+    }
+
+    /*!
+    \brief Calculates the distances of a range of points to the geometry
+    \param points Range of points
+    \param out Output iterator to which the distances are written, in the
+        order of the points
+    \return The output iterator after the last distance
+    */
+    template <typename Points, typename OutputIterator>
+    inline OutputIterator batch_distance(Points const& points,
+                                         OutputIterator out) const
+    {
+        return batch<distance_query>(points, out);
+    }
+
+    /*!
+    \brief Calculates the distances of a range of points to the geometry,
+        according to an execution policy
+    \param points Random access range of points
+    \param out Random access iterator to which the distances are written,
+        in the order of the points
+    \param policy Execution policy
+    \return The iterator after the last distance
+    */
+    template
+    <
+        typename Points, typename RandomAccessIterator,
+        typename ExecutionPolicy
+    >
+    inline RandomAccessIterator batch_distance(Points const& points,
+                                               RandomAccessIterator out,
+                                               ExecutionPolicy const& policy) const
+    {
+        return batch<distance_query>(points, out, policy);
+    }
+
+    //! Calculates the comparable distances of a range of points
+    template <typename Points, typename OutputIterator>
+    inline OutputIterator batch_comparable_distance(Points const& points,
+                                                    OutputIterator out) const
+    {
+        return batch<comparable_distance_query>(points, out);
+    }
+
+    //! Calculates the comparable distances of a random access range of
+    //! points, according to an execution policy
+    template
+    <
+        typename Points, typename RandomAccessIterator,
+        typename ExecutionPolicy
+    >
+    inline RandomAccessIterator
+    batch_comparable_distance(Points const& points, RandomAccessIterator out,
+                              ExecutionPolicy const& policy) const
+    {
+        return batch<comparable_distance_query>(points, out, policy);
+    }
+
+    //! Calculates the shortest segments (of segment_type) of a range of
+    //! points to the geometry
+    template <typename Points, typename OutputIterator>
+    inline OutputIterator batch_closest_points(Points const& points,
+                                               OutputIterator out) const
+    {
+        return batch<closest_points_query>(points, out);
+    }
+
+    //! Calculates the shortest segments (of segment_type) of a random access
+    //! range of points, according to an execution policy
+    template
+    <
+        typename Points, typename RandomAccessIterator,
+        typename ExecutionPolicy
+    >
+    inline RandomAccessIterator
+    batch_closest_points(Points const& points, RandomAccessIterator out,
+                         ExecutionPolicy const& policy) const
+    {
+        return batch<closest_points_query>(points, out, policy);
+    }
+
+private :
+
+    struct distance_query
+    {
+        template <typename Point>
+        struct result : distance_type<Point> {};
+
+        template <typename Point>
+        static inline typename result<Point>::type
+        apply(distance_index const& index, Point const& point)
+        {
+            return index.distance(point);
+        }
+    };
+
+    struct comparable_distance_query
+    {
+        template <typename Point>
+        struct result : comparable_distance_type<Point> {};
+
+        template <typename Point>
+        static inline typename result<Point>::type
+        apply(distance_index const& index, Point const& point)
+        {
+            return index.comparable_distance(point);
+        }
+    };
+
+    struct closest_points_query
+    {
+        template <typename Point>
+        struct result
+        {
+            typedef segment_type type;
+        };
+
+        template <typename Point>
+        static inline segment_type
+        apply(distance_index const& index, Point const& point)
+        {
+            segment_type segment;
+            index.closest_points(point, segment);
+            return segment;
+        }
+    };
+
+    // Writes the results of the points of a chunk
+    template <typename Query, typename Points, typename Iterator>
+    struct batch_worker
+    {
+        inline batch_worker(distance_index const& index,
+                            Points const& points, Iterator out)
+            : m_index(index)
+            , m_points(points)
+            , m_out(out)
+        {}
+
+        inline void operator()(std::size_t , std::size_t first,
+                               std::size_t last) const
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                m_out[i] = Query::apply(m_index, range::at(m_points, i));
+            }
+        }
+
+        distance_index const& m_index;
+        Points const& m_points;
+        Iterator m_out;
+    };
+
+    template <typename Query, typename Points, typename OutputIterator>
+    inline OutputIterator batch(Points const& points,
+                                OutputIterator out) const
+    {
+        for (typename boost::range_iterator<Points const>::type
+                it = boost::begin(points); it != boost::end(points); ++it)
+        {
+            *out = Query::apply(*this, *it);
+            ++out;
+        }
+        return out;
+    }
+
+    template
+    <
+        typename Query, typename Points, typename RandomAccessIterator,
+        typename ExecutionPolicy
+    >
+    inline RandomAccessIterator batch(Points const& points,
+                                      RandomAccessIterator out,
+                                      ExecutionPolicy const& policy) const
+    {
+        std::size_t const count = boost::size(points);
+        geometry::detail::execution::for_each_chunk(count, policy,
+            batch_worker<Query, Points, RandomAccessIterator>(*this, points, out));
+        return out + count;
+    }
+
+    template <typename Point>
+    inline value_type nearest(Point const& point) const
+    {
+        value_type result;
+        std::size_t const n = m_rtree.query(index::nearest(point, 1), &result);
+        BOOST_GEOMETRY_ASSERT( n > 0 );
+        boost::ignore_unused(n);
+        return result;
+    }
+
+    template <typename Point>
+    inline bool is_covered(Point const& point, boost::true_type) const
+    {
+        return is_covered(point, m_strategy.get_point_in_geometry_strategy(),
+                          typename cs_tag<geometry_point_type>::type());
+    }
+
+    // The winding strategies on the sphere and spheroid handle rings
+    // containing a pole by the counts of a ring, so the counts of all rings
+    // can't be combined and the whole geometry is checked
+    template <typename Point, typename WithinStrategy, typename CSTag>
+    inline bool is_covered(Point const& point,
+                           WithinStrategy const& within_strategy, CSTag) const
+    {
+        return detail::within::covered_by_point_geometry(point, m_geometry,
+                                                         within_strategy);
+    }
+
+    // Only the segments crossing the vertical ray going down from the point,
+    // or containing the point, change the winding number. These are found in
+    // the rtree. For valid geometries the sum of the counts of all rings
+    // (the holes having the opposite orientation) is non-zero only inside.
+    template <typename Point, typename WithinStrategy>
+    inline bool is_covered(Point const& point,
+                           WithinStrategy const& within_strategy,
+                           cartesian_tag) const
+    {
+        typedef typename rtree_type::bounds_type box_type;
+        typedef typename coordinate_type<box_type>::type coord_t;
+
+        coord_t const x = geometry::get<0>(point);
+        coord_t const y = geometry::get<1>(point);
+
+        // The strategy compares coordinates with a tolerance, so segments
+        // ending within it from the ray (or the point) are included too
+        coord_t const eps = 2 * std::numeric_limits<coord_t>::epsilon();
+        coord_t const dx = eps * (std::max)(math::abs(x), coord_t(1));
+        coord_t const dy = eps * (std::max)(math::abs(y), coord_t(1));
+
+        box_type ray = m_rtree.bounds();
+        if (x + dx < geometry::get<min_corner, 0>(ray)
+            || x - dx > geometry::get<max_corner, 0>(ray)
+            || y + dy < geometry::get<min_corner, 1>(ray))
+        {
+            return false;
+        }
+        geometry::set<min_corner, 0>(ray, x - dx);
+        geometry::set<max_corner, 0>(ray, x + dx);
+        geometry::set<max_corner, 1>(ray, y + dy);
+
+        typename WithinStrategy::state_type state;
+        m_rtree.query(index::intersects(ray),
+                      boost::make_function_output_iterator(
+                          winding_visitor<Point, WithinStrategy>(point,
+                                within_strategy, state)));
+        return within_strategy.result(state) >= 0;
+    }
+
+    template <typename Point, typename WithinStrategy>
+    struct winding_visitor
+    {
+        inline winding_visitor(Point const& point,
+                               WithinStrategy const& strategy,
+                               typename WithinStrategy::state_type& state)
+            : m_point(point)
+            , m_strategy(strategy)
+            , m_state(state)
+        {}
+
+        inline void operator()(value_type const& segment) const
+        {
+            geometry_point_type p1, p2;
+            geometry::detail::assign_point_from_index<0>(segment, p1);
+            geometry::detail::assign_point_from_index<1>(segment, p2);
+            m_strategy.apply(m_point, p1, p2, m_state);
+        }
+
+        Point const& m_point;
+        WithinStrategy const& m_strategy;
+        typename WithinStrategy::state_type& m_state;
+    };
+
+    template <typename Point>
+    inline bool is_covered(Point const& , boost::false_type) const
+    {
+        return false;
+    }
+
+    template <typename Point, typename Result>
+    inline void closest_point(Point const& point, value_type const& segment,
+                              Result& result, segment_tag) const
+    {
+        geometry_point_type p1, p2;
+        geometry::detail::assign_point_from_index<0>(segment, p1);
+        geometry::detail::assign_point_from_index<1>(segment, p2);
+        detail::closest_points::point_to_segment
+            <
+                typename cs_tag<geometry_point_type>::type
+            >::apply(point, p1, p2, m_strategy, result);
+    }
+
+    template <typename Point, typename Result>
+    inline void closest_point(Point const& , value_type const& point,
+                              Result& result, point_tag) const
+    {
+        geometry::convert(point, result);
+    }
+
+    template <typename S>
+    static inline strategy_type get_strategy(S const& strategy)
+    {
+        return strategy;
+    }
+
+    static inline strategy_type get_strategy(default_strategy const& )
+    {
+        return strategy_type();
+    }
+
+    Geometry const& m_geometry;
+    strategy_type m_strategy;
+    rtree_type m_rtree;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
@@ -47,13 +47,17 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/block_sum.hpp>
 #include <boost/geometry/algorithms/detail/calculate_null.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/numbered_ranges.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
 #include <boost/geometry/strategies/default_strategy.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/default_length_result.hpp>
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/views/detail/range_type.hpp>
 
 
 namespace boost { namespace geometry
@@ -79,6 +83,48 @@ struct segment_length
         geometry::detail::assign_point_from_index<1>(segment, p2);
         return strategy.apply(p1, p2);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<Segment>::type apply(
+            Segment const& segment, Strategy const& strategy,
+            ExecutionPolicy const& )
+    {
+        return apply(segment, strategy);
+    }
+};
+
+/*!
+\brief Internal, calculates the length of all linestrings or rings of a
+    geometry according to an execution policy
+\details The segments are summed in blocks, the blocks are processed in
+    chunks and their sums are added pairwise. So the result does not depend
+    on the policy, but might differ slightly from the sequential sum.
+*/
+template <closure_selector Closure>
+struct segments_length
+{
+    template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type apply(
+            Geometry const& geometry, Strategy const& strategy,
+            ExecutionPolicy const& policy)
+    {
+        typedef typename default_length_result<Geometry>::type return_type;
+        typedef geometry::detail::block_sum::distance_term<Strategy> term_type;
+        typedef geometry::detail::block_sum::segment_sum
+            <
+                return_type, term_type
+            > kernel_type;
+
+        geometry::detail::numbered_segments
+            <
+                typename geometry::detail::range_type<Geometry>::type,
+                Closure
+            > segments;
+        geometry::detail::for_each_segment_range<Geometry>::apply(geometry,
+                                                                  segments);
+        return geometry::detail::block_sum::apply(segments,
+            kernel_type(term_type(strategy)), policy);
+    }
 };
 
 /*!
@@ -120,6 +166,14 @@ struct range_length
 
         return sum;
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline return_type apply(
+            Range const& range, Strategy const& strategy,
+            ExecutionPolicy const& policy)
+    {
+        return segments_length<Closure>::apply(range, strategy, policy);
+    }
 };
 
 
@@ -142,6 +196,14 @@ struct length : detail::calculate_null
     {
         return calculate_null::apply<return_type>(geometry, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline return_type apply(Geometry const& geometry,
+                                    Strategy const& strategy,
+                                    ExecutionPolicy const& )
+    {
+        return apply(geometry, strategy);
+    }
 };
 
 
@@ -178,6 +240,17 @@ struct length<MultiLinestring, multi_linestring_tag> : detail::multi_sum
                >(multi, strategy);
 
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<MultiLinestring>::type
+    apply(MultiLinestring const& multi, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return detail::length::segments_length
+            <
+                closed
+            >::apply(multi, strategy, policy);
+    }
 };
 
 
@@ -207,6 +280,28 @@ struct length
 
         return dispatch::length<Geometry>::apply(geometry, strategy_type());
     }
+
+    template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return dispatch::length<Geometry>::apply(geometry, strategy, policy);
+    }
+
+    template <typename Geometry, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, default_strategy,
+          ExecutionPolicy const& policy)
+    {
+        typedef typename strategy::distance::services::default_strategy
+            <
+                point_tag, point_tag, typename point_type<Geometry>::type
+            >::type strategy_type;
+
+        return dispatch::length<Geometry>::apply(geometry, strategy_type(),
+                                                 policy);
+    }
 };
 
 } // namespace resolve_strategy
@@ -223,6 +318,14 @@ struct length
     {
         return resolve_strategy::length::apply(geometry, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return resolve_strategy::length::apply(geometry, strategy, policy);
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
@@ -259,6 +362,39 @@ struct length<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
     {
         return boost::apply_visitor(visitor<Strategy>(strategy), geometry);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor
+        : static_visitor<result_type>
+    {
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(Strategy const& strategy, ExecutionPolicy const& policy)
+            : m_strategy(strategy)
+            , m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        inline typename default_length_result<Geometry>::type
+        operator()(Geometry const& geometry) const
+        {
+            return length<Geometry>::apply(geometry, m_strategy, m_policy);
+        }
+    };
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline result_type apply(
+        variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+        Strategy const& strategy,
+        ExecutionPolicy const& policy
+    )
+    {
+        return boost::apply_visitor(policy_visitor
+            <
+                Strategy, ExecutionPolicy
+            >(strategy, policy), geometry);
+    }
 };
 
 } // namespace resolve_variant
@@ -313,6 +449,37 @@ length(Geometry const& geometry, Strategy const& strategy)
 }
 
 
+/*!
+\brief \brief_calc{length} \brief_strategy, according to an execution policy
+\ingroup length
+\details \details_calc{length, length (the sum of distances between consecutive points)} \brief_strategy.
+    The segments are summed in blocks, which are processed in chunks
+    according to the execution policy, sequenced or parallel. The sums of
+    the blocks are added pairwise in a fixed order, so the result does not
+    depend on the policy.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{distance}
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry \param_geometry
+\param strategy \param_strategy{distance}
+\param policy Execution policy
+\return \return_calc{length}
+
+\qbk{distinguish,with strategy and execution policy}
+\qbk{[include reference/algorithms/length.qbk]}
+ */
+template<typename Geometry, typename Strategy, typename ExecutionPolicy>
+inline typename default_length_result<Geometry>::type
+length(Geometry const& geometry, Strategy const& strategy,
+       ExecutionPolicy const& policy)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_variant::length<Geometry>::apply(geometry, strategy,
+                                                    policy);
+}
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
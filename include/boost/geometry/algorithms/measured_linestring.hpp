@@ -0,0 +1,501 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_MEASURED_LINESTRING_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_MEASURED_LINESTRING_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include <boost/mpl/if.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/closest_points/point_to_segment.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/geographic/distance_cross_track.hpp>
+#include <boost/geometry/strategies/geographic/line_interpolate.hpp>
+#include <boost/geometry/strategies/line_interpolate.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace measured_linestring
+{
+
+
+// The data cached per segment, used to calculate points on the segment.
+// By default nothing is cached and the line_interpolate strategy is used
+template <typename Strategy, typename Point>
+class segment_table
+{
+public :
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag, Point, Point
+        >::type point_segment_strategy_type;
+
+    explicit inline segment_table(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    inline void reserve(std::size_t )
+    {}
+
+    inline void push_back(Point const& , Point const& )
+    {}
+
+    template <typename Fraction, typename Length>
+    inline void interpolate(std::size_t , Point const& p0, Point const& p1,
+                            Fraction const& fraction, Length const& length,
+                            Point& p) const
+    {
+        m_strategy.apply(p0, p1, fraction, p, length);
+    }
+
+    inline point_segment_strategy_type point_segment_strategy() const
+    {
+        return point_segment_strategy_type();
+    }
+
+private :
+    Strategy m_strategy;
+};
+
+// Geographic segments cache their geodesic line, such that a point is
+// calculated by the distance dependent part of the direct formula only
+template
+<
+    typename FormulaPolicy, typename Spheroid, typename CalculationType,
+    typename Point
+>
+class segment_table
+    <
+        strategy::line_interpolate::geographic
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >,
+        Point
+    >
+{
+    typedef typename select_calculation_type_alt
+        <
+            CalculationType,
+            Point
+        >::type calc_t;
+
+    typedef typename FormulaPolicy::template inverse
+        <
+            calc_t, false, true, false, false, false
+        > inverse_t;
+
+    typedef typename FormulaPolicy::template direct
+        <
+            calc_t, true, false, false, false
+        > direct_t;
+
+    typedef typename direct_t::line line_t;
+
+public :
+    typedef strategy::distance::geographic_cross_track
+        <
+            FormulaPolicy, Spheroid, CalculationType
+        > point_segment_strategy_type;
+
+    explicit inline segment_table(strategy::line_interpolate::geographic
+                                    <
+                                        FormulaPolicy, Spheroid, CalculationType
+                                    > const& strategy)
+        : m_spheroid(strategy.model())
+    {}
+
+    inline void reserve(std::size_t count)
+    {
+        m_lines.reserve(count);
+    }
+
+    inline void push_back(Point const& p0, Point const& p1)
+    {
+        calc_t const lon0 = get_as_radian<0>(p0);
+        calc_t const lat0 = get_as_radian<1>(p0);
+        calc_t const azimuth = inverse_t::apply(lon0, lat0,
+                                                get_as_radian<0>(p1),
+                                                get_as_radian<1>(p1),
+                                                m_spheroid).azimuth;
+        m_lines.push_back(line_t(lon0, lat0, azimuth, m_spheroid));
+    }
+
+    template <typename Fraction, typename Length>
+    inline void interpolate(std::size_t index, Point const& , Point const& ,
+                            Fraction const& fraction, Length const& length,
+                            Point& p) const
+    {
+        typename direct_t::result_type const
+            dir_r = m_lines[index].apply(length * fraction);
+
+        set_from_radian<0>(p, dir_r.lon2);
+        set_from_radian<1>(p, dir_r.lat2);
+    }
+
+    inline point_segment_strategy_type point_segment_strategy() const
+    {
+        return point_segment_strategy_type(m_spheroid);
+    }
+
+private :
+    Spheroid m_spheroid;
+    std::vector<line_t> m_lines;
+};
+
+
+}} // namespace detail::measured_linestring
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Linestring with precomputed cumulative lengths, answering repeated
+    interpolation and location queries
+\ingroup line_interpolate
+\details The cumulative length at each point of the linestring is
+    calculated once, on construction, as well as the geodesic line of each
+    segment in geographic coordinate systems. Positions along the
+    linestring are then found by a binary search of the cumulative
+    lengths, instead of measuring the segments for every call as
+    line_interpolate and densify do.
+\tparam Linestring \tparam_geometry
+\tparam Strategy A type fulfilling a LineInterpolatePointStrategy concept.
+    By default the strategy of line_interpolate is used.
+\note The linestring is referred to and should outlive the measured
+    linestring, and should not be modified while it is used
+*/
+template <typename Linestring, typename Strategy = default_strategy>
+class measured_linestring
+{
+    typedef typename geometry::point_type<Linestring>::type point_type;
+
+public :
+
+    typedef typename boost::mpl::if_
+        <
+            boost::is_same<Strategy, default_strategy>,
+            typename strategy::line_interpolate::services::default_strategy
+                <
+                    typename cs_tag<Linestring>::type
+                >::type,
+            Strategy
+        >::type strategy_type;
+
+    typedef typename strategy::distance::services::return_type
+        <
+            typename strategy_type::distance_pp_strategy::type,
+            point_type, point_type
+        >::type length_type;
+
+private :
+
+    typedef detail::measured_linestring::segment_table
+        <
+            strategy_type, point_type
+        > segment_table_type;
+
+public :
+
+    /*!
+    \brief Measures a linestring
+    \param linestring \param_geometry, which should outlive the measured
+        linestring
+    \param strategy line_interpolate strategy
+    \exception empty_input_exception if the linestring is empty
+    */
+    explicit inline measured_linestring(Linestring const& linestring,
+                                        Strategy const& strategy = Strategy())
+        : m_linestring(linestring)
+        , m_strategy(get_strategy(strategy))
+        , m_segments(m_strategy)
+    {
+        concepts::check<Linestring const>();
+        detail::throw_on_empty_input(linestring);
+
+        std::size_t const count = boost::size(linestring);
+        typename strategy_type::distance_pp_strategy::type const
+            pp_strategy = m_strategy.get_distance_pp_strategy();
+
+        m_lengths.reserve(count);
+        m_segments.reserve(count - 1);
+        m_lengths.push_back(length_type(0));
+        for (std::size_t i = 1; i < count; i++)
+        {
+            point_type const& p0 = range::at(linestring, i - 1);
+            point_type const& p1 = range::at(linestring, i);
+            m_lengths.push_back(m_lengths.back() + pp_strategy.apply(p0, p1));
+            m_segments.push_back(p0, p1);
+        }
+    }
+
+    //! Returns the length of the linestring
+    inline length_type length() const
+    {
+        return m_lengths.back();
+    }
+
+    /*!
+    \brief Calculates the point at a fraction of the length of the
+        linestring
+    \param fraction Fraction of the length, clamped to [0, 1]
+    \param point Output point
+    */
+    template <typename Fraction, typename Point>
+    inline void interpolate(Fraction const& fraction, Point& point) const
+    {
+        point_type p;
+        point_at(clamped(fraction) * length(), p);
+        geometry::convert(p, point);
+    }
+
+    /*!
+    \brief Calculates the fraction of the length of the linestring at
+        which its point closest to a point is located
+    \details The closest segment is searched linearly, its closest point
+        is measured from the start of that segment.
+    */
+    template <typename Point>
+    inline length_type locate(Point const& point) const
+    {
+        std::size_t const count = m_lengths.size();
+        if (count < 2 || ! (length() > length_type(0)))
+        {
+            return length_type(0);
+        }
+
+        typedef typename segment_table_type::point_segment_strategy_type
+            ps_strategy_type;
+        typedef typename strategy::distance::services::comparable_type
+            <
+                ps_strategy_type
+            >::type comparable_strategy_type;
+
+        ps_strategy_type const ps_strategy = m_segments.point_segment_strategy();
+        comparable_strategy_type const cstrategy
+            = strategy::distance::services::get_comparable
+                <
+                    ps_strategy_type
+                >::apply(ps_strategy);
+
+        std::size_t closest = 0;
+        typename strategy::distance::services::return_type
+            <
+                comparable_strategy_type, Point, point_type
+            >::type cd_min = cstrategy.apply(point,
+                                             range::at(m_linestring, 0),
+                                             range::at(m_linestring, 1));
+        for (std::size_t i = 1; i + 1 < count; i++)
+        {
+            typename strategy::distance::services::return_type
+                <
+                    comparable_strategy_type, Point, point_type
+                >::type const cd = cstrategy.apply(point,
+                                                   range::at(m_linestring, i),
+                                                   range::at(m_linestring, i + 1));
+            if (cd < cd_min)
+            {
+                cd_min = cd;
+                closest = i;
+            }
+        }
+
+        point_type const& p0 = range::at(m_linestring, closest);
+        point_type projected;
+        detail::closest_points::point_to_segment
+            <
+                typename cs_tag<point_type>::type
+            >::apply(point, p0, range::at(m_linestring, closest + 1),
+                     ps_strategy, projected);
+
+        length_type const along = m_lengths[closest]
+            + m_strategy.get_distance_pp_strategy().apply(p0, projected);
+        return (std::min)(along / length(), length_type(1));
+    }
+
+    /*!
+    \brief Extracts the part of the linestring between two fractions of
+        its length
+    \details The output starts and ends with the interpolated points, and
+        contains the points of the linestring in between. If the first
+        fraction is larger than the second, the output is reversed.
+    \param from Fraction at which the output starts, clamped to [0, 1]
+    \param to Fraction at which the output ends, clamped to [0, 1]
+    \param output Output linestring
+    */
+    template <typename Fraction, typename OutputLinestring>
+    inline void substring(Fraction const& from, Fraction const& to,
+                          OutputLinestring& output) const
+    {
+        bool const reverse = to < from;
+        length_type const d_from = clamped(reverse ? to : from) * length();
+        length_type const d_to = clamped(reverse ? from : to) * length();
+
+        geometry::clear(output);
+
+        point_type p;
+        point_at(d_from, p);
+        append(p, output);
+
+        std::size_t const first = std::upper_bound(m_lengths.begin(),
+                                    m_lengths.end(), d_from) - m_lengths.begin();
+        std::size_t const last = std::lower_bound(m_lengths.begin(),
+                                    m_lengths.end(), d_to) - m_lengths.begin();
+        for (std::size_t i = first; i < last; i++)
+        {
+            append(range::at(m_linestring, i), output);
+        }
+
+        point_at(d_to, p);
+        append(p, output);
+
+        if (reverse)
+        {
+            std::reverse(boost::begin(output), boost::end(output));
+        }
+    }
+
+    /*!
+    \brief Densifies the linestring, using the cached measures
+    \details Points are inserted evenly in each segment longer than the
+        maximum distance, as densify does.
+    \param output Output linestring
+    \param max_distance Distance threshold (in units depending on the
+        coordinate system)
+    \exception invalid_input_exception if the threshold is not positive
+    */
+    template <typename OutputLinestring, typename Distance>
+    inline void densify(OutputLinestring& output,
+                        Distance const& max_distance) const
+    {
+        if (max_distance <= Distance(0))
+        {
+            BOOST_THROW_EXCEPTION(geometry::invalid_input_exception());
+        }
+
+        geometry::clear(output);
+
+        std::size_t const count = m_lengths.size();
+        append(range::front(m_linestring), output);
+        for (std::size_t i = 0; i + 1 < count; i++)
+        {
+            length_type const segment_length = m_lengths[i + 1] - m_lengths[i];
+            std::size_t const n = segment_length > max_distance
+                ? std::size_t(segment_length / max_distance)
+                : 0;
+
+            point_type const& p0 = range::at(m_linestring, i);
+            point_type const& p1 = range::at(m_linestring, i + 1);
+            for (std::size_t k = 1; k <= n; k++)
+            {
+                point_type p;
+                m_segments.interpolate(i, p0, p1,
+                                       length_type(k) / length_type(n + 1),
+                                       segment_length, p);
+                append(p, output);
+            }
+            append(p1, output);
+        }
+    }
+
+private :
+
+    template <typename Fraction>
+    static inline length_type clamped(Fraction const& fraction)
+    {
+        length_type const f = fraction;
+        return f < length_type(0) ? length_type(0)
+             : f > length_type(1) ? length_type(1)
+             : f;
+    }
+
+    // Calculates the point at a distance from the start, the segment is
+    // found by a binary search of the cumulative lengths
+    inline void point_at(length_type const& distance, point_type& point) const
+    {
+        std::size_t const count = m_lengths.size();
+        if (count < 2)
+        {
+            point = range::front(m_linestring);
+            return;
+        }
+
+        std::size_t i = std::upper_bound(m_lengths.begin(), m_lengths.end(),
+                                         distance) - m_lengths.begin();
+        i = i == 0 ? 0 : (std::min)(i - 1, count - 2);
+
+        length_type const segment_length = m_lengths[i + 1] - m_lengths[i];
+        length_type const along = distance - m_lengths[i];
+        if (! (segment_length > length_type(0)) || along <= length_type(0))
+        {
+            point = range::at(m_linestring, i);
+        }
+        else if (along >= segment_length)
+        {
+            point = range::at(m_linestring, i + 1);
+        }
+        else
+        {
+            m_segments.interpolate(i, range::at(m_linestring, i),
+                                   range::at(m_linestring, i + 1),
+                                   along / segment_length, segment_length,
+                                   point);
+        }
+    }
+
+    template <typename OutputLinestring>
+    static inline void append(point_type const& point, OutputLinestring& output)
+    {
+        typename geometry::point_type<OutputLinestring>::type p;
+        geometry::convert(point, p);
+        range::push_back(output, p);
+    }
+
+    template <typename S>
+    static inline strategy_type get_strategy(S const& strategy)
+    {
+        return strategy;
+    }
+
+    static inline strategy_type get_strategy(default_strategy const& )
+    {
+        return strategy_type();
+    }
+
+    Linestring const& m_linestring;
+    strategy_type m_strategy;
+    segment_table_type m_segments;
+    std::vector<length_type> m_lengths;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_MEASURED_LINESTRING_HPP
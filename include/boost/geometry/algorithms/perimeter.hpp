@@ -55,6 +55,14 @@ struct perimeter : detail::calculate_null
     {
         return calculate_null::apply<return_type>(geometry, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline return_type apply(Geometry const& geometry,
+                                    Strategy const& strategy,
+                                    ExecutionPolicy const& )
+    {
+        return apply(geometry, strategy);
+    }
 };
 
 template <typename Geometry>
@@ -81,6 +89,17 @@ struct perimeter<Polygon, polygon_tag> : detail::calculate_polygon_sum
     {
         return calculate_polygon_sum::apply<return_type, policy>(polygon, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline return_type apply(Polygon const& polygon,
+                                    Strategy const& strategy,
+                                    ExecutionPolicy const& execution_policy)
+    {
+        return detail::length::segments_length
+            <
+                closure<Polygon>::value
+            >::apply(polygon, strategy, execution_policy);
+    }
 };
 
 template <typename MultiPolygon>
@@ -97,6 +116,17 @@ struct perimeter<MultiPolygon, multi_polygon_tag> : detail::multi_sum
                    perimeter<typename boost::range_value<MultiPolygon>::type>
                >(multi, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline return_type apply(MultiPolygon const& multi,
+                                    Strategy const& strategy,
+                                    ExecutionPolicy const& policy)
+    {
+        return detail::length::segments_length
+            <
+                closure<MultiPolygon>::value
+            >::apply(multi, strategy, policy);
+    }
 };
 
 
@@ -128,6 +158,28 @@ struct perimeter
 
         return dispatch::perimeter<Geometry>::apply(geometry, strategy_type());
     }
+
+    template <typename Geometry, typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        return dispatch::perimeter<Geometry>::apply(geometry, strategy, policy);
+    }
+
+    template <typename Geometry, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, default_strategy,
+          ExecutionPolicy const& policy)
+    {
+        typedef typename strategy::distance::services::default_strategy
+            <
+                point_tag, point_tag, typename point_type<Geometry>::type
+            >::type strategy_type;
+
+        return dispatch::perimeter<Geometry>::apply(geometry, strategy_type(),
+                                                    policy);
+    }
 };
 
 } // namespace resolve_strategy
@@ -145,6 +197,15 @@ struct perimeter
         concepts::check<Geometry const>();
         return resolve_strategy::perimeter::apply(geometry, strategy);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        concepts::check<Geometry const>();
+        return resolve_strategy::perimeter::apply(geometry, strategy, policy);
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
@@ -177,6 +238,36 @@ struct perimeter<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
     {
         return boost::apply_visitor(visitor<Strategy>(strategy), geometry);
     }
+
+    template <typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor: boost::static_visitor<result_type>
+    {
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(Strategy const& strategy, ExecutionPolicy const& policy)
+            : m_strategy(strategy)
+            , m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        typename default_length_result<Geometry>::type
+        operator()(Geometry const& geometry) const
+        {
+            return perimeter<Geometry>::apply(geometry, m_strategy, m_policy);
+        }
+    };
+
+    template <typename Strategy, typename ExecutionPolicy>
+    static inline result_type
+    apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+          Strategy const& strategy, ExecutionPolicy const& policy)
+    {
+        return boost::apply_visitor(policy_visitor
+            <
+                Strategy, ExecutionPolicy
+            >(strategy, policy), geometry);
+    }
 };
 
 } // namespace resolve_variant
@@ -228,6 +319,34 @@ inline typename default_length_result<Geometry>::type perimeter(
     return resolve_variant::perimeter<Geometry>::apply(geometry, strategy);
 }
 
+/*!
+\brief \brief_calc{perimeter} \brief_strategy, according to an execution
+    policy
+\ingroup perimeter
+\details The function perimeter returns the perimeter of a geometry,
+    using specified strategy. The segments of the rings are summed in
+    blocks, which are processed in chunks according to the execution
+    policy. The result does not depend on the policy.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{distance}
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry \param_geometry
+\param strategy strategy to be used for distance calculations.
+\param policy Execution policy
+\return \return_calc{perimeter}
+
+\qbk{distinguish,with strategy and execution policy}
+\qbk{[include reference/algorithms/perimeter.qbk]}
+ */
+template<typename Geometry, typename Strategy, typename ExecutionPolicy>
+inline typename default_length_result<Geometry>::type perimeter(
+        Geometry const& geometry, Strategy const& strategy,
+        ExecutionPolicy const& policy)
+{
+    return resolve_variant::perimeter<Geometry>::apply(geometry, strategy,
+                                                       policy);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_PERIMETER_HPP
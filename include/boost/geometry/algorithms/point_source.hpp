@@ -0,0 +1,1071 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_POINT_SOURCE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_POINT_SOURCE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_source.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/register/point_source.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+
+#include <boost/geometry/strategies/area.hpp>
+#include <boost/geometry/strategies/centroid.hpp>
+#include <boost/geometry/strategies/default_length_result.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace point_source
+{
+
+//! Number of points read from a source at once
+static const std::size_t chunk_size = 4096;
+
+//! Number of points of a linestring or ring simplified at once
+static const std::size_t simplify_block_size = 1 << 16;
+
+template <typename Geometry>
+struct is_point_source
+    : boost::is_same<typename tag<Geometry>::type, point_source_tag>
+{};
+
+inline bool is_connected(point_source_part kind)
+{
+    return kind != part_points;
+}
+
+inline bool is_ring(point_source_part kind)
+{
+    return kind == part_exterior_ring || kind == part_interior_ring;
+}
+
+/*!
+\brief Internal, reads all parts of a source in chunks and hands them to
+    a visitor: begin_part(kind), apply(first, last) for every chunk and
+    end_part()
+*/
+template <typename Source, typename Visitor>
+inline void visit(Source& source, Visitor& visitor)
+{
+    typedef typename geometry::point_type<Source>::type point_type;
+
+    std::vector<point_type> chunk(chunk_size);
+    point_source_part kind = part_points;
+    while (source.next_part(kind))
+    {
+        visitor.begin_part(kind);
+        std::size_t count = 0;
+        while ((count = source.read(&chunk[0], chunk_size)) > 0)
+        {
+            point_type const* const first = &chunk[0];
+            visitor.apply(first, first + count);
+        }
+        visitor.end_part();
+    }
+}
+
+/*!
+\brief Internal, keeps the last point of a chunk, such that segments
+    continue over the chunks of a part
+*/
+template <typename Point>
+struct previous_point
+{
+    previous_point()
+        : m_valid(false)
+    {
+        geometry::assign_zero(m_point);
+    }
+
+    inline void reset()
+    {
+        m_valid = false;
+    }
+
+    // Calls f(p1, p2) for all segments of the chunk, and the one before it
+    template <typename Functor>
+    inline void apply(Point const* first, Point const* last, Functor& f)
+    {
+        if (first == last)
+        {
+            return;
+        }
+        if (m_valid)
+        {
+            f(m_point, *first);
+        }
+        for (Point const* it = first + 1; it != last; ++it)
+        {
+            f(*(it - 1), *it);
+        }
+        m_point = *(last - 1);
+        m_valid = true;
+    }
+
+    Point m_point;
+    bool m_valid;
+};
+
+template <typename Functor>
+struct point_visitor
+{
+    explicit point_visitor(Functor& f)
+        : m_f(f)
+    {}
+
+    inline void begin_part(point_source_part) {}
+    inline void end_part() {}
+
+    template <typename Point>
+    inline void apply(Point const* first, Point const* last)
+    {
+        for (; first != last; ++first)
+        {
+            m_f(*first);
+        }
+    }
+
+    Functor& m_f;
+};
+
+template <typename Point, typename Functor>
+struct segment_visitor
+{
+    explicit segment_visitor(Functor& f)
+        : m_f(f)
+        , m_connected(false)
+    {}
+
+    inline void begin_part(point_source_part kind)
+    {
+        m_connected = is_connected(kind);
+        m_previous.reset();
+    }
+
+    inline void end_part() {}
+
+    inline void apply(Point const* first, Point const* last)
+    {
+        if (m_connected)
+        {
+            m_previous.apply(first, last, *this);
+        }
+    }
+
+    inline void operator()(Point const& p1, Point const& p2)
+    {
+        model::referring_segment<Point const> const segment(p1, p2);
+        m_f(segment);
+    }
+
+    Functor& m_f;
+    bool m_connected;
+    previous_point<Point> m_previous;
+};
+
+struct count_visitor
+{
+    count_visitor()
+        : m_count(0)
+    {}
+
+    inline void begin_part(point_source_part) {}
+    inline void end_part() {}
+
+    template <typename Point>
+    inline void apply(Point const* first, Point const* last)
+    {
+        m_count += std::size_t(last - first);
+    }
+
+    std::size_t m_count;
+};
+
+template <typename Box>
+struct envelope_visitor
+{
+    explicit envelope_visitor(Box& box)
+        : m_box(box)
+    {
+        geometry::assign_inverse(m_box);
+    }
+
+    inline void begin_part(point_source_part) {}
+    inline void end_part() {}
+
+    template <typename Point>
+    inline void apply(Point const* first, Point const* last)
+    {
+        for (; first != last; ++first)
+        {
+            geometry::expand(m_box, *first);
+        }
+    }
+
+    Box& m_box;
+};
+
+/*!
+\brief Internal, sums the distances between the points of the parts for
+    which Predicate holds: linestrings for the length, rings for the
+    perimeter
+*/
+template <typename Point, typename Strategy, typename Result>
+struct sum_visitor
+{
+    sum_visitor(Strategy const& strategy, bool (*predicate)(point_source_part))
+        : m_strategy(strategy)
+        , m_predicate(predicate)
+        , m_active(false)
+        , m_sum()
+    {}
+
+    inline void begin_part(point_source_part kind)
+    {
+        m_active = m_predicate(kind);
+        m_previous.reset();
+    }
+
+    inline void end_part() {}
+
+    inline void apply(Point const* first, Point const* last)
+    {
+        if (m_active)
+        {
+            m_previous.apply(first, last, *this);
+        }
+    }
+
+    inline void operator()(Point const& p1, Point const& p2)
+    {
+        m_sum += m_strategy.apply(p1, p2);
+    }
+
+    Strategy const& m_strategy;
+    bool (*m_predicate)(point_source_part);
+    bool m_active;
+    Result m_sum;
+    previous_point<Point> m_previous;
+};
+
+inline bool is_linestring(point_source_part kind)
+{
+    return kind == part_linestring;
+}
+
+template <typename Source, typename Strategy>
+struct area_visitor
+{
+    typedef typename geometry::point_type<Source>::type point_type;
+    typedef typename area_result<Source, Strategy>::type result_type;
+    typedef typename Strategy::template state<Source> state_type;
+
+    explicit area_visitor(Strategy const& strategy)
+        : m_strategy(strategy)
+        , m_active(false)
+        , m_sum()
+    {}
+
+    inline void begin_part(point_source_part kind)
+    {
+        m_active = is_ring(kind);
+        m_state = state_type();
+        m_previous.reset();
+    }
+
+    inline void end_part()
+    {
+        if (m_active)
+        {
+            m_sum += m_strategy.result(m_state);
+        }
+    }
+
+    inline void apply(point_type const* first, point_type const* last)
+    {
+        if (m_active)
+        {
+            m_previous.apply(first, last, *this);
+        }
+    }
+
+    inline void operator()(point_type const& p1, point_type const& p2)
+    {
+        m_strategy.apply(p1, p2, m_state);
+    }
+
+    inline result_type result() const
+    {
+        // The strategies return positive areas for clockwise rings
+        return geometry::point_order<Source>::value == counterclockwise
+            ? -m_sum : m_sum;
+    }
+
+    Strategy const& m_strategy;
+    bool m_active;
+    result_type m_sum;
+    state_type m_state;
+    previous_point<point_type> m_previous;
+};
+
+/*!
+\brief Internal, collects the centroid of the areal, linear and pointlike
+    parts at once, because the kinds of the parts are only known after
+    reading them. The centroid of the rings is returned if they have an
+    area, otherwise the one of the linestrings or of the ring boundaries,
+    otherwise the average of the points.
+*/
+template <typename Source, typename Point>
+struct centroid_visitor
+{
+    typedef typename geometry::point_type<Source>::type point_type;
+    typedef typename cs_tag<Source>::type cs_tag_type;
+    static const std::size_t dimension_count = geometry::dimension<Source>::value;
+
+    typedef typename strategy::centroid::services::default_strategy
+        <
+            cs_tag_type, areal_tag, dimension_count, Point, Source
+        >::type areal_strategy;
+    typedef typename strategy::centroid::services::default_strategy
+        <
+            cs_tag_type, linear_tag, dimension_count, Point, Source
+        >::type linear_strategy;
+    typedef typename strategy::centroid::services::default_strategy
+        <
+            cs_tag_type, pointlike_tag, dimension_count, Point, Source
+        >::type pointlike_strategy;
+
+    centroid_visitor()
+        : m_kind(part_points)
+        , m_rings(false)
+        , m_linestrings(false)
+    {}
+
+    inline void begin_part(point_source_part kind)
+    {
+        m_kind = kind;
+        m_rings = m_rings || is_ring(kind);
+        m_linestrings = m_linestrings || kind == part_linestring;
+        m_previous.reset();
+    }
+
+    inline void end_part() {}
+
+    inline void apply(point_type const* first, point_type const* last)
+    {
+        for (point_type const* it = first; it != last; ++it)
+        {
+            pointlike_strategy::apply(*it, m_points);
+        }
+        if (is_connected(m_kind))
+        {
+            m_previous.apply(first, last, *this);
+        }
+    }
+
+    inline void operator()(point_type const& p1, point_type const& p2)
+    {
+        if (m_kind == part_linestring)
+        {
+            linear_strategy::apply(p1, p2, m_linear);
+        }
+        else
+        {
+            areal_strategy::apply(p1, p2, m_areal);
+            linear_strategy::apply(p1, p2, m_boundary);
+        }
+    }
+
+    inline bool result(Point& centroid) const
+    {
+        if (m_rings && areal_strategy::result(m_areal, centroid))
+        {
+            return true;
+        }
+        if (m_linestrings && linear_strategy::result(m_linear, centroid))
+        {
+            return true;
+        }
+        if (m_rings && linear_strategy::result(m_boundary, centroid))
+        {
+            return true;
+        }
+        return pointlike_strategy::result(m_points, centroid);
+    }
+
+    point_source_part m_kind;
+    bool m_rings;
+    bool m_linestrings;
+    typename areal_strategy::state_type m_areal;
+    typename linear_strategy::state_type m_linear;
+    typename linear_strategy::state_type m_boundary;
+    typename pointlike_strategy::state_type m_points;
+    previous_point<point_type> m_previous;
+};
+
+
+/*!
+\brief Internal, adds a simplified part to the output geometry. The index
+    is the number of the part within the output: the number of the
+    linestring, or the number of the polygon for its rings. Single
+    geometries take the first part of their kind.
+*/
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct simplify_output : not_implemented<Tag>
+{};
+
+template <typename Linestring>
+struct simplify_output<Linestring, linestring_tag>
+{
+    template <typename Points>
+    static inline void apply(Linestring& out, point_source_part kind,
+                             std::size_t index, Points const& points)
+    {
+        if (kind == part_linestring && index == 0)
+        {
+            std::copy(points.begin(), points.end(), range::back_inserter(out));
+        }
+    }
+};
+
+template <typename Ring>
+struct simplify_output<Ring, ring_tag>
+{
+    template <typename Points>
+    static inline void apply(Ring& out, point_source_part kind,
+                             std::size_t index, Points const& points)
+    {
+        if (kind == part_exterior_ring && index == 0)
+        {
+            std::copy(points.begin(), points.end(), range::back_inserter(out));
+        }
+    }
+};
+
+template <typename Polygon>
+struct simplify_output<Polygon, polygon_tag>
+{
+    template <typename Points>
+    static inline void apply(Polygon& out, point_source_part kind,
+                             std::size_t index, Points const& points)
+    {
+        if (index != 0)
+        {
+            return;
+        }
+        if (kind == part_exterior_ring)
+        {
+            typename ring_return_type<Polygon>::type
+                exterior = exterior_ring(out);
+            std::copy(points.begin(), points.end(), range::back_inserter(exterior));
+        }
+        else if (kind == part_interior_ring)
+        {
+            typename interior_return_type<Polygon>::type
+                interiors = interior_rings(out);
+            range::resize(interiors, boost::size(interiors) + 1);
+            std::copy(points.begin(), points.end(),
+                      range::back_inserter(range::back(interiors)));
+        }
+    }
+};
+
+template <typename MultiPoint>
+struct simplify_output<MultiPoint, multi_point_tag>
+{
+    template <typename Points>
+    static inline void apply(MultiPoint& out, point_source_part kind,
+                             std::size_t , Points const& points)
+    {
+        if (kind == part_points)
+        {
+            std::copy(points.begin(), points.end(), range::back_inserter(out));
+        }
+    }
+};
+
+template <typename MultiLinestring>
+struct simplify_output<MultiLinestring, multi_linestring_tag>
+{
+    template <typename Points>
+    static inline void apply(MultiLinestring& out, point_source_part kind,
+                             std::size_t , Points const& points)
+    {
+        if (kind == part_linestring)
+        {
+            range::resize(out, boost::size(out) + 1);
+            std::copy(points.begin(), points.end(),
+                      range::back_inserter(range::back(out)));
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct simplify_output<MultiPolygon, multi_polygon_tag>
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    template <typename Points>
+    static inline void apply(MultiPolygon& out, point_source_part kind,
+                             std::size_t , Points const& points)
+    {
+        if (kind == part_exterior_ring)
+        {
+            range::resize(out, boost::size(out) + 1);
+        }
+        if (is_ring(kind) && ! boost::empty(out))
+        {
+            simplify_output<polygon_type>::apply(range::back(out), kind,
+                                                 0, points);
+        }
+    }
+};
+
+/*!
+\brief Internal, simplifies the linestrings and rings of a source block by
+    block, each block starting with the last point kept of the previous
+    block. Rings which collapse, or whose area changes sign, are skipped.
+    If an exterior ring is skipped, its interior rings are skipped too.
+*/
+template <typename Source, typename Geometry, typename Distance, typename Strategy>
+struct simplify_visitor
+{
+    typedef typename geometry::point_type<Source>::type point_type;
+    typedef std::vector<point_type> points_type;
+    typedef typename strategy::area::services::default_strategy
+        <
+            typename cs_tag<Source>::type
+        >::type area_strategy;
+    typedef typename area_strategy::template state<Source> area_state;
+
+    simplify_visitor(Geometry& out, Distance const& max_distance,
+                     Strategy const& strategy)
+        : m_out(out)
+        , m_max_distance(max_distance)
+        , m_strategy(strategy)
+        , m_kind(part_points)
+        , m_linestrings(0)
+        , m_polygons(0)
+        , m_skip(false)
+    {}
+
+    inline void begin_part(point_source_part kind)
+    {
+        m_kind = kind;
+        if (kind == part_exterior_ring)
+        {
+            m_skip = false;
+        }
+        m_input_area = area_state();
+        m_previous.reset();
+        m_block.clear();
+        m_result.clear();
+    }
+
+    inline void apply(point_type const* first, point_type const* last)
+    {
+        if (m_skip && m_kind == part_interior_ring)
+        {
+            return;
+        }
+        if (! is_connected(m_kind))
+        {
+            m_result.insert(m_result.end(), first, last);
+            return;
+        }
+        if (is_ring(m_kind))
+        {
+            m_previous.apply(first, last, *this);
+        }
+        for (; first != last; ++first)
+        {
+            m_block.push_back(*first);
+            if (m_block.size() == simplify_block_size)
+            {
+                flush();
+            }
+        }
+    }
+
+    inline void end_part()
+    {
+        if (m_skip && m_kind == part_interior_ring)
+        {
+            return;
+        }
+        if (m_block.size() > 1 || m_result.empty())
+        {
+            flush();
+        }
+
+        if (m_kind == part_linestring)
+        {
+            typedef typename Strategy::distance_strategy_type
+                ::equals_point_point_strategy_type equals_strategy_type;
+
+            // Verify the two remaining points are equal, as in simplify_range
+            if (detail::simplify::is_degenerate(m_result, equals_strategy_type()))
+            {
+                m_result.resize(1);
+            }
+            simplify_output<Geometry>::apply(m_out, m_kind, m_linestrings++, m_result);
+            return;
+        }
+        if (is_ring(m_kind) && ! valid_ring())
+        {
+            m_skip = m_skip || m_kind == part_exterior_ring;
+            return;
+        }
+        if (m_kind == part_exterior_ring)
+        {
+            ++m_polygons;
+        }
+        else if (m_kind == part_interior_ring && m_polygons == 0)
+        {
+            return;
+        }
+        simplify_output<Geometry>::apply(m_out, m_kind,
+                m_polygons > 0 ? m_polygons - 1 : 0, m_result);
+    }
+
+    inline void operator()(point_type const& p1, point_type const& p2)
+    {
+        area_strategy::apply(p1, p2, m_input_area);
+    }
+
+private :
+
+    inline void flush()
+    {
+        if (m_block.empty())
+        {
+            return;
+        }
+        m_simplified.clear();
+        detail::simplify::simplify_range_insert::apply(m_block,
+                std::back_inserter(m_simplified), m_max_distance, m_strategy);
+
+        // The first point is the last one of the previous block
+        m_result.insert(m_result.end(),
+                        m_result.empty()
+                            ? m_simplified.begin()
+                            : m_simplified.begin() + 1,
+                        m_simplified.end());
+
+        point_type const back = m_block.back();
+        m_block.clear();
+        m_block.push_back(back);
+    }
+
+    template <typename Area>
+    static inline int sign(Area const& area)
+    {
+        return area > 0 ? 1 : area < 0 ? -1 : 0;
+    }
+
+    inline bool valid_ring()
+    {
+        if (m_result.size() < 4)
+        {
+            return false;
+        }
+        area_state output_area;
+        for (std::size_t i = 1; i < m_result.size(); ++i)
+        {
+            area_strategy::apply(m_result[i - 1], m_result[i], output_area);
+        }
+        return sign(area_strategy::result(output_area))
+            == sign(area_strategy::result(m_input_area));
+    }
+
+    Geometry& m_out;
+    Distance const& m_max_distance;
+    Strategy const& m_strategy;
+    point_source_part m_kind;
+    std::size_t m_linestrings;
+    std::size_t m_polygons;
+    bool m_skip;
+    area_state m_input_area;
+    previous_point<point_type> m_previous;
+    points_type m_block;
+    points_type m_simplified;
+    points_type m_result;
+};
+
+
+}} // namespace detail::point_source
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Source>
+struct for_each_point<Source, point_source_tag>
+{
+    template <typename Functor>
+    static inline void apply(Source& source, Functor& f)
+    {
+        detail::point_source::point_visitor<Functor> visitor(f);
+        detail::point_source::visit(source, visitor);
+    }
+};
+
+template <typename Source>
+struct for_each_segment<Source, point_source_tag>
+{
+    template <typename Functor>
+    static inline void apply(Source& source, Functor& f)
+    {
+        detail::point_source::segment_visitor
+            <
+                typename point_type<Source>::type, Functor
+            > visitor(f);
+        detail::point_source::visit(source, visitor);
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief \brief_calc{envelope} of the points of a point source
+\ingroup envelope
+\details The source is read once, chunk by chunk.
+\tparam Source \tparam_geometry{point source}
+\tparam Box \tparam_box
+\param source A point source, consumed by the call
+\param mbr \param_box \param_set{envelope}
+*/
+template <typename Source, typename Box>
+inline typename boost::enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value
+    >::type
+envelope(Source& source, Box& mbr)
+{
+    concepts::check<Source>();
+    concepts::check<Box>();
+
+    detail::point_source::envelope_visitor<Box> visitor(mbr);
+    detail::point_source::visit(source, visitor);
+}
+
+
+/*!
+\brief \brief_calc{length} of the linestrings of a point source
+\ingroup length
+\details The source is read once, chunk by chunk. Rings are not counted,
+    like the length of a polygon is zero.
+\tparam Source \tparam_geometry{point source}
+\tparam Strategy \tparam_strategy{distance}
+\param source A point source, consumed by the call
+\param strategy \param_strategy{distance}
+\return \return_calc{length}
+*/
+template <typename Source, typename Strategy>
+inline typename boost::lazy_enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        default_length_result<Source>
+    >::type
+length(Source& source, Strategy const& strategy)
+{
+    concepts::check<Source>();
+
+    detail::point_source::sum_visitor
+        <
+            typename point_type<Source>::type, Strategy,
+            typename default_length_result<Source>::type
+        > visitor(strategy, &detail::point_source::is_linestring);
+    detail::point_source::visit(source, visitor);
+    return visitor.m_sum;
+}
+
+
+/*!
+\brief \brief_calc{length} of the linestrings of a point source
+\ingroup length
+\tparam Source \tparam_geometry{point source}
+\param source A point source, consumed by the call
+\return \return_calc{length}
+*/
+template <typename Source>
+inline typename boost::lazy_enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        default_length_result<Source>
+    >::type
+length(Source& source)
+{
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag, typename point_type<Source>::type
+        >::type strategy_type;
+
+    return geometry::length(source, strategy_type());
+}
+
+
+/*!
+\brief \brief_calc{perimeter} of the rings of a point source
+\ingroup perimeter
+\details The source is read once, chunk by chunk.
+\tparam Source \tparam_geometry{point source}
+\tparam Strategy \tparam_strategy{distance}
+\param source A point source, consumed by the call
+\param strategy \param_strategy{distance}
+\return \return_calc{perimeter}
+*/
+template <typename Source, typename Strategy>
+inline typename boost::lazy_enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        default_length_result<Source>
+    >::type
+perimeter(Source& source, Strategy const& strategy)
+{
+    concepts::check<Source>();
+
+    detail::point_source::sum_visitor
+        <
+            typename point_type<Source>::type, Strategy,
+            typename default_length_result<Source>::type
+        > visitor(strategy, &detail::point_source::is_ring);
+    detail::point_source::visit(source, visitor);
+    return visitor.m_sum;
+}
+
+
+/*!
+\brief \brief_calc{perimeter} of the rings of a point source
+\ingroup perimeter
+\tparam Source \tparam_geometry{point source}
+\param source A point source, consumed by the call
+\return \return_calc{perimeter}
+*/
+template <typename Source>
+inline typename boost::lazy_enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        default_length_result<Source>
+    >::type
+perimeter(Source& source)
+{
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag, typename point_type<Source>::type
+        >::type strategy_type;
+
+    return geometry::perimeter(source, strategy_type());
+}
+
+
+/*!
+\brief \brief_calc{area} of the rings of a point source
+\ingroup area
+\details The source is read once, chunk by chunk. Exterior and interior
+    rings are summed with their orientation, as for a (multi) polygon.
+\tparam Source \tparam_geometry{point source}
+\tparam Strategy \tparam_strategy{Area}
+\param source A point source, consumed by the call
+\param strategy \param_strategy{area}
+\return \return_calc{area}
+*/
+template <typename Source, typename Strategy>
+inline typename boost::lazy_enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        area_result<Source, Strategy>
+    >::type
+area(Source& source, Strategy const& strategy)
+{
+    concepts::check<Source>();
+
+    detail::point_source::area_visitor<Source, Strategy> visitor(strategy);
+    detail::point_source::visit(source, visitor);
+    return visitor.result();
+}
+
+
+/*!
+\brief \brief_calc{area} of the rings of a point source
+\ingroup area
+\tparam Source \tparam_geometry{point source}
+\param source A point source, consumed by the call
+\return \return_calc{area}
+*/
+template <typename Source>
+inline typename boost::lazy_enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        area_result<Source, default_strategy>
+    >::type
+area(Source& source)
+{
+    typedef typename strategy::area::services::default_strategy
+        <
+            typename cs_tag<Source>::type
+        >::type strategy_type;
+
+    return geometry::area(source, strategy_type());
+}
+
+
+/*!
+\brief \brief_calc{number of points} of a point source
+\ingroup num_points
+\details The source is read once, chunk by chunk.
+\tparam Source \tparam_geometry{point source}
+\param source A point source, consumed by the call
+\return \return_calc{number of points}
+*/
+template <typename Source>
+inline typename boost::enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value,
+        std::size_t
+    >::type
+num_points(Source& source)
+{
+    concepts::check<Source>();
+
+    detail::point_source::count_visitor visitor;
+    detail::point_source::visit(source, visitor);
+    return visitor.m_count;
+}
+
+
+/*!
+\brief \brief_calc{centroid} of a point source
+\ingroup centroid
+\details The source is read once, chunk by chunk. The centroid is the one
+    of its rings if they have an area, otherwise the one of its linestrings
+    or of the ring boundaries, otherwise the average of its points.
+\tparam Source \tparam_geometry{point source}
+\tparam Point \tparam_point
+\param source A point source, consumed by the call
+\param c \param_point \param_set{centroid}
+\note An exception of type centroid_exception is thrown if the source is
+    empty (unless BOOST_GEOMETRY_CENTROID_NO_THROW is defined)
+*/
+template <typename Source, typename Point>
+inline typename boost::enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value
+    >::type
+centroid(Source& source, Point& c)
+{
+    concepts::check<Source>();
+    concepts::check<Point>();
+
+    detail::point_source::centroid_visitor<Source, Point> visitor;
+    detail::point_source::visit(source, visitor);
+    if (! visitor.result(c))
+    {
+#if ! defined(BOOST_GEOMETRY_CENTROID_NO_THROW)
+        BOOST_THROW_EXCEPTION(centroid_exception());
+#endif
+    }
+}
+
+
+/*!
+\brief Simplify the linestrings and rings of a point source
+\ingroup simplify
+\details The source is read once, chunk by chunk, and its linestrings and
+    rings are simplified with Douglas-Peucker in blocks of many thousands
+    of points. Each kept point is within max_distance of the simplified
+    lines, but long parts can keep a few points more than if they were
+    simplified at once. Rings which collapse or change their orientation
+    are removed, as are the holes of removed exterior rings.
+    The output geometry takes the parts of its kind: e.g. a multi polygon
+    takes all polygons, a polygon only the first one.
+\tparam Source \tparam_geometry{point source}
+\tparam Geometry \tparam_geometry
+\tparam Distance \tparam_numeric
+\param source A point source, consumed by the call
+\param out output geometry, simplified version of the source
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+*/
+template <typename Source, typename Geometry, typename Distance>
+inline typename boost::enable_if_c
+    <
+        detail::point_source::is_point_source<Source>::value
+    >::type
+simplify(Source& source, Geometry& out, Distance const& max_distance)
+{
+    concepts::check<Source>();
+    concepts::check<Geometry>();
+
+    typedef typename point_type<Source>::type point_type;
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag, point_type
+        >::type ds_strategy_type;
+    typedef strategy::simplify::douglas_peucker
+        <
+            point_type, ds_strategy_type
+        > strategy_type;
+
+    geometry::clear(out);
+
+    strategy_type const strategy;
+    detail::point_source::simplify_visitor
+        <
+            Source, Geometry, Distance, strategy_type
+        > visitor(out, max_distance, strategy);
+    detail::point_source::visit(source, visitor);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_POINT_SOURCE_HPP
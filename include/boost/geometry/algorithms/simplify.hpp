@@ -19,8 +19,10 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <set>
+#include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range.hpp>
@@ -34,10 +36,14 @@
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
 #include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/ring_type.hpp>
 #include <boost/geometry/core/tags.hpp>
 
+#include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/strategies/agnostic/simplify_douglas_peucker.hpp>
+#include <boost/geometry/strategies/agnostic/simplify_topology_preserving.hpp>
+#include <boost/geometry/strategies/agnostic/simplify_visvalingam_whyatt.hpp>
 #include <boost/geometry/strategies/concepts/simplify_concept.hpp>
 #include <boost/geometry/strategies/default_strategy.hpp>
 #include <boost/geometry/strategies/distance.hpp>
@@ -46,12 +52,16 @@
 #include <boost/geometry/algorithms/clear.hpp>
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
 #include <boost/geometry/algorithms/is_empty.hpp>
 #include <boost/geometry/algorithms/perimeter.hpp>
 
 #include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
 
+#include <boost/geometry/util/execution.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -107,6 +117,18 @@ struct simplify_copy
                     geometry::range::back_inserter(out)
             );
     }
+
+    template
+    <
+        typename RangeIn, typename RangeOut,
+        typename Strategy, typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(RangeIn const& range, RangeOut& out,
+                             Distance const& max_distance, Strategy const& strategy,
+                             ExecutionPolicy const& )
+    {
+        apply(range, out, max_distance, strategy);
+    }
 };
 
 
@@ -144,6 +166,18 @@ struct simplify_range
             range::resize(out, 1);
         }
     }
+
+    template
+    <
+        typename RangeIn, typename RangeOut,
+        typename Strategy, typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(RangeIn const& range, RangeOut& out,
+                    Distance const& max_distance, Strategy const& strategy,
+                    ExecutionPolicy const& )
+    {
+        apply(range, out, max_distance, strategy);
+    }
 };
 
 struct simplify_ring
@@ -270,6 +304,18 @@ public :
             rotated.resize(size);
         }
     }
+
+    template
+    <
+        typename Ring, typename Strategy,
+        typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(Ring const& ring, Ring& out,
+                    Distance const& max_distance, Strategy const& strategy,
+                    ExecutionPolicy const& )
+    {
+        apply(ring, out, max_distance, strategy);
+    }
 };
 
 
@@ -334,9 +380,54 @@ public:
         apply_interior_rings(interior_rings(poly_in),
             interior_rings(poly_out), max_distance, strategy);
     }
+
+    template
+    <
+        typename Polygon, typename Strategy,
+        typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(Polygon const& poly_in, Polygon& poly_out,
+                    Distance const& max_distance, Strategy const& strategy,
+                    ExecutionPolicy const& )
+    {
+        apply(poly_in, poly_out, max_distance, strategy);
+    }
 };
 
 
+template
+<
+    typename Policy, typename MultiGeometry,
+    typename Distance, typename Strategy
+>
+struct simplify_multi_worker
+{
+    typedef typename boost::range_value<MultiGeometry>::type single_type;
+
+    simplify_multi_worker(MultiGeometry const& multi,
+                          std::vector<single_type>& outputs,
+                          Distance const& max_distance, Strategy const& strategy)
+        : m_multi(multi)
+        , m_outputs(outputs)
+        , m_max_distance(max_distance)
+        , m_strategy(strategy)
+    {}
+
+    inline void operator()(std::size_t , std::size_t first, std::size_t last) const
+    {
+        for (std::size_t i = first; i < last; ++i)
+        {
+            Policy::apply(range::at(m_multi, i), m_outputs[i],
+                          m_max_distance, m_strategy);
+        }
+    }
+
+    MultiGeometry const& m_multi;
+    std::vector<single_type>& m_outputs;
+    Distance const& m_max_distance;
+    Strategy const& m_strategy;
+};
+
 template<typename Policy>
 struct simplify_multi
 {
@@ -359,8 +450,335 @@ struct simplify_multi
             }
         }
     }
+
+    // The members are simplified according to the execution policy
+    template
+    <
+        typename MultiGeometry, typename Strategy,
+        typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(MultiGeometry const& multi, MultiGeometry& out,
+                    Distance const& max_distance, Strategy const& strategy,
+                    ExecutionPolicy const& policy)
+    {
+        range::clear(out);
+
+        typedef typename boost::range_value<MultiGeometry>::type single_type;
+
+        std::vector<single_type> outputs(boost::size(multi));
+        geometry::detail::execution::for_each_chunk(outputs.size(), policy,
+            simplify_multi_worker
+                <
+                    Policy, MultiGeometry, Distance, Strategy
+                >(multi, outputs, max_distance, strategy));
+
+        for (std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            if (! geometry::is_empty(outputs[i]))
+            {
+                range::push_back(out, outputs[i]);
+            }
+        }
+    }
+};
+
+
+
+// Adds the linestrings or rings of a geometry as chains to the state of a
+// topology preserving simplification, and copies them back
+template <typename Tag>
+struct topology_chains
+{};
+
+template <>
+struct topology_chains<linestring_tag>
+{
+    template <typename State, typename Linestring>
+    static inline void add(State& state, Linestring const& linestring)
+    {
+        state.add_chain(boost::begin(linestring), boost::end(linestring), false);
+    }
+
+    template <typename State, typename Linestring>
+    static inline void copy(State const& state, std::size_t& chain,
+                            Linestring const& , Linestring& out)
+    {
+        state.copy_chain(chain++, range::back_inserter(out));
+    }
 };
 
+template <>
+struct topology_chains<ring_tag>
+{
+    template <typename State, typename Ring>
+    static inline void add(State& state, Ring const& ring)
+    {
+        // Without the closing point
+        std::size_t size = boost::size(ring);
+        if (geometry::closure<Ring>::value == closed && size > 0)
+        {
+            size--;
+        }
+        state.add_chain(boost::begin(ring), range::pos(ring, size), true);
+    }
+
+    template <typename State, typename Ring>
+    static inline void copy(State const& state, std::size_t& chain,
+                            Ring const& , Ring& out)
+    {
+        state.copy_chain(chain++, range::back_inserter(out));
+        if (geometry::closure<Ring>::value == closed && ! boost::empty(out))
+        {
+            typename geometry::point_type<Ring>::type const front
+                = range::front(out);
+            range::push_back(out, front);
+        }
+    }
+};
+
+template <>
+struct topology_chains<polygon_tag>
+{
+    template <typename State, typename Polygon>
+    static inline void add(State& state, Polygon const& polygon)
+    {
+        topology_chains<ring_tag>::add(state, exterior_ring(polygon));
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            topology_chains<ring_tag>::add(state, *it);
+        }
+    }
+
+    template <typename State, typename Polygon>
+    static inline void copy(State const& state, std::size_t& chain,
+                            Polygon const& polygon, Polygon& out)
+    {
+        topology_chains<ring_tag>::copy(state, chain,
+            exterior_ring(polygon), exterior_ring(out));
+
+        typedef typename ring_type<Polygon>::type ring_type;
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            ring_type ring;
+            topology_chains<ring_tag>::copy(state, chain, *it, ring);
+            range::push_back(interior_rings(out), ring);
+        }
+    }
+};
+
+template <typename Tag>
+struct simplify_topology_preserving
+{
+    template <typename Geometry, typename Strategy, typename Distance>
+    static inline void apply(Geometry const& geometry, Geometry& out,
+                    Distance const& max_area, Strategy const& )
+    {
+        typedef typename Strategy::state_type state_type;
+        typedef typename Strategy::constraint_type constraint_type;
+        typedef typename Strategy::area_type area_type;
+
+        state_type state;
+        topology_chains<Tag>::add(state, geometry);
+        state.apply(area_type(max_area), constraint_type(state));
+
+        std::size_t chain = 0;
+        topology_chains<Tag>::copy(state, chain, geometry, out);
+    }
+
+    template
+    <
+        typename Geometry, typename Strategy,
+        typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(Geometry const& geometry, Geometry& out,
+                    Distance const& max_area, Strategy const& strategy,
+                    ExecutionPolicy const& )
+    {
+        apply(geometry, out, max_area, strategy);
+    }
+};
+
+template <typename Box>
+struct less_min_x
+{
+    explicit less_min_x(std::vector<Box> const& boxes)
+        : m_boxes(boxes)
+    {}
+
+    inline bool operator()(std::size_t left, std::size_t right) const
+    {
+        return geometry::get<min_corner, 0>(m_boxes[left])
+                < geometry::get<min_corner, 0>(m_boxes[right])
+            || (geometry::get<min_corner, 0>(m_boxes[left])
+                    == geometry::get<min_corner, 0>(m_boxes[right])
+                && left < right);
+    }
+
+    std::vector<Box> const& m_boxes;
+};
+
+inline std::size_t find_root(std::vector<std::size_t>& parents, std::size_t i)
+{
+    while (parents[i] != i)
+    {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+
+// Groups the members of which the envelopes overlap, directly or by other
+// members. A simplified member stays within the convex hull of its input,
+// so members of different groups cannot start to intersect.
+template <typename MultiGeometry>
+inline std::vector<std::vector<std::size_t> >
+    overlapping_groups(MultiGeometry const& multi)
+{
+    typedef model::box<typename geometry::point_type<MultiGeometry>::type> box_type;
+
+    std::size_t const count = boost::size(multi);
+    std::vector<box_type> boxes(count);
+    std::vector<std::size_t> order(count);
+    std::vector<std::size_t> parents(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        geometry::envelope(range::at(multi, i), boxes[i]);
+        order[i] = i;
+        parents[i] = i;
+    }
+    std::sort(order.begin(), order.end(), less_min_x<box_type>(boxes));
+
+    for (std::size_t a = 0; a < count; ++a)
+    {
+        box_type const& box = boxes[order[a]];
+        for (std::size_t b = a + 1; b < count
+             && geometry::get<min_corner, 0>(boxes[order[b]])
+                    <= geometry::get<max_corner, 0>(box); ++b)
+        {
+            box_type const& other = boxes[order[b]];
+            if (geometry::get<min_corner, 1>(other) <= geometry::get<max_corner, 1>(box)
+                && geometry::get<min_corner, 1>(box) <= geometry::get<max_corner, 1>(other))
+            {
+                parents[find_root(parents, order[a])] = find_root(parents, order[b]);
+            }
+        }
+    }
+
+    // Groups in order of their first member
+    std::vector<std::vector<std::size_t> > groups;
+    std::vector<std::size_t> group_of_root(count, count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::size_t const root = find_root(parents, i);
+        if (group_of_root[root] == count)
+        {
+            group_of_root[root] = groups.size();
+            groups.push_back(std::vector<std::size_t>());
+        }
+        groups[group_of_root[root]].push_back(i);
+    }
+    return groups;
+}
+
+template <typename Tag, typename MultiGeometry, typename Strategy>
+struct simplify_topology_preserving_worker
+{
+    typedef typename boost::range_value<MultiGeometry>::type single_type;
+    typedef typename Strategy::area_type area_type;
+
+    simplify_topology_preserving_worker(MultiGeometry const& multi,
+            std::vector<std::vector<std::size_t> > const& groups,
+            std::vector<single_type>& outputs,
+            area_type const& max_area)
+        : m_multi(multi)
+        , m_groups(groups)
+        , m_outputs(outputs)
+        , m_max_area(max_area)
+    {}
+
+    inline void operator()(std::size_t , std::size_t first, std::size_t last) const
+    {
+        typedef typename Strategy::state_type state_type;
+        typedef typename Strategy::constraint_type constraint_type;
+
+        for (std::size_t g = first; g < last; ++g)
+        {
+            std::vector<std::size_t> const& group = m_groups[g];
+
+            state_type state;
+            for (std::size_t k = 0; k < group.size(); ++k)
+            {
+                topology_chains<Tag>::add(state, range::at(m_multi, group[k]));
+            }
+            state.apply(m_max_area, constraint_type(state));
+
+            std::size_t chain = 0;
+            for (std::size_t k = 0; k < group.size(); ++k)
+            {
+                topology_chains<Tag>::copy(state, chain,
+                    range::at(m_multi, group[k]), m_outputs[group[k]]);
+            }
+        }
+    }
+
+    MultiGeometry const& m_multi;
+    std::vector<std::vector<std::size_t> > const& m_groups;
+    std::vector<single_type>& m_outputs;
+    area_type m_max_area;
+};
+
+template <typename Tag>
+struct simplify_topology_preserving_multi
+{
+    template <typename MultiGeometry, typename Strategy, typename Distance>
+    static inline void apply(MultiGeometry const& multi, MultiGeometry& out,
+                    Distance const& max_area, Strategy const& strategy)
+    {
+        apply(multi, out, max_area, strategy,
+              geometry::execution::sequenced_policy());
+    }
+
+    // Groups of members which might interact are simplified according to
+    // the execution policy
+    template
+    <
+        typename MultiGeometry, typename Strategy,
+        typename Distance, typename ExecutionPolicy
+    >
+    static inline void apply(MultiGeometry const& multi, MultiGeometry& out,
+                    Distance const& max_area, Strategy const& ,
+                    ExecutionPolicy const& policy)
+    {
+        typedef simplify_topology_preserving_worker
+            <
+                Tag, MultiGeometry, Strategy
+            > worker_type;
+
+        range::clear(out);
+
+        std::vector<std::vector<std::size_t> > const groups
+            = overlapping_groups(multi);
+        std::vector<typename worker_type::single_type> outputs(boost::size(multi));
+        geometry::detail::execution::for_each_chunk(groups.size(), policy,
+            worker_type(multi, groups, outputs,
+                        typename worker_type::area_type(max_area)));
+
+        for (std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            if (! geometry::is_empty(outputs[i]))
+            {
+                range::push_back(out, outputs[i]);
+            }
+        }
+    }
+};
 
 }} // namespace detail::simplify
 #endif // DOXYGEN_NO_DETAIL
@@ -387,6 +805,13 @@ struct simplify<Point, point_tag>
     {
         geometry::convert(point, out);
     }
+
+    template <typename Distance, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Point const& point, Point& out,
+                    Distance const& , Strategy const& , ExecutionPolicy const& )
+    {
+        geometry::convert(point, out);
+    }
 };
 
 // Linestring, keep 2 points (unless those points are the same)
@@ -443,6 +868,43 @@ struct simplify<MultiPolygon, multi_polygon_tag>
 {};
 
 
+// With the topology_preserving strategy, all linestrings or rings of a
+// geometry are simplified together
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct simplify_topology_preserving
+    : simplify<Geometry, Tag>
+{};
+
+template <typename Linestring>
+struct simplify_topology_preserving<Linestring, linestring_tag>
+    : detail::simplify::simplify_topology_preserving<linestring_tag>
+{};
+
+template <typename Ring>
+struct simplify_topology_preserving<Ring, ring_tag>
+    : detail::simplify::simplify_topology_preserving<ring_tag>
+{};
+
+template <typename Polygon>
+struct simplify_topology_preserving<Polygon, polygon_tag>
+    : detail::simplify::simplify_topology_preserving<polygon_tag>
+{};
+
+template <typename MultiLinestring>
+struct simplify_topology_preserving<MultiLinestring, multi_linestring_tag>
+    : detail::simplify::simplify_topology_preserving_multi<linestring_tag>
+{};
+
+template <typename MultiPolygon>
+struct simplify_topology_preserving<MultiPolygon, multi_polygon_tag>
+    : detail::simplify::simplify_topology_preserving_multi<polygon_tag>
+{};
+
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -485,6 +947,87 @@ struct simplify
 
         apply(geometry, out, max_distance, strategy_type());
     }
+
+    template
+    <
+        typename Geometry, typename Distance,
+        typename Point, typename DistanceStrategy, typename CalculationType
+    >
+    static inline void apply(Geometry const& geometry,
+                             Geometry& out,
+                             Distance const& max_distance,
+                             strategy::simplify::topology_preserving
+                                <
+                                    Point, DistanceStrategy, CalculationType
+                                > const& strategy)
+    {
+        dispatch::simplify_topology_preserving
+            <
+                Geometry
+            >::apply(geometry, out, max_distance, strategy);
+    }
+
+    template
+    <
+        typename Geometry, typename Distance,
+        typename Strategy, typename ExecutionPolicy
+    >
+    static inline void apply(Geometry const& geometry,
+                             Geometry& out,
+                             Distance const& max_distance,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        dispatch::simplify<Geometry>::apply(geometry, out, max_distance,
+                                            strategy, policy);
+    }
+
+    template <typename Geometry, typename Distance, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry,
+                             Geometry& out,
+                             Distance const& max_distance,
+                             default_strategy,
+                             ExecutionPolicy const& policy)
+    {
+        typedef typename point_type<Geometry>::type point_type;
+
+        typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag, point_type
+        >::type ds_strategy_type;
+
+        typedef strategy::simplify::douglas_peucker
+        <
+            point_type, ds_strategy_type
+        > strategy_type;
+
+        BOOST_CONCEPT_ASSERT(
+            (concepts::SimplifyStrategy<strategy_type, point_type>)
+        );
+
+        apply(geometry, out, max_distance, strategy_type(), policy);
+    }
+
+    template
+    <
+        typename Geometry, typename Distance,
+        typename Point, typename DistanceStrategy, typename CalculationType,
+        typename ExecutionPolicy
+    >
+    static inline void apply(Geometry const& geometry,
+                             Geometry& out,
+                             Distance const& max_distance,
+                             strategy::simplify::topology_preserving
+                                <
+                                    Point, DistanceStrategy, CalculationType
+                                > const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        dispatch::simplify_topology_preserving
+            <
+                Geometry
+            >::apply(geometry, out, max_distance, strategy, policy);
+    }
 };
 
 struct simplify_insert
@@ -546,6 +1089,17 @@ struct simplify
     {
         resolve_strategy::simplify::apply(geometry, out, max_distance, strategy);
     }
+
+    template <typename Distance, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry const& geometry,
+                             Geometry& out,
+                             Distance const& max_distance,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& policy)
+    {
+        resolve_strategy::simplify::apply(geometry, out, max_distance,
+                                          strategy, policy);
+    }
 };
 
 template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
@@ -569,6 +1123,28 @@ struct simplify<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
         }
     };
 
+    template <typename Distance, typename Strategy, typename ExecutionPolicy>
+    struct policy_visitor: boost::static_visitor<void>
+    {
+        Distance const& m_max_distance;
+        Strategy const& m_strategy;
+        ExecutionPolicy const& m_policy;
+
+        policy_visitor(Distance const& max_distance, Strategy const& strategy,
+                       ExecutionPolicy const& policy)
+            : m_max_distance(max_distance)
+            , m_strategy(strategy)
+            , m_policy(policy)
+        {}
+
+        template <typename Geometry>
+        void operator()(Geometry const& geometry, Geometry& out) const
+        {
+            simplify<Geometry>::apply(geometry, out, m_max_distance,
+                                      m_strategy, m_policy);
+        }
+    };
+
     template <typename Distance, typename Strategy>
     static inline void
     apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
@@ -582,6 +1158,22 @@ struct simplify<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
             out
         );
     }
+
+    template <typename Distance, typename Strategy, typename ExecutionPolicy>
+    static inline void
+    apply(boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> const& geometry,
+          boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>& out,
+          Distance const& max_distance,
+          Strategy const& strategy,
+          ExecutionPolicy const& policy)
+    {
+        boost::apply_visitor(
+            policy_visitor<Distance, Strategy, ExecutionPolicy>(max_distance,
+                                                                strategy, policy),
+            geometry,
+            out
+        );
+    }
 };
 
 } // namespace resolve_variant
@@ -615,6 +1207,44 @@ inline void simplify(Geometry const& geometry, Geometry& out,
     resolve_variant::simplify<Geometry>::apply(geometry, out, max_distance, strategy);
 }
 
+/*!
+\brief Simplify a geometry using a specified strategy and execution policy
+\ingroup simplify
+\details The members of a multi geometry are simplified according to the
+    execution policy, sequenced or parallel. With the topology_preserving
+    strategy, members which cannot interact are simplified in parallel.
+    The result does not depend on the policy.
+\tparam Geometry \tparam_geometry
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\tparam ExecutionPolicy Type of the execution policy
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed, or the area for the
+    visvalingam_whyatt and topology_preserving strategies
+\param strategy simplify strategy to be used for simplification
+\param policy Execution policy
+
+\qbk{distinguish,with strategy and execution policy}
+*/
+template
+<
+    typename Geometry, typename Distance,
+    typename Strategy, typename ExecutionPolicy
+>
+inline void simplify(Geometry const& geometry, Geometry& out,
+                     Distance const& max_distance, Strategy const& strategy,
+                     ExecutionPolicy const& policy)
+{
+    concepts::check<Geometry>();
+
+    geometry::clear(out);
+
+    resolve_variant::simplify<Geometry>::apply(geometry, out, max_distance,
+                                               strategy, policy);
+}
+
 
 
 
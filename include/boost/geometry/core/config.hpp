@@ -28,4 +28,14 @@
 #define BOOST_GEOMETRY_USE_RESCALING
 #endif
 
+// Execution policies use std::thread if available, unless it is explicitly
+// disabled. Otherwise parallel policies fall back to sequential processing.
+#if ! defined(BOOST_GEOMETRY_USE_THREADS)
+#if ! defined(BOOST_GEOMETRY_NO_THREADS) \
+ && ! defined(BOOST_NO_CXX11_HDR_THREAD) \
+ && ! defined(BOOST_NO_CXX11_HDR_EXCEPTION)
+#define BOOST_GEOMETRY_USE_THREADS
+#endif
+#endif
+
 #endif // BOOST_GEOMETRY_CORE_CONFIG_HPP
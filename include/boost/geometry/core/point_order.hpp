@@ -129,6 +129,14 @@ struct point_order<ring_tag, Ring>
         = geometry::traits::point_order<Ring>::value;
 };
 
+// The order of the rings read from a point source
+template <typename Source>
+struct point_order<point_source_tag, Source>
+{
+    static const order_selector value
+        = geometry::traits::point_order<Source>::value;
+};
+
 // Specialization for polygon: the order is the order of its rings
 template <typename Polygon>
 struct point_order<polygon_tag, Polygon>
@@ -0,0 +1,40 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_CORE_POINT_SOURCE_HPP
+#define BOOST_GEOMETRY_CORE_POINT_SOURCE_HPP
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Enumerates the kinds of parts read from a point source
+\ingroup enum
+\details A point source (see concepts::PointSource) delivers its points in
+    parts. The kind of a part tells how its points are connected: points
+    are not connected, the points of a linestring are, and the points of a
+    ring form a closed ring. A polygon is an exterior ring followed by its
+    interior rings, so an exterior ring also starts a new polygon.
+*/
+enum point_source_part
+{
+    /// Separate points, e.g. of a multi point
+    part_points = 0,
+    /// A linestring
+    part_linestring = 1,
+    /// The exterior ring of a polygon, starting the polygon
+    part_exterior_ring = 2,
+    /// An interior ring of the last polygon
+    part_interior_ring = 3
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_CORE_POINT_SOURCE_HPP
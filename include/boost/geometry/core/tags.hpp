@@ -116,6 +116,10 @@ struct multi_polygon_tag : multi_tag, polygonal_tag {};
 /// OGC Geometry Collection identifying tag
 struct geometry_collection_tag : multi_tag {};
 
+/// Convenience tag identifying a forward-only source of points, read in
+/// chunks (see concepts::PointSource)
+struct point_source_tag {};
+
 
 /*!
 \brief Meta-function to get for a tag of a multi-geometry
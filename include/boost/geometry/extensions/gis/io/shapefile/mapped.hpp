@@ -0,0 +1,881 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace detail { namespace shapefile
+{
+
+// IStream reading from memory, used to decode one record with the policies
+// of read_shapefile. Reading or seeking outside of the record makes the
+// stream not good() and fills the output with zeros.
+class memory_stream
+{
+public:
+    enum seekdir { beg, cur };
+
+    memory_stream(char const* begin, char const* end)
+        : m_begin(begin)
+        , m_it(begin)
+        , m_end(end)
+        , m_good(true)
+    {}
+
+    inline void read(char* out, std::size_t n)
+    {
+        if (std::size_t(m_end - m_it) < n)
+        {
+            std::fill(out, out + n, char(0));
+            m_it = m_end;
+            m_good = false;
+            return;
+        }
+        std::memcpy(out, m_it, n);
+        m_it += n;
+    }
+
+    inline void seekg(std::ptrdiff_t off, seekdir dir = beg)
+    {
+        char const* const base = dir == beg ? m_begin : m_it;
+        if (off < m_begin - base || off > m_end - base)
+        {
+            m_it = m_end;
+            m_good = false;
+            return;
+        }
+        m_it = base + off;
+    }
+
+    inline bool good() const { return m_good; }
+    inline void clear() { m_good = true; }
+
+private:
+    char const* m_begin;
+    char const* m_it;
+    char const* m_end;
+    bool m_good;
+};
+
+inline boost::int32_t load_big(char const* p)
+{
+    boost::int32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return boost::endian::big_to_native(v);
+}
+
+inline boost::int32_t load_little(char const* p)
+{
+    boost::int32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return boost::endian::little_to_native(v);
+}
+
+inline double load_little_double(char const* p)
+{
+    memory_stream is(p, p + sizeof(double));
+    double v = 0;
+    read_little(is, v);
+    return v;
+}
+
+// Bounding box to which the records are limited, compared with the boxes
+// stored in the records, so without taking the coordinate system into account
+struct record_filter
+{
+    record_filter()
+        : enabled(false)
+        , min_x(0), min_y(0), max_x(0), max_y(0)
+    {}
+
+    template <typename Box>
+    explicit record_filter(Box const& box)
+        : enabled(true)
+        , min_x(geometry::get<min_corner, 0>(box))
+        , min_y(geometry::get<min_corner, 1>(box))
+        , max_x(geometry::get<max_corner, 0>(box))
+        , max_y(geometry::get<max_corner, 1>(box))
+    {}
+
+    inline bool disjoint(double x1, double y1, double x2, double y2) const
+    {
+        return enabled
+            && (x2 < min_x || x1 > max_x || y2 < min_y || y1 > max_y);
+    }
+
+    bool enabled;
+    double min_x, min_y, max_x, max_y;
+};
+
+static const std::size_t file_header_size = 100;
+static const std::size_t record_header_size = 8;
+
+struct record_entry
+{
+    std::size_t offset; // of the content, after the record header
+    std::size_t length;
+};
+
+}} // namespace detail::shapefile
+
+
+/*!
+\brief Shapefile of which the .shp and .shx files are mapped into memory
+\details The records are decoded from the mapped memory when they are read
+    by shapefile_view or read_mapped_shapefile. The index (.shx) is used to find
+    the records, if it does not exist the .shp is scanned once for the
+    record headers. The headers of the files are checked when the shapefile
+    is opened, read_shapefile_exception is thrown if they are invalid or if
+    the files cannot be mapped. The shapefile can be read by several threads
+    at the same time.
+*/
+class mapped_shapefile
+    : boost::noncopyable
+{
+public:
+    /*!
+    \brief Maps a .shp file and the .shx file next to it
+    \param path path of the .shp file
+    */
+    explicit mapped_shapefile(std::string const& path)
+    {
+        map(path, m_shp_region);
+
+        std::string index_path = path;
+        if (index_path.size() >= 4)
+        {
+            std::string const ext = index_path.substr(index_path.size() - 4);
+            index_path.resize(index_path.size() - 4);
+            index_path += ext == ".SHP" ? ".SHX" : ".shx";
+        }
+        try
+        {
+            map(index_path, m_shx_region);
+        }
+        catch (read_shapefile_exception const&)
+        {
+            // Without index
+        }
+
+        init(static_cast<char const*>(m_shp_region.get_address()),
+             m_shp_region.get_size(),
+             m_shx_region.get_size() > 0
+                ? static_cast<char const*>(m_shx_region.get_address())
+                : NULL,
+             m_shx_region.get_size());
+    }
+
+    /*!
+    \brief Uses a .shp and optionally a .shx file already in memory, which
+        should be kept alive while the shapefile is used
+    */
+    mapped_shapefile(char const* shp, std::size_t shp_size,
+                     char const* shx = NULL, std::size_t shx_size = 0)
+    {
+        init(shp, shp_size, shx, shx_size);
+    }
+
+    //! Number of records
+    inline std::size_t size() const
+    {
+        return m_shx != NULL
+             ? (m_shx_size - detail::shapefile::file_header_size)
+                / detail::shapefile::record_header_size
+             : m_entries.size();
+    }
+
+    //! Type of the shapes as stored in the header
+    inline boost::int32_t type() const { return m_type; }
+
+#ifndef DOXYGEN_NO_DETAIL
+    // Position of the content of a record, checked against the .shp
+    inline detail::shapefile::record_entry entry(std::size_t index) const
+    {
+        namespace shp = detail::shapefile;
+
+        if (m_shx == NULL)
+        {
+            return m_entries[index];
+        }
+
+        char const* const p = m_shx + shp::file_header_size
+                            + index * shp::record_header_size;
+        boost::int32_t const offset = shp::load_big(p);
+        boost::int32_t const length = shp::load_big(p + 4);
+        if (offset < 0 || length < 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid index record"));
+        }
+
+        shp::record_entry result;
+        result.offset = std::size_t(offset) * 2 + shp::record_header_size;
+        result.length = std::size_t(length) * 2;
+        if (result.offset > m_shp_size
+            || result.length > m_shp_size - result.offset
+            || shp::load_big(m_shp + result.offset - 4) != length)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Index record does not match the shapefile"));
+        }
+        return result;
+    }
+
+    inline char const* data() const { return m_shp; }
+#endif // DOXYGEN_NO_DETAIL
+
+private:
+    static inline void map(std::string const& path,
+                           boost::interprocess::mapped_region & region)
+    {
+        namespace bi = boost::interprocess;
+        try
+        {
+            bi::file_mapping mapping(path.c_str(), bi::read_only);
+            bi::mapped_region(mapping, bi::read_only).swap(region);
+        }
+        catch (bi::interprocess_exception const&)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Unable to map " + path));
+        }
+    }
+
+    static inline void check_header(char const* data, std::size_t size)
+    {
+        if (size < detail::shapefile::file_header_size
+            || detail::shapefile::load_big(data) != 9994)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid header code"));
+        }
+    }
+
+    inline void init(char const* shp, std::size_t shp_size,
+                     char const* shx, std::size_t shx_size)
+    {
+        namespace shp_ns = detail::shapefile;
+
+        check_header(shp, shp_size);
+        m_shp = shp;
+        m_shp_size = shp_size;
+        m_type = shp_ns::load_little(shp + 32);
+
+        m_shx = NULL;
+        m_shx_size = 0;
+        if (shx != NULL)
+        {
+            check_header(shx, shx_size);
+            m_shx = shx;
+            m_shx_size = shx_size;
+            return;
+        }
+
+        // Without index the record headers are scanned
+        std::size_t pos = shp_ns::file_header_size;
+        while (shp_size - pos >= shp_ns::record_header_size)
+        {
+            boost::int32_t const length = shp_ns::load_big(shp + pos + 4);
+            shp_ns::record_entry e;
+            e.offset = pos + shp_ns::record_header_size;
+            e.length = std::size_t(length) * 2;
+            if (length < 0 || e.length > shp_size - e.offset)
+            {
+                BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record header"));
+            }
+            m_entries.push_back(e);
+            pos = e.offset + e.length;
+        }
+    }
+
+    boost::interprocess::mapped_region m_shp_region;
+    boost::interprocess::mapped_region m_shx_region;
+
+    char const* m_shp;
+    std::size_t m_shp_size;
+    char const* m_shx;
+    std::size_t m_shx_size;
+    boost::int32_t m_type;
+    std::vector<detail::shapefile::record_entry> m_entries;
+};
+
+
+namespace detail { namespace shapefile
+{
+
+// Checks the numbers of parts and points of a record against its length,
+// before the policies allocate memory for them
+inline void check_record_counts(char const* content, std::size_t length,
+                                boost::int32_t type)
+{
+    std::size_t parts = 0;
+    std::size_t points = 0;
+    std::size_t fixed = 0;
+
+    switch (type)
+    {
+    case shape_type::multipoint:
+    case shape_type::multipoint_z:
+    case shape_type::multipoint_m:
+        fixed = 40;
+        if (length < fixed)
+        {
+            break;
+        }
+        points = std::size_t(std::max(load_little(content + 36), 0));
+        break;
+    case shape_type::polyline:
+    case shape_type::polyline_z:
+    case shape_type::polyline_m:
+    case shape_type::polygon:
+    case shape_type::polygon_z:
+    case shape_type::polygon_m:
+        fixed = 44;
+        if (length < fixed)
+        {
+            break;
+        }
+        parts = std::size_t(std::max(load_little(content + 36), 0));
+        points = std::size_t(std::max(load_little(content + 40), 0));
+        break;
+    default:
+        return;
+    }
+
+    if (length < fixed
+        || parts > (length - fixed) / 4
+        || points > (length - fixed - 4 * parts) / 16)
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record length"));
+    }
+}
+
+// Returns false for null shapes and records outside of the filter
+inline bool record_selected(char const* content, std::size_t length,
+                            boost::int32_t type, record_filter const& filter)
+{
+    if (length < 4 || load_little(content) == shape_type::null_shape)
+    {
+        return false;
+    }
+    if (! filter.enabled)
+    {
+        return true;
+    }
+
+    if (type == shape_type::point
+        || type == shape_type::point_z
+        || type == shape_type::point_m)
+    {
+        if (length < 20)
+        {
+            return true; // reported by the policy
+        }
+        double const x = load_little_double(content + 4);
+        double const y = load_little_double(content + 12);
+        return ! filter.disjoint(x, y, x, y);
+    }
+
+    if (length < 36)
+    {
+        return true;
+    }
+    return ! filter.disjoint(load_little_double(content + 4),
+                             load_little_double(content + 12),
+                             load_little_double(content + 20),
+                             load_little_double(content + 28));
+}
+
+// Appends the geometries of one record, in the same way as read_shapefile
+// reading the whole file
+template <typename Geometry, typename Tag = typename geometry::tag<Geometry>::type>
+struct read_record
+    : not_implemented<Tag>
+{};
+
+template <typename Geometry>
+struct read_record<Geometry, point_tag>
+{
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream & is, Range & points,
+                             boost::int32_t type, Strategy const& strategy)
+    {
+        if (type == shape_type::multipoint
+            || type == shape_type::multipoint_m
+            || type == shape_type::multipoint_z)
+        {
+            read_multipoint_policy::apply(is, points, type, strategy);
+        }
+        else
+        {
+            read_point_policy::apply(is, points, type, strategy);
+        }
+    }
+};
+
+// A MultiPoint for each record, also of a file of points
+template <typename Geometry>
+struct read_record<Geometry, multi_point_tag>
+{
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream & is, Range & multi_points,
+                             boost::int32_t type, Strategy const& strategy)
+    {
+        range::push_back(multi_points, Geometry());
+        read_record<typename boost::range_value<Geometry>::type>
+            ::apply(is, range::back(multi_points), type, strategy);
+    }
+};
+
+template <typename Geometry>
+struct read_record<Geometry, linestring_tag>
+{
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream & is, Range & linestrings,
+                             boost::int32_t type, Strategy const& strategy)
+    {
+        read_polyline_policy::apply(is, linestrings, type, strategy);
+    }
+};
+
+template <typename Geometry>
+struct read_record<Geometry, multi_linestring_tag>
+{
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream & is, Range & multi_linestrings,
+                             boost::int32_t type, Strategy const& strategy)
+    {
+        range::push_back(multi_linestrings, Geometry());
+        read_polyline_policy::apply(is, range::back(multi_linestrings),
+                                    type, strategy);
+    }
+};
+
+template <typename Geometry>
+struct read_record<Geometry, polygon_tag>
+{
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream & is, Range & polygons,
+                             boost::int32_t type, Strategy const& strategy)
+    {
+        read_polygon_policy::apply(is, polygons, type, strategy);
+    }
+};
+
+template <typename Geometry>
+struct read_record<Geometry, multi_polygon_tag>
+{
+    template <typename Range, typename Strategy>
+    static inline void apply(memory_stream & is, Range & multi_polygons,
+                             boost::int32_t type, Strategy const& strategy)
+    {
+        range::push_back(multi_polygons, Geometry());
+        read_polygon_policy::apply(is, range::back(multi_polygons),
+                                   type, strategy);
+    }
+};
+
+// Whether the records of a file of shapes of type can be read as Geometry
+inline bool supported_type(boost::int32_t type, point_tag)
+{
+    return type == shape_type::point
+        || type == shape_type::point_m
+        || type == shape_type::point_z
+        || type == shape_type::multipoint
+        || type == shape_type::multipoint_m
+        || type == shape_type::multipoint_z;
+}
+
+inline bool supported_type(boost::int32_t type, multi_point_tag)
+{
+    return supported_type(type, point_tag());
+}
+
+inline bool supported_type(boost::int32_t type, linestring_tag)
+{
+    return type == shape_type::polyline
+        || type == shape_type::polyline_m
+        || type == shape_type::polyline_z;
+}
+
+inline bool supported_type(boost::int32_t type, multi_linestring_tag)
+{
+    return supported_type(type, linestring_tag());
+}
+
+inline bool supported_type(boost::int32_t type, polygon_tag)
+{
+    return type == shape_type::polygon
+        || type == shape_type::polygon_m
+        || type == shape_type::polygon_z;
+}
+
+inline bool supported_type(boost::int32_t type, multi_polygon_tag)
+{
+    return supported_type(type, polygon_tag());
+}
+
+// Appends the geometries of the record, if it is selected
+template <typename Geometry, typename Range, typename Strategy>
+inline void read_mapped_record(mapped_shapefile const& file, std::size_t index,
+                               record_filter const& filter, Range & range,
+                               Strategy const& strategy)
+{
+    record_entry const e = file.entry(index);
+    char const* const content = file.data() + e.offset;
+    boost::int32_t const type = file.type();
+
+    if (! record_selected(content, e.length, type, filter))
+    {
+        return;
+    }
+
+    check_record_counts(content, e.length, type);
+
+    memory_stream is(content, content + e.length);
+    read_record<Geometry>::apply(is, range, type, strategy);
+}
+
+template <typename Geometry>
+struct default_read_strategy
+{
+    typedef typename strategy::io::services::default_strategy
+        <
+            typename cs_tag<Geometry>::type
+        >::type type;
+};
+
+template <typename Geometry, typename Strategy>
+struct read_mapped_chunk
+{
+    typedef std::vector<Geometry> chunk_type;
+
+    read_mapped_chunk(mapped_shapefile const& file, record_filter const& filter,
+                      std::vector<chunk_type> & chunks, Strategy const& strategy)
+        : m_file(file)
+        , m_filter(filter)
+        , m_chunks(chunks)
+        , m_strategy(strategy)
+    {}
+
+    inline void operator()(std::size_t chunk, std::size_t first,
+                           std::size_t last) const
+    {
+        for (std::size_t i = first ; i < last ; ++i)
+        {
+            read_mapped_record<Geometry>(m_file, i, m_filter,
+                                         m_chunks[chunk], m_strategy);
+        }
+    }
+
+    mapped_shapefile const& m_file;
+    record_filter const& m_filter;
+    std::vector<chunk_type> & m_chunks;
+    Strategy const& m_strategy;
+};
+
+}} // namespace detail::shapefile
+
+
+/*!
+\brief Iterator over the geometries of a mapped shapefile
+\details The records are decoded one at a time while iterating, the
+    geometries of the current record are kept by the iterator. Records
+    not intersecting the filter box and null shapes are skipped without
+    decoding them.
+*/
+template
+<
+    typename Geometry,
+    typename Strategy = typename detail::shapefile::default_read_strategy<Geometry>::type
+>
+class shapefile_iterator
+    : public boost::iterator_facade
+        <
+            shapefile_iterator<Geometry, Strategy>,
+            Geometry const,
+            boost::forward_traversal_tag
+        >
+{
+public:
+    shapefile_iterator()
+        : m_file(NULL)
+        , m_record(0)
+        , m_last(0)
+        , m_position(0)
+    {}
+
+    shapefile_iterator(mapped_shapefile const& file,
+                       detail::shapefile::record_filter const& filter,
+                       std::size_t first, std::size_t last,
+                       Strategy const& strategy = Strategy())
+        : m_file(&file)
+        , m_filter(filter)
+        , m_record(first)
+        , m_last(last)
+        , m_position(0)
+        , m_strategy(strategy)
+    {
+        load(first);
+    }
+
+    //! Index of the record of the current geometry
+    inline std::size_t record() const { return m_record; }
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Geometry const& dereference() const
+    {
+        return m_geometries[m_position];
+    }
+
+    inline bool equal(shapefile_iterator const& other) const
+    {
+        return m_record == other.m_record && m_position == other.m_position;
+    }
+
+    inline void increment()
+    {
+        if (++m_position >= m_geometries.size())
+        {
+            load(m_record + 1);
+        }
+    }
+
+    // Reads the next record with geometries, starting at index
+    inline void load(std::size_t index)
+    {
+        m_geometries.clear();
+        m_position = 0;
+        for (m_record = index ; m_record < m_last ; ++m_record)
+        {
+            detail::shapefile::read_mapped_record<Geometry>(*m_file, m_record,
+                m_filter, m_geometries, m_strategy);
+            if (! m_geometries.empty())
+            {
+                return;
+            }
+        }
+        m_record = m_last;
+    }
+
+    mapped_shapefile const* m_file;
+    detail::shapefile::record_filter m_filter;
+    std::size_t m_record;
+    std::size_t m_last;
+    std::size_t m_position;
+    std::vector<Geometry> m_geometries;
+    Strategy m_strategy;
+};
+
+
+/*!
+\brief Range of the geometries of a mapped shapefile, optionally only of the
+    records of which the bounding box intersects a box
+\details The geometries are read as by read_shapefile, e.g. a record of
+    a polyline contains a linestring for each part and a multi linestring
+    for all of them. Files of points can be read as points and multi points,
+    in the latter case a multi point is created for each record. The box
+    is compared with the bounding boxes of the records, as stored.
+*/
+template
+<
+    typename Geometry,
+    typename Strategy = typename detail::shapefile::default_read_strategy<Geometry>::type
+>
+class shapefile_view
+{
+public:
+    typedef shapefile_iterator<Geometry, Strategy> iterator;
+    typedef iterator const_iterator;
+
+    explicit shapefile_view(mapped_shapefile const& file,
+                            Strategy const& strategy = Strategy())
+        : m_file(file)
+        , m_strategy(strategy)
+    {
+        check();
+    }
+
+    template <typename Box>
+    shapefile_view(mapped_shapefile const& file, Box const& filter,
+                   Strategy const& strategy = Strategy())
+        : m_file(file)
+        , m_filter(filter)
+        , m_strategy(strategy)
+    {
+        check();
+    }
+
+    inline iterator begin() const
+    {
+        return iterator(m_file, m_filter, 0, m_file.size(), m_strategy);
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_file, m_filter, m_file.size(), m_file.size(), m_strategy);
+    }
+
+private:
+    inline void check() const
+    {
+        if (m_file.type() != detail::shapefile::shape_type::null_shape
+            && ! detail::shapefile::supported_type(m_file.type(),
+                    typename geometry::tag<Geometry>::type()))
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Shape type not supported by the geometry"));
+        }
+    }
+
+    mapped_shapefile const& m_file;
+    detail::shapefile::record_filter m_filter;
+    Strategy m_strategy;
+};
+
+
+namespace detail { namespace shapefile
+{
+
+template
+<
+    typename RangeOfGeometries, typename ExecutionPolicy, typename Strategy
+>
+inline void read_mapped(mapped_shapefile const& file,
+                        RangeOfGeometries & range_of_geometries,
+                        record_filter const& filter,
+                        ExecutionPolicy const& policy,
+                        Strategy const& strategy)
+{
+    typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+    typedef read_mapped_chunk<geometry_type, Strategy> function_type;
+
+    geometry::concepts::check<geometry_type>();
+
+    double_endianness_check();
+
+    if (! supported_type(file.type(),
+                         typename geometry::tag<geometry_type>::type()))
+    {
+        return;
+    }
+
+    std::size_t const count = file.size();
+    std::size_t const chunk_count = detail::execution::chunk_count(count, policy);
+    if (chunk_count <= 1)
+    {
+        // Read directly into the output
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            read_mapped_record<geometry_type>(file, i, filter,
+                                              range_of_geometries, strategy);
+        }
+        return;
+    }
+
+    std::vector<typename function_type::chunk_type> chunks(chunk_count);
+
+    detail::execution::for_each_chunk(count, policy,
+        function_type(file, filter, chunks, strategy));
+
+    for (std::size_t i = 0 ; i < chunks.size() ; ++i)
+    {
+        for (std::size_t j = 0 ; j < chunks[i].size() ; ++j)
+        {
+            range::push_back(range_of_geometries, chunks[i][j]);
+        }
+    }
+}
+
+}} // namespace detail::shapefile
+
+
+/*!
+\brief Reads the geometries of the records of a mapped shapefile of which the
+    bounding boxes intersect a box, on multiple threads if requested
+\details The geometries are read as by shapefile_view. The records are split
+    into consecutive ranges which are decoded in parallel, the geometries
+    are appended in the order of the records.
+\note If an exception is thrown the output range may contain partial data
+*/
+template
+<
+    typename RangeOfGeometries, typename Box,
+    typename ExecutionPolicy, typename Strategy
+>
+inline void read_mapped_shapefile(mapped_shapefile const& file,
+                                  RangeOfGeometries & range_of_geometries,
+                                  Box const& filter,
+                                  ExecutionPolicy const& policy,
+                                  Strategy const& strategy)
+{
+    detail::shapefile::read_mapped(file, range_of_geometries,
+        detail::shapefile::record_filter(filter), policy, strategy);
+}
+
+template
+<
+    typename RangeOfGeometries, typename Box, typename ExecutionPolicy
+>
+inline void read_mapped_shapefile(mapped_shapefile const& file,
+                                  RangeOfGeometries & range_of_geometries,
+                                  Box const& filter,
+                                  ExecutionPolicy const& policy)
+{
+    typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+
+    detail::shapefile::read_mapped(file, range_of_geometries,
+        detail::shapefile::record_filter(filter), policy,
+        typename detail::shapefile::default_read_strategy<geometry_type>::type());
+}
+
+/*!
+\brief Reads all of the geometries of a mapped shapefile
+\note If an exception is thrown the output range may contain partial data
+*/
+template <typename RangeOfGeometries>
+inline void read_mapped_shapefile(mapped_shapefile const& file,
+                                  RangeOfGeometries & range_of_geometries)
+{
+    typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+
+    detail::shapefile::read_mapped(file, range_of_geometries,
+        detail::shapefile::record_filter(), execution::sequenced_policy(),
+        typename detail::shapefile::default_read_strategy<geometry_type>::type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_HPP
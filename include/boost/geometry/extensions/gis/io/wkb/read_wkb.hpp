@@ -9,100 +9,7 @@
 #ifndef BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
 #define BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
 
-#include <iterator>
-
-#include <boost/type_traits/is_convertible.hpp>
-#include <boost/static_assert.hpp>
-
-#include <boost/geometry/core/tags.hpp>
-#include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
-
-namespace boost { namespace geometry
-{
-
-#ifndef DOXYGEN_NO_DISPATCH
-namespace dispatch
-{
-
-template <typename Tag, typename G>
-struct read_wkb {};
-
-template <typename Geometry>
-struct read_wkb<point_tag, Geometry>
-{
-    template <typename Iterator>
-    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
-        detail::wkb::byte_order_type::enum_t order)
-    {
-        return detail::wkb::point_parser<Geometry>::parse(it, end, geometry, order);
-    }
-};
-
-template <typename Geometry>
-struct read_wkb<linestring_tag, Geometry>
-{
-    template <typename Iterator>
-    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
-        detail::wkb::byte_order_type::enum_t order)
-    {
-        geometry::clear(geometry);
-        return detail::wkb::linestring_parser<Geometry>::parse(it, end, geometry, order);
-    }
-};
-
-template <typename Geometry>
-struct read_wkb<polygon_tag, Geometry>
-{
-    template <typename Iterator>
-    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
-        detail::wkb::byte_order_type::enum_t order)
-    {
-        geometry::clear(geometry);
-        return detail::wkb::polygon_parser<Geometry>::parse(it, end, geometry, order);
-    }
-};
-
-} // namespace dispatch
-#endif // DOXYGEN_NO_DISPATCH
-
-
-template <typename Iterator, typename Geometry>
-inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
-{
-    // Stream of bytes can only be parsed using random access iterator.
-    BOOST_STATIC_ASSERT((
-        boost::is_convertible
-        <
-            typename std::iterator_traits<Iterator>::iterator_category,
-            const std::random_access_iterator_tag&
-        >::value));
-
-    detail::wkb::byte_order_type::enum_t byte_order;
-    if (detail::wkb::byte_order_parser::parse(begin, end, byte_order))
-    {
-        return dispatch::read_wkb
-            <
-            typename tag<Geometry>::type,
-            Geometry
-            >::parse(begin, end, geometry, byte_order);
-    }
-
-    return false;
-}
-
-template <typename ByteType, typename Geometry>
-inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
-{
-    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
-    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
-
-    ByteType const* begin = bytes;
-    ByteType const* const end = bytes + length;
-
-    return read_wkb(begin, end, geometry);
-}
-
-
-}} // namespace boost::geometry
+// WKB has moved to boost/geometry/io/wkb
+#include <boost/geometry/io/wkb/read.hpp>
 
 #endif // BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
@@ -56,12 +56,40 @@ class andoyer_inverse
 public:
     typedef result_inverse<CT> result_type;
 
+    /*!
+    \brief Values depending only on the spheroid, calculated once and
+        reused for any number of pairs of points.
+    */
+    struct constants
+    {
+        template <typename Spheroid>
+        explicit constants(Spheroid const& spheroid)
+            : radius_a(CT(get_radius<0>(spheroid)))
+            , radius_b(CT(get_radius<2>(spheroid)))
+            , f(formula::flattening<CT>(spheroid))
+        {}
+
+        CT radius_a;
+        CT radius_b;
+        CT f;
+    };
+
     template <typename T1, typename T2, typename Spheroid>
     static inline result_type apply(T1 const& lon1,
                                     T1 const& lat1,
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lon1, lat1, lon2, lat2, constants(spheroid));
+    }
+
+    template <typename T1, typename T2>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    constants const& spheroid_constants)
     {
         result_type result;
 
@@ -75,7 +103,7 @@ public:
         CT const c0 = CT(0);
         CT const c1 = CT(1);
         CT const pi = math::pi<CT>();
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const f = spheroid_constants.f;
 
         CT const dlon = lon2 - lon1;
         CT const sin_dlon = sin(dlon);
@@ -118,7 +146,7 @@ public:
 
             CT const dd = -(f/CT(4))*(H*K+G*L);
 
-            CT const a = CT(get_radius<0>(spheroid));
+            CT const a = spheroid_constants.radius_a;
 
             result.distance = a * (d + dd);
         }
@@ -231,7 +259,7 @@ public:
 
         if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
         {
-            CT const b = CT(get_radius<2>(spheroid));
+            CT const b = spheroid_constants.radius_b;
 
             typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 1> quantities;
             quantities::apply(dlon, sin_lat1, cos_lat1, sin_lat2, cos_lat2,
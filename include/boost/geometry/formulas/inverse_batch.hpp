@@ -0,0 +1,362 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
+#define BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
+
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/result_inverse.hpp>
+
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace inverse_batch
+{
+
+// Karney's formula takes coordinates in degrees, the other ones in radians
+template <typename Inverse>
+struct coordinates_in_degrees
+    : boost::false_type
+{};
+
+template
+<
+    typename CT, bool EnableDistance, bool EnableAzimuth,
+    bool EnableReverseAzimuth, bool EnableReducedLength,
+    bool EnableGeodesicScale, size_t SeriesOrder
+>
+struct coordinates_in_degrees
+    <
+        karney_inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale, SeriesOrder
+            >
+    >
+    : boost::true_type
+{};
+
+template <typename Result>
+struct calculation_type
+{};
+
+template <typename CT>
+struct calculation_type<result_inverse<CT> >
+{
+    typedef CT type;
+};
+
+template <typename CT, bool Degrees>
+struct coordinates
+{
+    typedef std::pair<CT, CT> result_type;
+
+    template <typename Point>
+    static inline std::pair<CT, CT> apply(Point const& point)
+    {
+        return std::make_pair(CT(get_as_radian<0>(point)),
+                              CT(get_as_radian<1>(point)));
+    }
+};
+
+template <typename CT>
+struct coordinates<CT, true>
+{
+    typedef std::pair<CT, CT> result_type;
+
+    template <typename Point>
+    static inline std::pair<CT, CT> apply(Point const& point)
+    {
+        typedef boost::is_same
+            <
+                typename geometry::detail::cs_angular_units<Point>::type,
+                geometry::degree
+            > is_degree;
+
+        return apply(point, is_degree());
+    }
+
+    template <typename Point>
+    static inline std::pair<CT, CT> apply(Point const& point, boost::true_type)
+    {
+        return std::make_pair(CT(geometry::get<0>(point)),
+                              CT(geometry::get<1>(point)));
+    }
+
+    template <typename Point>
+    static inline std::pair<CT, CT> apply(Point const& point, boost::false_type)
+    {
+        return std::make_pair(CT(geometry::get<0>(point)) * math::r2d<CT>(),
+                              CT(geometry::get<1>(point)) * math::r2d<CT>());
+    }
+};
+
+// The whole result is stored or only the distance
+template <typename Result>
+inline void assign_result(Result const& result, Result & out)
+{
+    out = result;
+}
+
+template <typename Result, typename T>
+inline void assign_result(Result const& result, T & out)
+{
+    out = result.distance;
+}
+
+template
+<
+    typename Inverse,
+    typename Converter,
+    typename Points1,
+    typename Points2,
+    typename Results
+>
+struct pairs_worker
+{
+    typedef typename Inverse::constants constants_type;
+
+    pairs_worker(Points1 const& points1, Points2 const& points2,
+                 Results & results, constants_type const& constants)
+        : m_points1(points1)
+        , m_points2(points2)
+        , m_results(results)
+        , m_constants(constants)
+    {}
+
+    inline void operator()(std::size_t , std::size_t first, std::size_t last) const
+    {
+        for (std::size_t i = first ; i < last ; ++i)
+        {
+            typename Converter::result_type const c1
+                = Converter::apply(range::at(m_points1, i));
+            typename Converter::result_type const c2
+                = Converter::apply(range::at(m_points2, i));
+
+            assign_result(Inverse::apply(c1.first, c1.second,
+                                         c2.first, c2.second,
+                                         m_constants),
+                          range::at(m_results, i));
+        }
+    }
+
+    Points1 const& m_points1;
+    Points2 const& m_points2;
+    Results & m_results;
+    constants_type const& m_constants;
+};
+
+template
+<
+    typename Inverse,
+    typename Converter,
+    typename Points1,
+    typename Coordinates2,
+    typename Results
+>
+struct matrix_worker
+{
+    typedef typename Inverse::constants constants_type;
+
+    matrix_worker(Points1 const& points1, Coordinates2 const& coordinates2,
+                  Results & results, constants_type const& constants)
+        : m_points1(points1)
+        , m_coordinates2(coordinates2)
+        , m_results(results)
+        , m_constants(constants)
+    {}
+
+    inline void operator()(std::size_t , std::size_t first, std::size_t last) const
+    {
+        std::size_t const count2 = m_coordinates2.size();
+        for (std::size_t i = first ; i < last ; ++i)
+        {
+            typename Converter::result_type const c1
+                = Converter::apply(range::at(m_points1, i));
+
+            std::size_t const offset = i * count2;
+            for (std::size_t j = 0 ; j < count2 ; ++j)
+            {
+                assign_result(Inverse::apply(c1.first, c1.second,
+                                             m_coordinates2[j].first,
+                                             m_coordinates2[j].second,
+                                             m_constants),
+                              range::at(m_results, offset + j));
+            }
+        }
+    }
+
+    Points1 const& m_points1;
+    Coordinates2 const& m_coordinates2;
+    Results & m_results;
+    constants_type const& m_constants;
+};
+
+}} // namespace detail::inverse_batch
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief The solution of the inverse problem of geodesics for many pairs of
+    points at once.
+\details The values depending only on the spheroid (e.g. the series
+    coefficients of Karney's formula) are calculated once for all of the
+    pairs. The pairs are independent so they can be processed by several
+    threads, each pair iterating as long as it needs.
+\tparam Inverse Inverse formula, e.g. vincenty_inverse<double, true, false>
+*/
+template <typename Inverse>
+class inverse_batch
+{
+    typedef typename Inverse::constants constants_type;
+
+public:
+    typedef typename Inverse::result_type result_type;
+    typedef typename detail::inverse_batch::calculation_type
+        <
+            result_type
+        >::type calculation_type;
+
+private:
+    typedef detail::inverse_batch::coordinates
+        <
+            calculation_type,
+            detail::inverse_batch::coordinates_in_degrees<Inverse>::value
+        > converter;
+
+public:
+    /*!
+    \brief Solves the inverse problem for pairs of corresponding points of
+        two ranges, results[i] is the solution for points1[i] and points2[i].
+    \details The value type of Results is either result_type or a type
+        to which the distance is assigned.
+    */
+    template <typename Points1, typename Points2, typename Results, typename Spheroid>
+    static inline void apply(Points1 const& points1, Points2 const& points2,
+                             Results & results, Spheroid const& spheroid)
+    {
+        apply(points1, points2, results, spheroid, execution::sequenced_policy());
+    }
+
+    template
+    <
+        typename Points1, typename Points2, typename Results,
+        typename Spheroid, typename ExecutionPolicy
+    >
+    static inline void apply(Points1 const& points1, Points2 const& points2,
+                             Results & results, Spheroid const& spheroid,
+                             ExecutionPolicy const& policy)
+    {
+        std::size_t const count1 = boost::size(points1);
+        std::size_t const count2 = boost::size(points2);
+        std::size_t const count = count1 < count2 ? count1 : count2;
+
+        range::resize(results, count);
+
+        constants_type const constants(spheroid);
+
+        geometry::detail::execution::for_each_chunk(count, policy,
+            detail::inverse_batch::pairs_worker
+                <
+                    Inverse, converter, Points1, Points2, Results
+                >(points1, points2, results, constants));
+    }
+
+    /*!
+    \brief Solves the inverse problem for all pairs of points of two ranges,
+        results[i * size(points2) + j] is the solution for points1[i] and
+        points2[j].
+    \details The value type of Results is either result_type or a type
+        to which the distance is assigned, e.g. calculation_type for a
+        distance matrix.
+    */
+    template <typename Points1, typename Points2, typename Results, typename Spheroid>
+    static inline void matrix(Points1 const& points1, Points2 const& points2,
+                              Results & results, Spheroid const& spheroid)
+    {
+        matrix(points1, points2, results, spheroid, execution::sequenced_policy());
+    }
+
+    template
+    <
+        typename Points1, typename Points2, typename Results,
+        typename Spheroid, typename ExecutionPolicy
+    >
+    static inline void matrix(Points1 const& points1, Points2 const& points2,
+                              Results & results, Spheroid const& spheroid,
+                              ExecutionPolicy const& policy)
+    {
+        typedef std::vector<typename converter::result_type> coordinates_type;
+
+        std::size_t const count1 = boost::size(points1);
+        std::size_t const count2 = boost::size(points2);
+
+        range::resize(results, count1 * count2);
+
+        // The columns are converted once
+        coordinates_type coordinates2;
+        coordinates2.reserve(count2);
+        for (typename boost::range_iterator<Points2 const>::type
+                it = boost::begin(points2); it != boost::end(points2); ++it)
+        {
+            coordinates2.push_back(converter::apply(*it));
+        }
+
+        constants_type const constants(spheroid);
+
+        geometry::detail::execution::for_each_chunk(count1,
+            row_policy(policy, count2),
+            detail::inverse_batch::matrix_worker
+                <
+                    Inverse, converter, Points1, coordinates_type, Results
+                >(points1, coordinates2, results, constants));
+    }
+
+private:
+    static inline execution::sequenced_policy
+        row_policy(execution::sequenced_policy const& policy, std::size_t)
+    {
+        return policy;
+    }
+
+    // The grain size of the policy is the number of pairs, rows are chunked
+    static inline execution::parallel_policy
+        row_policy(execution::parallel_policy const& policy, std::size_t row_size)
+    {
+        std::size_t const grain = row_size > 0
+                                ? policy.grain_size() / row_size
+                                : policy.grain_size();
+        return execution::parallel_policy(policy.threads(),
+                                          grain > 0 ? grain : 1);
+    }
+};
+
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
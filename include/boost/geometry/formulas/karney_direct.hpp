@@ -73,187 +73,257 @@ class karney_direct
 public:
     typedef result_direct<CT> result_type;
 
-    template <typename T, typename Dist, typename Azi, typename Spheroid>
-    static inline result_type apply(T const& lo1,
-                                    T const& la1,
-                                    Dist const& distance,
-                                    Azi const& azimuth12,
-                                    Spheroid const& spheroid)
+    /*!
+    \brief The geodesic starting at a point in a direction, as the
+        GeodesicLine of GeographicLib
+    \details The terms not depending on the distance, among which the
+        series coefficients, are calculated once, such that points at
+        several distances along the geodesic are calculated faster than by
+        solving the direct problem for each.
+    */
+    class line
     {
-        result_type result;
-
-        CT lon1 = lo1;
-        CT const lat1 = la1;
+    public:
+        template <typename T, typename Azi, typename Spheroid>
+        inline line(T const& lo1,
+                    T const& la1,
+                    Azi const& azimuth12,
+                    Spheroid const& spheroid)
+            : m_lon1(lo1)
+            , m_b(get_radius<2>(spheroid))
+            , m_f(formula::flattening<CT>(spheroid))
+        {
+            CT const lat1 = la1;
 
-        Azi azi12 = azimuth12;
-        math::normalize_azimuth<degree, Azi>(azi12);
+            CT azi12 = azimuth12;
+            math::normalize_azimuth<degree, CT>(azi12);
 
-        CT const c0 = 0;
-        CT const c1 = 1;
-        CT const c2 = 2;
+            CT const c0 = 0;
+            CT const c1 = 1;
+            CT const c2 = 2;
 
-        CT const b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
-        CT const one_minus_f = c1 - f;
-        CT const two_minus_f = c2 - f;
+            CT const one_minus_f = c1 - m_f;
+            CT const two_minus_f = c2 - m_f;
 
-        CT const n = f / two_minus_f;
-        CT const e2 = f * two_minus_f;
-        CT const ep2 = e2 / math::sqr(one_minus_f);
+            CT const n = m_f / two_minus_f;
+            CT const e2 = m_f * two_minus_f;
+            m_ep2 = e2 / math::sqr(one_minus_f);
 
-        CT sin_alpha1, cos_alpha1;
-        math::sin_cos_degrees<CT>(azi12, sin_alpha1, cos_alpha1);
+            CT sin_alpha1, cos_alpha1;
+            math::sin_cos_degrees<CT>(azi12, sin_alpha1, cos_alpha1);
 
-        // Find the reduced latitude.
-        CT sin_beta1, cos_beta1;
-        math::sin_cos_degrees<CT>(lat1, sin_beta1, cos_beta1);
-        sin_beta1 *= one_minus_f;
+            // Find the reduced latitude.
+            CT cos_beta1;
+            math::sin_cos_degrees<CT>(lat1, m_sin_beta1, cos_beta1);
+            m_sin_beta1 *= one_minus_f;
 
-        math::normalize_unit_vector<CT>(sin_beta1, cos_beta1);
+            math::normalize_unit_vector<CT>(m_sin_beta1, cos_beta1);
 
-        cos_beta1 = (std::max)(c0, cos_beta1);
+            cos_beta1 = (std::max)(c0, cos_beta1);
 
-        // Obtain alpha 0 by solving the spherical triangle.
-        CT const sin_alpha0 = sin_alpha1 * cos_beta1;
-        CT const cos_alpha0 = boost::math::hypot(cos_alpha1, sin_alpha1 * sin_beta1);
+            // Obtain alpha 0 by solving the spherical triangle.
+            m_sin_alpha0 = sin_alpha1 * cos_beta1;
+            m_cos_alpha0 = boost::math::hypot(cos_alpha1, sin_alpha1 * m_sin_beta1);
 
-        CT const k2 = math::sqr(cos_alpha0) * ep2;
+            m_k2 = math::sqr(m_cos_alpha0) * m_ep2;
 
-        CT const epsilon = k2 / (c2 * (c1 + math::sqrt(c1 + k2)) + k2);
+            CT const epsilon = m_k2 / (c2 * (c1 + math::sqrt(c1 + m_k2)) + m_k2);
 
-        // Find the coefficients for A1 by computing the
-        // series expansion using Horner scehme.
-        CT const expansion_A1 = se::evaluate_A1<SeriesOrder>(epsilon);
+            // Find the coefficients for A1 by computing the
+            // series expansion using Horner scehme.
+            m_expansion_A1 = se::evaluate_A1<SeriesOrder>(epsilon);
 
-        // Index zero element of coeffs_C1 is unused.
-        se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(epsilon);
+            // Index zero element of coeffs_C1 is unused.
+            se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(epsilon);
 
-        // Tau is an integration variable.
-        CT const tau12 = distance / (b * (c1 + expansion_A1));
+            m_sin_sigma1 = m_sin_beta1;
+            m_sin_omega1 = m_sin_alpha0 * m_sin_beta1;
 
-        CT const sin_tau12 = sin(tau12);
-        CT const cos_tau12 = cos(tau12);
+            m_cos_sigma1 = m_cos_omega1 = m_sin_beta1 != c0 || cos_alpha1 != c0 ? cos_beta1 * cos_alpha1 : c1;
+            math::normalize_unit_vector<CT>(m_sin_sigma1, m_cos_sigma1);
 
-        CT sin_sigma1 = sin_beta1;
-        CT sin_omega1 = sin_alpha0 * sin_beta1;
+            m_B11 = se::sin_cos_series(m_sin_sigma1, m_cos_sigma1, coeffs_C1);
+            CT const sin_B11 = sin(m_B11);
+            CT const cos_B11 = cos(m_B11);
 
-        CT cos_sigma1, cos_omega1;
-        cos_sigma1 = cos_omega1 = sin_beta1 != c0 || cos_alpha1 != c0 ? cos_beta1 * cos_alpha1 : c1;
-        math::normalize_unit_vector<CT>(sin_sigma1, cos_sigma1);
+            m_sin_tau1 = m_sin_sigma1 * cos_B11 + m_cos_sigma1 * sin_B11;
+            m_cos_tau1 = m_cos_sigma1 * cos_B11 - m_sin_sigma1 * sin_B11;
 
-        CT const B11 = se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C1);
-        CT const sin_B11 = sin(B11);
-        CT const cos_B11 = cos(B11);
+            // Index zero element of coeffs_C1p is unused.
+            m_coeffs_C1p = se::coeffs_C1p<SeriesOrder, CT>(epsilon);
 
-        CT const sin_tau1 = sin_sigma1 * cos_B11 + cos_sigma1 * sin_B11;
-        CT const cos_tau1 = cos_sigma1 * cos_B11 - sin_sigma1 * sin_B11;
+            if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
+            {
+                se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
 
-        // Index zero element of coeffs_C1p is unused.
-        se::coeffs_C1p<SeriesOrder, CT> const coeffs_C1p(epsilon);
+                CT const A3 = math::horner_evaluate(epsilon, coeffs_A3.begin(), coeffs_A3.end());
+                m_A3c = -m_f * m_sin_alpha0 * A3;
 
-        CT const B12 = - se::sin_cos_series
-                             (sin_tau1 * cos_tau12 + cos_tau1 * sin_tau12,
-                              cos_tau1 * cos_tau12 - sin_tau1 * sin_tau12,
-                              coeffs_C1p);
+                m_coeffs_C3 = se::coeffs_C3<SeriesOrder, CT>(n, epsilon);
 
-        CT const sigma12 = tau12 - (B12 - B11);
-        CT const sin_sigma12 = sin(sigma12);
-        CT const cos_sigma12 = cos(sigma12);
+                m_B31 = se::sin_cos_series(m_sin_sigma1, m_cos_sigma1, m_coeffs_C3);
 
-        CT const sin_sigma2 = sin_sigma1 * cos_sigma12 + cos_sigma1 * sin_sigma12;
-        CT const cos_sigma2 = cos_sigma1 * cos_sigma12 - sin_sigma1 * sin_sigma12;
+                math::normalize_longitude<degree, CT>(m_lon1);
+            }
+            else
+            {
+                m_A3c = m_B31 = c0;
+                m_coeffs_C3.assign(c0);
+            }
 
-        if (BOOST_GEOMETRY_CONDITION(CalcRevAzimuth))
-        {
-            CT const sin_alpha2 = sin_alpha0;
-            CT const cos_alpha2 = cos_alpha0 * cos_sigma2;
+            if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
+            {
+                // Evaluate the coefficients for C2.
+                // Index zero element of coeffs_C2 is unused.
+                m_coeffs_C2 = se::coeffs_C2<SeriesOrder, CT>(epsilon);
 
-            result.reverse_azimuth = atan2(sin_alpha2, cos_alpha2);
+                m_B21 = se::sin_cos_series(m_sin_sigma1, m_cos_sigma1, m_coeffs_C2);
 
-            // Convert the angle to radians.
-            result.reverse_azimuth /= math::d2r<CT>();
+                // Find the coefficients for A2 by computing the
+                // series expansion using Horner scehme.
+                m_expansion_A2 = se::evaluate_A2<SeriesOrder>(epsilon);
+            }
+            else
+            {
+                m_B21 = m_expansion_A2 = c0;
+                m_coeffs_C2.assign(c0);
+            }
         }
 
-        if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
+        //! Calculates the point at a distance along the geodesic
+        template <typename Dist>
+        inline result_type apply(Dist const& distance) const
         {
-            // Find the latitude at the second point.
-            CT const sin_beta2 = cos_alpha0 * sin_sigma2;
-            CT const cos_beta2 = boost::math::hypot(sin_alpha0, cos_alpha0 * cos_sigma2);
+            result_type result;
 
-            result.lat2 = atan2(sin_beta2, one_minus_f * cos_beta2);
+            CT const c1 = 1;
 
-            // Convert the coordinate to radians.
-            result.lat2 /= math::d2r<CT>();
+            // Tau is an integration variable.
+            CT const tau12 = distance / (m_b * (c1 + m_expansion_A1));
 
-            // Find the longitude at the second point.
-            CT const sin_omega2 = sin_alpha0 * sin_sigma2;
-            CT const cos_omega2 = cos_sigma2;
+            CT const sin_tau12 = sin(tau12);
+            CT const cos_tau12 = cos(tau12);
 
-            CT const omega12 = atan2(sin_omega2 * cos_omega1 - cos_omega2 * sin_omega1,
-                                     cos_omega2 * cos_omega1 + sin_omega2 * sin_omega1);
+            CT const B12 = - se::sin_cos_series
+                                 (m_sin_tau1 * cos_tau12 + m_cos_tau1 * sin_tau12,
+                                  m_cos_tau1 * cos_tau12 - m_sin_tau1 * sin_tau12,
+                                  m_coeffs_C1p);
 
-            se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
+            CT const sigma12 = tau12 - (B12 - m_B11);
+            CT const sin_sigma12 = sin(sigma12);
+            CT const cos_sigma12 = cos(sigma12);
 
-            CT const A3 = math::horner_evaluate(epsilon, coeffs_A3.begin(), coeffs_A3.end());
-            CT const A3c = -f * sin_alpha0 * A3;
+            CT const sin_sigma2 = m_sin_sigma1 * cos_sigma12 + m_cos_sigma1 * sin_sigma12;
+            CT const cos_sigma2 = m_cos_sigma1 * cos_sigma12 - m_sin_sigma1 * sin_sigma12;
 
-            se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(n, epsilon);
+            if (BOOST_GEOMETRY_CONDITION(CalcRevAzimuth))
+            {
+                CT const sin_alpha2 = m_sin_alpha0;
+                CT const cos_alpha2 = m_cos_alpha0 * cos_sigma2;
 
-            CT const B31 = se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C3);
+                result.reverse_azimuth = atan2(sin_alpha2, cos_alpha2);
 
-            CT const lam12 = omega12 + A3c *
-                             (sigma12 + (se::sin_cos_series
-                                             (sin_sigma2,
-                                              cos_sigma2,
-                                              coeffs_C3) - B31));
+                // Convert the angle to radians.
+                result.reverse_azimuth /= math::d2r<CT>();
+            }
 
-            // Convert to radians to get the
-            // longitudinal difference.
-            CT lon12 = lam12 / math::d2r<CT>();
+            if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
+            {
+                // Find the latitude at the second point.
+                CT const sin_beta2 = m_cos_alpha0 * sin_sigma2;
+                CT const cos_beta2 = boost::math::hypot(m_sin_alpha0, m_cos_alpha0 * cos_sigma2);
 
-            // Add the longitude at first point to the longitudinal
-            // difference and normalize the result.
-            math::normalize_longitude<degree, CT>(lon1);
-            math::normalize_longitude<degree, CT>(lon12);
+                result.lat2 = atan2(sin_beta2, (c1 - m_f) * cos_beta2);
 
-            result.lon2 = lon1 + lon12;
-        }
+                // Convert the coordinate to radians.
+                result.lat2 /= math::d2r<CT>();
 
-        if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
-        {
-            // Evaluate the coefficients for C2.
-            // Index zero element of coeffs_C2 is unused.
-            se::coeffs_C2<SeriesOrder, CT> const coeffs_C2(epsilon);
+                // Find the longitude at the second point.
+                CT const sin_omega2 = m_sin_alpha0 * sin_sigma2;
+                CT const cos_omega2 = cos_sigma2;
 
-            CT const B21 = se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C2);
-            CT const B22 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C2);
+                CT const omega12 = atan2(sin_omega2 * m_cos_omega1 - cos_omega2 * m_sin_omega1,
+                                         cos_omega2 * m_cos_omega1 + sin_omega2 * m_sin_omega1);
 
-            // Find the coefficients for A2 by computing the
-            // series expansion using Horner scehme.
-            CT const expansion_A2 = se::evaluate_A2<SeriesOrder>(epsilon);
+                CT const lam12 = omega12 + m_A3c *
+                                 (sigma12 + (se::sin_cos_series
+                                                 (sin_sigma2,
+                                                  cos_sigma2,
+                                                  m_coeffs_C3) - m_B31));
 
-            CT const AB1 = (c1 + expansion_A1) * (B12 - B11);
-            CT const AB2 = (c1 + expansion_A2) * (B22 - B21);
-            CT const J12 = (expansion_A1 - expansion_A2) * sigma12 + (AB1 - AB2);
+                // Convert to radians to get the
+                // longitudinal difference.
+                CT lon12 = lam12 / math::d2r<CT>();
 
-            CT const dn1 = math::sqrt(c1 + ep2 * math::sqr(sin_beta1));
-            CT const dn2 = math::sqrt(c1 + k2 * math::sqr(sin_sigma2));
+                // Add the longitude at first point to the longitudinal
+                // difference and normalize the result.
+                math::normalize_longitude<degree, CT>(lon12);
 
-            // Find the reduced length.
-            result.reduced_length = b * ((dn2 * (cos_sigma1 * sin_sigma2) -
-                                          dn1 * (sin_sigma1 * cos_sigma2)) -
-                                          cos_sigma1 * cos_sigma2 * J12);
+                result.lon2 = m_lon1 + lon12;
+            }
 
-            // Find the geodesic scale.
-            CT const t = k2 * (sin_sigma2 - sin_sigma1) *
-                              (sin_sigma2 + sin_sigma1) / (dn1 + dn2);
+            if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
+            {
+                CT const B22 = se::sin_cos_series(sin_sigma2, cos_sigma2, m_coeffs_C2);
 
-            result.geodesic_scale = cos_sigma12 +
-                                    (t * sin_sigma2 - cos_sigma2 * J12) *
-                                    sin_sigma1 / dn1;
+                CT const AB1 = (c1 + m_expansion_A1) * (B12 - m_B11);
+                CT const AB2 = (c1 + m_expansion_A2) * (B22 - m_B21);
+                CT const J12 = (m_expansion_A1 - m_expansion_A2) * sigma12 + (AB1 - AB2);
+
+                CT const dn1 = math::sqrt(c1 + m_ep2 * math::sqr(m_sin_beta1));
+                CT const dn2 = math::sqrt(c1 + m_k2 * math::sqr(sin_sigma2));
+
+                // Find the reduced length.
+                result.reduced_length = m_b * ((dn2 * (m_cos_sigma1 * sin_sigma2) -
+                                                dn1 * (m_sin_sigma1 * cos_sigma2)) -
+                                                m_cos_sigma1 * cos_sigma2 * J12);
+
+                // Find the geodesic scale.
+                CT const t = m_k2 * (sin_sigma2 - m_sin_sigma1) *
+                                    (sin_sigma2 + m_sin_sigma1) / (dn1 + dn2);
+
+                result.geodesic_scale = cos_sigma12 +
+                                        (t * sin_sigma2 - cos_sigma2 * J12) *
+                                        m_sin_sigma1 / dn1;
+            }
+
+            return result;
         }
 
-        return result;
+    private:
+        CT m_lon1;
+        CT m_b;
+        CT m_f;
+        CT m_ep2;
+        CT m_k2;
+        CT m_sin_beta1;
+        CT m_sin_alpha0;
+        CT m_cos_alpha0;
+        CT m_expansion_A1;
+        CT m_sin_sigma1;
+        CT m_cos_sigma1;
+        CT m_sin_omega1;
+        CT m_cos_omega1;
+        CT m_B11;
+        CT m_sin_tau1;
+        CT m_cos_tau1;
+        boost::array<CT, SeriesOrder + 1> m_coeffs_C1p;
+        CT m_A3c;
+        boost::array<CT, SeriesOrder> m_coeffs_C3;
+        CT m_B31;
+        boost::array<CT, SeriesOrder + 1> m_coeffs_C2;
+        CT m_B21;
+        CT m_expansion_A2;
+    };
+
+    template <typename T, typename Dist, typename Azi, typename Spheroid>
+    static inline result_type apply(T const& lo1,
+                                    T const& la1,
+                                    Dist const& distance,
+                                    Azi const& azimuth12,
+                                    Spheroid const& spheroid)
+    {
+        return line(lo1, la1, azimuth12, spheroid).apply(distance);
     }
 };
 
@@ -98,12 +98,50 @@ class karney_inverse
 public:
     typedef result_inverse<CT> result_type;
 
+    /*!
+    \brief Values and series coefficients depending only on the spheroid,
+        calculated once and reused for any number of pairs of points.
+    */
+    struct constants
+    {
+        template <typename Spheroid>
+        explicit constants(Spheroid const& spheroid)
+            : a(CT(get_radius<0>(spheroid)))
+            , b(CT(get_radius<2>(spheroid)))
+            , f(formula::flattening<CT>(spheroid))
+            , n(f / (CT(2) - f))
+            , ep2(f * (CT(2) - f) / math::sqr(CT(1) - f))
+            , coeffs_C1(n)
+            , coeffs_A3(n)
+            , coeffs_C3x(n)
+        {}
+
+        CT a;
+        CT b;
+        CT f;
+        CT n;
+        CT ep2;
+        se::coeffs_C1<SeriesOrder, CT> coeffs_C1;
+        se::coeffs_A3<SeriesOrder, CT> coeffs_A3;
+        se::coeffs_C3x<SeriesOrder, CT> coeffs_C3x;
+    };
+
     template <typename T1, typename T2, typename Spheroid>
     static inline result_type apply(T1 const& lo1,
                                     T1 const& la1,
                                     T2 const& lo2,
                                     T2 const& la2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lo1, la1, lo2, la2, constants(spheroid));
+    }
+
+    template <typename T1, typename T2>
+    static inline result_type apply(T1 const& lo1,
+                                    T1 const& la1,
+                                    T2 const& lo2,
+                                    T2 const& la2,
+                                    constants const& spheroid_constants)
     {
         static CT const c0 = 0;
         static CT const c0_001 = 0.001;
@@ -128,11 +166,10 @@ public:
         CT lon1 = lo1;
         CT lon2 = lo2;
 
-        CT const a = CT(get_radius<0>(spheroid));
-        CT const b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const a = spheroid_constants.a;
+        CT const b = spheroid_constants.b;
+        CT const f = spheroid_constants.f;
         CT const one_minus_f = c1 - f;
-        CT const two_minus_f = c2 - f;
 
         CT const tol0 = std::numeric_limits<CT>::epsilon();
         CT const tol1 = c200 * tol0;
@@ -146,9 +183,8 @@ public:
 
         CT tiny = std::sqrt((std::numeric_limits<CT>::min)());
 
-        CT const n = f / two_minus_f;
-        CT const e2 = f * two_minus_f;
-        CT const ep2 = e2 / math::sqr(one_minus_f);
+        CT const n = spheroid_constants.n;
+        CT const ep2 = spheroid_constants.ep2;
 
         // Compute the longitudinal difference.
         CT lon12_error;
@@ -240,7 +276,7 @@ public:
         CT m12x, s12x, M21;
 
         // Index zero element of coeffs_C1 is unused.
-        se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(n);
+        se::coeffs_C1<SeriesOrder, CT> const& coeffs_C1 = spheroid_constants.coeffs_C1;
 
         bool meridian = lat1 == -90 || sin_lam12 == 0;
 
@@ -322,9 +358,8 @@ public:
                                    lam12, sin_lam12, cos_lam12,
                                    sin_alpha1, cos_alpha1,
                                    sin_alpha2, cos_alpha2,
-                                   dnm, coeffs_C1, ep2,
-                                   tol1, tol2, etol2,
-                                   n, f);
+                                   dnm, spheroid_constants,
+                                   tol1, tol2, etol2);
 
             if (sigma12 >= c0)
             {
@@ -368,7 +403,7 @@ public:
                                     sin_sigma2, cos_sigma2,
                                     eps, diff_omega12,
                                     iteration < max_iterations,
-                                    dv, f, n, ep2, tiny, coeffs_C1);
+                                    dv, tiny, spheroid_constants);
 
                     // Reversed test to allow escape with NaNs.
                     if (tripb || !(std::abs(v) >= (tripn ? c8 : c1) * tol0))
@@ -576,14 +611,13 @@ public:
      doesn't need to be used, return also sin_alpha2 and
      cos_alpha2 and function value is sig12.
     */
-    template <typename CoeffsC1>
     static inline CT newton_start(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
                                   CT const& sin_beta2, CT const& cos_beta2, CT dn2,
                                   CT const& lam12, CT const& sin_lam12, CT const& cos_lam12,
                                   CT& sin_alpha1, CT& cos_alpha1,
                                   CT& sin_alpha2, CT& cos_alpha2,
-                                  CT& dnm, CoeffsC1 const& coeffs_C1, CT const& ep2,
-                                  CT const& tol1, CT const& tol2, CT const& etol2, CT const& n, CT const& f)
+                                  CT& dnm, constants const& spheroid_constants,
+                                  CT const& tol1, CT const& tol2, CT const& etol2)
     {
         static CT const c0 = 0;
         static CT const c0_01 = 0.01;
@@ -595,6 +629,9 @@ public:
         static CT const c1000 = 1000;
         static CT const pi = math::pi<CT>();
 
+        CT const f = spheroid_constants.f;
+        CT const n = spheroid_constants.n;
+        CT const ep2 = spheroid_constants.ep2;
         CT const one_minus_f = c1 - f;
         CT const x_thresh = c1000 * tol2;
 
@@ -675,7 +712,7 @@ public:
                 CT k2 = math::sqr(sin_beta1) * ep2;
                 CT eps = k2 / (c2 * (c1 + sqrt(c1 + k2)) + k2);
 
-                se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
+                se::coeffs_A3<SeriesOrder, CT> const& coeffs_A3 = spheroid_constants.coeffs_A3;
 
                 CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
 
@@ -695,7 +732,7 @@ public:
                                 sin_beta1, -cos_beta1, dn1,
                                 sin_beta2, cos_beta2, dn2,
                                 cos_beta1, cos_beta2, dummy,
-                                m12b, m0, dummy, dummy, coeffs_C1);
+                                m12b, m0, dummy, dummy, spheroid_constants.coeffs_C1);
 
                 x = -c1 + m12b / (cos_beta1 * cos_beta2 * m0 * pi);
                 beta_scale = x < -c0_01
@@ -831,7 +868,6 @@ public:
         return k;
     }
 
-    template <typename CoeffsC1>
     static inline CT lambda12(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
                               CT const& sin_beta2, CT const& cos_beta2, CT const& dn2,
                               CT const& sin_alpha1, CT cos_alpha1,
@@ -842,13 +878,14 @@ public:
                               CT& sin_sigma2, CT& cos_sigma2,
                               CT& eps, CT& diff_omega12,
                               bool diffp, CT& diff_lam12,
-                              CT const& f, CT const& n, CT const& ep2, CT const& tiny,
-                              CoeffsC1 const& coeffs_C1)
+                              CT const& tiny, constants const& spheroid_constants)
     {
         static CT const c0 = 0;
         static CT const c1 = 1;
         static CT const c2 = 2;
 
+        CT const f = spheroid_constants.f;
+        CT const ep2 = spheroid_constants.ep2;
         CT const one_minus_f = c1 - f;
 
         if (sin_beta1 == c0 && cos_alpha1 == c0)
@@ -915,12 +952,13 @@ public:
 
         eps = k2 / (c2 * (c1 + std::sqrt(c1 + k2)) + k2);
 
-        se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(n, eps);
+        boost::array<CT, SeriesOrder> coeffs_C3;
+        se::evaluate_coeffs_C3(coeffs_C3, spheroid_constants.coeffs_C3x, eps);
 
         B312 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C3)
              - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C3);
 
-        se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
+        se::coeffs_A3<SeriesOrder, CT> const& coeffs_A3 = spheroid_constants.coeffs_A3;
 
         CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
 
@@ -940,7 +978,7 @@ public:
                                                    sin_sigma2, cos_sigma2, dn2,
                                                    cos_beta1, cos_beta2, dummy,
                                                    diff_lam12, dummy, dummy,
-                                                   dummy, coeffs_C1);
+                                                   dummy, spheroid_constants.coeffs_C1);
 
                 diff_lam12 *= one_minus_f / (cos_alpha2 * cos_beta2);
             }
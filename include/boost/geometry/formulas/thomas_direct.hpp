@@ -56,155 +56,204 @@ class thomas_direct
 public:
     typedef result_direct<CT> result_type;
 
-    template <typename T, typename Dist, typename Azi, typename Spheroid>
-    static inline result_type apply(T const& lo1,
-                                    T const& la1,
-                                    Dist const& distance,
-                                    Azi const& azimuth12,
-                                    Spheroid const& spheroid)
+    /*!
+    \brief The geodesic starting at a point in a direction
+    \details The terms not depending on the distance are calculated once,
+        such that points at several distances along the geodesic are
+        calculated faster than by solving the direct problem for each.
+    */
+    class line
     {
-        result_type result;
+    public:
+        template <typename T, typename Azi, typename Spheroid>
+        inline line(T const& lo1,
+                    T const& la1,
+                    Azi const& azimuth12,
+                    Spheroid const& spheroid)
+            : m_lon1(lo1)
+            , m_lat1(la1)
+            , m_azimuth12(azimuth12)
+            , m_a(get_radius<0>(spheroid))
+            , m_b(get_radius<2>(spheroid))
+            , m_f(formula::flattening<CT>(spheroid))
+        {
+            CT const c0 = 0;
+            CT const c1 = 1;
+            CT const c2 = 2;
+            CT const c4 = 4;
 
-        CT const lon1 = lo1;
-        CT const lat1 = la1;
+            CT const one_minus_f = c1 - m_f;
 
-        CT const c0 = 0;
-        CT const c1 = 1;
-        CT const c2 = 2;
-        CT const c4 = 4;
+            CT const pi = math::pi<CT>();
+            CT const pi_half = pi / c2;
 
-        CT const a = CT(get_radius<0>(spheroid));
-        CT const b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
-        CT const one_minus_f = c1 - f;
+            BOOST_GEOMETRY_ASSERT(-pi <= azimuth12 && azimuth12 <= pi);
 
-        CT const pi = math::pi<CT>();
-        CT const pi_half = pi / c2;
+            // keep azimuth small - experiments show low accuracy
+            // if the azimuth is closer to (+-)180 deg.
+            CT azi12_alt = m_azimuth12;
+            CT lat1_alt = m_lat1;
+            m_alter_result = vflip_if_south(m_lat1, m_azimuth12, lat1_alt, azi12_alt);
 
-        BOOST_GEOMETRY_ASSERT(-pi <= azimuth12 && azimuth12 <= pi);
-
-        // keep azimuth small - experiments show low accuracy
-        // if the azimuth is closer to (+-)180 deg.
-        CT azi12_alt = azimuth12;
-        CT lat1_alt = lat1;
-        bool alter_result = vflip_if_south(lat1, azimuth12, lat1_alt, azi12_alt);
-
-        CT const theta1 = math::equals(lat1_alt, pi_half) ? lat1_alt :
-                          math::equals(lat1_alt, -pi_half) ? lat1_alt :
-                          atan(one_minus_f * tan(lat1_alt));
-        CT const sin_theta1 = sin(theta1);
-        CT const cos_theta1 = cos(theta1);
-
-        CT const sin_a12 = sin(azi12_alt);
-        CT const cos_a12 = cos(azi12_alt);
-
-        CT const M = cos_theta1 * sin_a12; // cos_theta0
-        CT const theta0 = acos(M);
-        CT const sin_theta0 = sin(theta0);
-
-        CT const N = cos_theta1 * cos_a12;
-        CT const C1 = f * M; // lower-case c1 in the technical report
-        CT const C2 = f * (c1 - math::sqr(M)) / c4; // lower-case c2 in the technical report
-        CT D = 0;
-        CT P = 0;
-        if ( BOOST_GEOMETRY_CONDITION(SecondOrder) )
-        {
-            D = (c1 - C2) * (c1 - C2 - C1 * M);
-            P = C2 * (c1 + C1 * M / c2) / D;
-        }
-        else
-        {
-            D = c1 - c2 * C2 - C1 * M;
-            P = C2 / D;
-        }
-        // special case for equator:
-        // sin_theta0 = 0 <=> lat1 = 0 ^ |azimuth12| = pi/2
-        // NOTE: in this case it doesn't matter what's the value of cos_sigma1 because
-        //       theta1=0, theta0=0, M=1|-1, C2=0 so X=0 and Y=0 so d_sigma=d
-        //       cos_a12=0 so N=0, therefore
-        //       lat2=0, azi21=pi/2|-pi/2
-        //       d_eta = atan2(sin_d_sigma, cos_d_sigma)
-        //       H = C1 * d_sigma
-        CT const cos_sigma1 = math::equals(sin_theta0, c0)
-                                ? c1
-                                : normalized1_1(sin_theta1 / sin_theta0);
-        CT const sigma1 = acos(cos_sigma1);
-        CT const d = distance / (a * D);
-        CT const u = 2 * (sigma1 - d);
-        CT const cos_d = cos(d);
-        CT const sin_d = sin(d);
-        CT const cos_u = cos(u);
-        CT const sin_u = sin(u);
-
-        CT const W = c1 - c2 * P * cos_u;
-        CT const V = cos_u * cos_d - sin_u * sin_d;
-        CT const Y = c2 * P * V * W * sin_d;
-        CT X = 0;
-        CT d_sigma = d - Y;
-        if ( BOOST_GEOMETRY_CONDITION(SecondOrder) )
-        {
-            X = math::sqr(C2) * sin_d * cos_d * (2 * math::sqr(V) - c1);
-            d_sigma += X;
-        }
-        CT const sin_d_sigma = sin(d_sigma);
-        CT const cos_d_sigma = cos(d_sigma);
+            CT const theta1 = math::equals(lat1_alt, pi_half) ? lat1_alt :
+                              math::equals(lat1_alt, -pi_half) ? lat1_alt :
+                              atan(one_minus_f * tan(lat1_alt));
+            m_sin_theta1 = sin(theta1);
+            m_cos_theta1 = cos(theta1);
 
-        if (BOOST_GEOMETRY_CONDITION(CalcRevAzimuth))
-        {
-            result.reverse_azimuth = atan2(M, N * cos_d_sigma - sin_theta1 * sin_d_sigma);
+            m_sin_a12 = sin(azi12_alt);
+            m_cos_a12 = cos(azi12_alt);
 
-            if (alter_result)
+            m_M = m_cos_theta1 * m_sin_a12; // cos_theta0
+            CT const theta0 = acos(m_M);
+            CT const sin_theta0 = sin(theta0);
+
+            m_N = m_cos_theta1 * m_cos_a12;
+            m_C1 = m_f * m_M; // lower-case c1 in the technical report
+            m_C2 = m_f * (c1 - math::sqr(m_M)) / c4; // lower-case c2 in the technical report
+            if ( BOOST_GEOMETRY_CONDITION(SecondOrder) )
+            {
+                m_D = (c1 - m_C2) * (c1 - m_C2 - m_C1 * m_M);
+                m_P = m_C2 * (c1 + m_C1 * m_M / c2) / m_D;
+            }
+            else
             {
-                vflip_rev_azi(result.reverse_azimuth, azimuth12);
+                m_D = c1 - c2 * m_C2 - m_C1 * m_M;
+                m_P = m_C2 / m_D;
             }
+            // special case for equator:
+            // sin_theta0 = 0 <=> lat1 = 0 ^ |azimuth12| = pi/2
+            // NOTE: in this case it doesn't matter what's the value of cos_sigma1 because
+            //       theta1=0, theta0=0, M=1|-1, C2=0 so X=0 and Y=0 so d_sigma=d
+            //       cos_a12=0 so N=0, therefore
+            //       lat2=0, azi21=pi/2|-pi/2
+            //       d_eta = atan2(sin_d_sigma, cos_d_sigma)
+            //       H = C1 * d_sigma
+            CT const cos_sigma1 = math::equals(sin_theta0, c0)
+                                    ? c1
+                                    : normalized1_1(m_sin_theta1 / sin_theta0);
+            m_sigma1 = acos(cos_sigma1);
         }
 
-        if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
+        //! Calculates the point at a distance along the geodesic
+        template <typename Dist>
+        inline result_type apply(Dist const& distance) const
         {
-            CT const S_sigma = c2 * sigma1 - d_sigma;
-            CT cos_S_sigma = 0;
-            CT H = C1 * d_sigma;
+            result_type result;
+
+            CT const c0 = 0;
+            CT const c1 = 1;
+            CT const c2 = 2;
+
+            CT const d = distance / (m_a * m_D);
+            CT const u = 2 * (m_sigma1 - d);
+            CT const cos_d = cos(d);
+            CT const sin_d = sin(d);
+            CT const cos_u = cos(u);
+            CT const sin_u = sin(u);
+
+            CT const W = c1 - c2 * m_P * cos_u;
+            CT const V = cos_u * cos_d - sin_u * sin_d;
+            CT const Y = c2 * m_P * V * W * sin_d;
+            CT X = 0;
+            CT d_sigma = d - Y;
             if ( BOOST_GEOMETRY_CONDITION(SecondOrder) )
             {
-                cos_S_sigma = cos(S_sigma);
-                H = H * (c1 - C2) - C1 * C2 * sin_d_sigma * cos_S_sigma;
+                X = math::sqr(m_C2) * sin_d * cos_d * (2 * math::sqr(V) - c1);
+                d_sigma += X;
             }
-            CT const d_eta = atan2(sin_d_sigma * sin_a12, cos_theta1 * cos_d_sigma - sin_theta1 * sin_d_sigma * cos_a12);
-            CT const d_lambda = d_eta - H;
+            CT const sin_d_sigma = sin(d_sigma);
+            CT const cos_d_sigma = cos(d_sigma);
 
-            result.lon2 = lon1 + d_lambda;
-
-            if (! math::equals(M, c0))
+            if (BOOST_GEOMETRY_CONDITION(CalcRevAzimuth))
             {
-                CT const sin_a21 = sin(result.reverse_azimuth);
-                CT const tan_theta2 = (sin_theta1 * cos_d_sigma + N * sin_d_sigma) * sin_a21 / M;
-                result.lat2 = atan(tan_theta2 / one_minus_f);
+                result.reverse_azimuth = atan2(m_M, m_N * cos_d_sigma - m_sin_theta1 * sin_d_sigma);
+
+                if (m_alter_result)
+                {
+                    vflip_rev_azi(result.reverse_azimuth, m_azimuth12);
+                }
             }
-            else
+
+            if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
             {
-                CT const sigma2 = S_sigma - sigma1;
-                //theta2 = asin(cos(sigma2)) <=> sin_theta0 = 1
-                // NOTE: cos(sigma2) defines the sign of tan_theta2
-                CT const tan_theta2 = cos(sigma2) / math::abs(sin(sigma2));
-                result.lat2 = atan(tan_theta2 / one_minus_f);
+                CT const one_minus_f = c1 - m_f;
+
+                CT const S_sigma = c2 * m_sigma1 - d_sigma;
+                CT cos_S_sigma = 0;
+                CT H = m_C1 * d_sigma;
+                if ( BOOST_GEOMETRY_CONDITION(SecondOrder) )
+                {
+                    cos_S_sigma = cos(S_sigma);
+                    H = H * (c1 - m_C2) - m_C1 * m_C2 * sin_d_sigma * cos_S_sigma;
+                }
+                CT const d_eta = atan2(sin_d_sigma * m_sin_a12, m_cos_theta1 * cos_d_sigma - m_sin_theta1 * sin_d_sigma * m_cos_a12);
+                CT const d_lambda = d_eta - H;
+
+                result.lon2 = m_lon1 + d_lambda;
+
+                if (! math::equals(m_M, c0))
+                {
+                    CT const sin_a21 = sin(result.reverse_azimuth);
+                    CT const tan_theta2 = (m_sin_theta1 * cos_d_sigma + m_N * sin_d_sigma) * sin_a21 / m_M;
+                    result.lat2 = atan(tan_theta2 / one_minus_f);
+                }
+                else
+                {
+                    CT const sigma2 = S_sigma - m_sigma1;
+                    //theta2 = asin(cos(sigma2)) <=> sin_theta0 = 1
+                    // NOTE: cos(sigma2) defines the sign of tan_theta2
+                    CT const tan_theta2 = cos(sigma2) / math::abs(sin(sigma2));
+                    result.lat2 = atan(tan_theta2 / one_minus_f);
+                }
+
+                if (m_alter_result)
+                {
+                    result.lat2 = -result.lat2;
+                }
             }
 
-            if (alter_result)
+            if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
             {
-                result.lat2 = -result.lat2;
+                typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 2> quantities;
+                quantities::apply(m_lon1, m_lat1, result.lon2, result.lat2,
+                                  m_azimuth12, result.reverse_azimuth,
+                                  m_b, m_f,
+                                  result.reduced_length, result.geodesic_scale);
             }
-        }
 
-        if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
-        {
-            typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 2> quantities;
-            quantities::apply(lon1, lat1, result.lon2, result.lat2,
-                              azimuth12, result.reverse_azimuth,
-                              b, f,
-                              result.reduced_length, result.geodesic_scale);
+            return result;
         }
 
-        return result;
+    private:
+        CT m_lon1;
+        CT m_lat1;
+        CT m_azimuth12;
+        CT m_a;
+        CT m_b;
+        CT m_f;
+        bool m_alter_result;
+        CT m_sin_theta1;
+        CT m_cos_theta1;
+        CT m_sin_a12;
+        CT m_cos_a12;
+        CT m_M;
+        CT m_N;
+        CT m_C1;
+        CT m_C2;
+        CT m_D;
+        CT m_P;
+        CT m_sigma1;
+    };
+
+    template <typename T, typename Dist, typename Azi, typename Spheroid>
+    static inline result_type apply(T const& lo1,
+                                    T const& la1,
+                                    Dist const& distance,
+                                    Azi const& azimuth12,
+                                    Spheroid const& spheroid)
+    {
+        return line(lo1, la1, azimuth12, spheroid).apply(distance);
     }
 
 private:
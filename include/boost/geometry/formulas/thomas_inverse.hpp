@@ -55,12 +55,40 @@ class thomas_inverse
 public:
     typedef result_inverse<CT> result_type;
 
+    /*!
+    \brief Values depending only on the spheroid, calculated once and
+        reused for any number of pairs of points.
+    */
+    struct constants
+    {
+        template <typename Spheroid>
+        explicit constants(Spheroid const& spheroid)
+            : radius_a(CT(get_radius<0>(spheroid)))
+            , radius_b(CT(get_radius<2>(spheroid)))
+            , f(formula::flattening<CT>(spheroid))
+        {}
+
+        CT radius_a;
+        CT radius_b;
+        CT f;
+    };
+
     template <typename T1, typename T2, typename Spheroid>
     static inline result_type apply(T1 const& lon1,
                                     T1 const& lat1,
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lon1, lat1, lon2, lat2, constants(spheroid));
+    }
+
+    template <typename T1, typename T2>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    constants const& spheroid_constants)
     {
         result_type result;
 
@@ -77,7 +105,7 @@ public:
         CT const c4 = 4;
 
         CT const pi_half = math::pi<CT>() / c2;
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const f = spheroid_constants.f;
         CT const one_minus_f = c1 - f;
 
 //        CT const tan_theta1 = one_minus_f * tan(lat1);
@@ -146,7 +174,7 @@ public:
             CT const delta1d = f * (T*X-Y) / c4;
             CT const delta2d = f_sqr_per_64 * (n1 - n2 + n3);
 
-            CT const a = get_radius<0>(spheroid);
+            CT const a = spheroid_constants.radius_a;
 
             //result.distance = a * sin_d * (T - delta1d);
             result.distance = a * sin_d * (T - delta1d + delta2d);
@@ -206,7 +234,7 @@ public:
             typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 2> quantities;
             quantities::apply(lon1, lat1, lon2, lat2,
                               result.azimuth, result.reverse_azimuth,
-                              get_radius<2>(spheroid), f,
+                              spheroid_constants.radius_b, f,
                               result.reduced_length, result.geodesic_scale);
         }
 
@@ -62,110 +62,155 @@ class vincenty_direct
 public:
     typedef result_direct<CT> result_type;
 
-    template <typename T, typename Dist, typename Azi, typename Spheroid>
-    static inline result_type apply(T const& lo1,
-                                    T const& la1,
-                                    Dist const& distance,
-                                    Azi const& azimuth12,
-                                    Spheroid const& spheroid)
+    /*!
+    \brief The geodesic starting at a point in a direction
+    \details The terms not depending on the distance are calculated once,
+        such that points at several distances along the geodesic are
+        calculated faster than by solving the direct problem for each.
+    */
+    class line
     {
-        result_type result;
+    public:
+        template <typename T, typename Azi, typename Spheroid>
+        inline line(T const& lo1,
+                    T const& la1,
+                    Azi const& azimuth12,
+                    Spheroid const& spheroid)
+            : m_lon1(lo1)
+            , m_lat1(la1)
+            , m_azimuth12(azimuth12)
+            , m_radius_b(get_radius<2>(spheroid))
+            , m_flattening(formula::flattening<CT>(spheroid))
+        {
+            CT const radius_a = CT(get_radius<0>(spheroid));
 
-        CT const lon1 = lo1;
-        CT const lat1 = la1;
+            m_sin_azimuth12 = sin(m_azimuth12);
+            m_cos_azimuth12 = cos(m_azimuth12);
 
-        CT const radius_a = CT(get_radius<0>(spheroid));
-        CT const radius_b = CT(get_radius<2>(spheroid));
-        CT const flattening = formula::flattening<CT>(spheroid);
+            // U: reduced latitude, defined by tan U = (1-f) tan phi
+            CT const one_min_f = CT(1) - m_flattening;
+            CT const tan_U1 = one_min_f * tan(m_lat1);
+            m_sigma1 = atan2(tan_U1, m_cos_azimuth12); // (1)
 
-        CT const sin_azimuth12 = sin(azimuth12);
-        CT const cos_azimuth12 = cos(azimuth12);
+            // may be calculated from tan using 1 sqrt()
+            CT const U1 = atan(tan_U1);
+            m_sin_U1 = sin(U1);
+            m_cos_U1 = cos(U1);
 
-        // U: reduced latitude, defined by tan U = (1-f) tan phi
-        CT const one_min_f = CT(1) - flattening;
-        CT const tan_U1 = one_min_f * tan(lat1);
-        CT const sigma1 = atan2(tan_U1, cos_azimuth12); // (1)
+            m_sin_alpha = m_cos_U1 * m_sin_azimuth12; // (2)
+            m_sin_alpha_sqr = math::sqr(m_sin_alpha);
+            m_cos_alpha_sqr = CT(1) - m_sin_alpha_sqr;
 
-        // may be calculated from tan using 1 sqrt()
-        CT const U1 = atan(tan_U1);
-        CT const sin_U1 = sin(U1);
-        CT const cos_U1 = cos(U1);
+            CT const b_sqr = m_radius_b * m_radius_b;
+            CT const u_sqr = m_cos_alpha_sqr * (radius_a * radius_a - b_sqr) / b_sqr;
+            m_A = CT(1) + (u_sqr/CT(16384)) * (CT(4096) + u_sqr*(CT(-768) + u_sqr*(CT(320) - u_sqr*CT(175)))); // (3)
+            m_B = (u_sqr/CT(1024))*(CT(256) + u_sqr*(CT(-128) + u_sqr*(CT(74) - u_sqr*CT(47)))); // (4)
+        }
 
-        CT const sin_alpha = cos_U1 * sin_azimuth12; // (2)
-        CT const sin_alpha_sqr = math::sqr(sin_alpha);
-        CT const cos_alpha_sqr = CT(1) - sin_alpha_sqr;
+        //! Calculates the point at a distance along the geodesic
+        template <typename Dist>
+        inline result_type apply(Dist const& distance) const
+        {
+            result_type result;
 
-        CT const b_sqr = radius_b * radius_b;
-        CT const u_sqr = cos_alpha_sqr * (radius_a * radius_a - b_sqr) / b_sqr;
-        CT const A = CT(1) + (u_sqr/CT(16384)) * (CT(4096) + u_sqr*(CT(-768) + u_sqr*(CT(320) - u_sqr*CT(175)))); // (3)
-        CT const B = (u_sqr/CT(1024))*(CT(256) + u_sqr*(CT(-128) + u_sqr*(CT(74) - u_sqr*CT(47)))); // (4)
+            CT const B = m_B;
 
-        CT s_div_bA = distance / (radius_b * A);
-        CT sigma = s_div_bA; // (7)
+            CT s_div_bA = distance / (m_radius_b * m_A);
+            CT sigma = s_div_bA; // (7)
 
-        CT previous_sigma;
-        CT sin_sigma;
-        CT cos_sigma;
-        CT cos_2sigma_m;
-        CT cos_2sigma_m_sqr;
+            CT previous_sigma;
+            CT sin_sigma;
+            CT cos_sigma;
+            CT cos_2sigma_m;
+            CT cos_2sigma_m_sqr;
 
-        int counter = 0; // robustness
+            int counter = 0; // robustness
 
-        do
-        {
-            previous_sigma = sigma;
+            do
+            {
+                previous_sigma = sigma;
 
-            CT const two_sigma_m = CT(2) * sigma1 + sigma; // (5)
+                CT const two_sigma_m = CT(2) * m_sigma1 + sigma; // (5)
 
-            sin_sigma = sin(sigma);
-            cos_sigma = cos(sigma);
-            CT const sin_sigma_sqr = math::sqr(sin_sigma);
-            cos_2sigma_m = cos(two_sigma_m);
-            cos_2sigma_m_sqr = math::sqr(cos_2sigma_m);
+                sin_sigma = sin(sigma);
+                cos_sigma = cos(sigma);
+                CT const sin_sigma_sqr = math::sqr(sin_sigma);
+                cos_2sigma_m = cos(two_sigma_m);
+                cos_2sigma_m_sqr = math::sqr(cos_2sigma_m);
 
-            CT const delta_sigma = B * sin_sigma * (cos_2sigma_m
-                                        + (B/CT(4)) * ( cos_sigma * (CT(-1) + CT(2)*cos_2sigma_m_sqr)
-                                            - (B/CT(6) * cos_2sigma_m * (CT(-3)+CT(4)*sin_sigma_sqr) * (CT(-3)+CT(4)*cos_2sigma_m_sqr)) )); // (6)
+                CT const delta_sigma = B * sin_sigma * (cos_2sigma_m
+                                            + (B/CT(4)) * ( cos_sigma * (CT(-1) + CT(2)*cos_2sigma_m_sqr)
+                                                - (B/CT(6) * cos_2sigma_m * (CT(-3)+CT(4)*sin_sigma_sqr) * (CT(-3)+CT(4)*cos_2sigma_m_sqr)) )); // (6)
 
-            sigma = s_div_bA + delta_sigma; // (7)
+                sigma = s_div_bA + delta_sigma; // (7)
 
-            ++counter; // robustness
+                ++counter; // robustness
 
-        } while ( geometry::math::abs(previous_sigma - sigma) > CT(1e-12)
-               //&& geometry::math::abs(sigma) < pi
-               && counter < BOOST_GEOMETRY_DETAIL_VINCENTY_MAX_STEPS ); // robustness
+            } while ( geometry::math::abs(previous_sigma - sigma) > CT(1e-12)
+                   //&& geometry::math::abs(sigma) < pi
+                   && counter < BOOST_GEOMETRY_DETAIL_VINCENTY_MAX_STEPS ); // robustness
 
-        if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
-        {
-            result.lat2
-                = atan2( sin_U1 * cos_sigma + cos_U1 * sin_sigma * cos_azimuth12,
-                         one_min_f * math::sqrt(sin_alpha_sqr + math::sqr(sin_U1 * sin_sigma - cos_U1 * cos_sigma * cos_azimuth12))); // (8)
-            
-            CT const lambda = atan2( sin_sigma * sin_azimuth12,
-                                     cos_U1 * cos_sigma - sin_U1 * sin_sigma * cos_azimuth12); // (9)
-            CT const C = (flattening/CT(16)) * cos_alpha_sqr * ( CT(4) + flattening * ( CT(4) - CT(3) * cos_alpha_sqr ) ); // (10)
-            CT const L = lambda - (CT(1) - C) * flattening * sin_alpha
-                            * ( sigma + C * sin_sigma * ( cos_2sigma_m + C * cos_sigma * ( CT(-1) + CT(2) * cos_2sigma_m_sqr ) ) ); // (11)
-
-            result.lon2 = lon1 + L;
-        }
+            if (BOOST_GEOMETRY_CONDITION(CalcCoordinates))
+            {
+                CT const one_min_f = CT(1) - m_flattening;
 
-        if (BOOST_GEOMETRY_CONDITION(CalcRevAzimuth))
-        {
-            result.reverse_azimuth
-                = atan2(sin_alpha, -sin_U1 * sin_sigma + cos_U1 * cos_sigma * cos_azimuth12); // (12)
-        }
+                result.lat2
+                    = atan2( m_sin_U1 * cos_sigma + m_cos_U1 * sin_sigma * m_cos_azimuth12,
+                             one_min_f * math::sqrt(m_sin_alpha_sqr + math::sqr(m_sin_U1 * sin_sigma - m_cos_U1 * cos_sigma * m_cos_azimuth12))); // (8)
 
-        if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
-        {
-            typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 2> quantities;
-            quantities::apply(lon1, lat1, result.lon2, result.lat2,
-                              azimuth12, result.reverse_azimuth,
-                              radius_b, flattening,
-                              result.reduced_length, result.geodesic_scale);
+                CT const lambda = atan2( sin_sigma * m_sin_azimuth12,
+                                         m_cos_U1 * cos_sigma - m_sin_U1 * sin_sigma * m_cos_azimuth12); // (9)
+                CT const C = (m_flattening/CT(16)) * m_cos_alpha_sqr * ( CT(4) + m_flattening * ( CT(4) - CT(3) * m_cos_alpha_sqr ) ); // (10)
+                CT const L = lambda - (CT(1) - C) * m_flattening * m_sin_alpha
+                                * ( sigma + C * sin_sigma * ( cos_2sigma_m + C * cos_sigma * ( CT(-1) + CT(2) * cos_2sigma_m_sqr ) ) ); // (11)
+
+                result.lon2 = m_lon1 + L;
+            }
+
+            if (BOOST_GEOMETRY_CONDITION(CalcRevAzimuth))
+            {
+                result.reverse_azimuth
+                    = atan2(m_sin_alpha, -m_sin_U1 * sin_sigma + m_cos_U1 * cos_sigma * m_cos_azimuth12); // (12)
+            }
+
+            if (BOOST_GEOMETRY_CONDITION(CalcQuantities))
+            {
+                typedef differential_quantities<CT, EnableReducedLength, EnableGeodesicScale, 2> quantities;
+                quantities::apply(m_lon1, m_lat1, result.lon2, result.lat2,
+                                  m_azimuth12, result.reverse_azimuth,
+                                  m_radius_b, m_flattening,
+                                  result.reduced_length, result.geodesic_scale);
+            }
+
+            return result;
         }
 
-        return result;
+    private:
+        CT m_lon1;
+        CT m_lat1;
+        CT m_azimuth12;
+        CT m_radius_b;
+        CT m_flattening;
+        CT m_sin_azimuth12;
+        CT m_cos_azimuth12;
+        CT m_sigma1;
+        CT m_sin_U1;
+        CT m_cos_U1;
+        CT m_sin_alpha;
+        CT m_sin_alpha_sqr;
+        CT m_cos_alpha_sqr;
+        CT m_A;
+        CT m_B;
+    };
+
+    template <typename T, typename Dist, typename Azi, typename Spheroid>
+    static inline result_type apply(T const& lo1,
+                                    T const& la1,
+                                    Dist const& distance,
+                                    Azi const& azimuth12,
+                                    Spheroid const& spheroid)
+    {
+        return line(lo1, la1, azimuth12, spheroid).apply(distance);
     }
 
 };
@@ -65,12 +65,44 @@ struct vincenty_inverse
 public:
     typedef result_inverse<CT> result_type;
 
+    /*!
+    \brief Values depending only on the spheroid, calculated once and
+        reused for any number of pairs of points.
+    */
+    struct constants
+    {
+        template <typename Spheroid>
+        explicit constants(Spheroid const& spheroid)
+            : radius_a(CT(get_radius<0>(spheroid)))
+            , radius_b(CT(get_radius<2>(spheroid)))
+            , f(formula::flattening<CT>(spheroid))
+            , one_min_f(CT(1) - f)
+            , sqr_ab_min_1(math::sqr(radius_a / radius_b) - CT(1))
+        {}
+
+        CT radius_a;
+        CT radius_b;
+        CT f;
+        CT one_min_f;
+        CT sqr_ab_min_1;
+    };
+
     template <typename T1, typename T2, typename Spheroid>
     static inline result_type apply(T1 const& lon1,
                                     T1 const& lat1,
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lon1, lat1, lon2, lat2, constants(spheroid));
+    }
+
+    template <typename T1, typename T2>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    constants const& spheroid_constants)
     {
         result_type result;
 
@@ -97,12 +129,11 @@ public:
         if (L < -pi) L += two_pi;
         if (L > pi) L -= two_pi;
 
-        CT const radius_a = CT(get_radius<0>(spheroid));
-        CT const radius_b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const radius_b = spheroid_constants.radius_b;
+        CT const f = spheroid_constants.f;
 
         // U: reduced latitude, defined by tan U = (1-f) tan phi
-        CT const one_min_f = c1 - f;
+        CT const one_min_f = spheroid_constants.one_min_f;
         CT const tan_U1 = one_min_f * tan(lat1); // above (1)
         CT const tan_U2 = one_min_f * tan(lat2); // above (1)
 
@@ -177,7 +208,7 @@ public:
             CT const c16384 = 16384;
 
             //CT sqr_u = cos2_alpha * (math::sqr(radius_a) - math::sqr(radius_b)) / math::sqr(radius_b); // above (1)
-            CT sqr_u = cos2_alpha * ( math::sqr(radius_a / radius_b) - c1 ); // above (1)
+            CT sqr_u = cos2_alpha * spheroid_constants.sqr_ab_min_1; // above (1)
 
             CT A = c1 + sqr_u/c16384 * (c4096 + sqr_u * (-c768 + sqr_u * (c320 - c175 * sqr_u))); // (3)
             CT B = sqr_u/c1024 * (c256 + sqr_u * ( -c128 + sqr_u * (c74 - c47 * sqr_u))); // (4)
@@ -31,6 +31,7 @@
 #include <boost/geometry/geometries/concepts/multi_linestring_concept.hpp>
 #include <boost/geometry/geometries/concepts/multi_polygon_concept.hpp>
 #include <boost/geometry/geometries/concepts/point_concept.hpp>
+#include <boost/geometry/geometries/concepts/point_source_concept.hpp>
 #include <boost/geometry/geometries/concepts/polygon_concept.hpp>
 #include <boost/geometry/geometries/concepts/ring_concept.hpp>
 #include <boost/geometry/geometries/concepts/segment_concept.hpp>
@@ -177,6 +178,13 @@ struct check<Geometry, multi_polygon_tag, false>
 {};
 
 
+// Point sources are read, so only the mutable version is defined
+template <typename Geometry>
+struct check<Geometry, point_source_tag, false>
+    : detail::concept_check::check<concepts::PointSource<Geometry> >
+{};
+
+
 } // namespace dispatch
 #endif
 
@@ -0,0 +1,74 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_GEOMETRIES_CONCEPTS_POINT_SOURCE_CONCEPT_HPP
+#define BOOST_GEOMETRY_GEOMETRIES_CONCEPTS_POINT_SOURCE_CONCEPT_HPP
+
+
+#include <cstddef>
+
+#include <boost/concept_check.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <boost/geometry/core/point_source.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/concepts/point_concept.hpp>
+
+
+namespace boost { namespace geometry { namespace concepts
+{
+
+
+/*!
+\brief Point source concept
+\ingroup concepts
+\details A point source is a forward-only sequence of points, read in chunks
+    and never held in memory as a whole, e.g. the coordinates of a large
+    multi polygon read from a file. The points are delivered in parts,
+    see point_source_part. A point source is consumed by reading it, so it
+    is passed to the algorithms as a non-const reference.
+\par Formal definition:
+The point source concept is defined as following:
+- there must be a specialization of traits::tag defining point_source_tag
+  as type, and of traits::point_type, e.g. by the registration macro
+  BOOST_GEOMETRY_REGISTER_POINT_SOURCE
+- there must be a member function bool next_part(point_source_part& kind),
+  advancing to the next part and setting its kind, or returning false at
+  the end. Points of the previous part which are not read are skipped.
+- there must be a member function std::size_t read(point_type* points,
+  std::size_t count), reading at most count points of the current part
+  and returning the number read, 0 at the end of the part
+- rings are closed, their order is given by traits::point_order (clockwise
+  by default)
+*/
+template <typename Source>
+class PointSource
+{
+#ifndef DOXYGEN_NO_CONCEPT_MEMBERS
+    typedef typename point_type<Source>::type point_type;
+
+    BOOST_CONCEPT_ASSERT( (concepts::Point<point_type>) );
+
+public :
+
+    BOOST_CONCEPT_USAGE(PointSource)
+    {
+        Source* source = 0;
+        point_source_part kind = part_points;
+        point_type* points = 0;
+        bool const more = source->next_part(kind);
+        std::size_t const count = source->read(points, 1);
+        boost::ignore_unused(more, count);
+    }
+#endif
+};
+
+
+}}} // namespace boost::geometry::concepts
+
+
+#endif // BOOST_GEOMETRY_GEOMETRIES_CONCEPTS_POINT_SOURCE_CONCEPT_HPP
@@ -0,0 +1,44 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#ifndef BOOST_GEOMETRY_GEOMETRIES_REGISTER_POINT_SOURCE_HPP
+#define BOOST_GEOMETRY_GEOMETRIES_REGISTER_POINT_SOURCE_HPP
+
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+/*!
+\brief \brief_macro{point source}
+\ingroup register
+\details \details_macro{BOOST_GEOMETRY_REGISTER_POINT_SOURCE, point source}
+    The point type is the nested type point_type of the source.
+\param Source \param_macro_type{point source}
+*/
+#define BOOST_GEOMETRY_REGISTER_POINT_SOURCE(Source) \
+namespace boost { namespace geometry { namespace traits {  \
+    template<> struct tag<Source> { typedef point_source_tag type; }; \
+    template<> struct point_type<Source> { typedef Source::point_type type; }; \
+}}}
+
+
+/*!
+\brief \brief_macro{templated point source}
+\ingroup register
+\details \details_macro{BOOST_GEOMETRY_REGISTER_POINT_SOURCE_TEMPLATED, templated point source}
+    \details_macro_templated{point source, point}
+\param Source \param_macro_type{point source (without template parameters)}
+*/
+#define BOOST_GEOMETRY_REGISTER_POINT_SOURCE_TEMPLATED(Source) \
+namespace boost { namespace geometry { namespace traits {  \
+    template<typename P> struct tag< Source<P> > { typedef point_source_tag type; }; \
+    template<typename P> struct point_type< Source<P> > { typedef P type; }; \
+}}}
+
+
+#endif // BOOST_GEOMETRY_GEOMETRIES_REGISTER_POINT_SOURCE_HPP
@@ -0,0 +1,169 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_COMPACT_DETAIL_ENCODING_HPP
+#define BOOST_GEOMETRY_IO_COMPACT_DETAIL_ENCODING_HPP
+
+#include <cmath>
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+// Geometry types, as in Tiny WKB (TWKB)
+enum geometry_type
+{
+    compact_point = 1,
+    compact_linestring = 2,
+    compact_polygon = 3,
+    compact_multi_point = 4,
+    compact_multi_linestring = 5,
+    compact_multi_polygon = 6
+};
+
+// Flags of the metadata byte
+enum metadata_flag
+{
+    flag_bbox = 0x01,
+    flag_size = 0x02,
+    flag_idlist = 0x04,
+    flag_extended_dimensions = 0x08,
+    flag_empty = 0x10
+};
+
+// Precision is stored zig-zag encoded in four bits
+static int const min_precision = -8;
+static int const max_precision = 7;
+
+// Quantized coordinates are limited such that their differences fit
+static double const max_quantized = 4.6e18;
+
+inline boost::uint64_t zigzag_encode(boost::int64_t value)
+{
+    return (boost::uint64_t(value) << 1) ^ boost::uint64_t(value >> 63);
+}
+
+inline boost::int64_t zigzag_decode(boost::uint64_t value)
+{
+    return boost::int64_t(value >> 1) ^ -boost::int64_t(value & 1);
+}
+
+template <typename OutputIterator>
+inline void write_varint(boost::uint64_t value, OutputIterator& out)
+{
+    while (value >= 0x80)
+    {
+        *out = char((value & 0x7f) | 0x80);
+        ++out;
+        value >>= 7;
+    }
+    *out = char(value);
+    ++out;
+}
+
+template <typename Iterator>
+inline bool read_varint(Iterator& it, Iterator const& end,
+                        boost::uint64_t& value)
+{
+    // Fast path for the many small deltas
+    if (it != end && (boost::uint8_t(*it) & 0x80) == 0)
+    {
+        value = boost::uint8_t(*it);
+        ++it;
+        return true;
+    }
+
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && it != end; shift += 7)
+    {
+        boost::uint64_t const byte = boost::uint8_t(*it);
+        ++it;
+        value |= (byte & 0x7f) << shift;
+        if (byte < 0x80)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Converts coordinates from and to integers with a decimal precision
+class quantizer
+{
+public:
+    explicit quantizer(int precision = 0)
+        : m_multiply(precision >= 0)
+        , m_factor(1.0)
+    {
+        int const exponent = precision >= 0 ? precision : -precision;
+        for (int i = 0; i < exponent; ++i)
+        {
+            m_factor *= 10.0;
+        }
+    }
+
+    template <typename T>
+    inline bool quantize(T const& value, boost::int64_t& result) const
+    {
+        double const scaled = m_multiply
+            ? static_cast<double>(value) * m_factor
+            : static_cast<double>(value) / m_factor;
+        double const rounded = std::floor(scaled + 0.5);
+
+        // Also false for NaN
+        if (! (rounded > -max_quantized && rounded < max_quantized))
+        {
+            return false;
+        }
+        result = static_cast<boost::int64_t>(rounded);
+        return true;
+    }
+
+    template <typename T>
+    inline T value(boost::int64_t quantized) const
+    {
+        // Division by a power of ten gives the nearest double of the decimal
+        double const result = m_multiply
+            ? static_cast<double>(quantized) / m_factor
+            : static_cast<double>(quantized) * m_factor;
+        return convert<T>(result, boost::is_integral<T>());
+    }
+
+private:
+    template <typename T>
+    static inline T convert(double value, boost::false_type)
+    {
+        return static_cast<T>(value);
+    }
+
+    template <typename T>
+    static inline T convert(double value, boost::true_type)
+    {
+        return static_cast<T>(std::floor(value + 0.5));
+    }
+
+    bool m_multiply;
+    double m_factor;
+};
+
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_COMPACT_DETAIL_ENCODING_HPP
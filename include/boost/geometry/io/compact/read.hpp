@@ -0,0 +1,644 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_COMPACT_READ_HPP
+#define BOOST_GEOMETRY_IO_COMPACT_READ_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/io/compact/detail/encoding.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+template <typename Point, std::size_t I = 0,
+          std::size_t Count = geometry::dimension<Point>::value>
+struct coordinates_assigner
+{
+    static inline void apply(Point& point, quantizer const* quantizers,
+                             boost::int64_t const* values)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        geometry::set<I>(point,
+            quantizers[I].template value<coordinate_type>(values[I]));
+        coordinates_assigner<Point, I + 1, Count>::apply(point, quantizers,
+                                                         values);
+    }
+};
+
+template <typename Point, std::size_t Count>
+struct coordinates_assigner<Point, Count, Count>
+{
+    static inline void apply(Point&, quantizer const*, boost::int64_t const*)
+    {}
+};
+
+template <typename Iterator>
+struct header
+{
+    int type;
+    int flags;
+    std::size_t dimension;
+    quantizer quantizers[4];
+
+    // Quantized minimum and maximum coordinates, if flag_bbox is set
+    boost::int64_t min[4];
+    boost::int64_t max[4];
+
+    // End of the geometry, if flag_size is set
+    Iterator end;
+};
+
+template <typename Iterator>
+inline bool parse_header(Iterator& it, Iterator end, header<Iterator>& h)
+{
+    if (end - it < 2)
+    {
+        return false;
+    }
+
+    boost::uint8_t const type = boost::uint8_t(*it++);
+    h.type = type & 0x0f;
+    h.quantizers[0] = h.quantizers[1]
+                    = quantizer(int(zigzag_decode(type >> 4)));
+    h.flags = boost::uint8_t(*it++);
+    h.dimension = 2;
+    h.end = end;
+
+    if (h.flags & flag_extended_dimensions)
+    {
+        if (it == end)
+        {
+            return false;
+        }
+        boost::uint8_t const dimensions = boost::uint8_t(*it++);
+        if (dimensions & 0x01)
+        {
+            h.quantizers[h.dimension++] = quantizer((dimensions >> 2) & 0x07);
+        }
+        if (dimensions & 0x02)
+        {
+            h.quantizers[h.dimension++] = quantizer((dimensions >> 5) & 0x07);
+        }
+    }
+
+    boost::uint64_t value = 0;
+    if (h.flags & flag_size)
+    {
+        if (! read_varint(it, end, value)
+            || value > boost::uint64_t(end - it))
+        {
+            return false;
+        }
+        h.end = it + std::ptrdiff_t(value);
+    }
+
+    if (h.flags & flag_bbox)
+    {
+        for (std::size_t i = 0; i < h.dimension; ++i)
+        {
+            if (! read_varint(it, h.end, value))
+            {
+                return false;
+            }
+            h.min[i] = zigzag_decode(value);
+            if (! read_varint(it, h.end, value))
+            {
+                return false;
+            }
+            h.max[i] = h.min[i] + zigzag_decode(value);
+        }
+    }
+    return true;
+}
+
+// Reader of counts and delta encoded coordinates
+template <typename Iterator>
+class decoder
+{
+public:
+    decoder(Iterator it, header<Iterator> const& h)
+        : m_it(it)
+        , m_end(h.end)
+        , m_dimension(h.dimension)
+        , m_quantizers(h.quantizers)
+        , m_idlist((h.flags & flag_idlist) != 0)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            m_previous[i] = 0;
+        }
+    }
+
+    // Reads a count of items which take at least item_size bytes each
+    inline bool count(std::size_t& n, std::size_t item_size)
+    {
+        boost::uint64_t value = 0;
+        if (! read_varint(m_it, m_end, value)
+            || value > boost::uint64_t(m_end - m_it) / item_size)
+        {
+            return false;
+        }
+        n = std::size_t(value);
+        return true;
+    }
+
+    inline bool count_points(std::size_t& n)
+    {
+        return count(n, m_dimension);
+    }
+
+    // Skips the identifiers of the elements of a multi geometry
+    inline bool ids(std::size_t n)
+    {
+        boost::uint64_t value = 0;
+        for (std::size_t i = 0; m_idlist && i < n; ++i)
+        {
+            if (! read_varint(m_it, m_end, value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Coordinates which are not stored are 0, those which are not in the
+    // point are skipped
+    template <typename Point>
+    inline bool point(Point& point)
+    {
+        boost::uint64_t value = 0;
+        for (std::size_t i = 0; i < m_dimension; ++i)
+        {
+            if (! read_varint(m_it, m_end, value))
+            {
+                return false;
+            }
+            m_previous[i] += zigzag_decode(value);
+        }
+        coordinates_assigner<Point>::apply(point, m_quantizers, m_previous);
+        return true;
+    }
+
+    inline bool finished() const
+    {
+        return m_it == m_end;
+    }
+
+private:
+    Iterator m_it;
+    Iterator m_end;
+    std::size_t m_dimension;
+    quantizer const* m_quantizers;
+    bool m_idlist;
+    boost::int64_t m_previous[4];
+};
+
+
+template <typename Point>
+struct point_reader
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Point& point)
+    {
+        return decoder.point(point);
+    }
+};
+
+template <typename Range, bool Open = false>
+struct range_reader
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Range& range)
+    {
+        typedef typename boost::range_iterator<Range>::type iterator;
+        typedef typename point_type<Range>::type point_type;
+
+        std::size_t n = 0;
+        if (! decoder.count_points(n))
+        {
+            return false;
+        }
+
+        // The closing point of open rings is read but not stored
+        bool const skip_last = Open && n > 0;
+        range::resize(range, skip_last ? n - 1 : n);
+        for (iterator it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            if (! decoder.point(*it))
+            {
+                return false;
+            }
+        }
+
+        point_type last;
+        return ! skip_last || decoder.point(last);
+    }
+};
+
+template <typename Ring>
+struct ring_reader
+    : range_reader<Ring, geometry::closure<Ring>::value == open>
+{};
+
+template <typename Polygon>
+struct polygon_reader
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Polygon& polygon)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+
+        std::size_t n = 0;
+        if (! decoder.count(n, 1))
+        {
+            return false;
+        }
+        if (n == 0)
+        {
+            return true;
+        }
+
+        if (! ring_reader<ring_type>::apply(decoder, exterior_ring(polygon)))
+        {
+            return false;
+        }
+
+        typename interior_return_type<Polygon>::type
+            interiors = interior_rings(polygon);
+        range::resize(interiors, n - 1);
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            if (! ring_reader<ring_type>::apply(decoder,
+                                                range::at(interiors, i - 1)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename Multi, typename Reader>
+struct multi_reader
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Multi& multi)
+    {
+        typedef typename boost::range_iterator<Multi>::type iterator;
+
+        std::size_t n = 0;
+        if (! decoder.count(n, 1) || ! decoder.ids(n))
+        {
+            return false;
+        }
+
+        range::resize(multi, n);
+        for (iterator it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            if (! Reader::apply(decoder, *it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename MultiPoint>
+struct multi_point_reader
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, MultiPoint& multi_point)
+    {
+        typedef typename boost::range_iterator<MultiPoint>::type iterator;
+
+        std::size_t n = 0;
+        if (! decoder.count_points(n) || ! decoder.ids(n))
+        {
+            return false;
+        }
+
+        range::resize(multi_point, n);
+        for (iterator it = boost::begin(multi_point);
+                it != boost::end(multi_point); ++it)
+        {
+            if (! decoder.point(*it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+// Reads the counts and points of a geometry stored as the compact type()
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_compact : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct read_compact<Point, point_tag>
+    : detail::compact::point_reader<Point>
+{
+    static inline int type() { return detail::compact::compact_point; }
+};
+
+template <typename Linestring>
+struct read_compact<Linestring, linestring_tag>
+    : detail::compact::range_reader<Linestring>
+{
+    static inline int type() { return detail::compact::compact_linestring; }
+};
+
+template <typename Ring>
+struct read_compact<Ring, ring_tag>
+{
+    static inline int type() { return detail::compact::compact_polygon; }
+
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Ring& ring)
+    {
+        std::size_t n = 0;
+        return decoder.count(n, 1)
+            && n <= 1
+            && (n == 0 || detail::compact::ring_reader<Ring>::apply(decoder, ring));
+    }
+};
+
+template <typename Polygon>
+struct read_compact<Polygon, polygon_tag>
+    : detail::compact::polygon_reader<Polygon>
+{
+    static inline int type() { return detail::compact::compact_polygon; }
+};
+
+/*!
+\brief Specialization to read a box from a polygon with a ring of 5 points,
+    of which the first and the third are opposite corners
+*/
+template <typename Box>
+struct read_compact<Box, box_tag>
+{
+    static inline int type() { return detail::compact::compact_polygon; }
+
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Box& box)
+    {
+        typedef typename point_type<Box>::type point_type;
+
+        std::size_t n = 0;
+        if (! decoder.count(n, 1) || n != 1
+            || ! decoder.count_points(n) || n != 5)
+        {
+            return false;
+        }
+
+        point_type corners[5];
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            if (! decoder.point(corners[i]))
+            {
+                return false;
+            }
+        }
+        assign_corners<0>(box, corners[0], corners[2]);
+        assign_corners<1>(box, corners[0], corners[2]);
+        return true;
+    }
+
+private:
+    template <std::size_t I, typename Point>
+    static inline void assign_corners(Box& box, Point const& p1,
+                                      Point const& p2)
+    {
+        bool const less = geometry::get<I>(p1) < geometry::get<I>(p2);
+        geometry::set<min_corner, I>(box, geometry::get<I>(less ? p1 : p2));
+        geometry::set<max_corner, I>(box, geometry::get<I>(less ? p2 : p1));
+    }
+};
+
+template <typename Segment>
+struct read_compact<Segment, segment_tag>
+{
+    static inline int type() { return detail::compact::compact_linestring; }
+
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, Segment& segment)
+    {
+        typedef typename point_type<Segment>::type point_type;
+
+        std::size_t n = 0;
+        point_type points[2];
+        if (! decoder.count_points(n) || n != 2
+            || ! decoder.point(points[0]) || ! decoder.point(points[1]))
+        {
+            return false;
+        }
+        geometry::detail::assign_point_to_index<0>(points[0], segment);
+        geometry::detail::assign_point_to_index<1>(points[1], segment);
+        return true;
+    }
+};
+
+template <typename MultiPoint>
+struct read_compact<MultiPoint, multi_point_tag>
+    : detail::compact::multi_point_reader<MultiPoint>
+{
+    static inline int type() { return detail::compact::compact_multi_point; }
+};
+
+template <typename MultiLinestring>
+struct read_compact<MultiLinestring, multi_linestring_tag>
+    : detail::compact::multi_reader
+        <
+            MultiLinestring,
+            detail::compact::range_reader
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >
+        >
+{
+    static inline int type() { return detail::compact::compact_multi_linestring; }
+};
+
+template <typename MultiPolygon>
+struct read_compact<MultiPolygon, multi_polygon_tag>
+    : detail::compact::multi_reader
+        <
+            MultiPolygon,
+            detail::compact::polygon_reader
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >
+        >
+{
+    static inline int type() { return detail::compact::compact_multi_polygon; }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+template <typename Iterator>
+inline void check_byte_iterator()
+{
+    // Bytes can only be parsed using random access iterators.
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<Iterator>::iterator_category,
+            const std::random_access_iterator_tag&
+        >::value));
+    BOOST_STATIC_ASSERT((
+        boost::is_integral
+            <
+                typename std::iterator_traits<Iterator>::value_type
+            >::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) ==
+        sizeof(typename std::iterator_traits<Iterator>::value_type)));
+}
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads a geometry written by write_compact, or Tiny WKB (TWKB) of the
+    type of the geometry
+\ingroup compact
+\details Boxes are read from polygons and segments from linestrings, as they
+    are written. The coordinates are scaled back by the precision of the
+    header. Coordinates which are not in the encoding, such as Z when
+    reading 2D data into a 3D point, are 0. Identifier lists and sizes of
+    TWKB are accepted, identifiers are ignored.
+\param begin iterator to the first byte, random access
+\param end iterator after the last byte
+\param geometry \param_geometry which is cleared and filled
+\return true if the bytes are a valid encoding of the type of the geometry,
+    without trailing bytes
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_compact(Iterator begin, Iterator end, Geometry& geometry)
+{
+    typedef dispatch::read_compact<Geometry> reader;
+
+    geometry::concepts::check<Geometry>();
+    detail::compact::check_byte_iterator<Iterator>();
+    BOOST_STATIC_ASSERT((geometry::dimension<Geometry>::value <= 4));
+
+    geometry::clear(geometry);
+
+    detail::compact::header<Iterator> h;
+    if (! detail::compact::parse_header(begin, end, h)
+        || h.type != reader::type())
+    {
+        return false;
+    }
+
+    if (h.flags & detail::compact::flag_empty)
+    {
+        return h.type != detail::compact::compact_point
+            && begin == end && h.end == end;
+    }
+
+    detail::compact::decoder<Iterator> decoder(begin, h);
+    return reader::apply(decoder, geometry)
+        && decoder.finished()
+        && h.end == end;
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_compact(ByteType const* bytes, std::size_t length,
+                         Geometry& geometry)
+{
+    return read_compact(bytes, bytes + length, geometry);
+}
+
+/*!
+\brief Reads the bounding box in the header of the compact encoding of a
+    geometry, without decoding the geometry
+\ingroup compact
+\param begin iterator to the first byte, random access
+\param end iterator after the last byte
+\param box the bounding box
+\return true if there is a bounding box, it is written by write_compact if
+    requested and if the geometry is not empty
+*/
+template <typename Iterator, typename Box>
+inline bool read_compact_envelope(Iterator begin, Iterator end, Box& box)
+{
+    typedef typename coordinate_type<Box>::type coordinate_type;
+
+    geometry::concepts::check<Box>();
+    detail::compact::check_byte_iterator<Iterator>();
+
+    detail::compact::header<Iterator> h;
+    if (! detail::compact::parse_header(begin, end, h)
+        || (h.flags & detail::compact::flag_bbox) == 0)
+    {
+        return false;
+    }
+
+    detail::compact::quantizer const& q = h.quantizers[0];
+    geometry::set<min_corner, 0>(box, q.template value<coordinate_type>(h.min[0]));
+    geometry::set<min_corner, 1>(box, q.template value<coordinate_type>(h.min[1]));
+    geometry::set<max_corner, 0>(box, q.template value<coordinate_type>(h.max[0]));
+    geometry::set<max_corner, 1>(box, q.template value<coordinate_type>(h.max[1]));
+    return true;
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_COMPACT_READ_HPP
@@ -0,0 +1,519 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_COMPACT_WRITE_HPP
+#define BOOST_GEOMETRY_IO_COMPACT_WRITE_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/assign_box_corners.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/condition.hpp>
+
+#include <boost/geometry/io/compact/detail/encoding.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+template <typename Point, std::size_t I = 0,
+          std::size_t Count = geometry::dimension<Point>::value>
+struct coordinates_quantizer
+{
+    static inline bool apply(Point const& point, quantizer const* quantizers,
+                             boost::int64_t* values)
+    {
+        return quantizers[I].quantize(geometry::get<I>(point), values[I])
+            && coordinates_quantizer<Point, I + 1, Count>::apply(point,
+                    quantizers, values);
+    }
+};
+
+template <typename Point, std::size_t Count>
+struct coordinates_quantizer<Point, Count, Count>
+{
+    static inline bool apply(Point const&, quantizer const*, boost::int64_t*)
+    {
+        return true;
+    }
+};
+
+// Visitor collecting the bounds of the quantized coordinates
+template <std::size_t Dimension>
+class bounds_visitor
+{
+public:
+    explicit bounds_visitor(quantizer const* quantizers)
+        : m_quantizers(quantizers)
+        , m_valid(true)
+        , m_empty(true)
+    {}
+
+    inline void count(std::size_t) {}
+
+    template <typename Point>
+    inline void point(Point const& point)
+    {
+        boost::int64_t values[Dimension];
+        if (! coordinates_quantizer<Point>::apply(point, m_quantizers, values))
+        {
+            m_valid = false;
+            return;
+        }
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            if (m_empty || values[i] < m_min[i])
+            {
+                m_min[i] = values[i];
+            }
+            if (m_empty || values[i] > m_max[i])
+            {
+                m_max[i] = values[i];
+            }
+        }
+        m_empty = false;
+    }
+
+    inline bool valid() const { return m_valid; }
+
+    template <typename OutputIterator>
+    inline void write(OutputIterator& out) const
+    {
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            write_varint(zigzag_encode(m_empty ? 0 : m_min[i]), out);
+            write_varint(zigzag_encode(m_empty ? 0 : m_max[i] - m_min[i]), out);
+        }
+    }
+
+private:
+    quantizer const* m_quantizers;
+    boost::int64_t m_min[Dimension];
+    boost::int64_t m_max[Dimension];
+    bool m_valid;
+    bool m_empty;
+};
+
+// Visitor writing counts and delta encoded coordinates
+template <typename OutputIterator, std::size_t Dimension>
+class encoder
+{
+public:
+    encoder(OutputIterator& out, quantizer const* quantizers)
+        : m_out(out)
+        , m_quantizers(quantizers)
+        , m_valid(true)
+    {
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            m_previous[i] = 0;
+        }
+    }
+
+    inline void count(std::size_t n)
+    {
+        write_varint(n, m_out);
+    }
+
+    template <typename Point>
+    inline void point(Point const& point)
+    {
+        boost::int64_t values[Dimension];
+        if (! coordinates_quantizer<Point>::apply(point, m_quantizers, values))
+        {
+            m_valid = false;
+            return;
+        }
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            write_varint(zigzag_encode(values[i] - m_previous[i]), m_out);
+            m_previous[i] = values[i];
+        }
+    }
+
+    inline bool valid() const { return m_valid; }
+
+private:
+    OutputIterator& m_out;
+    quantizer const* m_quantizers;
+    boost::int64_t m_previous[Dimension];
+    bool m_valid;
+};
+
+
+template <typename Point>
+struct point_writer
+{
+    template <typename Visitor>
+    static inline void apply(Point const& point, Visitor& visitor)
+    {
+        visitor.point(point);
+    }
+
+    static inline bool empty(Point const&)
+    {
+        return false;
+    }
+};
+
+template <typename Range, bool Close = false>
+struct range_writer
+{
+    template <typename Visitor>
+    static inline void apply(Range const& range, Visitor& visitor)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        iterator const begin = boost::begin(range);
+        iterator const end = boost::end(range);
+        bool const close = BOOST_GEOMETRY_CONDITION(Close) && begin != end;
+
+        visitor.count(boost::size(range) + (close ? 1 : 0));
+        for (iterator it = begin; it != end; ++it)
+        {
+            visitor.point(*it);
+        }
+
+        // Rings are stored closed
+        if (close)
+        {
+            visitor.point(*begin);
+        }
+    }
+
+    static inline bool empty(Range const& range)
+    {
+        return boost::size(range) == 0;
+    }
+};
+
+template <typename Ring>
+struct ring_writer
+    : range_writer<Ring, geometry::closure<Ring>::value == open>
+{};
+
+template <typename Polygon>
+struct polygon_writer
+{
+    template <typename Visitor>
+    static inline void apply(Polygon const& polygon, Visitor& visitor)
+    {
+        typedef typename ring_type<Polygon const>::type ring_type;
+        typedef typename interior_return_type<Polygon const>::type rings_type;
+
+        rings_type rings = interior_rings(polygon);
+        visitor.count(1 + boost::size(rings));
+        ring_writer<ring_type>::apply(exterior_ring(polygon), visitor);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            ring_writer<ring_type>::apply(*it, visitor);
+        }
+    }
+
+    static inline bool empty(Polygon const& polygon)
+    {
+        return boost::size(exterior_ring(polygon)) == 0
+            && boost::size(interior_rings(polygon)) == 0;
+    }
+};
+
+template <typename Multi, typename Writer>
+struct multi_writer
+{
+    template <typename Visitor>
+    static inline void apply(Multi const& multi, Visitor& visitor)
+    {
+        typedef typename boost::range_iterator<Multi const>::type iterator;
+
+        visitor.count(boost::size(multi));
+        for (iterator it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            Writer::apply(*it, visitor);
+        }
+    }
+
+    static inline bool empty(Multi const& multi)
+    {
+        return boost::size(multi) == 0;
+    }
+};
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+// Visits the counts and points of a geometry in the order they are stored,
+// as the compact type()
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct write_compact : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct write_compact<Point, point_tag>
+    : detail::compact::point_writer<Point>
+{
+    static inline int type() { return detail::compact::compact_point; }
+};
+
+template <typename Linestring>
+struct write_compact<Linestring, linestring_tag>
+    : detail::compact::range_writer<Linestring>
+{
+    static inline int type() { return detail::compact::compact_linestring; }
+};
+
+template <typename Ring>
+struct write_compact<Ring, ring_tag>
+{
+    static inline int type() { return detail::compact::compact_polygon; }
+
+    template <typename Visitor>
+    static inline void apply(Ring const& ring, Visitor& visitor)
+    {
+        visitor.count(1);
+        detail::compact::ring_writer<Ring>::apply(ring, visitor);
+    }
+
+    static inline bool empty(Ring const& ring)
+    {
+        return boost::size(ring) == 0;
+    }
+};
+
+template <typename Polygon>
+struct write_compact<Polygon, polygon_tag>
+    : detail::compact::polygon_writer<Polygon>
+{
+    static inline int type() { return detail::compact::compact_polygon; }
+};
+
+/*!
+\brief Specialization to write a box as a polygon, with its corners in
+    clockwise order starting at the minimum corner
+*/
+template <typename Box>
+struct write_compact<Box, box_tag>
+{
+    static inline int type() { return detail::compact::compact_polygon; }
+
+    template <typename Visitor>
+    static inline void apply(Box const& box, Visitor& visitor)
+    {
+        typedef typename point_type<Box>::type point_type;
+
+        point_type corners[4];
+        geometry::detail::assign_box_corners_oriented<false>(box, corners);
+
+        visitor.count(1);
+        visitor.count(5);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            visitor.point(corners[i]);
+        }
+        visitor.point(corners[0]);
+    }
+
+    static inline bool empty(Box const&)
+    {
+        return false;
+    }
+};
+
+template <typename Segment>
+struct write_compact<Segment, segment_tag>
+{
+    static inline int type() { return detail::compact::compact_linestring; }
+
+    template <typename Visitor>
+    static inline void apply(Segment const& segment, Visitor& visitor)
+    {
+        typedef typename point_type<Segment>::type point_type;
+
+        point_type points[2];
+        geometry::detail::assign_point_from_index<0>(segment, points[0]);
+        geometry::detail::assign_point_from_index<1>(segment, points[1]);
+
+        visitor.count(2);
+        visitor.point(points[0]);
+        visitor.point(points[1]);
+    }
+
+    static inline bool empty(Segment const&)
+    {
+        return false;
+    }
+};
+
+template <typename MultiPoint>
+struct write_compact<MultiPoint, multi_point_tag>
+    : detail::compact::range_writer<MultiPoint>
+{
+    static inline int type() { return detail::compact::compact_multi_point; }
+};
+
+template <typename MultiLinestring>
+struct write_compact<MultiLinestring, multi_linestring_tag>
+    : detail::compact::multi_writer
+        <
+            MultiLinestring,
+            detail::compact::range_writer
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >
+        >
+{
+    static inline int type() { return detail::compact::compact_multi_linestring; }
+};
+
+template <typename MultiPolygon>
+struct write_compact<MultiPolygon, multi_polygon_tag>
+    : detail::compact::multi_writer
+        <
+            MultiPolygon,
+            detail::compact::polygon_writer
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >
+        >
+{
+    static inline int type() { return detail::compact::compact_multi_polygon; }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry in a compact binary encoding, compatible with
+    Tiny WKB (TWKB)
+\ingroup compact
+\details Coordinates are rounded to \p precision decimal digits and stored as
+    integers, the first point of the geometry as such and the following
+    points as the difference with their predecessor. The integers are
+    zig-zag encoded variable length integers of 7 bits per byte, so small
+    differences take a single byte. 3D points are written with Z and 4D
+    points with Z and M, which are stored with the precision if it is not
+    negative and otherwise with precision 0. Rings are written closed.
+    Boxes and rings are written as polygons, segments as linestrings.
+\param geometry \param_geometry
+\param out output iterator to which the bytes are written, e.g. a
+    std::back_insert_iterator of a std::string or a std::vector of bytes
+\param precision number of decimal digits, from -8 to 7. Negative values
+    round to tens, hundreds, etc.
+\param bbox if true, the bounding box of the quantized coordinates is written
+    in the header, it can be read by read_compact_envelope
+\return false if the precision is out of range or a coordinate can not be
+    represented with the precision. The output is then incomplete, unless
+    a bounding box was requested: it is checked before anything is written.
+*/
+template <typename Geometry, typename OutputIterator>
+inline bool write_compact(Geometry const& geometry, OutputIterator out,
+                          int precision, bool bbox = false)
+{
+    namespace compact = detail::compact;
+
+    typedef dispatch::write_compact<Geometry> writer;
+    static std::size_t const dimension = geometry::dimension<Geometry>::value;
+
+    geometry::concepts::check<Geometry const>();
+
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<OutputIterator>::iterator_category,
+            const std::output_iterator_tag&
+        >::value));
+    BOOST_STATIC_ASSERT((dimension >= 2 && dimension <= 4));
+
+    if (precision < compact::min_precision || precision > compact::max_precision)
+    {
+        return false;
+    }
+
+    int const zm_precision = precision < 0 ? 0 : precision;
+    compact::quantizer const quantizers[4] =
+    {
+        compact::quantizer(precision), compact::quantizer(precision),
+        compact::quantizer(zm_precision), compact::quantizer(zm_precision)
+    };
+
+    bool const empty = writer::empty(geometry);
+    compact::bounds_visitor<dimension> bounds(quantizers);
+    if (bbox && ! empty)
+    {
+        writer::apply(geometry, bounds);
+        if (! bounds.valid())
+        {
+            return false;
+        }
+    }
+
+    boost::uint64_t const zigzag_precision = compact::zigzag_encode(precision);
+    *out = char(writer::type() | (zigzag_precision << 4));
+    ++out;
+    *out = char((bbox && ! empty ? compact::flag_bbox : 0)
+              | (dimension > 2 ? compact::flag_extended_dimensions : 0)
+              | (empty ? compact::flag_empty : 0));
+    ++out;
+    if (BOOST_GEOMETRY_CONDITION(dimension > 2))
+    {
+        *out = char((dimension > 2 ? 0x01 : 0) | (dimension > 3 ? 0x02 : 0)
+                  | (dimension > 2 ? zm_precision << 2 : 0)
+                  | (dimension > 3 ? zm_precision << 5 : 0));
+        ++out;
+    }
+
+    if (empty)
+    {
+        return true;
+    }
+    if (bbox)
+    {
+        bounds.write(out);
+    }
+
+    compact::encoder<OutputIterator, dimension> encoder(out, quantizers);
+    writer::apply(geometry, encoder);
+    return encoder.valid();
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_COMPACT_WRITE_HPP
@@ -37,6 +37,8 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/util/coordinate_format.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -78,13 +80,16 @@ struct dsv_settings
 template <typename Point, std::size_t Dimension, std::size_t Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Point const& point,
             dsv_settings const& settings)
     {
-        os << (Dimension > 0 ? settings.coordinate_separator : "")
-            << get<Dimension>(point);
+        if (Dimension > 0)
+        {
+            os << settings.coordinate_separator;
+        }
+        os << get<Dimension>(point);
 
         stream_coordinate
             <
@@ -96,8 +101,8 @@ struct stream_coordinate
 template <typename Point, std::size_t Count>
 struct stream_coordinate<Point, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&,
+    template <typename OutputStream>
+    static inline void apply(OutputStream&,
             Point const&,
             dsv_settings const& )
     {
@@ -116,13 +121,16 @@ template
 >
 struct stream_indexed
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
-        os << (Dimension > 0 ? settings.coordinate_separator : "")
-            << get<Index, Dimension>(geometry);
+        if (Dimension > 0)
+        {
+            os << settings.coordinate_separator;
+        }
+        os << get<Index, Dimension>(geometry);
         stream_indexed
             <
                 Geometry, Index, Dimension + 1, Count
@@ -133,8 +141,8 @@ struct stream_indexed
 template <typename Geometry, std::size_t Index, std::size_t Count>
 struct stream_indexed<Geometry, Index, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, Geometry const&,
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, Geometry const&,
             dsv_settings const& )
     {
     }
@@ -146,8 +154,8 @@ struct stream_indexed<Geometry, Index, Count, Count>
 template <typename Point>
 struct dsv_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Point const& p,
             dsv_settings const& settings)
     {
@@ -164,8 +172,8 @@ struct dsv_point
 template <typename Range>
 struct dsv_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Range const& range,
             dsv_settings const& settings)
     {
@@ -179,8 +187,11 @@ struct dsv_range
             it != boost::end(range);
             ++it)
         {
-            os << (first ? "" : settings.point_separator)
-                << settings.point_open;
+            if (! first)
+            {
+                os << settings.point_separator;
+            }
+            os << settings.point_open;
 
             stream_coordinate
                 <
@@ -206,8 +217,8 @@ private:
 template <typename Polygon>
 struct dsv_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly,
                 dsv_settings const& settings)
     {
@@ -234,8 +245,8 @@ struct dsv_per_index
 {
     typedef typename point_type<Geometry>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -253,8 +264,8 @@ struct dsv_indexed
 {
     typedef typename point_type<Geometry>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -367,8 +378,8 @@ struct dsv_multi
         >::type iterator;
 
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 MultiGeometry const& multi,
                 dsv_settings const& settings)
     {
@@ -379,7 +390,10 @@ struct dsv_multi
             it != boost::end(multi);
             ++it, first = false)
         {
-            os << (first ? "" : settings.list_separator);
+            if (! first)
+            {
+                os << settings.list_separator;
+            }
             dispatch_one::apply(os, *it, settings);
         }
         os << settings.list_close;
@@ -403,6 +417,91 @@ struct dsv<multi_tag, Geometry>
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace dsv
+{
+
+/*!
+\brief Internal, output appending DSV to a buffer of characters, used in
+    place of a stream.
+\tparam Buffer container of characters, e.g. std::string or std::vector<char>
+\tparam Formatter formatter of coordinates, see util/coordinate_format.hpp
+*/
+template <typename Buffer, typename Formatter>
+class buffer_output
+{
+public:
+    buffer_output(Buffer& buffer, Formatter const& formatter)
+        : m_buffer(buffer)
+        , m_formatter(formatter)
+    {}
+
+    inline buffer_output& operator<<(std::string const& str)
+    {
+        detail::coordinate_format::append(m_buffer,
+            str.data(), str.data() + str.size());
+        return *this;
+    }
+
+    template <typename Coordinate>
+    inline buffer_output& operator<<(Coordinate const& coordinate)
+    {
+        m_formatter.apply(m_buffer, coordinate);
+        return *this;
+    }
+
+private:
+    Buffer& m_buffer;
+    Formatter m_formatter;
+};
+
+template <typename Geometry, typename Buffer, typename Formatter>
+inline void to_buffer(Geometry const& geometry, Buffer& buffer,
+                      Formatter const& formatter,
+                      dsv_settings const& settings)
+{
+    buffer_output<Buffer, Formatter> output(buffer, formatter);
+    dispatch::dsv
+        <
+            typename tag_cast
+                <
+                    typename tag<Geometry>::type,
+                    multi_tag
+                >::type,
+            Geometry
+        >::apply(output, geometry, settings);
+}
+
+// Writes the points of a range, each followed by the row separator
+template <typename Range, typename Buffer, typename Formatter>
+inline void to_buffer_rows(Range const& points, Buffer& buffer,
+                           Formatter const& formatter,
+                           std::string const& coordinate_separator,
+                           std::string const& row_separator)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef typename boost::range_iterator<Range const>::type iterator_type;
+    typedef stream_coordinate
+        <
+            point_type, 0, dimension<point_type>::type::value
+        > stream_type;
+
+    dsv_settings const settings(coordinate_separator,
+                                "", "", "", "", "", "");
+    buffer_output<Buffer, Formatter> output(buffer, formatter);
+
+    for (iterator_type it = boost::begin(points);
+         it != boost::end(points);
+         ++it)
+    {
+        stream_type::apply(output, *it, settings);
+        output << row_separator;
+    }
+}
+
+}} // namespace detail::dsv
+#endif // DOXYGEN_NO_DETAIL
+
 /*!
 \brief Main DSV-streaming function
 \details DSV stands for Delimiter Separated Values. Geometries can be streamed
@@ -431,6 +530,129 @@ inline detail::dsv::dsv_manipulator<Geometry> dsv(Geometry const& geometry
             list_open, list_close, list_separator));
 }
 
+/*!
+\brief Appends the DSV representation of a geometry to a buffer of
+    characters, without using streams
+\details Coordinates are written with the shortest representation which is
+    read back as the same value. The separators have the same meaning and
+    defaults as in \ref dsv.
+\tparam Geometry \tparam_geometry
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+\param geometry \param_geometry
+\param buffer buffer the DSV is appended to
+\ingroup dsv
+*/
+template <typename Geometry, typename Buffer>
+inline void to_dsv(Geometry const& geometry, Buffer& buffer
+    , std::string const& coordinate_separator = ", "
+    , std::string const& point_open = "("
+    , std::string const& point_close = ")"
+    , std::string const& point_separator = ", "
+    , std::string const& list_open = "("
+    , std::string const& list_close = ")"
+    , std::string const& list_separator = ", "
+    )
+{
+    concepts::check<Geometry const>();
+
+    detail::dsv::to_buffer(geometry, buffer,
+        detail::coordinate_format::shortest(),
+        detail::dsv::dsv_settings(coordinate_separator,
+            point_open, point_close, point_separator,
+            list_open, list_close, list_separator));
+}
+
+/*!
+\brief Appends the DSV representation of a geometry to a buffer of
+    characters, without using streams
+\details Coordinates are written with the number of significant digits
+    passed, the result is the same as streamed with this precision.
+\tparam Geometry \tparam_geometry
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+\param geometry \param_geometry
+\param buffer buffer the DSV is appended to
+\param precision number of significant digits of coordinates
+\ingroup dsv
+*/
+template <typename Geometry, typename Buffer>
+inline void to_dsv(Geometry const& geometry, Buffer& buffer, int precision
+    , std::string const& coordinate_separator = ", "
+    , std::string const& point_open = "("
+    , std::string const& point_close = ")"
+    , std::string const& point_separator = ", "
+    , std::string const& list_open = "("
+    , std::string const& list_close = ")"
+    , std::string const& list_separator = ", "
+    )
+{
+    concepts::check<Geometry const>();
+
+    detail::dsv::to_buffer(geometry, buffer,
+        detail::coordinate_format::precision(precision),
+        detail::dsv::dsv_settings(coordinate_separator,
+            point_open, point_close, point_separator,
+            list_open, list_close, list_separator));
+}
+
+/*!
+\brief Appends the points of a range to a buffer of characters, one row
+    per point, e.g. as CSV
+\details Coordinates are written with the shortest representation which is
+    read back as the same value. Each point, including the last one, is
+    followed by the row separator.
+\tparam Range range of points, e.g. a std::vector or a linestring
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+\param points range of points
+\param buffer buffer the rows are appended to
+\param coordinate_separator separator between the coordinates of a point
+\param row_separator string written after each point
+\ingroup dsv
+*/
+template <typename Range, typename Buffer>
+inline void to_dsv_rows(Range const& points, Buffer& buffer
+    , std::string const& coordinate_separator = ","
+    , std::string const& row_separator = "\n"
+    )
+{
+    concepts::check<typename boost::range_value<Range>::type const>();
+
+    detail::dsv::to_buffer_rows(points, buffer,
+        detail::coordinate_format::shortest(),
+        coordinate_separator, row_separator);
+}
+
+/*!
+\brief Appends the points of a range to a buffer of characters, one row
+    per point, e.g. as CSV
+\details Coordinates are written with the number of significant digits
+    passed. Each point, including the last one, is followed by the row
+    separator.
+\tparam Range range of points, e.g. a std::vector or a linestring
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+\param points range of points
+\param buffer buffer the rows are appended to
+\param precision number of significant digits of coordinates
+\param coordinate_separator separator between the coordinates of a point
+\param row_separator string written after each point
+\ingroup dsv
+*/
+template <typename Range, typename Buffer>
+inline void to_dsv_rows(Range const& points, Buffer& buffer, int precision
+    , std::string const& coordinate_separator = ","
+    , std::string const& row_separator = "\n"
+    )
+{
+    concepts::check<typename boost::range_value<Range>::type const>();
+
+    detail::dsv::to_buffer_rows(points, buffer,
+        detail::coordinate_format::precision(precision),
+        coordinate_separator, row_separator);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_DSV_WRITE_HPP
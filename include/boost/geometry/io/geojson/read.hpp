@@ -0,0 +1,935 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOJSON_READ_HPP
+#define BOOST_GEOMETRY_IO_GEOJSON_READ_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/coordinate_cast.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Exception showing things wrong with GeoJSON parsing
+\ingroup geojson
+\details The offset of the character at which the error was detected is
+    reported. For geojson_reader it is the offset in the current feature,
+    or in the collection without its features.
+*/
+class read_geojson_exception : public geometry::exception
+{
+public:
+    read_geojson_exception(std::string const& message, std::size_t offset)
+        : m_offset(offset)
+    {
+        m_complete = message + " (offset "
+                   + boost::lexical_cast<std::string>(offset) + ")";
+    }
+
+    virtual ~read_geojson_exception() throw() {}
+
+    virtual char const* what() const throw()
+    {
+        return m_complete.c_str();
+    }
+
+    //! Offset of the erroneous character
+    inline std::size_t offset() const
+    {
+        return m_offset;
+    }
+
+private:
+    std::string m_complete;
+    std::size_t m_offset;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+typedef std::pair<char const*, char const*> char_range;
+
+inline bool equals(char_range const& range, char const* str)
+{
+    std::size_t const length = std::strlen(str);
+    return std::size_t(range.second - range.first) == length
+        && std::memcmp(range.first, str, length) == 0;
+}
+
+inline bool is_number_char(char c)
+{
+    return (c >= '0' && c <= '9')
+        || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+/*!
+\brief Internal, pull parser of the JSON of one object, reading the values
+    in place without creating a document
+*/
+class parser
+{
+public:
+    parser(char const* first, char const* last)
+        : m_first(first)
+        , m_it(first)
+        , m_last(last)
+    {}
+
+    // Returns the next character which is not whitespace, or 0 at the end
+    inline char peek()
+    {
+        while (m_it != m_last
+            && (*m_it == ' ' || *m_it == '\n' || *m_it == '\r' || *m_it == '\t'))
+        {
+            ++m_it;
+        }
+        return m_it != m_last ? *m_it : '\0';
+    }
+
+    inline bool consume(char c)
+    {
+        if (peek() == c && m_it != m_last)
+        {
+            ++m_it;
+            return true;
+        }
+        return false;
+    }
+
+    inline void expect(char c)
+    {
+        if (! consume(c))
+        {
+            char const message[] = { 'E', 'x', 'p', 'e', 'c', 't', 'e', 'd',
+                                     ' ', '\'', c, '\'', '\0' };
+            error(message);
+        }
+    }
+
+    inline bool at_end()
+    {
+        return peek() == '\0' && m_it == m_last;
+    }
+
+    // Returns the characters of a string, escape sequences are not replaced
+    inline char_range string()
+    {
+        expect('"');
+        char const* const first = m_it;
+        for ( ; m_it != m_last ; ++m_it)
+        {
+            if (*m_it == '\\')
+            {
+                if (++m_it == m_last)
+                {
+                    break;
+                }
+            }
+            else if (*m_it == '"')
+            {
+                return char_range(first, m_it++);
+            }
+        }
+        error("Unterminated string");
+        return char_range();
+    }
+
+    template <typename CoordinateType>
+    inline CoordinateType number()
+    {
+        peek();
+        char const* const first = m_it;
+        while (m_it != m_last && is_number_char(*m_it))
+        {
+            ++m_it;
+        }
+        if (first == m_it)
+        {
+            error("Expected a number");
+        }
+
+        try
+        {
+            return coordinate_parser<CoordinateType>::apply(first, m_it);
+        }
+        catch (boost::bad_lexical_cast const&)
+        {
+            m_it = first;
+            error("Invalid number");
+        }
+        return CoordinateType();
+    }
+
+    // Skips a value of any type, returning its characters
+    inline char_range value()
+    {
+        char const c = peek();
+        char const* const first = m_it;
+        if (c == '"')
+        {
+            string();
+        }
+        else if (c == '{' || c == '[')
+        {
+            std::size_t depth = 0;
+            do
+            {
+                char const n = peek();
+                if (n == '"')
+                {
+                    string();
+                    continue;
+                }
+                if (n == '\0' && m_it == m_last)
+                {
+                    error("Unexpected end");
+                }
+                if (n == '{' || n == '[')
+                {
+                    ++depth;
+                }
+                else if (n == '}' || n == ']')
+                {
+                    --depth;
+                }
+                ++m_it;
+            }
+            while (depth > 0);
+        }
+        else
+        {
+            // Number, true, false or null
+            while (m_it != m_last
+                && (is_number_char(*m_it) || (*m_it >= 'a' && *m_it <= 'z')))
+            {
+                ++m_it;
+            }
+            if (first == m_it)
+            {
+                error("Expected a value");
+            }
+        }
+        return char_range(first, m_it);
+    }
+
+    inline bool null()
+    {
+        if (peek() == 'n' && m_last - m_it >= 4
+            && std::memcmp(m_it, "null", 4) == 0)
+        {
+            m_it += 4;
+            return true;
+        }
+        return false;
+    }
+
+    inline void error(char const* message) const
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception(message,
+                                std::size_t(m_it - m_first)));
+    }
+
+private:
+    char const* m_first;
+    char const* m_it;
+    char const* m_last;
+};
+
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point>::value
+>
+struct position_assigner
+{
+    // Missing coordinates are initialized to zero, as in WKT
+    static inline void apply(parser& p, Point& point, bool finished)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        if (! finished)
+        {
+            finished = Dimension == 0 ? p.peek() == ']' : ! p.consume(',');
+        }
+
+        set<Dimension>(point, finished
+                              ? coordinate_type()
+                              : p.number<coordinate_type>());
+
+        position_assigner
+            <
+                Point, Dimension + 1, DimensionCount
+            >::apply(p, point, finished);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct position_assigner<Point, DimensionCount, DimensionCount>
+{
+    static inline void apply(parser& p, Point&, bool finished)
+    {
+        // Coordinates not stored in the point (e.g. altitudes) are skipped
+        if (! finished)
+        {
+            while (p.consume(','))
+            {
+                p.value();
+            }
+        }
+    }
+};
+
+template <typename Point>
+inline void parse_position(parser& p, Point& point)
+{
+    p.expect('[');
+    position_assigner<Point>::apply(p, point, false);
+    p.expect(']');
+}
+
+// Parses an array of positions into a linestring or ring, closing points
+// of open rings are not appended
+template <typename Range>
+struct points_parser
+{
+    static inline void apply(parser& p, Range& range)
+    {
+        typedef typename geometry::point_type<Range>::type point_type;
+
+        p.expect('[');
+        if (p.consume(']'))
+        {
+            return;
+        }
+
+        detail::wkt::stateful_range_appender<Range&> appender;
+        bool is_next_expected = true;
+        while (is_next_expected)
+        {
+            point_type point;
+            parse_position(p, point);
+            is_next_expected = p.consume(',');
+            appender.append(range, point, is_next_expected);
+        }
+        p.expect(']');
+    }
+};
+
+template <typename MultiPoint>
+struct multi_point_parser
+{
+    static inline void apply(parser& p, MultiPoint& multi_point)
+    {
+        typedef typename boost::range_value<MultiPoint>::type point_type;
+
+        p.expect('[');
+        if (p.consume(']'))
+        {
+            return;
+        }
+
+        do
+        {
+            point_type point;
+            parse_position(p, point);
+            range::push_back(multi_point, point);
+        }
+        while (p.consume(','));
+        p.expect(']');
+    }
+};
+
+template <typename Polygon>
+struct polygon_parser
+{
+    static inline void apply(parser& p, Polygon& polygon)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+        typedef typename boost::remove_reference
+            <
+                typename traits::interior_mutable_type<Polygon>::type
+            >::type interior_type;
+
+        p.expect('[');
+        if (p.consume(']'))
+        {
+            return;
+        }
+
+        points_parser<ring_type>::apply(p, exterior_ring(polygon));
+        while (p.consume(','))
+        {
+            ring_type ring;
+            points_parser<ring_type>::apply(p, ring);
+            traits::push_back<interior_type>::apply(interior_rings(polygon), ring);
+        }
+        p.expect(']');
+    }
+};
+
+template <typename Multi, typename Parser>
+struct multi_parser
+{
+    static inline void apply(parser& p, Multi& multi)
+    {
+        typedef typename boost::range_value<Multi>::type element_type;
+
+        p.expect('[');
+        if (p.consume(']'))
+        {
+            return;
+        }
+
+        do
+        {
+            range::push_back(multi, element_type());
+            Parser::apply(p, range::back(multi));
+        }
+        while (p.consume(','));
+        p.expect(']');
+    }
+};
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+// Parses the "coordinates" of a GeoJSON geometry of type name()
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_geojson : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct read_geojson<Point, point_tag>
+{
+    static inline char const* name() { return "Point"; }
+
+    static inline void apply(detail::geojson::parser& p, Point& point)
+    {
+        detail::geojson::parse_position(p, point);
+    }
+};
+
+template <typename Linestring>
+struct read_geojson<Linestring, linestring_tag>
+    : detail::geojson::points_parser<Linestring>
+{
+    static inline char const* name() { return "LineString"; }
+};
+
+template <typename Polygon>
+struct read_geojson<Polygon, polygon_tag>
+    : detail::geojson::polygon_parser<Polygon>
+{
+    static inline char const* name() { return "Polygon"; }
+};
+
+template <typename MultiPoint>
+struct read_geojson<MultiPoint, multi_point_tag>
+    : detail::geojson::multi_point_parser<MultiPoint>
+{
+    static inline char const* name() { return "MultiPoint"; }
+};
+
+template <typename MultiLinestring>
+struct read_geojson<MultiLinestring, multi_linestring_tag>
+    : detail::geojson::multi_parser
+        <
+            MultiLinestring,
+            detail::geojson::points_parser
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >
+        >
+{
+    static inline char const* name() { return "MultiLineString"; }
+};
+
+template <typename MultiPolygon>
+struct read_geojson<MultiPolygon, multi_polygon_tag>
+    : detail::geojson::multi_parser
+        <
+            MultiPolygon,
+            detail::geojson::polygon_parser
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >
+        >
+{
+    static inline char const* name() { return "MultiPolygon"; }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+/*!
+\brief Internal, parses a GeoJSON Geometry or Feature object into geometry
+\details The members may come in any order, the coordinates are parsed
+    according to the type of Geometry and the type member is checked when
+    it is found. The properties of a Feature are returned as JSON text,
+    "null" if there are none.
+\return false for a Feature without geometry
+*/
+template <typename Geometry>
+inline bool parse_object(parser& p, Geometry& geometry,
+                         char_range& properties, bool nested = false)
+{
+    typedef dispatch::read_geojson<Geometry> reader;
+
+    static char const null_text[] = "null";
+    properties = char_range(null_text, null_text + 4);
+
+    bool is_feature = false;
+    bool is_geometry = false;
+    bool has_coordinates = false;
+    bool has_geometry = false;
+
+    p.expect('{');
+    if (! p.consume('}'))
+    {
+        do
+        {
+            char_range const key = p.string();
+            p.expect(':');
+            if (equals(key, "type"))
+            {
+                char_range const type = p.string();
+                if (equals(type, reader::name()))
+                {
+                    is_geometry = true;
+                }
+                else if (! nested && equals(type, "Feature"))
+                {
+                    is_feature = true;
+                }
+                else
+                {
+                    p.error("Unexpected type");
+                }
+            }
+            else if (equals(key, "coordinates"))
+            {
+                reader::apply(p, geometry);
+                has_coordinates = true;
+            }
+            else if (! nested && equals(key, "geometry"))
+            {
+                char_range no_properties;
+                has_geometry = ! p.null()
+                            && parse_object(p, geometry, no_properties, true);
+            }
+            else if (! nested && equals(key, "properties"))
+            {
+                properties = p.value();
+            }
+            else
+            {
+                p.value();
+            }
+        }
+        while (p.consume(','));
+        p.expect('}');
+    }
+
+    if (is_geometry)
+    {
+        if (! has_coordinates || has_geometry)
+        {
+            p.error("Expected coordinates");
+        }
+        return true;
+    }
+    if (is_feature)
+    {
+        if (has_coordinates)
+        {
+            p.error("Unexpected coordinates");
+        }
+        return has_geometry;
+    }
+    p.error("Expected type");
+    return false;
+}
+
+/*!
+\brief Internal, scanner of a FeatureCollection passed in chunks, collecting
+    the characters of one Feature at a time
+*/
+class collection_scanner
+{
+public:
+    collection_scanner()
+        : m_depth(0)
+        , m_features_depth(0)
+        , m_in_string(false)
+        , m_escape(false)
+        , m_in_feature(false)
+        , m_colon(false)
+        , m_closed(false)
+        , m_has_features(false)
+        , m_offset(0)
+    {}
+
+    // Calls f(first, last) for each complete feature
+    template <typename Function>
+    inline void apply(char const* first, char const* last, Function& f)
+    {
+        char const* start = first;
+        for (char const* it = first ; it != last ; ++it)
+        {
+            char const c = *it;
+
+            if (m_in_string)
+            {
+                if (! m_in_feature)
+                {
+                    m_collection += c;
+                }
+
+                if (m_escape)
+                {
+                    m_escape = false;
+                }
+                else if (c == '\\')
+                {
+                    m_escape = true;
+                }
+                else if (c == '"')
+                {
+                    m_in_string = false;
+                }
+                else if (m_depth == 1 && ! m_in_feature && m_key.size() < 16)
+                {
+                    m_key += c;
+                }
+                continue;
+            }
+
+            if (m_in_feature)
+            {
+                if (c == '"')
+                {
+                    m_in_string = true;
+                }
+                else if (c == '{' || c == '[')
+                {
+                    ++m_depth;
+                }
+                else if (c == '}' || c == ']')
+                {
+                    if (--m_depth == m_features_depth)
+                    {
+                        m_feature.append(start, it + 1);
+                        f(m_feature.data(), m_feature.data() + m_feature.size());
+                        m_feature.clear();
+                        m_in_feature = false;
+                        start = it + 1;
+                    }
+                }
+                continue;
+            }
+
+            if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+            {
+                continue;
+            }
+
+            if (m_features_depth > 0 && m_depth == m_features_depth)
+            {
+                // Between the features
+                if (c == '{')
+                {
+                    m_in_feature = true;
+                    ++m_depth;
+                    start = it;
+                }
+                else if (c == ']')
+                {
+                    --m_depth;
+                    m_features_depth = 0;
+                    m_collection += c;
+                }
+                else if (c != ',')
+                {
+                    error("Expected a Feature");
+                }
+                continue;
+            }
+
+            if (m_depth == 0 && (m_closed || c != '{'))
+            {
+                error("Expected end");
+            }
+
+            m_collection += c;
+            if (c == '"')
+            {
+                m_in_string = true;
+                if (m_depth == 1)
+                {
+                    m_key.clear();
+                }
+            }
+            else if (c == '{' || c == '[')
+            {
+                if (c == '[' && m_depth == 1 && m_colon && m_key == "features")
+                {
+                    m_features_depth = m_depth + 1;
+                    m_has_features = true;
+                }
+                ++m_depth;
+            }
+            else if (c == '}' || c == ']')
+            {
+                if (--m_depth == 0)
+                {
+                    m_closed = true;
+                }
+            }
+            m_colon = c == ':';
+        }
+
+        if (m_in_feature)
+        {
+            m_feature.append(start, last);
+        }
+        m_offset += std::size_t(last - first);
+    }
+
+    inline bool complete() const
+    {
+        return m_closed;
+    }
+
+    inline bool has_features() const
+    {
+        return m_has_features;
+    }
+
+    // Characters of the top level object, without the features
+    inline std::string const& collection() const
+    {
+        return m_collection;
+    }
+
+private:
+    inline void error(char const* message) const
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception(message, m_offset));
+    }
+
+    std::size_t m_depth;
+    std::size_t m_features_depth;
+    bool m_in_string;
+    bool m_escape;
+    bool m_in_feature;
+    bool m_colon;
+    bool m_closed;
+    bool m_has_features;
+    std::size_t m_offset;
+    std::string m_key;
+    std::string m_feature;
+    std::string m_collection;
+};
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Parses a GeoJSON Geometry object, or a Feature object, into a geometry
+\ingroup geojson
+\details The coordinates are parsed directly into the geometry, which can be
+    of any type fulfilling the concept (e.g. model::polygon or a registered
+    type). The GeoJSON type should match the type of the geometry. Extra
+    coordinates of positions are ignored and missing coordinates are set to
+    zero. Polygons are not corrected, and rings are not reversed.
+    Throws read_geojson_exception if the GeoJSON is invalid.
+\return false if it is a Feature without geometry, the geometry is empty then
+*/
+template <typename Geometry>
+inline bool read_geojson(char const* first, char const* last, Geometry& geometry)
+{
+    concepts::check<Geometry>();
+
+    geometry::clear(geometry);
+
+    detail::geojson::parser p(first, last);
+    detail::geojson::char_range properties;
+    bool const result = detail::geojson::parse_object(p, geometry, properties);
+    if (! p.at_end())
+    {
+        p.error("Expected end");
+    }
+    return result;
+}
+
+template <typename Geometry>
+inline bool read_geojson(std::string const& geojson, Geometry& geometry)
+{
+    return read_geojson(geojson.data(), geojson.data() + geojson.size(),
+                        geometry);
+}
+
+
+/*!
+\brief Reader of GeoJSON passed in chunks, e.g. a FeatureCollection larger
+    than the memory, calling a handler for each Feature
+\ingroup geojson
+\details The chunks can be split anywhere. Only the characters of the
+    current Feature are kept, its geometry is parsed directly into a
+    Geometry as by read_geojson when the Feature is complete. The handler
+    is called with the geometry and the properties as JSON text, e.g.
+    handler(Geometry const& geometry, std::string const& properties).
+    Features without geometry are passed with an empty geometry.
+    A single Feature or Geometry object is also accepted, it is passed to
+    the handler by finish().
+    Throws read_geojson_exception if the GeoJSON is invalid.
+\tparam Geometry type of the geometries of the features
+\tparam Handler function object called for each feature
+*/
+template <typename Geometry, typename Handler>
+class geojson_reader
+{
+public:
+    explicit geojson_reader(Handler const& handler = Handler())
+        : m_handler(handler)
+    {
+        concepts::check<Geometry>();
+    }
+
+    //! Reads the next chunk of characters
+    inline void feed(char const* data, std::size_t size)
+    {
+        m_scanner.apply(data, data + size, *this);
+    }
+
+    inline void feed(std::string const& chunk)
+    {
+        feed(chunk.data(), chunk.size());
+    }
+
+    //! Checks that the GeoJSON is complete, after the last chunk
+    inline void finish()
+    {
+        std::string const& top = m_scanner.collection();
+        if (! m_scanner.complete())
+        {
+            BOOST_THROW_EXCEPTION(read_geojson_exception("Unexpected end",
+                                                         top.size()));
+        }
+
+        if (m_scanner.has_features())
+        {
+            check_collection(top);
+        }
+        else
+        {
+            (*this)(top.data(), top.data() + top.size());
+        }
+    }
+
+    inline Handler const& handler() const { return m_handler; }
+    inline Handler& handler() { return m_handler; }
+
+#ifndef DOXYGEN_NO_DETAIL
+    // Parses a complete feature
+    inline void operator()(char const* first, char const* last)
+    {
+        geometry::clear(m_geometry);
+
+        detail::geojson::parser p(first, last);
+        detail::geojson::char_range properties;
+        detail::geojson::parse_object(p, m_geometry, properties);
+
+        m_properties.assign(properties.first, properties.second);
+        m_handler(static_cast<Geometry const&>(m_geometry),
+                  static_cast<std::string const&>(m_properties));
+    }
+#endif
+
+private:
+    static inline void check_collection(std::string const& top)
+    {
+        detail::geojson::parser p(top.data(), top.data() + top.size());
+        bool is_collection = false;
+        p.expect('{');
+        do
+        {
+            detail::geojson::char_range const key = p.string();
+            p.expect(':');
+            if (detail::geojson::equals(key, "type"))
+            {
+                is_collection = detail::geojson::equals(p.string(),
+                                                        "FeatureCollection");
+            }
+            else
+            {
+                p.value();
+            }
+        }
+        while (p.consume(','));
+        p.expect('}');
+
+        if (! is_collection)
+        {
+            p.error("Expected FeatureCollection");
+        }
+    }
+
+    Handler m_handler;
+    detail::geojson::collection_scanner m_scanner;
+    Geometry m_geometry;
+    std::string m_properties;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_GEOJSON_READ_HPP
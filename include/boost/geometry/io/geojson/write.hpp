@@ -0,0 +1,442 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOJSON_WRITE_HPP
+#define BOOST_GEOMETRY_IO_GEOJSON_WRITE_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/assign_box_corners.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/interior_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/coordinate_format.hpp>
+
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+template <typename Point, std::size_t I = 0,
+          std::size_t Count = geometry::dimension<Point>::value>
+struct position_writer
+{
+    template <typename Output>
+    static inline void apply(Output& out, Point const& point)
+    {
+        out << (I == 0 ? "[" : ",") << geometry::get<I>(point);
+        position_writer<Point, I + 1, Count>::apply(out, point);
+    }
+};
+
+template <typename Point, std::size_t Count>
+struct position_writer<Point, Count, Count>
+{
+    template <typename Output>
+    static inline void apply(Output& out, Point const&)
+    {
+        out << "]";
+    }
+};
+
+template <typename Range, bool Close = false>
+struct positions_writer
+{
+    template <typename Output>
+    static inline void apply(Output& out, Range const& range)
+    {
+        typedef typename geometry::point_type<Range>::type point_type;
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        out << "[";
+        iterator const begin = boost::begin(range);
+        iterator const end = boost::end(range);
+        for (iterator it = begin ; it != end ; ++it)
+        {
+            if (it != begin)
+            {
+                out << ",";
+            }
+            position_writer<point_type>::apply(out, *it);
+        }
+
+        // GeoJSON rings are closed
+        if (BOOST_GEOMETRY_CONDITION(Close) && begin != end)
+        {
+            out << ",";
+            position_writer<point_type>::apply(out, *begin);
+        }
+        out << "]";
+    }
+};
+
+template <typename Ring>
+struct ring_writer
+    : positions_writer<Ring, geometry::closure<Ring>::value == open>
+{};
+
+template <typename Polygon>
+struct polygon_writer
+{
+    template <typename Output>
+    static inline void apply(Output& out, Polygon const& polygon)
+    {
+        typedef typename ring_type<Polygon const>::type ring_type;
+        typedef typename interior_return_type<Polygon const>::type rings_type;
+
+        out << "[";
+        ring_writer<ring_type>::apply(out, exterior_ring(polygon));
+
+        rings_type rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            out << ",";
+            ring_writer<ring_type>::apply(out, *it);
+        }
+        out << "]";
+    }
+};
+
+template <typename Multi, typename Writer>
+struct multi_writer
+{
+    template <typename Output>
+    static inline void apply(Output& out, Multi const& multi)
+    {
+        typedef typename boost::range_iterator<Multi const>::type iterator;
+
+        out << "[";
+        for (iterator it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            if (it != boost::begin(multi))
+            {
+                out << ",";
+            }
+            Writer::apply(out, *it);
+        }
+        out << "]";
+    }
+};
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+// Writes the "coordinates" of a GeoJSON geometry of type name()
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct geojson : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct geojson<Point, point_tag>
+    : detail::geojson::position_writer<Point>
+{
+    static inline char const* name() { return "Point"; }
+};
+
+template <typename Linestring>
+struct geojson<Linestring, linestring_tag>
+    : detail::geojson::positions_writer<Linestring>
+{
+    static inline char const* name() { return "LineString"; }
+};
+
+template <typename Ring>
+struct geojson<Ring, ring_tag>
+{
+    static inline char const* name() { return "Polygon"; }
+
+    template <typename Output>
+    static inline void apply(Output& out, Ring const& ring)
+    {
+        out << "[";
+        detail::geojson::ring_writer<Ring>::apply(out, ring);
+        out << "]";
+    }
+};
+
+template <typename Polygon>
+struct geojson<Polygon, polygon_tag>
+    : detail::geojson::polygon_writer<Polygon>
+{
+    static inline char const* name() { return "Polygon"; }
+};
+
+/*!
+\brief Specialization to write a box as a GeoJSON Polygon
+*/
+template <typename Box>
+struct geojson<Box, box_tag>
+{
+    static inline char const* name() { return "Polygon"; }
+
+    template <typename Output>
+    static inline void apply(Output& out, Box const& box)
+    {
+        typedef typename point_type<Box>::type point_type;
+        typedef detail::geojson::position_writer<point_type> writer;
+
+        point_type corners[4];
+        geometry::detail::assign_box_corners_oriented<false>(box, corners);
+
+        out << "[[";
+        for (std::size_t i = 0 ; i < 4 ; ++i)
+        {
+            writer::apply(out, corners[i]);
+            out << ",";
+        }
+        writer::apply(out, corners[0]);
+        out << "]]";
+    }
+};
+
+template <typename Segment>
+struct geojson<Segment, segment_tag>
+{
+    static inline char const* name() { return "LineString"; }
+
+    template <typename Output>
+    static inline void apply(Output& out, Segment const& segment)
+    {
+        typedef typename point_type<Segment>::type point_type;
+        typedef detail::geojson::position_writer<point_type> writer;
+
+        point_type points[2];
+        geometry::detail::assign_point_from_index<0>(segment, points[0]);
+        geometry::detail::assign_point_from_index<1>(segment, points[1]);
+
+        out << "[";
+        writer::apply(out, points[0]);
+        out << ",";
+        writer::apply(out, points[1]);
+        out << "]";
+    }
+};
+
+template <typename MultiPoint>
+struct geojson<MultiPoint, multi_point_tag>
+    : detail::geojson::positions_writer<MultiPoint>
+{
+    static inline char const* name() { return "MultiPoint"; }
+};
+
+template <typename MultiLinestring>
+struct geojson<MultiLinestring, multi_linestring_tag>
+    : detail::geojson::multi_writer
+        <
+            MultiLinestring,
+            detail::geojson::positions_writer
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >
+        >
+{
+    static inline char const* name() { return "MultiLineString"; }
+};
+
+template <typename MultiPolygon>
+struct geojson<MultiPolygon, multi_polygon_tag>
+    : detail::geojson::multi_writer
+        <
+            MultiPolygon,
+            detail::geojson::polygon_writer
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >
+        >
+{
+    static inline char const* name() { return "MultiPolygon"; }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+template <typename Geometry, typename Buffer, typename Formatter>
+inline void to_buffer(Geometry const& geometry, Buffer& buffer,
+                      Formatter const& formatter)
+{
+    typedef dispatch::geojson<Geometry> writer;
+
+    detail::wkt::buffer_output<Buffer, Formatter> out(buffer, formatter);
+    out << "{\"type\":\"" << writer::name() << "\",\"coordinates\":";
+    writer::apply(out, geometry);
+    out << "}";
+}
+
+template <typename Geometry, typename Buffer, typename Formatter>
+inline void feature_to_buffer(Geometry const& geometry,
+                              std::string const& properties,
+                              Buffer& buffer, Formatter const& formatter)
+{
+    detail::wkt::buffer_output<Buffer, Formatter> out(buffer, formatter);
+    out << "{\"type\":\"Feature\",\"geometry\":";
+    to_buffer(geometry, buffer, formatter);
+    out << ",\"properties\":" << (properties.empty() ? "null" : properties.c_str())
+        << "}";
+}
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Appends a geometry as a GeoJSON Geometry object to a buffer of
+    characters
+\ingroup geojson
+\details Coordinates are written with the shortest representation which is
+    read back as the same value. Boxes and rings are written as Polygons,
+    segments as LineStrings. Rings are closed, their orientation is not
+    changed.
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+*/
+template <typename Geometry, typename Buffer>
+inline void to_geojson(Geometry const& geometry, Buffer& buffer)
+{
+    concepts::check<Geometry const>();
+
+    detail::geojson::to_buffer(geometry, buffer,
+                               detail::coordinate_format::shortest());
+}
+
+/*!
+\brief Appends a geometry as a GeoJSON Geometry object to a buffer of
+    characters, with coordinates written with a number of significant digits
+\ingroup geojson
+*/
+template <typename Geometry, typename Buffer>
+inline void to_geojson(Geometry const& geometry, Buffer& buffer, int precision)
+{
+    concepts::check<Geometry const>();
+
+    detail::geojson::to_buffer(geometry, buffer,
+                               detail::coordinate_format::precision(precision));
+}
+
+
+/*!
+\brief Writer of a GeoJSON FeatureCollection to a stream, one Feature at a time
+\ingroup geojson
+\details Each feature is formatted into a buffer which is reused and written
+    to the stream when it is added, so the collection does not have to fit
+    into memory. The collection is completed by close(), which is not
+    called by the destructor.
+*/
+class geojson_writer
+{
+public:
+    //! Writes coordinates with their shortest representation
+    explicit geojson_writer(std::ostream& os)
+        : m_os(os)
+        , m_precision(-1)
+        , m_count(0)
+        , m_closed(false)
+    {}
+
+    //! Writes coordinates with a number of significant digits
+    geojson_writer(std::ostream& os, int precision)
+        : m_os(os)
+        , m_precision(precision)
+        , m_count(0)
+        , m_closed(false)
+    {}
+
+    /*!
+    \brief Writes a Feature
+    \param geometry \param_geometry
+    \param properties the properties as JSON text, e.g. {"name":"Amsterdam"},
+        or empty for null
+    */
+    template <typename Geometry>
+    inline void add(Geometry const& geometry,
+                    std::string const& properties = std::string())
+    {
+        concepts::check<Geometry const>();
+
+        m_buffer.clear();
+        m_buffer += m_count == 0
+                  ? "{\"type\":\"FeatureCollection\",\"features\":["
+                  : ",";
+        if (m_precision < 0)
+        {
+            detail::geojson::feature_to_buffer(geometry, properties, m_buffer,
+                detail::coordinate_format::shortest());
+        }
+        else
+        {
+            detail::geojson::feature_to_buffer(geometry, properties, m_buffer,
+                detail::coordinate_format::precision(m_precision));
+        }
+        m_os.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        ++m_count;
+    }
+
+    //! Completes the FeatureCollection
+    inline void close()
+    {
+        if (m_closed)
+        {
+            return;
+        }
+        if (m_count == 0)
+        {
+            m_os << "{\"type\":\"FeatureCollection\",\"features\":[";
+        }
+        m_os << "]}";
+        m_os.flush();
+        m_closed = true;
+    }
+
+    //! Number of features written
+    inline std::size_t count() const { return m_count; }
+
+private:
+    std::ostream& m_os;
+    int m_precision;
+    std::size_t m_count;
+    bool m_closed;
+    std::string m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_GEOJSON_WRITE_HPP
@@ -0,0 +1,532 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_RECORDS_READ_HPP
+#define BOOST_GEOMETRY_IO_RECORDS_READ_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/execution.hpp>
+
+#include <boost/geometry/io/wkb/read.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Exception thrown by read_wkt_records and read_wkb_records
+\ingroup core
+\details Reports the index of the record which could not be read, and the
+    reason.
+*/
+class read_records_exception : public geometry::exception
+{
+public:
+    read_records_exception(std::size_t record, std::string const& reason)
+        : m_record(record)
+        , m_what("Boost.Geometry Read records exception: record "
+                 + boost::lexical_cast<std::string>(record) + ": " + reason)
+    {}
+
+    virtual ~read_records_exception() throw() {}
+
+    virtual char const* what() const throw()
+    {
+        return m_what.c_str();
+    }
+
+    //! Index of the record, counting the records from 0
+    inline std::size_t record() const
+    {
+        return m_record;
+    }
+
+private:
+    std::size_t m_record;
+    std::string m_what;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace records
+{
+
+// Called for each record read into the output
+struct no_values
+{
+    template <typename Geometry>
+    inline void apply(std::size_t, Geometry const&) const
+    {}
+};
+
+// Fills values for the packing constructor of the rtree
+template <typename Box>
+struct envelope_values
+{
+    typedef std::pair<Box, std::size_t> value_type;
+
+    envelope_values(std::vector<value_type>& values, std::size_t offset)
+        : m_values(values)
+        , m_offset(offset)
+    {}
+
+    template <typename Geometry>
+    inline void apply(std::size_t index, Geometry const& geometry) const
+    {
+        value_type& value = m_values[index - m_offset];
+        geometry::envelope(geometry, value.first);
+        value.second = index;
+    }
+
+    std::vector<value_type>& m_values;
+    std::size_t m_offset;
+};
+
+template <typename Values>
+struct values_resizer
+{
+    static inline void apply(Values const&, std::size_t) {}
+};
+
+template <typename Box>
+struct values_resizer<envelope_values<Box> >
+{
+    static inline void apply(envelope_values<Box> const& values,
+                             std::size_t count)
+    {
+        values.m_values.resize(values.m_values.size() + count);
+    }
+};
+
+
+// Newline delimited text, one record per line. Lines containing only
+// whitespace are skipped.
+
+inline bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Start of the first line at or after offset
+inline char const* line_begin(char const* data, char const* end,
+                              std::size_t offset)
+{
+    char const* it = data + offset;
+    if (offset == 0 || it == end || *(it - 1) == '\n')
+    {
+        return it;
+    }
+    it = std::find(it, end, '\n');
+    return it == end ? end : it + 1;
+}
+
+// Finds the next non blank line, returns it without surrounding whitespace
+inline bool next_line(char const*& it, char const* end,
+                      char const*& first, char const*& last)
+{
+    while (it != end)
+    {
+        char const* const eol = std::find(it, end, '\n');
+        first = it;
+        last = eol;
+        it = eol == end ? end : eol + 1;
+
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        while (last != first && is_blank(*(last - 1)))
+        {
+            --last;
+        }
+        if (first != last)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct line_counter
+{
+    line_counter(char const* data, char const* end,
+                 std::vector<std::size_t>& counts)
+        : m_data(data)
+        , m_end(end)
+        , m_counts(counts)
+    {}
+
+    inline void operator()(std::size_t chunk, std::size_t first,
+                           std::size_t last) const
+    {
+        char const* it = line_begin(m_data, m_end, first);
+        char const* const end = line_begin(m_data, m_end, last);
+        char const* line_first = NULL;
+        char const* line_last = NULL;
+        std::size_t count = 0;
+        while (next_line(it, end, line_first, line_last))
+        {
+            ++count;
+        }
+        m_counts[chunk] = count;
+    }
+
+    char const* m_data;
+    char const* m_end;
+    std::vector<std::size_t>& m_counts;
+};
+
+template <typename Geometry, typename Values>
+struct wkt_chunk_reader
+{
+    wkt_chunk_reader(char const* data, char const* end,
+                     std::vector<std::size_t> const& offsets,
+                     std::vector<Geometry>& geometries, Values const& values)
+        : m_data(data)
+        , m_end(end)
+        , m_offsets(offsets)
+        , m_geometries(geometries)
+        , m_values(values)
+    {}
+
+    inline void operator()(std::size_t chunk, std::size_t first,
+                           std::size_t last) const
+    {
+        char const* it = line_begin(m_data, m_end, first);
+        char const* const end = line_begin(m_data, m_end, last);
+        char const* line_first = NULL;
+        char const* line_last = NULL;
+
+        // Reused for all records of the chunk
+        std::string wkt;
+        std::size_t index = m_offsets[chunk];
+        while (next_line(it, end, line_first, line_last))
+        {
+            wkt.assign(line_first, line_last);
+            Geometry& geometry = m_geometries[index];
+            try
+            {
+                geometry::read_wkt(wkt, geometry);
+            }
+            catch (std::exception const& e)
+            {
+                throw read_records_exception(index - m_offsets.front(),
+                                             e.what());
+            }
+            m_values.apply(index, geometry);
+            ++index;
+        }
+    }
+
+    char const* m_data;
+    char const* m_end;
+    std::vector<std::size_t> const& m_offsets;
+    std::vector<Geometry>& m_geometries;
+    Values m_values;
+};
+
+// Converts the counts per chunk to the index of their first geometry
+inline std::size_t offsets_from_counts(std::vector<std::size_t>& counts,
+                                       std::size_t offset)
+{
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        std::size_t const count = counts[i];
+        counts[i] = offset;
+        offset += count;
+    }
+    return offset;
+}
+
+template <typename Geometry, typename Values, typename ExecutionPolicy>
+inline void read_wkt(char const* first, char const* last,
+                     std::vector<Geometry>& geometries, Values const& values,
+                     ExecutionPolicy const& policy)
+{
+    geometry::concepts::check<Geometry>();
+
+    // Chunks of bytes, the records starting in a chunk belong to it. They
+    // are counted first, such that they can be read in place.
+    std::size_t const size = std::size_t(last - first);
+    std::vector<std::size_t> offsets(
+        detail::execution::chunk_count(size, policy), 0);
+    detail::execution::for_each_chunk(size, policy,
+        line_counter(first, last, offsets));
+
+    std::size_t const begin = geometries.size();
+    std::size_t const end = offsets_from_counts(offsets, begin);
+    geometries.resize(end);
+    values_resizer<Values>::apply(values, end - begin);
+
+    detail::execution::for_each_chunk(size, policy,
+        wkt_chunk_reader<Geometry, Values>(first, last, offsets,
+                                           geometries, values));
+}
+
+
+// Records of WKB prefixed by their length, a 32 bit unsigned little endian
+// integer. The start of every stride-th record is indexed, such that the
+// records can be divided in chunks without keeping the start of all records.
+class wkb_index
+{
+public:
+    static std::size_t const stride = 1024;
+
+    wkb_index(boost::uint8_t const* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+        , m_count(0)
+    {
+        std::size_t offset = 0;
+        while (offset < size)
+        {
+            if (m_count % stride == 0)
+            {
+                m_starts.push_back(offset);
+            }
+            offset = next(offset, m_count);
+            ++m_count;
+        }
+    }
+
+    inline std::size_t size() const
+    {
+        return m_count;
+    }
+
+    //! Offset of the length of a record
+    inline std::size_t start(std::size_t record) const
+    {
+        std::size_t offset = m_starts[record / stride];
+        for (std::size_t i = record - record % stride; i < record; ++i)
+        {
+            offset = next(offset, i);
+        }
+        return offset;
+    }
+
+    //! Offset of the next record, checking the length of the record
+    inline std::size_t next(std::size_t offset, std::size_t record) const
+    {
+        if (m_size - offset < 4)
+        {
+            throw read_records_exception(record, "incomplete length");
+        }
+        boost::uint8_t const* const p = m_data + offset;
+        std::size_t const length = std::size_t(p[0])
+                                 | std::size_t(p[1]) << 8
+                                 | std::size_t(p[2]) << 16
+                                 | std::size_t(boost::uint32_t(p[3]) << 24);
+        if (m_size - offset - 4 < length)
+        {
+            throw read_records_exception(record, "incomplete WKB");
+        }
+        return offset + 4 + length;
+    }
+
+    inline boost::uint8_t const* data() const
+    {
+        return m_data;
+    }
+
+private:
+    boost::uint8_t const* m_data;
+    std::size_t m_size;
+    std::size_t m_count;
+    std::vector<std::size_t> m_starts;
+};
+
+template <typename Geometry, typename Values>
+struct wkb_chunk_reader
+{
+    wkb_chunk_reader(wkb_index const& index, std::size_t offset,
+                     std::vector<Geometry>& geometries, Values const& values)
+        : m_index(index)
+        , m_offset(offset)
+        , m_geometries(geometries)
+        , m_values(values)
+    {}
+
+    inline void operator()(std::size_t, std::size_t first,
+                           std::size_t last) const
+    {
+        std::size_t start = first < last ? m_index.start(first) : 0;
+        for (std::size_t i = first; i < last; ++i)
+        {
+            std::size_t const next = m_index.next(start, i);
+            Geometry& geometry = m_geometries[m_offset + i];
+            if (! geometry::read_wkb(m_index.data() + start + 4,
+                                     m_index.data() + next, geometry))
+            {
+                throw read_records_exception(i,
+                    "invalid WKB or WKB of another type");
+            }
+            m_values.apply(m_offset + i, geometry);
+            start = next;
+        }
+    }
+
+    wkb_index const& m_index;
+    std::size_t m_offset;
+    std::vector<Geometry>& m_geometries;
+    Values m_values;
+};
+
+template <typename Geometry, typename Values, typename ExecutionPolicy>
+inline void read_wkb(boost::uint8_t const* data, std::size_t size,
+                     std::vector<Geometry>& geometries, Values const& values,
+                     ExecutionPolicy const& policy)
+{
+    geometry::concepts::check<Geometry>();
+
+    wkb_index const index(data, size);
+
+    std::size_t const begin = geometries.size();
+    geometries.resize(begin + index.size());
+    values_resizer<Values>::apply(values, index.size());
+
+    detail::execution::for_each_chunk(index.size(), policy,
+        wkb_chunk_reader<Geometry, Values>(index, begin, geometries, values));
+}
+
+}} // namespace detail::records
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads newline delimited WKT, one geometry per line, in parallel
+\ingroup wkt
+\details The text is divided into chunks at line boundaries, which are
+    parsed on the threads of the policy directly into their place in the
+    output: the geometries are appended in the order of the lines.
+    Empty lines, and lines containing only whitespace, are skipped.
+\param first pointer to the first character, e.g. of a mapped file
+\param last pointer after the last character
+\param geometries vector to which the geometries are appended
+\param policy execution policy, the grain size of a parallel policy is
+    the minimum number of characters of a chunk
+\exception read_records_exception if a line can not be read, the
+    geometries are then in an unspecified state
+*/
+template <typename Geometry, typename ExecutionPolicy>
+inline void read_wkt_records(char const* first, char const* last,
+                             std::vector<Geometry>& geometries,
+                             ExecutionPolicy const& policy)
+{
+    detail::records::read_wkt(first, last, geometries,
+                              detail::records::no_values(), policy);
+}
+
+template <typename Geometry>
+inline void read_wkt_records(char const* first, char const* last,
+                             std::vector<Geometry>& geometries)
+{
+    read_wkt_records(first, last, geometries, execution::sequenced_policy());
+}
+
+/*!
+\brief Reads newline delimited WKT in parallel, and the values for the
+    packing constructor of an rtree
+\ingroup wkt
+\details Besides the geometries, the envelope of each geometry and its
+    index in \p geometries are appended to \p values, such that
+    rtree<std::pair<Box, std::size_t>, ...>(values) can be constructed
+    without another pass over the geometries.
+*/
+template <typename Geometry, typename Box, typename ExecutionPolicy>
+inline void read_wkt_records(char const* first, char const* last,
+                             std::vector<Geometry>& geometries,
+                             std::vector<std::pair<Box, std::size_t> >& values,
+                             ExecutionPolicy const& policy)
+{
+    detail::records::read_wkt(first, last, geometries,
+        detail::records::envelope_values<Box>(values,
+            geometries.size() - values.size()),
+        policy);
+}
+
+/*!
+\brief Reads records of WKB prefixed by their length, in parallel
+\ingroup wkb
+\details Each record is a 32 bit unsigned little endian length followed by
+    that number of bytes of WKB. The lengths are scanned first, then the
+    records are parsed on the threads of the policy directly into their
+    place in the output: the geometries are appended in the order of the
+    records.
+\param data pointer to the first byte, e.g. of a mapped file
+\param size number of bytes
+\param geometries vector to which the geometries are appended
+\param policy execution policy, the grain size of a parallel policy is the
+    minimum number of records of a chunk
+\exception read_records_exception if a record is incomplete or can not be
+    read into the geometry type, the geometries are then in an unspecified
+    state
+*/
+template <typename ByteType, typename Geometry, typename ExecutionPolicy>
+inline void read_wkb_records(ByteType const* data, std::size_t size,
+                             std::vector<Geometry>& geometries,
+                             ExecutionPolicy const& policy)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    detail::records::read_wkb(reinterpret_cast<boost::uint8_t const*>(data),
+                              size, geometries,
+                              detail::records::no_values(), policy);
+}
+
+template <typename ByteType, typename Geometry>
+inline void read_wkb_records(ByteType const* data, std::size_t size,
+                             std::vector<Geometry>& geometries)
+{
+    read_wkb_records(data, size, geometries, execution::sequenced_policy());
+}
+
+/*!
+\brief Reads records of WKB prefixed by their length in parallel, and the
+    values for the packing constructor of an rtree
+\ingroup wkb
+\details Besides the geometries, the envelope of each geometry and its
+    index in \p geometries are appended to \p values.
+*/
+template <typename ByteType, typename Geometry, typename Box,
+          typename ExecutionPolicy>
+inline void read_wkb_records(ByteType const* data, std::size_t size,
+                             std::vector<Geometry>& geometries,
+                             std::vector<std::pair<Box, std::size_t> >& values,
+                             ExecutionPolicy const& policy)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    detail::records::read_wkb(reinterpret_cast<boost::uint8_t const*>(data),
+        size, geometries,
+        detail::records::envelope_values<Box>(values,
+            geometries.size() - values.size()),
+        policy);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_RECORDS_READ_HPP
@@ -0,0 +1,757 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_SVG_STREAM_MAPPER_HPP
+#define BOOST_GEOMETRY_IO_SVG_STREAM_MAPPER_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/strategies/transform/map_transformer.hpp>
+#include <boost/geometry/util/coordinate_format.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace svg
+{
+
+struct pixel
+{
+    pixel() : x(0), y(0) {}
+    pixel(double x_, double y_) : x(x_), y(y_) {}
+    double x, y;
+};
+
+/*!
+\brief Decimates a range of pixels while they are added: coincident pixels
+    are skipped and pixels within the tolerance of the line from the last
+    kept pixel in the direction of the next one are replaced by their
+    successor (Reumann-Witkam). The kept pixels deviate at most twice the
+    tolerance from the input.
+*/
+class pixel_decimator
+{
+public:
+    explicit pixel_decimator(double tolerance)
+        : m_tolerance(tolerance)
+    {
+        clear();
+    }
+
+    inline void clear()
+    {
+        m_kept.clear();
+        m_has_pending = false;
+        m_has_direction = false;
+    }
+
+    inline void add(pixel const& p)
+    {
+        if (m_kept.empty())
+        {
+            m_kept.push_back(p);
+            return;
+        }
+
+        pixel const& last = m_has_pending ? m_pending : m_kept.back();
+        if (std::fabs(p.x - last.x) <= m_tolerance
+            && std::fabs(p.y - last.y) <= m_tolerance)
+        {
+            return;
+        }
+
+        pixel const& anchor = m_kept.back();
+        double const dx = p.x - anchor.x;
+        double const dy = p.y - anchor.y;
+
+        if (m_has_direction)
+        {
+            // Distance to the line and position along it
+            double const cross = std::fabs(m_dx * dy - m_dy * dx) / m_length;
+            double const along = (m_dx * dx + m_dy * dy) / m_length;
+            if (cross <= m_tolerance && along >= m_along)
+            {
+                m_pending = p;
+                m_along = along;
+                return;
+            }
+
+            m_kept.push_back(m_pending);
+            set_direction(p);
+            return;
+        }
+
+        set_direction(p);
+    }
+
+    //! Returns the kept pixels, including the last one
+    inline std::vector<pixel> const& finish()
+    {
+        if (m_has_pending)
+        {
+            m_kept.push_back(m_pending);
+            m_has_pending = false;
+        }
+        m_has_direction = false;
+        return m_kept;
+    }
+
+    //! Returns the kept pixels of a ring, without its closing pixel
+    inline std::vector<pixel> const& finish_ring()
+    {
+        finish();
+        if (m_kept.size() > 1
+            && std::fabs(m_kept.back().x - m_kept.front().x) <= m_tolerance
+            && std::fabs(m_kept.back().y - m_kept.front().y) <= m_tolerance)
+        {
+            m_kept.pop_back();
+        }
+        return m_kept;
+    }
+
+private:
+    inline void set_direction(pixel const& p)
+    {
+        pixel const& anchor = m_kept.back();
+        m_dx = p.x - anchor.x;
+        m_dy = p.y - anchor.y;
+        m_length = std::sqrt(m_dx * m_dx + m_dy * m_dy);
+        m_along = m_length;
+        m_pending = p;
+        m_has_pending = true;
+        m_has_direction = m_length > 0;
+    }
+
+    double m_tolerance;
+    std::vector<pixel> m_kept;
+    pixel m_pending;
+    bool m_has_pending;
+    bool m_has_direction;
+    double m_dx, m_dy, m_length, m_along;
+};
+
+/*!
+\brief State of svg_stream_mapper: the transformation, the decimator and the
+    buffer which is formatted and written to the stream in large blocks
+*/
+template <typename Point, bool SameScale>
+class stream_context
+{
+    typedef typename geometry::select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+
+    typedef strategy::transform::map_transformer
+        <
+            calculation_type,
+            geometry::dimension<Point>::type::value,
+            geometry::dimension<Point>::type::value,
+            true,
+            SameScale
+        > transformer_type;
+
+    typedef model::point<double, 2, cs::cartesian> svg_point_type;
+
+public:
+    template <typename Box>
+    stream_context(std::ostream& stream, Box const& viewport,
+                   double width, double height, double tolerance,
+                   std::size_t flush_size)
+        : m_stream(stream)
+        , m_transformer(viewport, width, height)
+        , m_width(width)
+        , m_height(height)
+        , m_decimator(tolerance)
+        , m_flush_size(flush_size)
+        , m_written(0)
+        , m_skipped(0)
+    {
+        m_buffer.reserve(flush_size + flush_size / 4);
+    }
+
+    template <typename P>
+    inline pixel transform(P const& point) const
+    {
+        svg_point_type result;
+        m_transformer.apply(point, result);
+        return pixel(geometry::get<0>(result), geometry::get<1>(result));
+    }
+
+    // Pixels are written with one decimal, unless they are too large to be
+    // converted to an integer (e.g. far outside of a small viewport)
+    inline void append(double value)
+    {
+        double const scaled = std::floor(value * 10.0 + 0.5);
+        bool const negative = scaled < 0;
+        double const abs_scaled = negative ? -scaled : scaled;
+        if (! (abs_scaled < 9007199254740992.0)) // 2^53, false for NaN
+        {
+            coordinate_format::shortest().apply(m_buffer, value);
+            return;
+        }
+        coordinate_format::append_decimal(m_buffer, negative,
+            boost::uint64_t(abs_scaled), 1);
+    }
+
+    inline void append(pixel const& p)
+    {
+        append(p.x);
+        m_buffer += ',';
+        append(p.y);
+    }
+
+    inline void append(char const* s)
+    {
+        m_buffer += s;
+    }
+
+    inline void append(std::string const& s)
+    {
+        m_buffer += s;
+    }
+
+    // Decimates a range of points, returns false if it is outside the
+    // viewport or if too few pixels are left. A ring needs three distinct
+    // pixels, a linestring two.
+    template <typename Range>
+    inline bool decimate(Range const& range, bool closed)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        m_decimator.clear();
+        bool first = true;
+        pixel min, max;
+        for (iterator it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            pixel const p = transform(*it);
+            if (first)
+            {
+                min = max = p;
+                first = false;
+            }
+            else
+            {
+                expand(min, max, p);
+            }
+            m_decimator.add(p);
+        }
+        return ! first
+            && visible(min, max, 0)
+            && (closed ? m_decimator.finish_ring().size() >= 3
+                       : m_decimator.finish().size() >= 2);
+    }
+
+    inline std::vector<pixel> const& decimated()
+    {
+        return m_decimator.finish();
+    }
+
+    inline bool visible(pixel const& min, pixel const& max, double margin) const
+    {
+        return max.x >= -margin && max.y >= -margin
+            && min.x <= m_width + margin && min.y <= m_height + margin;
+    }
+
+    static inline void expand(pixel& min, pixel& max, pixel const& p)
+    {
+        if (p.x < min.x) { min.x = p.x; }
+        if (p.y < min.y) { min.y = p.y; }
+        if (p.x > max.x) { max.x = p.x; }
+        if (p.y > max.y) { max.y = p.y; }
+    }
+
+    // Called after each element
+    inline void written(bool written)
+    {
+        if (written)
+        {
+            ++m_written;
+        }
+        else
+        {
+            ++m_skipped;
+        }
+        if (m_buffer.size() >= m_flush_size)
+        {
+            flush();
+        }
+    }
+
+    inline void flush()
+    {
+        m_stream.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        m_buffer.clear();
+    }
+
+    inline std::size_t written_count() const { return m_written; }
+    inline std::size_t skipped_count() const { return m_skipped; }
+
+private:
+    std::ostream& m_stream;
+    transformer_type m_transformer;
+    double m_width, m_height;
+    pixel_decimator m_decimator;
+    std::string m_buffer;
+    std::size_t m_flush_size;
+    std::size_t m_written;
+    std::size_t m_skipped;
+};
+
+
+template <typename Point>
+struct stream_point
+{
+    template <typename Context>
+    static inline void apply(Context& context, Point const& point,
+                             std::string const& style, double size)
+    {
+        double const radius = size < 0 ? 5 : size;
+        pixel const p = context.transform(point);
+        if (! context.visible(p, p, radius))
+        {
+            context.written(false);
+            return;
+        }
+
+        context.append("<circle cx=\"");
+        context.append(p.x);
+        context.append("\" cy=\"");
+        context.append(p.y);
+        context.append("\" r=\"");
+        context.append(radius);
+        context.append("\" style=\"");
+        context.append(style);
+        context.append("\"/>\n");
+        context.written(true);
+    }
+};
+
+template <typename Box>
+struct stream_box
+{
+    template <typename Context>
+    static inline void apply(Context& context, Box const& box,
+                             std::string const& style, double)
+    {
+        typedef typename point_type<Box>::type point_type;
+
+        point_type corner;
+        geometry::detail::assign_point_from_index<0>(box, corner);
+        pixel min = context.transform(corner);
+        pixel max = min;
+        geometry::detail::assign_point_from_index<1>(box, corner);
+        Context::expand(min, max, context.transform(corner));
+        if (! context.visible(min, max, 0))
+        {
+            context.written(false);
+            return;
+        }
+
+        // Prevent invisible boxes, making them at least one pixel
+        context.append("<rect x=\"");
+        context.append(min.x);
+        context.append("\" y=\"");
+        context.append(min.y);
+        context.append("\" width=\"");
+        context.append((std::max)(1.0, max.x - min.x));
+        context.append("\" height=\"");
+        context.append((std::max)(1.0, max.y - min.y));
+        context.append("\" style=\"");
+        context.append(style);
+        context.append("\"/>\n");
+        context.written(true);
+    }
+};
+
+template <typename Segment>
+struct stream_segment
+{
+    template <typename Context>
+    static inline void apply(Context& context, Segment const& segment,
+                             std::string const& style, double)
+    {
+        typedef typename point_type<Segment>::type point_type;
+
+        point_type point;
+        geometry::detail::assign_point_from_index<0>(segment, point);
+        pixel const p1 = context.transform(point);
+        geometry::detail::assign_point_from_index<1>(segment, point);
+        pixel const p2 = context.transform(point);
+
+        pixel min = p1, max = p1;
+        Context::expand(min, max, p2);
+        if (! context.visible(min, max, 0))
+        {
+            context.written(false);
+            return;
+        }
+
+        context.append("<line x1=\"");
+        context.append(p1.x);
+        context.append("\" y1=\"");
+        context.append(p1.y);
+        context.append("\" x2=\"");
+        context.append(p2.x);
+        context.append("\" y2=\"");
+        context.append(p2.y);
+        context.append("\" style=\"");
+        context.append(style);
+        context.append("\"/>\n");
+        context.written(true);
+    }
+};
+
+template <typename Context>
+inline void append_points(Context& context, std::vector<pixel> const& pixels)
+{
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+    {
+        if (i > 0)
+        {
+            context.append(" ");
+        }
+        context.append(pixels[i]);
+    }
+}
+
+template <typename Range, bool Closed>
+struct stream_range
+{
+    template <typename Context>
+    static inline void apply(Context& context, Range const& range,
+                             std::string const& style, double)
+    {
+        if (! context.decimate(range, Closed))
+        {
+            context.written(false);
+            return;
+        }
+
+        context.append(Closed ? "<polygon points=\"" : "<polyline points=\"");
+        append_points(context, context.decimated());
+        context.append("\" style=\"");
+        context.append(style);
+        context.append(Closed ? "\"/>\n" : ";fill:none\"/>\n");
+        context.written(true);
+    }
+};
+
+template <typename Polygon>
+struct stream_polygon
+{
+    template <typename Context>
+    static inline void append_ring(Context& context)
+    {
+        std::vector<pixel> const& pixels = context.decimated();
+        context.append("M");
+        context.append(pixels[0]);
+        context.append("L");
+        for (std::size_t i = 1; i < pixels.size(); ++i)
+        {
+            if (i > 1)
+            {
+                context.append(" ");
+            }
+            context.append(pixels[i]);
+        }
+        context.append("Z");
+    }
+
+    template <typename Context>
+    static inline void apply(Context& context, Polygon const& polygon,
+                             std::string const& style, double)
+    {
+        // Interior rings are not visible if the exterior ring is not
+        if (! context.decimate(exterior_ring(polygon), true))
+        {
+            context.written(false);
+            return;
+        }
+
+        context.append("<path fill-rule=\"evenodd\" d=\"");
+        append_ring(context);
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            if (context.decimate(*it, true))
+            {
+                append_ring(context);
+            }
+        }
+        context.append("\" style=\"");
+        context.append(style);
+        context.append("\"/>\n");
+        context.written(true);
+    }
+};
+
+template <typename Multi, typename Policy>
+struct stream_multi
+{
+    template <typename Context>
+    static inline void apply(Context& context, Multi const& multi,
+                             std::string const& style, double size)
+    {
+        for (typename boost::range_iterator<Multi const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            Policy::apply(context, *it, style, size);
+        }
+    }
+};
+
+}} // namespace detail::svg
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct svg_stream_map
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            false, NOT_OR_NOT_YET_IMPLEMENTED_FOR_THIS_GEOMETRY_TYPE
+            , (Geometry)
+        );
+};
+
+template <typename Point>
+struct svg_stream_map<Point, point_tag>
+    : detail::svg::stream_point<Point>
+{};
+
+template <typename Box>
+struct svg_stream_map<Box, box_tag>
+    : detail::svg::stream_box<Box>
+{};
+
+template <typename Segment>
+struct svg_stream_map<Segment, segment_tag>
+    : detail::svg::stream_segment<Segment>
+{};
+
+template <typename Linestring>
+struct svg_stream_map<Linestring, linestring_tag>
+    : detail::svg::stream_range<Linestring, false>
+{};
+
+template <typename Ring>
+struct svg_stream_map<Ring, ring_tag>
+    : detail::svg::stream_range<Ring, true>
+{};
+
+template <typename Polygon>
+struct svg_stream_map<Polygon, polygon_tag>
+    : detail::svg::stream_polygon<Polygon>
+{};
+
+template <typename MultiPoint>
+struct svg_stream_map<MultiPoint, multi_point_tag>
+    : detail::svg::stream_multi
+        <
+            MultiPoint,
+            detail::svg::stream_point
+                <
+                    typename boost::range_value<MultiPoint>::type
+                >
+        >
+{};
+
+template <typename MultiLinestring>
+struct svg_stream_map<MultiLinestring, multi_linestring_tag>
+    : detail::svg::stream_multi
+        <
+            MultiLinestring,
+            detail::svg::stream_range
+                <
+                    typename boost::range_value<MultiLinestring>::type,
+                    false
+                >
+        >
+{};
+
+template <typename MultiPolygon>
+struct svg_stream_map<MultiPolygon, multi_polygon_tag>
+    : detail::svg::stream_multi
+        <
+            MultiPolygon,
+            detail::svg::stream_polygon
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >
+        >
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Helper class to create SVG maps of very many geometries, writing them
+    while they are mapped
+\details Unlike svg_mapper, the viewport is given and geometries do not have
+    to be added before they are mapped, so they do not have to be kept in
+    memory. Each geometry is written immediately, into a buffer which is
+    written to the stream in large blocks, with coordinates in pixels
+    with one decimal:
+    - geometries completely outside the viewport are skipped
+    - points of linestrings and rings falling within the tolerance of
+      their predecessor, or of the line through their neighbours, are
+      skipped (the result deviates at most twice the tolerance), and so
+      are exactly coincident points if the tolerance is 0
+    - rings collapsing to fewer than three pixels are skipped
+\tparam Point Point type, for input geometries.
+\tparam SameScale Boolean flag indicating if horizontal and vertical scale should
+    be the same. The default value is true
+\ingroup svg
+*/
+template <typename Point, bool SameScale = true>
+class svg_stream_mapper : boost::noncopyable
+{
+public :
+
+    /*!
+    \brief Constructor, writes the SVG header
+    \param stream Output stream, should be a stream already open
+    \param viewport Box, in map units, which is mapped onto the SVG
+    \param width Width of the SVG map (in SVG pixels)
+    \param height Height of the SVG map (in SVG pixels)
+    \param tolerance Tolerance, in SVG pixels, of the decimation of points.
+        0 only skips coincident points and points on a line
+    \param width_height Optional information to increase width and/or height
+    \param flush_size Size, in bytes, of the blocks written to the stream
+    */
+    svg_stream_mapper(std::ostream& stream
+        , model::box<Point> const& viewport
+        , double width
+        , double height
+        , double tolerance = 0.5
+        , std::string const& width_height = "width=\"100%\" height=\"100%\""
+        , std::size_t flush_size = 1 << 16)
+        : m_context(stream, viewport, width, height, tolerance, flush_size)
+    {
+        m_context.append("<?xml version=\"1.0\" standalone=\"no\"?>\n"
+            "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n"
+            "\"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n"
+            "<svg ");
+        m_context.append(width_height);
+        m_context.append(" version=\"1.1\"\n"
+            "xmlns=\"http://www.w3.org/2000/svg\"\n"
+            "xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n");
+    }
+
+    /*!
+    \brief Destructor, closes the SVG and writes the rest of the buffer
+    */
+    ~svg_stream_mapper()
+    {
+        m_context.append("</svg>\n");
+        m_context.flush();
+    }
+
+    /*!
+    \brief Maps a geometry into the SVG map using the specified style
+    \tparam Geometry \tparam_geometry
+    \param geometry \param_geometry
+    \param style String containing verbatim SVG style information
+    \param size Optional size (used for SVG points) in SVG pixels. For linestrings,
+        specify linewidth in the SVG style information
+    */
+    template <typename Geometry>
+    void map(Geometry const& geometry, std::string const& style,
+             double size = -1.0)
+    {
+        concepts::check<Geometry const>();
+
+        dispatch::svg_stream_map<Geometry>::apply(m_context, geometry,
+                                                  style, size);
+    }
+
+    /*!
+    \brief Adds a text to the SVG map
+    \tparam TextPoint \tparam_point
+    \param point Location of the text (in map units)
+    \param s The text itself, written verbatim
+    \param style String containing verbatim SVG style information, of the text
+    \param offset_x Offset in SVG pixels, defaults to 0
+    \param offset_y Offset in SVG pixels, defaults to 0
+    */
+    template <typename TextPoint>
+    void text(TextPoint const& point, std::string const& s,
+              std::string const& style,
+              double offset_x = 0.0, double offset_y = 0.0)
+    {
+        detail::svg::pixel const p = m_context.transform(point);
+        m_context.append("<text style=\"");
+        m_context.append(style);
+        m_context.append("\" x=\"");
+        m_context.append(p.x + offset_x);
+        m_context.append("\" y=\"");
+        m_context.append(p.y + offset_y);
+        m_context.append("\">");
+        m_context.append(s);
+        m_context.append("</text>\n");
+        m_context.written(true);
+    }
+
+    //! Writes the buffer to the stream
+    void flush()
+    {
+        m_context.flush();
+    }
+
+    //! Number of written SVG elements (elements of multi geometries are counted)
+    std::size_t written_count() const { return m_context.written_count(); }
+
+    //! Number of skipped elements, outside the viewport or too small
+    std::size_t skipped_count() const { return m_context.skipped_count(); }
+
+private :
+    detail::svg::stream_context<Point, SameScale> m_context;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_SVG_STREAM_MAPPER_HPP
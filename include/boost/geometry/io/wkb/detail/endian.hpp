@@ -0,0 +1,177 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/predef/other/endian.h>
+#include <boost/static_assert.hpp>
+
+#if CHAR_BIT != 8
+#error Platforms with CHAR_BIT != 8 are not supported
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+struct byte_order_type
+{
+    enum enum_t
+    {
+        xdr     = 0, // wkbXDR, big-endian
+        ndr     = 1, // wkbNDR, little-endian
+        unknown = 2  // not defined by OGC
+    };
+};
+
+inline byte_order_type::enum_t native_byte_order()
+{
+#if BOOST_ENDIAN_BIG_BYTE
+    return byte_order_type::xdr;
+#else
+    return byte_order_type::ndr;
+#endif
+}
+
+// Bytes are swapped if the byte order of the data is not the native one
+inline bool swap_bytes(byte_order_type::enum_t order)
+{
+    return order != byte_order_type::unknown
+        && order != native_byte_order();
+}
+
+template <std::size_t Size>
+struct byte_swapper
+{};
+
+template <>
+struct byte_swapper<1>
+{
+    typedef boost::uint8_t type;
+
+    static inline type apply(type value)
+    {
+        return value;
+    }
+};
+
+template <>
+struct byte_swapper<4>
+{
+    typedef boost::uint32_t type;
+
+    static inline type apply(type value)
+    {
+        return (value >> 24)
+             | ((value >> 8) & 0x0000FF00u)
+             | ((value << 8) & 0x00FF0000u)
+             | (value << 24);
+    }
+};
+
+template <>
+struct byte_swapper<8>
+{
+    typedef boost::uint64_t type;
+
+    static inline type apply(type value)
+    {
+        typedef byte_swapper<4> half;
+        return (type(half::apply(half::type(value))) << 32)
+             | type(half::apply(half::type(value >> 32)));
+    }
+};
+
+/*!
+\brief Internal, reads a value of type T stored at the position of the
+    iterator in the given byte order, the iterator is not advanced
+\details The bytes are copied into a value of the same size, so the data
+    does not have to be aligned, and swapped if necessary.
+*/
+template <typename T, typename Iterator>
+inline T load_value(Iterator it, bool swap)
+{
+    typedef byte_swapper<sizeof(T)> swapper;
+
+    char bytes[sizeof(T)];
+    std::copy(it, it + sizeof(T), bytes);
+
+    typename swapper::type raw;
+    std::memcpy(&raw, bytes, sizeof(T));
+    if (swap)
+    {
+        raw = swapper::apply(raw);
+    }
+
+    T value;
+    std::memcpy(&value, &raw, sizeof(T));
+    return value;
+}
+
+/*!
+\brief Internal, writes a value of type T to the output iterator in the given
+    byte order
+*/
+template <typename T, typename OutputIterator>
+inline void store_value(T const& value, OutputIterator& out, bool swap)
+{
+    typedef byte_swapper<sizeof(T)> swapper;
+
+    typename swapper::type raw;
+    std::memcpy(&raw, &value, sizeof(T));
+    if (swap)
+    {
+        raw = swapper::apply(raw);
+    }
+
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &raw, sizeof(T));
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        *out = bytes[i];
+        ++out;
+    }
+}
+
+/*!
+\brief Internal, swaps the bytes of count doubles stored in place
+*/
+inline void swap_doubles(char* data, std::size_t count)
+{
+    typedef byte_swapper<sizeof(double)> swapper;
+
+    for (std::size_t i = 0; i < count; ++i, data += sizeof(double))
+    {
+        swapper::type raw;
+        std::memcpy(&raw, data, sizeof(double));
+        raw = swapper::apply(raw);
+        std::memcpy(data, &raw, sizeof(double));
+    }
+}
+
+BOOST_STATIC_ASSERT(sizeof(double) == 8);
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
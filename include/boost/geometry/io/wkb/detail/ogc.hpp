@@ -0,0 +1,287 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+// The well-known binary representation for OGC geometry (WKBGeometry),
+// provides a portable representation of a geometry value as a contiguous
+// stream of bytes. It permits geometry values to be exchanged between
+// a client application and an SQL database in binary form.
+//
+// Basic Type definitions
+// byte : 1 byte
+// uint32 : 32 bit unsigned integer (4 bytes)
+// double : double precision number (8 bytes)
+//
+// Every geometry, also every element of a collection, starts with
+// byte      byteOrder   (0 = big-endian (XDR), 1 = little-endian (NDR))
+// uint32    wkbType
+//
+// The type is one of
+//   Point = 1, LineString = 2, Polygon = 3, MultiPoint = 4,
+//   MultiLineString = 5, MultiPolygon = 6, GeometryCollection = 7
+// plus 1000 for Z, 2000 for M or 3000 for ZM coordinates (ISO SQL/MM).
+//
+// Extended WKB (EWKB, as written by PostGIS) marks the coordinates by flags
+// instead: 0x80000000 for Z and 0x40000000 for M. The flag 0x20000000
+// means that the type is followed by a uint32 SRID.
+//
+// Point:           double[dimension]
+// LineString:      uint32 numPoints, Point[numPoints]
+// Polygon:         uint32 numRings, LinearRing[numRings]
+//                  where LinearRing is uint32 numPoints, Point[numPoints]
+// Multi/Collection: uint32 numGeometries, WKBGeometry[numGeometries]
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+struct geometry_type_ogc
+{
+    enum enum_t
+    {
+        point      = 1,
+        linestring = 2,
+        polygon    = 3,
+        multipoint = 4,
+        multilinestring = 5,
+        multipolygon = 6,
+        collection = 7
+    };
+};
+
+struct ewkb_flags
+{
+    enum enum_t
+    {
+        z    = 0x80000000u,
+        m    = 0x40000000u,
+        srid = 0x20000000u
+    };
+};
+
+/*!
+\brief Internal, the decoded start of a WKB geometry: the byte order, the
+    type and the SRID (if any)
+*/
+struct header
+{
+    header()
+        : order(byte_order_type::unknown)
+        , type(0)
+        , has_z(false)
+        , has_m(false)
+        , has_srid(false)
+        , srid(0)
+    {}
+
+    inline bool swap() const
+    {
+        return swap_bytes(order);
+    }
+
+    //! Number of coordinates of each point
+    inline std::size_t dimension() const
+    {
+        return 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+    }
+
+    byte_order_type::enum_t order;
+    boost::uint32_t type;
+    bool has_z;
+    bool has_m;
+    bool has_srid;
+    boost::uint32_t srid;
+};
+
+struct header_parser
+{
+    //! Size of the byte order and the type
+    static const std::size_t min_size = 5;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, header& h)
+    {
+        if (std::distance(it, end) < std::ptrdiff_t(min_size))
+        {
+            return false;
+        }
+
+        boost::uint8_t const order = static_cast<boost::uint8_t>(*it);
+        if (order > boost::uint8_t(byte_order_type::ndr))
+        {
+            return false;
+        }
+        h.order = byte_order_type::enum_t(order);
+        ++it;
+
+        boost::uint32_t type = load_value<boost::uint32_t>(it, h.swap());
+        it += 4;
+
+        h.has_z = (type & ewkb_flags::z) != 0;
+        h.has_m = (type & ewkb_flags::m) != 0;
+        h.has_srid = (type & ewkb_flags::srid) != 0;
+        type &= ~boost::uint32_t(ewkb_flags::z | ewkb_flags::m | ewkb_flags::srid);
+
+        // ISO types, 1001 is a Point Z, 2001 a Point M, 3001 a Point ZM
+        boost::uint32_t const iso = type / 1000;
+        if (iso > 3 || ((h.has_z || h.has_m) && iso > 0))
+        {
+            return false;
+        }
+        h.has_z = h.has_z || iso == 1 || iso == 3;
+        h.has_m = h.has_m || iso == 2 || iso == 3;
+        h.type = type % 1000;
+
+        if (h.type < boost::uint32_t(geometry_type_ogc::point)
+            || h.type > boost::uint32_t(geometry_type_ogc::collection))
+        {
+            return false;
+        }
+
+        h.srid = 0;
+        if (h.has_srid)
+        {
+            if (std::distance(it, end) < 4)
+            {
+                return false;
+            }
+            h.srid = load_value<boost::uint32_t>(it, h.swap());
+            it += 4;
+        }
+        return true;
+    }
+};
+
+template <typename Tag>
+struct ogc_type : not_implemented<Tag>
+{};
+
+template <>
+struct ogc_type<point_tag>
+{
+    static const geometry_type_ogc::enum_t value = geometry_type_ogc::point;
+};
+
+template <>
+struct ogc_type<linestring_tag>
+{
+    static const geometry_type_ogc::enum_t value = geometry_type_ogc::linestring;
+};
+
+template <>
+struct ogc_type<polygon_tag>
+{
+    static const geometry_type_ogc::enum_t value = geometry_type_ogc::polygon;
+};
+
+template <>
+struct ogc_type<multi_point_tag>
+{
+    static const geometry_type_ogc::enum_t value = geometry_type_ogc::multipoint;
+};
+
+template <>
+struct ogc_type<multi_linestring_tag>
+{
+    static const geometry_type_ogc::enum_t value = geometry_type_ogc::multilinestring;
+};
+
+template <>
+struct ogc_type<multi_polygon_tag>
+{
+    static const geometry_type_ogc::enum_t value = geometry_type_ogc::multipolygon;
+};
+
+/*!
+\brief Internal, checks if the geometry of a header can be read into a
+    Geometry: the types should be the same and the number of coordinates
+    should be the dimension of the point type. The elements of a multi
+    geometry may also be stored in a GeometryCollection.
+*/
+template <typename Geometry>
+struct header_checker
+{
+    typedef typename tag<Geometry>::type tag_type;
+
+    static inline bool apply(header const& h)
+    {
+        return (h.type == boost::uint32_t(ogc_type<tag_type>::value)
+                || (h.type == boost::uint32_t(geometry_type_ogc::collection)
+                    && is_multi()))
+            && h.dimension() == dimension<Geometry>::value;
+    }
+
+private:
+    static inline bool is_multi()
+    {
+        return ogc_type<tag_type>::value >= geometry_type_ogc::multipoint;
+    }
+};
+
+/*!
+\brief Internal, writes the byte order and the type of a geometry, with the
+    ISO codes (1000 + type for Z) or with the EWKB flags, the SRID is written
+    if it is not 0 and EWKB is written
+*/
+template <typename Geometry>
+struct header_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(OutputIterator& out, bool ewkb,
+                             boost::uint32_t srid = 0)
+    {
+        std::size_t const dim = dimension<Geometry>::value;
+        boost::uint32_t type = ogc_type<typename tag<Geometry>::type>::value;
+
+        if (ewkb)
+        {
+            type |= dim > 2 ? boost::uint32_t(ewkb_flags::z) : 0u;
+            type |= dim > 3 ? boost::uint32_t(ewkb_flags::m) : 0u;
+            type |= srid != 0 ? boost::uint32_t(ewkb_flags::srid) : 0u;
+        }
+        else
+        {
+            type += dim > 3 ? 3000 : dim > 2 ? 1000 : 0;
+        }
+
+        *out = char(native_byte_order());
+        ++out;
+        store_value(type, out, false);
+        if (ewkb && srid != 0)
+        {
+            store_value(srid, out, false);
+        }
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
@@ -0,0 +1,337 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_PARSER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_PARSER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/type_traits/remove_const.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Points which are stored as an array of doubles, exactly like a point in
+// WKB, so their coordinates can be copied at once
+template <typename Point>
+struct is_coordinate_array
+    : boost::false_type
+{};
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct is_coordinate_array
+    <
+        model::point<double, DimensionCount, CoordinateSystem>
+    >
+    : boost::integral_constant
+        <
+            bool,
+            sizeof(model::point<double, DimensionCount, CoordinateSystem>)
+                == DimensionCount * sizeof(double)
+        >
+{};
+
+template <typename CoordinateSystem>
+struct is_coordinate_array<model::d2::point_xy<double, CoordinateSystem> >
+    : boost::integral_constant
+        <
+            bool,
+            sizeof(model::d2::point_xy<double, CoordinateSystem>)
+                == 2 * sizeof(double)
+        >
+{};
+
+// Ranges which are (derived from) std::vector, they can be resized and
+// their points are stored contiguously
+template <typename Range>
+struct is_vector
+    : boost::is_base_of
+        <
+            std::vector
+                <
+                    typename boost::range_value<Range>::type,
+                    std::allocator<typename boost::range_value<Range>::type>
+                >,
+            Range
+        >
+{};
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct parsing_assigner
+{
+    template <typename Iterator>
+    static inline void apply(Iterator it, Point& point, bool swap)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        // coordinate type in WKB is always double
+        set<I>(point, static_cast<coordinate_type>(load_value<double>(it, swap)));
+        parsing_assigner<Point, I + 1, N>::apply(it + sizeof(double), point, swap);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct parsing_assigner<Point, N, N>
+{
+    template <typename Iterator>
+    static inline void apply(Iterator, Point&, bool)
+    {}
+};
+
+template <typename Point>
+struct point_size
+{
+    static const std::size_t value = dimension<Point>::value * sizeof(double);
+};
+
+template <typename Iterator>
+inline bool parse_count(Iterator& it, Iterator end, bool swap,
+                        std::size_t element_size, boost::uint32_t& count)
+{
+    if (std::distance(it, end) < 4)
+    {
+        return false;
+    }
+    count = load_value<boost::uint32_t>(it, swap);
+    it += 4;
+
+    // Check the count before anything is allocated for it
+    return std::size_t(std::distance(it, end)) / element_size >= count;
+}
+
+template <typename Point>
+struct point_parser
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Point& point,
+                             header const& h)
+    {
+        if (std::distance(it, end) < std::ptrdiff_t(point_size<Point>::value))
+        {
+            return false;
+        }
+        parsing_assigner<Point>::apply(it, point, h.swap());
+        it += point_size<Point>::value;
+        return true;
+    }
+};
+
+/*!
+\brief Internal, reads the points of a linestring or ring
+\details If the range is a std::vector of points stored as doubles the bytes
+    are copied into the points at once, and swapped afterwards if they are
+    not in the native byte order.
+*/
+template
+<
+    typename Range,
+    bool Copy = is_vector<Range>::value
+        && is_coordinate_array<typename boost::range_value<Range>::type>::value
+>
+struct point_range_parser
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Range& range,
+                             header const& h)
+    {
+        boost::uint32_t count = 0;
+        if (! parse_count(it, end, h.swap(), point_size<point_type>::value, count))
+        {
+            return false;
+        }
+
+        reserve(range, count, is_vector<Range>());
+
+        bool const swap = h.swap();
+        point_type point;
+        for (boost::uint32_t i = 0; i < count; ++i)
+        {
+            parsing_assigner<point_type>::apply(it, point, swap);
+            range::push_back(range, point);
+            it += point_size<point_type>::value;
+        }
+        return true;
+    }
+
+private:
+    static inline void reserve(Range& range, std::size_t count, boost::true_type)
+    {
+        range.reserve(boost::size(range) + count);
+    }
+
+    static inline void reserve(Range&, std::size_t, boost::false_type)
+    {}
+};
+
+template <typename Range>
+struct point_range_parser<Range, true>
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Range& range,
+                             header const& h)
+    {
+        typedef typename boost::remove_const
+            <
+                typename std::iterator_traits<Iterator>::value_type
+            >::type byte_type;
+
+        boost::uint32_t count = 0;
+        if (! parse_count(it, end, h.swap(), point_size<point_type>::value, count))
+        {
+            return false;
+        }
+
+        std::size_t const offset = range.size();
+        range.resize(offset + count);
+        if (count == 0)
+        {
+            return true;
+        }
+
+        std::size_t const size = count * point_size<point_type>::value;
+        char* const target = reinterpret_cast<char*>(&range[offset]);
+
+        // Copies bytes to bytes of the same type (memmove for contiguous
+        // iterators), then swaps the doubles in place if necessary
+        std::copy(it, it + size, reinterpret_cast<byte_type*>(target));
+        if (h.swap())
+        {
+            swap_doubles(target, count * dimension<point_type>::value);
+        }
+
+        it += size;
+        return true;
+    }
+};
+
+template <typename Polygon>
+struct polygon_parser
+{
+    typedef typename ring_type<Polygon>::type ring_type;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Polygon& polygon,
+                             header const& h)
+    {
+        // Every ring has at least its number of points
+        boost::uint32_t num_rings = 0;
+        if (! parse_count(it, end, h.swap(), 4, num_rings))
+        {
+            return false;
+        }
+        if (num_rings == 0)
+        {
+            return true;
+        }
+
+        typename ring_return_type<Polygon>::type
+            exterior = exterior_ring(polygon);
+        if (! point_range_parser<ring_type>::parse(it, end, exterior, h))
+        {
+            return false;
+        }
+
+        typename interior_return_type<Polygon>::type
+            interiors = interior_rings(polygon);
+        range::resize(interiors, num_rings - 1);
+        for (boost::uint32_t i = 1; i < num_rings; ++i)
+        {
+            if (! point_range_parser<ring_type>::parse(it, end,
+                        range::at(interiors, i - 1), h))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/*!
+\brief Internal, reads the elements of a multi geometry (or of a
+    GeometryCollection), each element starts with its own header
+*/
+template <typename MultiGeometry, typename Parser>
+struct multi_parser
+{
+    typedef typename boost::range_value<MultiGeometry>::type element_type;
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, MultiGeometry& multi,
+                             header const& h)
+    {
+        boost::uint32_t count = 0;
+        if (! parse_count(it, end, h.swap(), header_parser::min_size, count))
+        {
+            return false;
+        }
+
+        range::resize(multi, boost::size(multi) + count);
+
+        typename boost::range_iterator<MultiGeometry>::type
+            element = boost::end(multi) - count;
+        for (boost::uint32_t i = 0; i < count; ++i, ++element)
+        {
+            header element_header;
+            if (! header_parser::parse(it, end, element_header)
+                || ! header_checker<element_type>::apply(element_header)
+                || ! Parser::parse(it, end, *element, element_header))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_PARSER_HPP
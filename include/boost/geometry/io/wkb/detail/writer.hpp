@@ -0,0 +1,143 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/interior_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct writer_assigner
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const& point, OutputIterator& out)
+    {
+        // NOTE: coordinates of any type are converted to double
+        store_value(static_cast<double>(geometry::get<I>(point)), out, false);
+        writer_assigner<Point, I + 1, N>::apply(point, out);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct writer_assigner<Point, N, N>
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const&, OutputIterator&)
+    {}
+};
+
+template <typename Point>
+struct point_writer
+{
+    template <typename OutputIterator>
+    static inline void write(Point const& point, OutputIterator& out, bool)
+    {
+        writer_assigner<Point>::apply(point, out);
+    }
+};
+
+template <typename Range>
+struct point_range_writer
+{
+    template <typename OutputIterator>
+    static inline void write(Range const& range, OutputIterator& out,
+                             bool = false)
+    {
+        typedef typename point_type<Range>::type point_type;
+
+        store_value(boost::uint32_t(boost::size(range)), out, false);
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            writer_assigner<point_type>::apply(*it, out);
+        }
+    }
+};
+
+template <typename Polygon>
+struct polygon_writer
+{
+    template <typename OutputIterator>
+    static inline void write(Polygon const& polygon, OutputIterator& out,
+                             bool)
+    {
+        typedef typename ring_type<Polygon const>::type ring_type;
+        typedef typename interior_type<Polygon const>::type interior_type;
+
+        typename interior_return_type<Polygon const>::type
+            interiors = interior_rings(polygon);
+
+        store_value(boost::uint32_t(1 + boost::size(interiors)), out, false);
+        point_range_writer<ring_type>::write(exterior_ring(polygon), out);
+        for (typename boost::range_iterator<interior_type const>::type
+                it = boost::begin(interiors); it != boost::end(interiors); ++it)
+        {
+            point_range_writer<ring_type>::write(*it, out);
+        }
+    }
+};
+
+template <typename MultiGeometry, typename Writer>
+struct multi_writer
+{
+    template <typename OutputIterator>
+    static inline void write(MultiGeometry const& multi, OutputIterator& out,
+                             bool ewkb)
+    {
+        typedef typename boost::range_value<MultiGeometry>::type element_type;
+
+        store_value(boost::uint32_t(boost::size(multi)), out, false);
+        for (typename boost::range_iterator<MultiGeometry const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            // The elements are written without SRID
+            header_writer<element_type>::apply(out, ewkb);
+            Writer::write(*it, out, ewkb);
+        }
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_WRITER_HPP
@@ -0,0 +1,276 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_POINT_SOURCE_HPP
+#define BOOST_GEOMETRY_IO_WKB_POINT_SOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_source.hpp>
+#include <boost/geometry/geometries/register/point_source.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/parser.hpp>
+#include <boost/geometry/io/wkb/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Point source reading the points of a WKB geometry from a stream
+\ingroup wkb
+\details The points of a point, linestring, polygon or multi geometry are
+    read in chunks, so the geometry is never held in memory as a whole.
+    The stream is read forward only, once. Geometry collections are not
+    supported.
+    An exception of type read_wkb_exception is thrown if the data is invalid
+    or truncated, or if its points do not have the dimension of Point.
+\tparam Point \tparam_point
+\note Models the concept PointSource, so it can be passed to the streaming
+    versions of envelope, length, area, perimeter, num_points, centroid,
+    simplify, for_each_point and for_each_segment
+    (see algorithms/point_source.hpp)
+*/
+template <typename Point>
+class wkb_point_source
+{
+public :
+    typedef Point point_type;
+
+    explicit wkb_point_source(std::istream& stream)
+        : m_stream(stream)
+        , m_started(false)
+        , m_swap(false)
+        , m_multi(0)
+        , m_elements(0)
+        , m_rings(0)
+        , m_ring(0)
+        , m_points(0)
+        , m_point_elements(false)
+    {}
+
+    //! Advances to the next part, skipping the points which are not read
+    inline bool next_part(point_source_part& kind)
+    {
+        skip();
+
+        if (! m_started)
+        {
+            m_started = true;
+            detail::wkb::header const h = read_header();
+            if (h.type == detail::wkb::geometry_type_ogc::point)
+            {
+                m_points = 1;
+                kind = part_points;
+                return true;
+            }
+            if (h.type == detail::wkb::geometry_type_ogc::collection)
+            {
+                BOOST_THROW_EXCEPTION(read_wkb_exception());
+            }
+            if (h.type >= detail::wkb::geometry_type_ogc::multipoint)
+            {
+                m_multi = h.type;
+                m_elements = read_count();
+            }
+            else if (start_element(h, kind))
+            {
+                return true;
+            }
+        }
+
+        for (;;)
+        {
+            if (m_rings > 0)
+            {
+                --m_rings;
+                m_points = read_count();
+                kind = m_ring++ == 0 ? part_exterior_ring : part_interior_ring;
+                return true;
+            }
+            if (m_elements == 0)
+            {
+                return false;
+            }
+            if (m_multi == detail::wkb::geometry_type_ogc::multipoint)
+            {
+                // All points, each with its own header, form one part
+                m_points = m_elements;
+                m_elements = 0;
+                m_point_elements = true;
+                kind = part_points;
+                return true;
+            }
+
+            --m_elements;
+            detail::wkb::header const h = read_header();
+            if (h.type != m_multi - 3)
+            {
+                BOOST_THROW_EXCEPTION(read_wkb_exception());
+            }
+            if (start_element(h, kind))
+            {
+                return true;
+            }
+        }
+    }
+
+    //! Reads at most count points of the current part
+    inline std::size_t read(Point* points, std::size_t count)
+    {
+        std::size_t const n = (std::min)(count, m_points);
+        if (m_point_elements)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (read_header().type != detail::wkb::geometry_type_ogc::point)
+                {
+                    BOOST_THROW_EXCEPTION(read_wkb_exception());
+                }
+                read_points(points + i, 1);
+            }
+        }
+        else
+        {
+            read_points(points, n);
+        }
+        m_points -= n;
+        return n;
+    }
+
+private :
+
+    static const std::size_t point_size
+        = detail::wkb::point_size<Point>::value;
+
+    inline void skip()
+    {
+        Point points[64];
+        while (read(points, 64) > 0)
+        {}
+        m_point_elements = false;
+    }
+
+    // Starts a linestring (returning true), or the rings of a polygon
+    inline bool start_element(detail::wkb::header const& h,
+                              point_source_part& kind)
+    {
+        if (h.type == detail::wkb::geometry_type_ogc::linestring)
+        {
+            m_points = read_count();
+            kind = part_linestring;
+            return true;
+        }
+        if (h.type != detail::wkb::geometry_type_ogc::polygon)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        m_rings = read_count();
+        m_ring = 0;
+        return false;
+    }
+
+    inline void read_bytes(char* data, std::size_t size)
+    {
+        m_stream.read(data, std::streamsize(size));
+        if (std::size_t(m_stream.gcount()) != size)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+    }
+
+    inline detail::wkb::header read_header()
+    {
+        // Byte order, type, and the SRID if it is flagged in the type
+        char bytes[9];
+        read_bytes(bytes, 5);
+        if (boost::uint8_t(bytes[0]) > boost::uint8_t(detail::wkb::byte_order_type::ndr))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+
+        bool const swap = detail::wkb::swap_bytes(
+            detail::wkb::byte_order_type::enum_t(bytes[0]));
+        boost::uint32_t const type
+            = detail::wkb::load_value<boost::uint32_t>(bytes + 1, swap);
+        std::size_t size = 5;
+        if ((type & detail::wkb::ewkb_flags::srid) != 0)
+        {
+            read_bytes(bytes + 5, 4);
+            size = 9;
+        }
+
+        detail::wkb::header h;
+        char const* it = bytes;
+        if (! detail::wkb::header_parser::parse(it, it + size, h)
+            || h.dimension() != dimension<Point>::value)
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+        m_swap = h.swap();
+        return h;
+    }
+
+    inline std::size_t read_count()
+    {
+        char bytes[4];
+        read_bytes(bytes, 4);
+        return detail::wkb::load_value<boost::uint32_t>(bytes, m_swap);
+    }
+
+    inline void read_points(Point* points, std::size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        m_buffer.resize(count * point_size);
+        read_bytes(&m_buffer[0], m_buffer.size());
+
+        char const* it = &m_buffer[0];
+        for (std::size_t i = 0; i < count; ++i, it += point_size)
+        {
+            detail::wkb::parsing_assigner<Point>::apply(it, points[i], m_swap);
+        }
+    }
+
+    std::istream& m_stream;
+    bool m_started;
+    bool m_swap;
+
+    //! Type of the multi geometry, and the number of its elements left
+    boost::uint32_t m_multi;
+    std::size_t m_elements;
+
+    //! Number of rings left of the current polygon, and the current ring
+    std::size_t m_rings;
+    std::size_t m_ring;
+
+    //! Number of points left of the current part
+    std::size_t m_points;
+    bool m_point_elements;
+
+    std::vector<char> m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+
+BOOST_GEOMETRY_REGISTER_POINT_SOURCE_TEMPLATED(boost::geometry::wkb_point_source)
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_POINT_SOURCE_HPP
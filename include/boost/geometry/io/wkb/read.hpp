@@ -0,0 +1,182 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/parser.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Read WKB Exception
+\ingroup core
+\details The read_wkb_exception is thrown when there is an error in wkb parsing
+ */
+class read_wkb_exception : public geometry::exception
+{
+public:
+
+    inline read_wkb_exception() {}
+
+    virtual char const* what() const throw()
+    {
+        return "Boost.Geometry Read WKB exception";
+    }
+};
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_wkb : not_implemented<Tag>
+{};
+
+template <typename Geometry>
+struct read_wkb<Geometry, point_tag>
+    : detail::wkb::point_parser<Geometry>
+{};
+
+template <typename Geometry>
+struct read_wkb<Geometry, linestring_tag>
+    : detail::wkb::point_range_parser<Geometry>
+{};
+
+template <typename Geometry>
+struct read_wkb<Geometry, polygon_tag>
+    : detail::wkb::polygon_parser<Geometry>
+{};
+
+template <typename Geometry>
+struct read_wkb<Geometry, multi_point_tag>
+    : detail::wkb::multi_parser
+        <
+            Geometry,
+            read_wkb<typename boost::range_value<Geometry>::type>
+        >
+{};
+
+template <typename Geometry>
+struct read_wkb<Geometry, multi_linestring_tag>
+    : detail::wkb::multi_parser
+        <
+            Geometry,
+            read_wkb<typename boost::range_value<Geometry>::type>
+        >
+{};
+
+template <typename Geometry>
+struct read_wkb<Geometry, multi_polygon_tag>
+    : detail::wkb::multi_parser
+        <
+            Geometry,
+            read_wkb<typename boost::range_value<Geometry>::type>
+        >
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Parses OGC Well-Known Binary (WKB) into a geometry
+\ingroup wkb
+\details Reads WKB in both byte orders, with ISO SQL/MM types for Z, M and ZM
+    coordinates, and Extended WKB (EWKB) as written by PostGIS, with the
+    coordinates marked by flags and an optional SRID. The number of
+    coordinates of the points should be the dimension of the point type of
+    the geometry (M is read as the third coordinate of 3D points).
+    Multi geometries can also be read from a GeometryCollection of their
+    elements.
+    If the points of a linestring or ring are stored in a std::vector, and
+    consist of doubles only, their coordinates are copied at once.
+\param begin iterator to the first byte, random access
+\param end iterator after the last byte
+\param geometry \param_geometry which is cleared and filled
+\param srid output, the SRID of EWKB or 0 if there is no SRID
+\return true if the WKB is valid and of the type of the geometry
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry,
+                     boost::uint32_t& srid)
+{
+    geometry::concepts::check<Geometry>();
+
+    // Stream of bytes can only be parsed using random access iterator.
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<Iterator>::iterator_category,
+            const std::random_access_iterator_tag&
+        >::value));
+    BOOST_STATIC_ASSERT((
+        boost::is_integral
+            <
+                typename std::iterator_traits<Iterator>::value_type
+            >::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) ==
+        sizeof(typename std::iterator_traits<Iterator>::value_type)));
+
+    geometry::clear(geometry);
+
+    detail::wkb::header h;
+    bool const result = detail::wkb::header_parser::parse(begin, end, h)
+        && detail::wkb::header_checker<Geometry>::apply(h)
+        && dispatch::read_wkb<Geometry>::parse(begin, end, geometry, h);
+
+    srid = h.srid;
+    return result;
+}
+
+/*!
+\brief Parses OGC Well-Known Binary (WKB) into a geometry
+\ingroup wkb
+\param begin iterator to the first byte, random access
+\param end iterator after the last byte
+\param geometry \param_geometry which is cleared and filled
+\return true if the WKB is valid and of the type of the geometry
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    boost::uint32_t srid = 0;
+    return read_wkb(begin, end, geometry, srid);
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    return read_wkb(bytes, bytes + length, geometry);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_HPP
@@ -0,0 +1,103 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
+#define BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
+
+#include <iterator>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Returns the value of a hexadecimal digit, or -1
+inline int hex_value(char c)
+{
+    return c >= '0' && c <= '9' ? c - '0'
+         : c >= 'A' && c <= 'F' ? c - 'A' + 10
+         : c >= 'a' && c <= 'f' ? c - 'a' + 10
+         : -1;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Converts WKB in hexadecimal notation (e.g. as returned by PostGIS)
+    to bytes
+\ingroup wkb
+\return false if the string has an odd length or contains other characters
+    than hexadecimal digits
+*/
+template <typename OutputIterator>
+bool hex2wkb(std::string const& hex, OutputIterator bytes)
+{
+    // Bytes can be only written to output iterator.
+    BOOST_STATIC_ASSERT((boost::is_convertible<
+        typename std::iterator_traits<OutputIterator>::iterator_category,
+        const std::output_iterator_tag&>::value));
+
+    if (0 != hex.size() % 2)
+    {
+        return false;
+    }
+
+    for (std::string::size_type i = 0; i < hex.size(); i += 2)
+    {
+        int const high = detail::wkb::hex_value(hex[i]);
+        int const low = detail::wkb::hex_value(hex[i + 1]);
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        *bytes = static_cast<boost::uint8_t>(high * 16 + low);
+        ++bytes;
+    }
+
+    return true;
+}
+
+/*!
+\brief Converts WKB to hexadecimal notation, with upper case digits
+\ingroup wkb
+*/
+template <typename Iterator>
+bool wkb2hex(Iterator begin, Iterator end, std::string& hex)
+{
+    // Stream of bytes can only be passed using random access iterator.
+    BOOST_STATIC_ASSERT((boost::is_convertible<
+        typename std::iterator_traits<Iterator>::iterator_category,
+        const std::random_access_iterator_tag&>::value));
+
+    static const char hexalpha[] = "0123456789ABCDEF";
+
+    hex.clear();
+    hex.reserve(2 * std::string::size_type(std::distance(begin, end)));
+    for (Iterator it = begin; it != end; ++it)
+    {
+        boost::uint8_t const byte = static_cast<boost::uint8_t>(*it);
+        hex += hexalpha[(byte >> 4) & 0xf];
+        hex += hexalpha[byte & 0xf];
+    }
+
+    return begin != end;
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
@@ -0,0 +1,665 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_IO_WKB_VIEW_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/parser.hpp>
+#include <boost/geometry/io/wkb/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+/*!
+\brief Internal, point of which the coordinates are stored in WKB in the
+    native byte order, the type is laid over the bytes
+\details The coordinates are decoded when they are accessed, so the bytes do
+    not have to be aligned. The views are read-only, the points can only be
+    modified when they are copied. The points of a MultiPoint each have their own
+    header in front of their coordinates, which is part of the type.
+*/
+template <typename Point, std::size_t HeaderSize = 0>
+struct point_bytes
+{
+    static const std::size_t size = HeaderSize + point_size<Point>::value;
+
+    char bytes[size];
+
+    template <std::size_t Dimension>
+    inline double get() const
+    {
+        return load_value<double>(bytes + HeaderSize + Dimension * sizeof(double),
+                                  false);
+    }
+
+    template <std::size_t Dimension>
+    inline void set(double value)
+    {
+        char* it = bytes + HeaderSize + Dimension * sizeof(double);
+        store_value(value, it, false);
+    }
+};
+
+/*!
+\brief Internal, random access range of the points of a WKB LineString,
+    LinearRing or MultiPoint
+*/
+template <typename Point, std::size_t HeaderSize = 0>
+class point_range
+{
+public:
+    typedef point_bytes<Point, HeaderSize> value_type;
+    typedef value_type const* iterator;
+    typedef value_type const* const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    point_range()
+        : m_begin(NULL)
+        , m_count(0)
+    {}
+
+    // The points are laid over the bytes, without padding
+    BOOST_STATIC_ASSERT((sizeof(value_type) == value_type::size));
+
+    point_range(char const* data, std::size_t count)
+        : m_begin(reinterpret_cast<value_type const*>(data))
+        , m_count(count)
+    {}
+
+    inline const_iterator begin() const { return m_begin; }
+    inline const_iterator end() const { return m_begin + m_count; }
+    inline std::size_t size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+private:
+    value_type const* m_begin;
+    std::size_t m_count;
+};
+
+template <typename ByteType>
+inline char const* as_chars(ByteType const* data)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    return reinterpret_cast<char const*>(data);
+}
+
+// Reads the header of a geometry which should have the type of the Geometry,
+// the points of a view are laid over the bytes so they should be native
+template <typename Geometry>
+inline void parse_view_header(char const*& it, char const* end, header& h)
+{
+    if (! header_parser::parse(it, end, h)
+        || ! header_checker<Geometry>::apply(h)
+        || h.swap())
+    {
+        throw read_wkb_exception();
+    }
+}
+
+// Reads the number of points and checks that they are all there
+template <typename Point>
+inline std::size_t parse_view_points(char const*& it, char const* end,
+                                     header const& h)
+{
+    boost::uint32_t count = 0;
+    if (! parse_count(it, end, h.swap(), point_size<Point>::value, count))
+    {
+        throw read_wkb_exception();
+    }
+    it += count * point_size<Point>::value;
+    return count;
+}
+
+// Reads the number of elements of a multi geometry, each at least a header
+inline std::size_t parse_view_count(char const*& it, char const* end,
+                                    header const& h, std::size_t element_size)
+{
+    boost::uint32_t count = 0;
+    if (! parse_count(it, end, h.swap(), element_size, count))
+    {
+        throw read_wkb_exception();
+    }
+    return count;
+}
+
+/*!
+\brief Internal, random access range of the elements of a WKB MultiLineString
+    or MultiPolygon, the views of the elements are created once
+*/
+template <typename Multi, typename View>
+class multi_view
+{
+public:
+    typedef View value_type;
+    typedef typename std::vector<View>::const_iterator iterator;
+    typedef typename std::vector<View>::const_iterator const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    multi_view()
+        : m_srid(0)
+    {}
+
+    inline const_iterator begin() const { return m_elements.begin(); }
+    inline const_iterator end() const { return m_elements.end(); }
+
+    inline std::size_t size() const { return m_elements.size(); }
+    inline bool empty() const { return m_elements.empty(); }
+
+    //! SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_srid; }
+
+protected:
+    inline void parse(char const* it, char const* end)
+    {
+        header h;
+        parse_view_header<Multi>(it, end, h);
+        m_srid = h.srid;
+
+        std::size_t const count = parse_view_count(it, end, h,
+                                                   header_parser::min_size);
+        m_elements.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_elements.push_back(View(it, end));
+            View::skip(it, end);
+        }
+    }
+
+private:
+    std::vector<View> m_elements;
+    boost::uint32_t m_srid;
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only view of a LinearRing stored in WKB, the rings of
+    wkb_polygon_view
+\ingroup wkb
+*/
+template <typename Point, bool ClockWise = true>
+class wkb_ring_view
+    : public detail::wkb::point_range<Point>
+{
+    typedef detail::wkb::point_range<Point> base_type;
+
+public:
+    static const std::size_t point_size = detail::wkb::point_size<Point>::value;
+
+    wkb_ring_view()
+    {}
+
+    wkb_ring_view(char const* data, std::size_t count)
+        : base_type(data, count)
+    {}
+};
+
+
+/*!
+\brief Read-only view of a LineString stored in (E)WKB
+\ingroup wkb
+\details The view does not copy the WKB, the points are decoded when they are
+    accessed, so algorithms can be applied directly on the WKB. The structure
+    is checked when the view is constructed, read_wkb_exception is thrown
+    if the WKB is invalid or not a LineString with points of the dimension
+    of Point. The points are laid over the bytes, so the WKB should be in
+    the native byte order (as written by write_wkb), WKB in another byte
+    order can be read with read_wkb.
+\tparam Point point type of the view, its dimension should be the number of
+    coordinates stored in the WKB
+*/
+template <typename Point>
+class wkb_linestring_view
+    : public detail::wkb::point_range<Point>
+{
+    typedef detail::wkb::point_range<Point> base_type;
+
+public:
+    wkb_linestring_view()
+        : m_srid(0)
+    {}
+
+    template <typename ByteType>
+    wkb_linestring_view(ByteType const* data, std::size_t size)
+    {
+        char const* it = detail::wkb::as_chars(data);
+        parse(it, it + size);
+    }
+
+    wkb_linestring_view(char const* data, char const* end)
+    {
+        parse(data, end);
+    }
+
+    //! SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_srid; }
+
+    static inline void skip(char const*& it, char const* end)
+    {
+        detail::wkb::header h;
+        detail::wkb::parse_view_header<wkb_linestring_view>(it, end, h);
+        detail::wkb::parse_view_points<Point>(it, end, h);
+    }
+
+private:
+    inline void parse(char const* it, char const* end)
+    {
+        detail::wkb::header h;
+        detail::wkb::parse_view_header<wkb_linestring_view>(it, end, h);
+        char const* const data = it + 4;
+        std::size_t const count = detail::wkb::parse_view_points<Point>(it, end, h);
+        static_cast<base_type&>(*this) = base_type(data, count);
+        m_srid = h.srid;
+    }
+
+    boost::uint32_t m_srid;
+};
+
+
+/*!
+\brief Read-only view of a Polygon stored in (E)WKB
+\ingroup wkb
+\details The view does not copy the WKB, the points are decoded when they are
+    accessed. The positions of the interior rings are determined when the
+    view is constructed, they form a random access range. The structure is
+    checked when the view is constructed, read_wkb_exception is thrown
+    if the WKB is invalid or not a Polygon with points of the dimension
+    of Point, or not in the native byte order. WKB does not define the
+    orientation of the rings, it is specified as for model::polygon.
+    The rings are closed.
+\tparam Point point type of the view
+\tparam ClockWise true for clockwise direction, false for counterclockwise
+*/
+template <typename Point, bool ClockWise = true>
+class wkb_polygon_view
+{
+public:
+    typedef wkb_ring_view<Point, ClockWise> ring_type;
+    typedef typename ring_type::value_type point_type;
+    typedef std::vector<ring_type> inner_container_type;
+
+    wkb_polygon_view()
+        : m_srid(0)
+    {}
+
+    template <typename ByteType>
+    wkb_polygon_view(ByteType const* data, std::size_t size)
+    {
+        char const* it = detail::wkb::as_chars(data);
+        parse(it, it + size);
+    }
+
+    wkb_polygon_view(char const* data, char const* end)
+    {
+        parse(data, end);
+    }
+
+    inline ring_type const& outer() const { return m_outer; }
+    inline inner_container_type const& inners() const { return m_inners; }
+
+    //! SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_srid; }
+
+    static inline void skip(char const*& it, char const* end)
+    {
+        detail::wkb::header h;
+        detail::wkb::parse_view_header<wkb_polygon_view>(it, end, h);
+        std::size_t const count = detail::wkb::parse_view_count(it, end, h, 4);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            detail::wkb::parse_view_points<Point>(it, end, h);
+        }
+    }
+
+private:
+    inline void parse(char const* it, char const* end)
+    {
+        detail::wkb::header h;
+        detail::wkb::parse_view_header<wkb_polygon_view>(it, end, h);
+        m_srid = h.srid;
+
+        std::size_t const count = detail::wkb::parse_view_count(it, end, h, 4);
+        if (count == 0)
+        {
+            return;
+        }
+
+        char const* data = it + 4;
+        std::size_t const outer_count
+            = detail::wkb::parse_view_points<Point>(it, end, h);
+        m_outer = ring_type(data, outer_count);
+
+        m_inners.reserve(count - 1);
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            data = it + 4;
+            std::size_t const inner_count
+                = detail::wkb::parse_view_points<Point>(it, end, h);
+            m_inners.push_back(ring_type(data, inner_count));
+        }
+    }
+
+    ring_type m_outer;
+    inner_container_type m_inners;
+    boost::uint32_t m_srid;
+};
+
+
+/*!
+\brief Read-only view of a MultiPoint stored in (E)WKB
+\ingroup wkb
+\details The points are decoded when they are accessed. The structure is
+    checked when the view is constructed, read_wkb_exception is thrown
+    if the WKB is invalid or not a MultiPoint with points of the dimension
+    of Point, or not in the native byte order.
+*/
+template <typename Point>
+class wkb_multi_point_view
+    : public detail::wkb::point_range
+        <
+            Point, detail::wkb::header_parser::min_size
+        >
+{
+    typedef detail::wkb::point_range
+        <
+            Point, detail::wkb::header_parser::min_size
+        > base_type;
+
+public:
+    wkb_multi_point_view()
+        : m_srid(0)
+    {}
+
+    template <typename ByteType>
+    wkb_multi_point_view(ByteType const* data, std::size_t size)
+    {
+        char const* it = detail::wkb::as_chars(data);
+        char const* const end = it + size;
+
+        detail::wkb::header h;
+        detail::wkb::parse_view_header<wkb_multi_point_view>(it, end, h);
+        m_srid = h.srid;
+
+        // Each point has its own header, which should not have an SRID
+        // such that the points are a fixed number of bytes apart
+        std::size_t const count = detail::wkb::parse_view_count(it, end, h,
+            base_type::value_type::size);
+        char const* const first = it;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            detail::wkb::header element;
+            if (! detail::wkb::header_parser::parse(it, end, element)
+                || ! detail::wkb::header_checker<Point>::apply(element)
+                || element.has_srid
+                || element.swap())
+            {
+                throw read_wkb_exception();
+            }
+            it += detail::wkb::point_size<Point>::value;
+        }
+
+        static_cast<base_type&>(*this) = base_type(first, count);
+    }
+
+    //! SRID of EWKB, or 0
+    inline boost::uint32_t srid() const { return m_srid; }
+
+private:
+    boost::uint32_t m_srid;
+};
+
+
+/*!
+\brief Read-only view of a MultiLineString stored in (E)WKB
+\ingroup wkb
+\details The views of the linestrings are created when the view is
+    constructed, the points are decoded when they are accessed.
+    Throws read_wkb_exception if the WKB is invalid or not in the native
+    byte order.
+*/
+template <typename Point>
+class wkb_multi_linestring_view
+    : public detail::wkb::multi_view
+        <
+            wkb_multi_linestring_view<Point>,
+            wkb_linestring_view<Point>
+        >
+{
+public:
+    wkb_multi_linestring_view()
+    {}
+
+    template <typename ByteType>
+    wkb_multi_linestring_view(ByteType const* data, std::size_t size)
+    {
+        char const* it = detail::wkb::as_chars(data);
+        this->parse(it, it + size);
+    }
+};
+
+
+/*!
+\brief Read-only view of a MultiPolygon stored in (E)WKB
+\ingroup wkb
+\details The views of the polygons, with the positions of their rings, are
+    created when the view is constructed, the points are decoded when they
+    are accessed.
+    Throws read_wkb_exception if the WKB is invalid or not in the native
+    byte order.
+*/
+template <typename Point, bool ClockWise = true>
+class wkb_multi_polygon_view
+    : public detail::wkb::multi_view
+        <
+            wkb_multi_polygon_view<Point, ClockWise>,
+            wkb_polygon_view<Point, ClockWise>
+        >
+{
+public:
+    wkb_multi_polygon_view()
+    {}
+
+    template <typename ByteType>
+    wkb_multi_polygon_view(ByteType const* data, std::size_t size)
+    {
+        char const* it = detail::wkb::as_chars(data);
+        this->parse(it, it + size);
+    }
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point, std::size_t HeaderSize>
+struct tag<detail::wkb::point_bytes<Point, HeaderSize> >
+{
+    typedef point_tag type;
+};
+
+template <typename Point, std::size_t HeaderSize>
+struct coordinate_type<detail::wkb::point_bytes<Point, HeaderSize> >
+{
+    typedef double type;
+};
+
+template <typename Point, std::size_t HeaderSize>
+struct coordinate_system<detail::wkb::point_bytes<Point, HeaderSize> >
+{
+    typedef typename geometry::coordinate_system<Point>::type type;
+};
+
+template <typename Point, std::size_t HeaderSize>
+struct dimension<detail::wkb::point_bytes<Point, HeaderSize> >
+    : geometry::dimension<Point>
+{};
+
+template <typename Point, std::size_t HeaderSize, std::size_t Dimension>
+struct access<detail::wkb::point_bytes<Point, HeaderSize>, Dimension>
+{
+    static inline double get(detail::wkb::point_bytes<Point, HeaderSize> const& p)
+    {
+        return p.template get<Dimension>();
+    }
+
+    static inline void set(detail::wkb::point_bytes<Point, HeaderSize>& p,
+                           double value)
+    {
+        p.template set<Dimension>(value);
+    }
+};
+
+template <typename Point, bool ClockWise>
+struct tag<wkb_ring_view<Point, ClockWise> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point>
+struct point_order<wkb_ring_view<Point, false> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point>
+struct point_order<wkb_ring_view<Point, true> >
+{
+    static const order_selector value = clockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<wkb_ring_view<Point, ClockWise> >
+{
+    static const closure_selector value = closed;
+};
+
+template <typename Point>
+struct tag<wkb_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point, bool ClockWise>
+struct tag<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise>
+struct ring_const_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view<Point, ClockWise>::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct ring_mutable_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view<Point, ClockWise>::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct interior_const_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view
+        <
+            Point, ClockWise
+        >::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct interior_mutable_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view
+        <
+            Point, ClockWise
+        >::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct exterior_ring<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef wkb_polygon_view<Point, ClockWise> polygon_type;
+
+    static inline typename polygon_type::ring_type const&
+        get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise>
+struct interior_rings<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef wkb_polygon_view<Point, ClockWise> polygon_type;
+
+    static inline typename polygon_type::inner_container_type const&
+        get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+template <typename Point>
+struct tag<wkb_multi_point_view<Point> >
+{
+    typedef multi_point_tag type;
+};
+
+template <typename Point>
+struct tag<wkb_multi_linestring_view<Point> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Point, bool ClockWise>
+struct tag<wkb_multi_polygon_view<Point, ClockWise> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_VIEW_HPP
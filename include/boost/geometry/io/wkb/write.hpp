@@ -0,0 +1,150 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WRITE_HPP
+#define BOOST_GEOMETRY_IO_WKB_WRITE_HPP
+
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/io/wkb/detail/writer.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct write_wkb : not_implemented<Tag>
+{};
+
+template <typename Geometry>
+struct write_wkb<Geometry, point_tag>
+    : detail::wkb::point_writer<Geometry>
+{};
+
+template <typename Geometry>
+struct write_wkb<Geometry, linestring_tag>
+    : detail::wkb::point_range_writer<Geometry>
+{};
+
+template <typename Geometry>
+struct write_wkb<Geometry, polygon_tag>
+    : detail::wkb::polygon_writer<Geometry>
+{};
+
+template <typename Geometry>
+struct write_wkb<Geometry, multi_point_tag>
+    : detail::wkb::multi_writer
+        <
+            Geometry,
+            write_wkb<typename boost::range_value<Geometry>::type>
+        >
+{};
+
+template <typename Geometry>
+struct write_wkb<Geometry, multi_linestring_tag>
+    : detail::wkb::multi_writer
+        <
+            Geometry,
+            write_wkb<typename boost::range_value<Geometry>::type>
+        >
+{};
+
+template <typename Geometry>
+struct write_wkb<Geometry, multi_polygon_tag>
+    : detail::wkb::multi_writer
+        <
+            Geometry,
+            write_wkb<typename boost::range_value<Geometry>::type>
+        >
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+template <typename Geometry, typename OutputIterator>
+inline bool write(Geometry const& geometry, OutputIterator out,
+                  bool ewkb, boost::uint32_t srid)
+{
+    geometry::concepts::check<Geometry const>();
+
+    // The WKB is written to an OutputIterator.
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<OutputIterator>::iterator_category,
+            const std::output_iterator_tag&
+        >::value));
+
+    header_writer<Geometry>::apply(out, ewkb, srid);
+    dispatch::write_wkb<Geometry>::write(geometry, out, ewkb);
+    return true;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Writes a geometry as OGC Well-Known Binary (WKB)
+\ingroup wkb
+\details The WKB is written in the native byte order. 3D points are written
+    with Z coordinates and 4D points with ZM coordinates, using the ISO
+    SQL/MM types (1000 + type for Z).
+\param geometry \param_geometry
+\param out output iterator to which the bytes are written, e.g. a
+    std::back_insert_iterator of a std::string or a std::vector of bytes
+\return true
+*/
+template <typename Geometry, typename OutputIterator>
+inline bool write_wkb(Geometry const& geometry, OutputIterator out)
+{
+    return detail::wkb::write(geometry, out, false, 0);
+}
+
+/*!
+\brief Writes a geometry as Extended WKB (EWKB), as read and written by
+    PostGIS
+\ingroup wkb
+\details Z and M coordinates are marked by flags of the type and the SRID,
+    if it is not 0, is written after the type of the geometry.
+\param geometry \param_geometry
+\param out output iterator to which the bytes are written
+\param srid spatial reference identifier, 0 if it is unknown
+\return true
+*/
+template <typename Geometry, typename OutputIterator>
+inline bool write_ewkb(Geometry const& geometry, OutputIterator out,
+                       boost::uint32_t srid = 0)
+{
+    return detail::wkb::write(geometry, out, true, srid);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKB_WRITE_HPP
@@ -0,0 +1,266 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Internal, token of a WKT string, a range of characters referring to
+    the string.
+*/
+class token
+{
+public:
+    typedef char const* iterator;
+    typedef char const* const_iterator;
+
+    token()
+        : m_first(NULL), m_last(NULL)
+    {}
+
+    token(char const* first, char const* last)
+        : m_first(first), m_last(last)
+    {}
+
+    inline char const* begin() const { return m_first; }
+    inline char const* end() const { return m_last; }
+    inline std::size_t size() const { return std::size_t(m_last - m_first); }
+
+    inline std::string str() const
+    {
+        return std::string(m_first, m_last);
+    }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+inline bool operator==(token const& t, char const* str)
+{
+    std::size_t const length = std::strlen(str);
+    return t.size() == length
+        && std::memcmp(t.begin(), str, length) == 0;
+}
+
+inline bool operator!=(token const& t, char const* str)
+{
+    return ! (t == str);
+}
+
+inline char to_upper(char c)
+{
+    return c >= 'a' && c <= 'z' ? char(c - 'a' + 'A') : c;
+}
+
+// Case insensitive comparison of ASCII characters, the keywords of WKT
+inline bool iequals(token const& t, char const* str)
+{
+    char const* it = t.begin();
+    for ( ; it != t.end() && *str != '\0' ; ++it, ++str)
+    {
+        if (to_upper(*it) != to_upper(*str))
+        {
+            return false;
+        }
+    }
+    return it == t.end() && *str == '\0';
+}
+
+inline bool iequals(token const& t, std::string const& str)
+{
+    return iequals(t, str.c_str());
+}
+
+
+/*!
+\brief Internal, splits a WKT string into tokens without allocating memory.
+\details White space separates tokens and is dropped, the characters ",()"
+    are tokens on their own.
+*/
+class tokenizer
+{
+public:
+    class iterator
+    {
+    public:
+        typedef token value_type;
+        typedef token const& reference;
+        typedef token const* pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+
+        iterator()
+            : m_begin(NULL), m_end(NULL)
+        {}
+
+        iterator(char const* begin, char const* position, char const* end)
+            : m_begin(begin), m_end(end)
+        {
+            next(position);
+        }
+
+        inline token const& operator*() const { return m_token; }
+        inline token const* operator->() const { return &m_token; }
+
+        inline iterator& operator++()
+        {
+            next(m_token.end());
+            return *this;
+        }
+
+        inline iterator operator++(int)
+        {
+            iterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        inline bool operator==(iterator const& other) const
+        {
+            return m_token.begin() == other.m_token.begin();
+        }
+
+        inline bool operator!=(iterator const& other) const
+        {
+            return m_token.begin() != other.m_token.begin();
+        }
+
+        //! Offset of the current token (or of the end) in the string
+        inline std::size_t offset() const
+        {
+            return std::size_t(m_token.begin() - m_begin);
+        }
+
+    private:
+        static inline bool is_space(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r'
+                || c == '\v' || c == '\f';
+        }
+
+        static inline bool is_separator(char c)
+        {
+            return c == ',' || c == '(' || c == ')';
+        }
+
+        inline void next(char const* position)
+        {
+            while (position != m_end && is_space(*position))
+            {
+                ++position;
+            }
+
+            char const* last = position;
+            if (last != m_end)
+            {
+                if (is_separator(*last))
+                {
+                    ++last;
+                }
+                else
+                {
+                    while (last != m_end && ! is_space(*last)
+                           && ! is_separator(*last))
+                    {
+                        ++last;
+                    }
+                }
+            }
+
+            m_token = token(position, last);
+        }
+
+        char const* m_begin;
+        char const* m_end;
+        token m_token;
+    };
+
+    typedef iterator const_iterator;
+
+    explicit tokenizer(std::string const& wkt)
+        : m_begin(wkt.data())
+        , m_end(wkt.data() + wkt.size())
+    {}
+
+    inline iterator begin() const
+    {
+        return iterator(m_begin, m_begin, m_end);
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_begin, m_end, m_end);
+    }
+
+private:
+    char const* m_begin;
+    char const* m_end;
+};
+
+
+/*!
+\brief Internal, returns the number of elements of a list, i.e. the number of
+    commas before the closing parenthesis which are not nested in other
+    parentheses plus one.
+\param it token-iterator, should be positioned after "("
+\param end end-token-iterator
+*/
+inline std::size_t count_elements(tokenizer::iterator const& it,
+                                  tokenizer::iterator const& end)
+{
+    if (it == end || *it == ")")
+    {
+        return 0;
+    }
+
+    std::size_t count = 1;
+    std::size_t depth = 0;
+    for (char const* c = it->begin() ; c != end->begin() ; ++c)
+    {
+        if (*c == '(')
+        {
+            ++depth;
+        }
+        else if (*c == ')')
+        {
+            if (depth == 0)
+            {
+                break;
+            }
+            --depth;
+        }
+        else if (*c == ',' && depth == 0)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
@@ -21,18 +21,19 @@
 #define BOOST_GEOMETRY_IO_WKT_READ_HPP
 
 #include <cstddef>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
-#include <boost/algorithm/string.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/size.hpp>
 #include <boost/range/value_type.hpp>
 #include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_base_of.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 
@@ -57,6 +58,7 @@
 #include <boost/geometry/util/coordinate_cast.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
 
 namespace boost { namespace geometry
 {
@@ -64,6 +66,8 @@ namespace boost { namespace geometry
 /*!
 \brief Exception showing things wrong with WKT parsing
 \ingroup wkt
+\details The offset of the character of the WKT string at which the error
+    was detected is reported if it is known.
 */
 struct read_wkt_exception : public geometry::exception
 {
@@ -74,19 +78,22 @@ struct read_wkt_exception : public geometry::exception
                        std::string const& wkt)
         : message(msg)
         , wkt(wkt)
+        , m_offset(it.offset())
     {
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(it->begin(), it->end());
             source += "'";
         }
-        complete = message + source + " in '" + wkt.substr(0, 100) + "'";
+        complete = message + source + " in '" + wkt.substr(0, 100) + "'"
+                 + " (offset " + boost::lexical_cast<std::string>(m_offset) + ")";
     }
 
     read_wkt_exception(std::string const& msg, std::string const& wkt)
         : message(msg)
         , wkt(wkt)
+        , m_offset(std::string::npos)
     {
         complete = message + "' in (" + wkt.substr(0, 100) + ")";
     }
@@ -97,11 +104,18 @@ struct read_wkt_exception : public geometry::exception
     {
         return complete.c_str();
     }
+
+    //! Offset of the erroneous character, std::string::npos if unknown
+    inline std::size_t offset() const
+    {
+        return m_offset;
+    }
 private :
     std::string source;
     std::string message;
     std::string wkt;
     std::string complete;
+    std::size_t m_offset;
 };
 
 
@@ -110,7 +124,46 @@ private :
 namespace detail { namespace wkt
 {
 
-typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
+// Ranges are reserved if they are (derived from) std::vector
+template
+<
+    typename Range,
+    bool IsVector = boost::is_base_of
+        <
+            std::vector
+                <
+                    typename boost::range_value<Range>::type,
+                    std::allocator<typename boost::range_value<Range>::type>
+                >,
+            Range
+        >::value
+>
+struct range_reserver
+{
+    static inline void apply(Range&, std::size_t)
+    {}
+};
+
+template <typename Range>
+struct range_reserver<Range, true>
+{
+    static inline void apply(Range& range, std::size_t count)
+    {
+        range.reserve(count);
+    }
+};
+
+template <typename Range>
+inline void reserve_elements(Range& range,
+                             tokenizer::iterator const& it,
+                             tokenizer::iterator const& end)
+{
+    std::size_t const count = count_elements(it, end);
+    if (count > 0)
+    {
+        range_reserver<Range>::apply(range, boost::size(range) + count);
+    }
+}
 
 template <typename Point,
           std::size_t Dimension = 0,
@@ -131,13 +184,11 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Convert the characters of the token in place, other than
+            // decimal numbers are converted using lexical_cast
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : coordinate_parser<coordinate_type>::apply(it->begin(), it->end()));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -334,6 +385,8 @@ struct container_appender
     {
         handle_open_parenthesis(it, end, wkt);
 
+        reserve_elements(out, it, end);
+
         stateful_range_appender<Geometry> appender;
 
         // Parse points until closing parenthesis
@@ -425,6 +478,16 @@ struct polygon_parser
 
         handle_open_parenthesis(it, end, wkt);
 
+        std::size_t const count = count_elements(it, end);
+        if (count > 1)
+        {
+            typedef typename boost::remove_reference
+                <
+                    typename traits::interior_mutable_type<Polygon>::type
+                >::type interior_type;
+            range_reserver<interior_type>::apply(interior_rings(poly), count - 1);
+        }
+
         int n = -1;
 
         // Stop at ")"
@@ -464,7 +527,7 @@ inline bool one_of(tokenizer::iterator const& it,
                    std::string const& value,
                    bool& is_present)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         is_present = true;
         return true;
@@ -477,7 +540,7 @@ inline bool one_of(tokenizer::iterator const& it,
                    bool& present1,
                    bool& present2)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         present1 = true;
         present2 = true;
@@ -529,7 +592,7 @@ inline bool initialize(tokenizer const& tokens,
     it = tokens.begin();
     end = tokens.end();
 
-    if (it == end || ! boost::iequals(*it++, geometry_name))
+    if (it == end || ! iequals(*it++, geometry_name))
     {
         BOOST_THROW_EXCEPTION(read_wkt_exception(std::string("Should start with '") + geometry_name + "'", wkt));
     }
@@ -571,7 +634,7 @@ struct geometry_parser
     {
         geometry::clear(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<Geometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
@@ -589,12 +652,14 @@ struct multi_parser
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
             handle_open_parenthesis(it, end, wkt);
 
+            reserve_elements(geometry, it, end);
+
             // Parse sub-geometries
             while(it != end && *it != ")")
             {
@@ -636,7 +701,7 @@ struct multi_point_parser
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
 
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
@@ -647,6 +712,8 @@ struct multi_point_parser
             // otherwise as "x y"
             bool using_brackets = (it != end && *it == "(");
 
+            reserve_elements(geometry, it, end);
+
             while(it != end && *it != ")")
             {
                 traits::resize<MultiGeometry>::apply(geometry, boost::size(geometry) + 1);
@@ -695,10 +762,10 @@ struct box_parser
     static inline void apply(std::string const& wkt, Box& box)
     {
         bool should_close = false;
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
-        if (it != end && boost::iequals(*it, "POLYGON"))
+        if (it != end && iequals(*it, "POLYGON"))
         {
             ++it;
             bool has_empty, has_z, has_m;
@@ -711,7 +778,7 @@ struct box_parser
             handle_open_parenthesis(it, end, wkt);
             should_close = true;
         }
-        else if (it != end && boost::iequals(*it, "BOX"))
+        else if (it != end && iequals(*it, "BOX"))
         {
             ++it;
         }
@@ -764,12 +831,12 @@ struct segment_parser
 {
     static inline void apply(std::string const& wkt, Segment& segment)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end &&
-            (boost::iequals(*it, "SEGMENT")
-            || boost::iequals(*it, "LINESTRING") ))
+            (iequals(*it, "SEGMENT")
+            || iequals(*it, "LINESTRING") ))
         {
             ++it;
         }
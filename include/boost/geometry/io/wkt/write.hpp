@@ -21,6 +21,8 @@
 #ifndef BOOST_GEOMETRY_IO_WKT_WRITE_HPP
 #define BOOST_GEOMETRY_IO_WKT_WRITE_HPP
 
+#include <ios>
+#include <locale>
 #include <ostream>
 #include <string>
 
@@ -47,6 +49,7 @@
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/coordinate_format.hpp>
 
 
 namespace boost { namespace geometry
@@ -65,8 +68,8 @@ namespace detail { namespace wkt
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -76,8 +79,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -113,8 +116,8 @@ struct double_closing_parenthesis
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p, bool)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p, bool)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -135,8 +138,8 @@ template
 >
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closure = ForceClosurePossible)
     {
         typedef typename boost::range_iterator<Range const>::type iterator_type;
@@ -208,8 +211,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly, bool force_closure)
     {
         typedef typename ring_type<Polygon const>::type ring;
@@ -235,8 +238,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry, bool force_closure)
     {
         os << PrefixPolicy::apply();
@@ -264,8 +267,8 @@ struct wkt_box
 {
     typedef typename point_type<Box>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, bool force_closure)
     {
         // Convert to a clockwire ring, then stream.
@@ -289,8 +292,8 @@ struct wkt_box
             //assert_dimension<B, 2>();
         }
 
-        template <typename RingType, typename Char, typename Traits>
-        static inline void do_apply(std::basic_ostream<Char, Traits>& os,
+        template <typename RingType, typename OutputStream>
+        static inline void do_apply(OutputStream& os,
                     Box const& box)
         {
             RingType ring;
@@ -308,8 +311,8 @@ struct wkt_segment
 {
     typedef typename point_type<Segment>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment, bool)
     {
         // Convert to two points, then stream
@@ -331,6 +334,44 @@ struct wkt_segment
         {}
 };
 
+/*!
+\brief Internal, output appending WKT to a buffer of characters, used in
+    place of a stream.
+\tparam Buffer container of characters, e.g. std::string or std::vector<char>
+\tparam Formatter formatter of coordinates, see util/coordinate_format.hpp
+*/
+template <typename Buffer, typename Formatter>
+class buffer_output
+{
+public:
+    buffer_output(Buffer& buffer, Formatter const& formatter)
+        : m_buffer(buffer)
+        , m_formatter(formatter)
+    {}
+
+    inline buffer_output& operator<<(char const* str)
+    {
+        char const* last = str;
+        while (*last != '\0')
+        {
+            ++last;
+        }
+        m_buffer.insert(m_buffer.end(), str, last);
+        return *this;
+    }
+
+    template <typename Coordinate>
+    inline buffer_output& operator<<(Coordinate const& coordinate)
+    {
+        m_formatter.apply(m_buffer, coordinate);
+        return *this;
+    }
+
+private:
+    Buffer& m_buffer;
+    Formatter m_formatter;
+};
+
 }} // namespace detail::wkt
 #endif // DOXYGEN_NO_DETAIL
 
@@ -495,6 +536,21 @@ struct devarianted_wkt<variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+template <typename Geometry, typename Buffer, typename Formatter>
+inline void to_buffer(Geometry const& geometry, Buffer& buffer,
+                      Formatter const& formatter, bool force_closure)
+{
+    buffer_output<Buffer, Formatter> output(buffer, formatter);
+    dispatch::devarianted_wkt<Geometry>::apply(output, geometry, force_closure);
+}
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
 /*!
 \brief Generic geometry template manipulator class, takes corresponding output class from traits class
 \ingroup wkt
@@ -526,12 +582,41 @@ public:
             std::basic_ostream<Char, Traits>& os,
             wkt_manipulator const& m)
     {
-        dispatch::devarianted_wkt<Geometry>::apply(os, m.m_geometry, m.m_force_closure);
+        m.write(os);
         os.flush();
         return os;
     }
 
 private:
+    template <typename Char, typename Traits>
+    inline void write(std::basic_ostream<Char, Traits>& os) const
+    {
+        dispatch::devarianted_wkt<Geometry>::apply(os, m_geometry, m_force_closure);
+    }
+
+    // The WKT is formatted into a buffer if the result is the same as
+    // streamed, i.e. the stream uses the default format and locale
+    inline void write(std::ostream& os) const
+    {
+        std::ios_base::fmtflags const flags = std::ios_base::floatfield
+                                            | std::ios_base::showpos
+                                            | std::ios_base::showpoint
+                                            | std::ios_base::uppercase;
+        if ((os.flags() & flags) != 0
+            || os.width() != 0
+            || os.getloc() != std::locale::classic())
+        {
+            dispatch::devarianted_wkt<Geometry>::apply(os, m_geometry, m_force_closure);
+            return;
+        }
+
+        std::string buffer;
+        detail::wkt::to_buffer(m_geometry, buffer,
+            detail::coordinate_format::precision(int(os.precision())),
+            m_force_closure);
+        os.write(buffer.data(), std::streamsize(buffer.size()));
+    }
+
     Geometry const& m_geometry;
     bool m_force_closure;
 };
@@ -551,6 +636,51 @@ inline wkt_manipulator<Geometry> wkt(Geometry const& geometry)
     return wkt_manipulator<Geometry>(geometry);
 }
 
+/*!
+\brief Appends the WKT representation of a geometry to a buffer of
+    characters, without using streams
+\details Coordinates are written with the shortest representation which is
+    read back as the same value.
+\tparam Geometry \tparam_geometry
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+\param geometry \param_geometry
+\param buffer buffer the WKT is appended to
+\ingroup wkt
+*/
+template <typename Geometry, typename Buffer>
+inline void to_wkt(Geometry const& geometry, Buffer& buffer)
+{
+    concepts::check<Geometry const>();
+
+    detail::wkt::to_buffer(geometry, buffer,
+        detail::coordinate_format::shortest(),
+        ! boost::is_same<typename tag<Geometry>::type, ring_tag>::value);
+}
+
+/*!
+\brief Appends the WKT representation of a geometry to a buffer of
+    characters, without using streams
+\details Coordinates are written with the number of significant digits
+    passed, the result is the same as streamed with this precision.
+\tparam Geometry \tparam_geometry
+\tparam Buffer container of characters supporting insertion at the end,
+    e.g. std::string or std::vector<char>
+\param geometry \param_geometry
+\param buffer buffer the WKT is appended to
+\param precision number of significant digits of coordinates
+\ingroup wkt
+*/
+template <typename Geometry, typename Buffer>
+inline void to_wkt(Geometry const& geometry, Buffer& buffer, int precision)
+{
+    concepts::check<Geometry const>();
+
+    detail::wkt::to_buffer(geometry, buffer,
+        detail::coordinate_format::precision(precision),
+        ! boost::is_same<typename tag<Geometry>::type, ring_tag>::value);
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
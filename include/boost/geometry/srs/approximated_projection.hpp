@@ -0,0 +1,548 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_APPROXIMATED_PROJECTION_HPP
+#define BOOST_GEOMETRY_SRS_APPROXIMATED_PROJECTION_HPP
+
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/math.hpp>
+
+#include <boost/mpl/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/utility/enable_if.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+/*!
+\brief Coefficients of the approximation of a projection
+\details The area of use is recursively divided into quadrants. Each leaf
+    holds the coefficients of two bivariate Chebyshev series of given degree
+    (for x and y) or is marked as exact if the series couldn't be fitted with
+    required accuracy. The data can be stored and used later to create
+    approximated_projection without fitting.
+\ingroup projection
+*/
+template <typename CT = double>
+struct approximation_data
+{
+    struct node
+    {
+        node()
+            : children(0)
+            , coefficients(exact)
+            , degree(0)
+        {}
+
+        static const std::size_t exact = std::size_t(-1);
+
+        // index of the first of 4 children or 0 for leafs
+        std::size_t children;
+        // offset of coefficients or exact
+        std::size_t coefficients;
+        // degree of Chebyshev series of this node
+        std::size_t degree;
+    };
+
+    approximation_data()
+        : degree(0)
+        , min_lon(0), min_lat(0), max_lon(0), max_lat(0)
+    {}
+
+    // maximum degree of Chebyshev series
+    std::size_t degree;
+    // area of use in radians
+    CT min_lon, min_lat, max_lon, max_lat;
+    std::vector<node> nodes;
+    std::vector<CT> coefficients;
+};
+
+
+} // namespace srs
+
+
+namespace projections
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+struct approximated_forward_point_policy
+{
+    template <typename LL, typename XY, typename Proj>
+    static inline bool apply(LL const& ll, XY & xy, Proj const& proj)
+    {
+        return proj.forward_point(ll, xy);
+    }
+};
+
+// Values of Chebyshev polynomials T_i(t) for i in [0, n]
+template <typename CT>
+inline void chebyshev_polynomials(CT const& t, std::size_t n, CT * result)
+{
+    CT const t2 = t + t;
+    result[0] = 1;
+    if (n > 0)
+    {
+        result[1] = t;
+    }
+    for (std::size_t i = 2 ; i <= n ; ++i)
+    {
+        result[i] = t2 * result[i - 1] - result[i - 2];
+    }
+}
+
+// Evaluates sum c[i * (n + 1) + j] T_i(u) T_j(v) for i, j in [0, n] for two
+// series stored one after another. The inner sums are independent, so
+// contrary to Clenshaw's recurrence they can be pipelined and vectorized.
+template <typename CT>
+inline void chebyshev_series(CT const* c, std::size_t n,
+                             CT const& u, CT const& v,
+                             CT & result1, CT & result2)
+{
+    // degree is checked when the approximation is created
+    CT tu[32], tv[32];
+    chebyshev_polynomials(u, n, tu);
+    chebyshev_polynomials(v, n, tv);
+
+    std::size_t const n1 = n + 1;
+    CT const* c2 = c + n1 * n1;
+    CT r1 = 0, r2 = 0;
+    for (std::size_t i = 0 ; i < n1 ; ++i, c += n1, c2 += n1)
+    {
+        CT s1 = 0, s2 = 0;
+        for (std::size_t j = 0 ; j < n1 ; ++j)
+        {
+            s1 += c[j] * tv[j];
+            s2 += c2[j] * tv[j];
+        }
+        r1 += s1 * tu[i];
+        r2 += s2 * tu[i];
+    }
+    result1 = r1;
+    result2 = r2;
+}
+
+template <typename Projection, typename CT>
+class approximation_builder
+{
+    typedef model::point<CT, 2, cs::geographic<radian> > point_ll;
+    typedef model::point<CT, 2, cs::cartesian> point_xy;
+    typedef srs::approximation_data<CT> data_type;
+    typedef typename data_type::node node_type;
+
+public:
+    approximation_builder(Projection const& projection, data_type & data,
+                          CT const& max_error, std::size_t max_depth)
+        : m_projection(projection)
+        , m_data(data)
+        , m_max_error(max_error)
+        , m_max_depth(max_depth)
+    {}
+
+    void apply()
+    {
+        m_data.nodes.clear();
+        m_data.coefficients.clear();
+        m_data.nodes.push_back(node_type());
+        build(0, m_data.min_lon, m_data.min_lat, m_data.max_lon, m_data.max_lat, 0);
+    }
+
+private:
+    void build(std::size_t index, CT const& lon0, CT const& lat0,
+               CT const& lon1, CT const& lat1, std::size_t depth)
+    {
+        for (std::size_t degree = 1 ; degree <= m_data.degree ; ++degree)
+        {
+            if (fit(index, degree, lon0, lat0, lon1, lat1))
+            {
+                return;
+            }
+        }
+
+        if (depth >= m_max_depth)
+        {
+            return;
+        }
+
+        std::size_t const children = m_data.nodes.size();
+        m_data.nodes[index].children = children;
+        m_data.nodes.resize(children + 4);
+
+        CT const lon_m = (lon0 + lon1) / 2;
+        CT const lat_m = (lat0 + lat1) / 2;
+        build(children + 0, lon0, lat0, lon_m, lat_m, depth + 1);
+        build(children + 1, lon_m, lat0, lon1, lat_m, depth + 1);
+        build(children + 2, lon0, lat_m, lon_m, lat1, depth + 1);
+        build(children + 3, lon_m, lat_m, lon1, lat1, depth + 1);
+    }
+
+    // Fits the series and checks the error. If the approximation is accurate
+    // enough the coefficients are appended to the data and assigned to the node.
+    bool fit(std::size_t index, std::size_t n,
+             CT const& lon0, CT const& lat0, CT const& lon1, CT const& lat1)
+    {
+        using std::cos;
+
+        std::size_t const n1 = n + 1;
+        CT const pi = math::pi<CT>();
+
+        CT const lon_m = (lon0 + lon1) / 2, lon_h = (lon1 - lon0) / 2;
+        CT const lat_m = (lat0 + lat1) / 2, lat_h = (lat1 - lat0) / 2;
+
+        // values of the function at Chebyshev nodes
+        std::vector<CT> fx(n1 * n1), fy(n1 * n1);
+        for (std::size_t i = 0 ; i < n1 ; ++i)
+        {
+            CT const u = cos(pi * (CT(i) + CT(0.5)) / CT(n1));
+            for (std::size_t j = 0 ; j < n1 ; ++j)
+            {
+                CT const v = cos(pi * (CT(j) + CT(0.5)) / CT(n1));
+                point_xy xy;
+                if (! m_projection.forward(point_ll(lon_m + lon_h * u, lat_m + lat_h * v), xy))
+                {
+                    return false;
+                }
+                fx[i * n1 + j] = geometry::get<0>(xy);
+                fy[i * n1 + j] = geometry::get<1>(xy);
+            }
+        }
+
+        std::size_t const offset = m_data.coefficients.size();
+        m_data.coefficients.resize(offset + 2 * n1 * n1, CT(0));
+        CT * cx = &m_data.coefficients[offset];
+        CT * cy = cx + n1 * n1;
+
+        for (std::size_t a = 0 ; a < n1 ; ++a)
+        {
+            for (std::size_t b = 0 ; b < n1 ; ++b)
+            {
+                CT sx = 0, sy = 0;
+                for (std::size_t i = 0 ; i < n1 ; ++i)
+                {
+                    CT const ta = cos(pi * CT(a) * (CT(i) + CT(0.5)) / CT(n1));
+                    for (std::size_t j = 0 ; j < n1 ; ++j)
+                    {
+                        CT const t = ta * cos(pi * CT(b) * (CT(j) + CT(0.5)) / CT(n1));
+                        sx += fx[i * n1 + j] * t;
+                        sy += fy[i * n1 + j] * t;
+                    }
+                }
+                CT f = CT(4) / CT(n1 * n1);
+                if (a == 0) f /= 2;
+                if (b == 0) f /= 2;
+                cx[a * n1 + b] = sx * f;
+                cy[a * n1 + b] = sy * f;
+            }
+        }
+
+        // The error is only sampled, so half of max_error is reserved for the
+        // error between the samples. It is estimated by the Chebyshev tail,
+        // i.e. the sum of the magnitudes of the highest degree coefficients,
+        // which for smooth functions is not smaller than the error of the
+        // series of degree n - 1.
+        CT const half_error = m_max_error / 2;
+        CT tx = 0, ty = 0;
+        for (std::size_t k = 0 ; k < n1 ; ++k)
+        {
+            tx += math::abs(cx[n * n1 + k]) + math::abs(cx[k * n1 + n]);
+            ty += math::abs(cy[n * n1 + k]) + math::abs(cy[k * n1 + n]);
+        }
+        tx -= math::abs(cx[n * n1 + n]);
+        ty -= math::abs(cy[n * n1 + n]);
+        if (! (tx * tx + ty * ty <= half_error * half_error))
+        {
+            m_data.coefficients.resize(offset);
+            return false;
+        }
+
+        // check the error on a dense regular grid, including the borders
+        std::size_t const m = 4 * n1 + 1;
+        for (std::size_t i = 0 ; i < m ; ++i)
+        {
+            CT const u = CT(2 * i) / CT(m - 1) - CT(1);
+            for (std::size_t j = 0 ; j < m ; ++j)
+            {
+                CT const v = CT(2 * j) / CT(m - 1) - CT(1);
+                point_xy xy;
+                if (! m_projection.forward(point_ll(lon_m + lon_h * u, lat_m + lat_h * v), xy))
+                {
+                    m_data.coefficients.resize(offset);
+                    return false;
+                }
+                CT x, y;
+                chebyshev_series(cx, n, u, v, x, y);
+                CT const dx = x - geometry::get<0>(xy);
+                CT const dy = y - geometry::get<1>(xy);
+                if (! (dx * dx + dy * dy <= half_error * half_error))
+                {
+                    m_data.coefficients.resize(offset);
+                    return false;
+                }
+            }
+        }
+
+        m_data.nodes[index].coefficients = offset;
+        m_data.nodes[index].degree = n;
+        return true;
+    }
+
+    Projection const& m_projection;
+    data_type & m_data;
+    CT m_max_error;
+    std::size_t m_max_depth;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+} // namespace projections
+
+
+namespace srs
+{
+
+/*!
+\brief Projection approximated with piecewise Chebyshev series
+\details The forward projection is fitted once in the area of use, which is
+    recursively divided until the difference between the approximation and
+    the exact projection is not greater than max_error. The error is not
+    strictly guaranteed: it is sampled on a dense regular grid of each quadrant
+    where it has to be within half of max_error, the other half is reserved
+    for the error between the samples, estimated by the magnitude of the
+    highest degree Chebyshev coefficients. Points outside the area of use and in quadrants
+    which couldn't be approximated (e.g. containing points which can't be
+    projected) are projected exactly. The inverse projection is always exact.
+\ingroup projection
+\tparam Projection the exact projection, e.g. srs::projection<>
+\tparam CT calculation type of the approximation
+*/
+template <typename Projection, typename CT = double>
+class approximated_projection
+{
+public:
+    typedef approximation_data<CT> data_type;
+
+    /*!
+    \brief Fits the approximation
+    \param projection the exact projection
+    \param area_of_use geographic box in which the projection is approximated
+    \param max_error maximum error in units of projected coordinates (e.g.
+        metres only if the projection is defined with +units=m), estimated
+        conservatively as described above
+    \param degree degree of the Chebyshev series in each quadrant
+    \param max_depth maximum depth of subdivision of the area of use
+    \exception projection_exception if the degree is greater than 31
+    */
+    template <typename Box>
+    approximated_projection(Projection const& projection,
+                            Box const& area_of_use,
+                            CT const& max_error,
+                            std::size_t degree = 6,
+                            std::size_t max_depth = 8)
+        : m_projection(projection)
+    {
+        check_degree(degree);
+
+        m_data.degree = degree;
+        m_data.min_lon = geometry::get_as_radian<min_corner, 0>(area_of_use);
+        m_data.min_lat = geometry::get_as_radian<min_corner, 1>(area_of_use);
+        m_data.max_lon = geometry::get_as_radian<max_corner, 0>(area_of_use);
+        m_data.max_lat = geometry::get_as_radian<max_corner, 1>(area_of_use);
+
+        projections::detail::approximation_builder
+            <
+                Projection, CT
+            >(m_projection, m_data, max_error, max_depth).apply();
+    }
+
+    /*!
+    \brief Uses previously fitted approximation, e.g. loaded from cache
+    \exception projection_exception if the data is not consistent, e.g. the
+        degree is greater than 31 or the coefficients of a node are missing
+    */
+    approximated_projection(Projection const& projection,
+                            data_type const& data)
+        : m_projection(projection)
+        , m_data(data)
+    {
+        check_data();
+    }
+
+    data_type const& data() const
+    {
+        return m_data;
+    }
+
+    Projection const& exact() const
+    {
+        return m_projection;
+    }
+
+    /// Forward projection, from Latitude-Longitude to Cartesian
+    template <typename LL, typename XY>
+    inline bool forward(LL const& ll, XY& xy) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<LL, XY>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (LL, XY));
+
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        return projections::detail::project_geometry
+                <
+                    LL,
+                    projections::detail::approximated_forward_point_policy
+                >::apply(ll, xy, *this);
+    }
+
+    /// Forward projection using execution policy
+    template <typename ExecutionPolicy, typename LL, typename XY>
+    inline typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    forward(ExecutionPolicy const& policy, LL const& ll, XY& xy) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<LL, XY>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (LL, XY));
+
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        return projections::detail::project_geometry
+                <
+                    LL,
+                    projections::detail::approximated_forward_point_policy
+                >::apply(ll, xy, *this, policy);
+    }
+
+    /// Inverse projection, from Cartesian to Latitude-Longitude, exact
+    template <typename XY, typename LL>
+    inline bool inverse(XY const& xy, LL& ll) const
+    {
+        return m_projection.inverse(xy, ll);
+    }
+
+private:
+    friend struct projections::detail::approximated_forward_point_policy;
+
+    // The series are evaluated using buffers of 32 Chebyshev polynomials
+    static inline void check_degree(std::size_t degree)
+    {
+        if (degree >= 32)
+        {
+            BOOST_THROW_EXCEPTION( projection_exception(
+                "Degree of the approximation should be less than 32.") );
+        }
+    }
+
+    // Stored data is checked because it is used without bounds checking
+    inline void check_data() const
+    {
+        typedef typename data_type::node node_type;
+
+        check_degree(m_data.degree);
+
+        std::size_t const count = m_data.nodes.size();
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            node_type const& n = m_data.nodes[i];
+            // children follow their parent so the traversal terminates
+            if (n.children != 0
+             && (count < 4 || n.children <= i || n.children > count - 4))
+            {
+                BOOST_THROW_EXCEPTION( projection_exception(
+                    "Invalid node of the approximation.") );
+            }
+            if (n.coefficients != node_type::exact)
+            {
+                std::size_t const n1 = n.degree + 1;
+                if (n.degree > m_data.degree
+                 || n.coefficients > m_data.coefficients.size()
+                 || m_data.coefficients.size() - n.coefficients < 2 * n1 * n1)
+                {
+                    BOOST_THROW_EXCEPTION( projection_exception(
+                        "Number of coefficients of the approximation doesn't match its degree.") );
+                }
+            }
+        }
+    }
+
+    template <typename LL, typename XY>
+    inline bool forward_point(LL const& ll, XY& xy) const
+    {
+        typedef typename data_type::node node_type;
+
+        CT const lon = geometry::get_as_radian<0>(ll);
+        CT const lat = geometry::get_as_radian<1>(ll);
+
+        if (m_data.nodes.empty()
+         || ! (lon >= m_data.min_lon && lon <= m_data.max_lon
+            && lat >= m_data.min_lat && lat <= m_data.max_lat))
+        {
+            return m_projection.forward(ll, xy);
+        }
+
+        CT lon0 = m_data.min_lon, lon1 = m_data.max_lon;
+        CT lat0 = m_data.min_lat, lat1 = m_data.max_lat;
+        node_type const* n = &m_data.nodes.front();
+        while (n->children != 0)
+        {
+            CT const lon_m = (lon0 + lon1) / 2;
+            CT const lat_m = (lat0 + lat1) / 2;
+            std::size_t i = 0;
+            if (lon < lon_m) { lon1 = lon_m; } else { lon0 = lon_m; i += 1; }
+            if (lat < lat_m) { lat1 = lat_m; } else { lat0 = lat_m; i += 2; }
+            n = &m_data.nodes[n->children + i];
+        }
+
+        if (n->coefficients == node_type::exact)
+        {
+            return m_projection.forward(ll, xy);
+        }
+
+        CT const u = (lon + lon - lon0 - lon1) / (lon1 - lon0);
+        CT const v = (lat + lat - lat0 - lat1) / (lat1 - lat0);
+
+        CT x, y;
+        projections::detail::chebyshev_series(&m_data.coefficients[n->coefficients],
+                                              n->degree, u, v, x, y);
+        geometry::set<0>(xy, x);
+        geometry::set<1>(xy, y);
+
+        return true;
+    }
+
+    Projection m_projection;
+    data_type m_data;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_APPROXIMATED_PROJECTION_HPP
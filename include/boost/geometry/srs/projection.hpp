@@ -14,10 +14,13 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
 
@@ -31,6 +34,9 @@
 #include <boost/geometry/srs/projections/proj4.hpp>
 #include <boost/geometry/srs/projections/spar.hpp>
 
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/range.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 #include <boost/mpl/assert.hpp>
@@ -39,6 +45,7 @@
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
 
 
 namespace boost { namespace geometry
@@ -168,6 +175,85 @@ struct project_range
                 geometry::point_order<R1>::value != geometry::point_order<R2>::value
             >::apply(r1, r2, convert_policy<Proj>(proj)).result();
     }
+
+    template <typename R1, typename R2, typename Proj>
+    static inline bool apply(R1 const& r1, R2 & r2, Proj const& proj,
+                             geometry::execution::sequenced_policy const& )
+    {
+        return apply(r1, r2, proj);
+    }
+
+    // Points are projected in chunks, possibly on several threads. The
+    // output is the same as the one created by range_to_range above, i.e.
+    // the i-th output point is projected from the point of the input range
+    // with index source_index(i) (the order and closure are taken into account)
+    template <typename R1, typename R2, typename Proj>
+    static inline bool apply(R1 const& r1, R2 & r2, Proj const& proj,
+                             geometry::execution::parallel_policy const& policy)
+    {
+        std::size_t const size1 = boost::size(r1);
+        std::size_t size2 = size1;
+        if (size1 > 0 && geometry::closure<R1>::value == geometry::open)
+        {
+            ++size2;
+        }
+        if (size2 > 0 && geometry::closure<R2>::value == geometry::open)
+        {
+            --size2;
+        }
+
+        geometry::clear(r2);
+        range::resize(r2, size2);
+
+        static const bool reverse = geometry::point_order<R1>::value
+                                 != geometry::point_order<R2>::value;
+
+        std::vector<int> results(geometry::detail::execution::chunk_count(size2, policy), 1);
+        geometry::detail::execution::for_each_chunk(size2, policy,
+            chunk_policy<R1, R2, Proj>(r1, r2, proj, reverse, results));
+
+        return std::find(results.begin(), results.end(), 0) == results.end();
+    }
+
+private:
+    template <typename R1, typename R2, typename Proj>
+    struct chunk_policy
+    {
+        chunk_policy(R1 const& r1, R2 & r2, Proj const& proj, bool reverse,
+                     std::vector<int> & results)
+            : m_r1(r1), m_r2(r2), m_proj(proj), m_reverse(reverse)
+            , m_results(results)
+        {}
+
+        inline std::size_t source_index(std::size_t i) const
+        {
+            std::size_t const size1 = boost::size(m_r1);
+            // the closing point of the open input range is the first one
+            std::size_t const j = i < size1 ? i : i - size1;
+            return m_reverse ? size1 - 1 - j : j;
+        }
+
+        inline void operator()(std::size_t chunk, std::size_t first, std::size_t last) const
+        {
+            int result = 1;
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                if (! project_point<PointPolicy>::apply(range::at(m_r1, source_index(i)),
+                                                        range::at(m_r2, i),
+                                                        m_proj))
+                {
+                    result = 0;
+                }
+            }
+            m_results[chunk] = result;
+        }
+
+        R1 const& m_r1;
+        R2 & m_r2;
+        Proj const& m_proj;
+        bool m_reverse;
+        std::vector<int> & m_results;
+    };
 };
 
 template <typename Policy>
@@ -177,14 +263,118 @@ struct project_multi
     static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj)
     {
         range::resize(g2, boost::size(g1));
-        return apply(boost::begin(g1), boost::end(g1),
-                     boost::begin(g2),
-                     proj);
+        return apply_range(boost::begin(g1), boost::end(g1),
+                           boost::begin(g2),
+                           proj);
+    }
+
+    template <typename G1, typename G2, typename Proj>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             geometry::execution::sequenced_policy const& )
+    {
+        return apply(g1, g2, proj);
+    }
+
+    // Members containing at least 1/threads of all points are projected
+    // one by one, each of them in parallel. The remaining members are
+    // distributed between threads and projected sequentially.
+    template <typename G1, typename G2, typename Proj>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             geometry::execution::parallel_policy const& policy)
+    {
+        std::size_t const count = boost::size(g1);
+        range::resize(g2, count);
+
+        std::vector<std::size_t> points(count);
+        std::size_t total = 0;
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            points[i] = geometry::num_points(range::at(g1, i));
+            total += points[i];
+        }
+
+        std::size_t const threads = policy.threads();
+        bool result = true;
+        std::vector<std::size_t> small;
+        std::size_t small_total = 0;
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            if (threads > 1 && points[i] * threads >= total
+                && points[i] >= policy.grain_size())
+            {
+                if (! Policy::apply(range::at(g1, i), range::at(g2, i), proj, policy))
+                {
+                    result = false;
+                }
+            }
+            else
+            {
+                small.push_back(i);
+                small_total += points[i];
+            }
+        }
+
+        if (! small.empty())
+        {
+            // The grain size expressed in members instead of points
+            std::size_t grain = small_total > 0
+                ? policy.grain_size() * small.size() / small_total
+                : small.size();
+            // A grain of 0 would be replaced by the default grain size
+            if (grain == 0)
+            {
+                grain = 1;
+            }
+
+            std::vector<int> results(geometry::detail::execution::chunk_count(
+                small.size(), geometry::execution::parallel_policy(threads, grain)), 1);
+            geometry::detail::execution::for_each_chunk(small.size(),
+                geometry::execution::parallel_policy(threads, grain),
+                chunk_policy<G1, G2, Proj>(g1, g2, proj, small, results));
+
+            if (std::find(results.begin(), results.end(), 0) != results.end())
+            {
+                result = false;
+            }
+        }
+
+        return result;
     }
 
 private:
+    template <typename G1, typename G2, typename Proj>
+    struct chunk_policy
+    {
+        chunk_policy(G1 const& g1, G2 & g2, Proj const& proj,
+                     std::vector<std::size_t> const& indexes,
+                     std::vector<int> & results)
+            : m_g1(g1), m_g2(g2), m_proj(proj)
+            , m_indexes(indexes), m_results(results)
+        {}
+
+        inline void operator()(std::size_t chunk, std::size_t first, std::size_t last) const
+        {
+            int result = 1;
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                std::size_t const index = m_indexes[i];
+                if (! Policy::apply(range::at(m_g1, index), range::at(m_g2, index), m_proj))
+                {
+                    result = 0;
+                }
+            }
+            m_results[chunk] = result;
+        }
+
+        G1 const& m_g1;
+        G2 & m_g2;
+        Proj const& m_proj;
+        std::vector<std::size_t> const& m_indexes;
+        std::vector<int> & m_results;
+    };
+
     template <typename It1, typename It2, typename Proj>
-    static inline bool apply(It1 g1_first, It1 g1_last, It2 g2_first, Proj const& proj)
+    static inline bool apply_range(It1 g1_first, It1 g1_last, It2 g2_first, Proj const& proj)
     {
         bool result = true;
         for ( ; g1_first != g1_last ; ++g1_first, ++g2_first )
@@ -210,7 +400,16 @@ struct project_geometry
 template <typename Geometry, typename PointPolicy>
 struct project_geometry<Geometry, PointPolicy, point_tag>
     : project_point<PointPolicy>
-{};
+{
+    using project_point<PointPolicy>::apply;
+
+    template <typename P1, typename P2, typename Proj, typename ExecutionPolicy>
+    static inline bool apply(P1 const& p1, P2 & p2, Proj const& proj,
+                             ExecutionPolicy const& )
+    {
+        return project_point<PointPolicy>::apply(p1, p2, proj);
+    }
+};
 
 template <typename Geometry, typename PointPolicy>
 struct project_geometry<Geometry, PointPolicy, multi_point_tag>
@@ -228,6 +427,13 @@ struct project_geometry<Geometry, PointPolicy, segment_tag>
         return r1 && r2;
     }
 
+    template <typename G1, typename G2, typename Proj, typename ExecutionPolicy>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             ExecutionPolicy const& )
+    {
+        return apply(g1, g2, proj);
+    }
+
 private:
     template <std::size_t Index, typename G1, typename G2, typename Proj>
     static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj)
@@ -273,6 +479,25 @@ struct project_geometry<Geometry, PointPolicy, polygon_tag>
                              proj);
         return r1 && r2;
     }
+
+    template <typename G1, typename G2, typename Proj, typename ExecutionPolicy>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             ExecutionPolicy const& policy)
+    {
+        bool r1 = project_range
+                    <
+                        PointPolicy
+                    >::apply(geometry::exterior_ring(g1),
+                             geometry::exterior_ring(g2),
+                             proj, policy);
+        bool r2 = project_multi
+                    <
+                        project_range<PointPolicy>
+                    >::apply(geometry::interior_rings(g1),
+                             geometry::interior_rings(g2),
+                             proj, policy);
+        return r1 && r2;
+    }
 };
 
 template <typename MultiPolygon, typename PointPolicy>
@@ -487,6 +712,50 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /// Forward projection using execution policy
+    template <typename ExecutionPolicy, typename LL, typename XY>
+    inline typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    forward(ExecutionPolicy const& policy, LL const& ll, XY& xy) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<LL, XY>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (LL, XY));
+
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        return projections::detail::project_geometry
+                <
+                    LL,
+                    projections::detail::forward_point_projection_policy
+                >::apply(ll, xy, base_t::proj(), policy);
+    }
+
+    /// Inverse projection using execution policy
+    template <typename ExecutionPolicy, typename XY, typename LL>
+    inline typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    inverse(ExecutionPolicy const& policy, XY const& xy, LL& ll) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<XY, LL>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (XY, LL));
+
+        concepts::check_concepts_and_equal_dimensions<XY const, LL>();
+
+        return projections::detail::project_geometry
+                <
+                    XY,
+                    projections::detail::inverse_point_projection_policy
+                >::apply(xy, ll, base_t::proj(), policy);
+    }
 };
 
 } // namespace projections
@@ -13,10 +13,12 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_FACTORY_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_FACTORY_HPP
 
-#include <map>
+#include <cstring>
 #include <string>
 
-#include <boost/shared_ptr.hpp>
+#include <boost/array.hpp>
+
+#include <boost/geometry/core/assert.hpp>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
 #include <boost/geometry/srs/projections/proj4.hpp>
@@ -126,40 +128,121 @@ namespace boost { namespace geometry { namespace projections
 namespace detail
 {
 
-template <typename Params>
-struct factory_key
-{
-    BOOST_MPL_ASSERT_MSG((false), INVALID_PARAMETERS_TYPE, (Params));
-};
+// Number of dynamic projection identifiers, proj_wink2 is the last one
+static const std::size_t factory_max_entries = srs::dpar::proj_wink2 + 1;
 
-template <>
-struct factory_key<srs::detail::proj4_parameters>
+// Table of entries sorted by name, searched with binary search
+template <typename Function>
+class factory_table_by_name
 {
-    typedef std::string type;
+    struct entry
+    {
+        const char* name;
+        Function function;
+    };
+
+public:
+    factory_table_by_name()
+        : m_count(0)
+    {}
+
+    void add(const char* name, srs::dpar::value_proj , Function function)
+    {
+        // Insertion sort, this is done once for a small number of entries
+        std::size_t i = lower_bound(name);
+        if (i < m_count && std::strcmp(m_entries[i].name, name) == 0)
+        {
+            m_entries[i].function = function;
+            return;
+        }
+
+        BOOST_GEOMETRY_ASSERT(m_count < m_entries.size());
+        for (std::size_t j = m_count ; j > i ; --j)
+        {
+            m_entries[j] = m_entries[j - 1];
+        }
+        m_entries[i].name = name;
+        m_entries[i].function = function;
+        ++m_count;
+    }
+
     template <typename ProjParams>
-    static type const& get(ProjParams const& par)
+    Function find(ProjParams const& par) const
     {
-        return par.id.name;
+        const char* name = par.id.name.c_str();
+        std::size_t i = lower_bound(name);
+        return i < m_count && std::strcmp(m_entries[i].name, name) == 0
+             ? m_entries[i].function
+             : 0;
     }
-    static const char* get(const char* name, srs::dpar::value_proj id)
+
+private:
+    std::size_t lower_bound(const char* name) const
     {
-        return name;
+        std::size_t first = 0, count = m_count;
+        while (count > 0)
+        {
+            std::size_t const step = count / 2;
+            if (std::strcmp(m_entries[first + step].name, name) < 0)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+        return first;
     }
+
+    boost::array<entry, factory_max_entries> m_entries;
+    std::size_t m_count;
 };
 
-template <typename T>
-struct factory_key<srs::dpar::parameters<T> >
+// Table of entries indexed by projection identifier
+template <typename Function>
+class factory_table_by_id
 {
-    typedef srs::dpar::value_proj type;
-    template <typename ProjParams>
-    static type const& get(ProjParams const& par)
+public:
+    factory_table_by_id()
     {
-        return par.id.id;
+        m_entries.assign(0);
     }
-    static srs::dpar::value_proj get(const char* name, srs::dpar::value_proj id)
+
+    void add(const char* , srs::dpar::value_proj id, Function function)
     {
-        return id;
+        BOOST_GEOMETRY_ASSERT(std::size_t(id) < m_entries.size());
+        m_entries[id] = function;
     }
+
+    template <typename ProjParams>
+    Function find(ProjParams const& par) const
+    {
+        std::size_t const id = par.id.id;
+        return id < m_entries.size() ? m_entries[id] : 0;
+    }
+
+private:
+    boost::array<Function, factory_max_entries> m_entries;
+};
+
+template <typename Params, typename Function>
+struct factory_table
+{
+    BOOST_MPL_ASSERT_MSG((false), INVALID_PARAMETERS_TYPE, (Params));
+};
+
+template <typename Function>
+struct factory_table<srs::detail::proj4_parameters, Function>
+{
+    typedef factory_table_by_name<Function> type;
+};
+
+template <typename T, typename Function>
+struct factory_table<srs::dpar::parameters<T>, Function>
+{
+    typedef factory_table_by_id<Function> type;
 };
 
 
@@ -167,20 +250,19 @@ template <typename Params, typename CT, typename ProjParams>
 class factory
 {
 private:
-    typedef detail::factory_entry
+    typedef typename detail::factory_entry
         <
             Params,
             CT,
             ProjParams
-        > entry_base;
+        >::create_function create_function;
 
-    typedef factory_key<Params> key;
-    typedef typename key::type key_type;
-    typedef boost::shared_ptr<entry_base> entry_ptr;
-
-    typedef std::map<key_type, entry_ptr> entries_map;
+    typedef typename factory_table
+        <
+            Params, create_function
+        >::type table_type;
 
-    entries_map m_entries;
+    table_type m_entries;
 
 public:
 
@@ -286,20 +368,17 @@ public:
         detail::wink2_init(*this);
     }
 
-    void add_to_factory(const char* name, srs::dpar::value_proj id, entry_base* entry)
+    void add_to_factory(const char* name, srs::dpar::value_proj id, create_function function)
     {
-        // The pointer has to be owned before std::map::operator[] in case it thrown an exception.
-        entry_ptr ptr(entry);
-        m_entries[key::get(name, id)] = ptr;
+        m_entries.add(name, id, function);
     }
 
     detail::dynamic_wrapper_b<CT, ProjParams>* create_new(Params const& params, ProjParams const& proj_par) const
     {
-        typedef typename entries_map::const_iterator const_iterator;
-        const_iterator it = m_entries.find(key::get(proj_par));
-        if (it != m_entries.end())
+        create_function function = m_entries.find(proj_par);
+        if (function != 0)
         {
-            return it->second->create_new(params, proj_par);
+            return function(params, proj_par);
         }
 
         return 0;
@@ -110,6 +110,8 @@ public:
 template <typename GridsStorage = grids_storage<> >
 struct transformation_grids
 {
+    typedef projection_grids<GridsStorage> projection_grids_type;
+
     explicit transformation_grids(GridsStorage & storage)
         : src_grids(storage)
         , dst_grids(storage)
@@ -132,6 +134,8 @@ struct empty_projection_grids {};
 template <>
 struct transformation_grids<detail::empty_grids_storage>
 {
+    typedef detail::empty_projection_grids projection_grids_type;
+
     detail::empty_projection_grids src_grids;
     detail::empty_projection_grids dst_grids;
 };
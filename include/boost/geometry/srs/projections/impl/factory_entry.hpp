@@ -27,21 +27,22 @@ namespace detail
 template <typename Params, typename CT, typename Parameters>
 class factory;
 
+// Entries are stateless, they're stored in the factory as pointers to
+// creating functions, so no dynamic allocation is needed
 template <typename Params, typename CT, typename Parameters>
 struct factory_entry
 {
-    virtual ~factory_entry() {}
-    virtual dynamic_wrapper_b<CT, Parameters>* create_new(Params const& , Parameters const& ) const = 0;
+    typedef dynamic_wrapper_b<CT, Parameters>* (*create_function)(Params const& , Parameters const& );
 };
 
 // Macros for entries definition
 
 #define BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_BEGIN(ENTRY) \
 template <typename Params, typename T, typename Parameters> \
-struct ENTRY : projections::detail::factory_entry<Params, T, Parameters> \
+struct ENTRY \
 { \
-    projections::detail::dynamic_wrapper_b<T, Parameters>* create_new(Params const& params, \
-                                                                      Parameters const& parameters) const
+    static projections::detail::dynamic_wrapper_b<T, Parameters>* create_new(Params const& params, \
+                                                                             Parameters const& parameters)
 
 #define BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_ENTRY_END };
 
@@ -77,7 +78,7 @@ inline void FUN_NAME(projections::detail::factory<Params, T, Parameters>& factor
 #define BOOST_GEOMETRY_PROJECTIONS_DETAIL_FACTORY_INIT_ENTRY(PROJ_NAME, ENTRY) \
     factory.add_to_factory(#PROJ_NAME, \
                            srs::dpar::proj_##PROJ_NAME, \
-                           new ENTRY<Params, T, Parameters>);
+                           &ENTRY<Params, T, Parameters>::create_new);
 
 } // namespace detail
 }}} // namespace boost::geometry::projections
@@ -11,9 +11,13 @@
 #define BOOST_GEOMETRY_SRS_TRANSFORMATION_HPP
 
 
+#include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
 
@@ -27,6 +31,9 @@
 #include <boost/geometry/srs/projections/grids.hpp>
 #include <boost/geometry/srs/projections/impl/pj_transform.hpp>
 
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/range.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 #include <boost/mpl/assert.hpp>
@@ -35,6 +42,7 @@
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
 
 
 namespace boost { namespace geometry
@@ -43,6 +51,55 @@ namespace boost { namespace geometry
 namespace projections { namespace detail
 {
 
+// Grids may be used concurrently by several threads only if they don't have
+// to be loaded or if they are shared (loaded under lock)
+template <typename Grids>
+struct are_grids_thread_safe
+{
+    static const bool value = false;
+};
+
+template <>
+struct are_grids_thread_safe<srs::detail::empty_projection_grids>
+{
+    static const bool value = true;
+};
+
+template <typename GridsStorage>
+struct are_grids_thread_safe<srs::projection_grids<GridsStorage> >
+{
+    static const bool value = boost::is_same
+        <
+            typename GridsStorage::grids_type::tag,
+            shared_grids_tag
+        >::value;
+};
+
+// Execution policy used for given grids
+template
+<
+    typename Grids,
+    bool ThreadSafe = are_grids_thread_safe<Grids>::value
+>
+struct grids_execution_policy
+{
+    template <typename ExecutionPolicy>
+    static inline ExecutionPolicy const& apply(ExecutionPolicy const& policy)
+    {
+        return policy;
+    }
+};
+
+template <typename Grids>
+struct grids_execution_policy<Grids, false>
+{
+    template <typename ExecutionPolicy>
+    static inline geometry::execution::sequenced_policy apply(ExecutionPolicy const& )
+    {
+        return geometry::execution::sequenced_policy();
+    }
+};
+
 template <typename T1, typename T2>
 inline bool same_object(T1 const& , T2 const& )
 {
@@ -326,6 +383,109 @@ struct transform_range
 
         return res;
     }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename RangeIn, typename RangeOut,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             RangeIn const& in, RangeOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             geometry::execution::sequenced_policy const& )
+    {
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2);
+    }
+
+    // The range is transformed in chunks, each of them by a separate call
+    // of pj_transform(), possibly on several threads
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename RangeIn, typename RangeOut,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             RangeIn const& in, RangeOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             geometry::execution::parallel_policy const& policy)
+    {
+        // NOTE: this has to be consistent with pj_transform()
+        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+
+        transform_geometry_wrapper<RangeOut, CT> wrapper(in, out, input_angles);
+
+        typedef typename transform_geometry_wrapper<RangeOut, CT>::type range_type;
+        typedef chunk_policy<Proj1, Par1, Proj2, Par2, range_type, Grids> chunk_policy_type;
+
+        std::size_t const count = boost::size(wrapper.get());
+        std::vector<int> results(geometry::detail::execution::chunk_count(count, policy), 1);
+        geometry::detail::execution::for_each_chunk(count, policy,
+            chunk_policy_type(proj1, par1, proj2, par2,
+                              wrapper.get(), grids1, grids2, results));
+
+        wrapper.finish();
+
+        return std::find(results.begin(), results.end(), 0) == results.end();
+    }
+
+private:
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename Range, typename Grids
+    >
+    struct chunk_policy
+    {
+        chunk_policy(Proj1 const& proj1, Par1 const& par1,
+                     Proj2 const& proj2, Par2 const& par2,
+                     Range & range,
+                     Grids const& grids1, Grids const& grids2,
+                     std::vector<int> & results)
+            : m_proj1(proj1), m_par1(par1), m_proj2(proj2), m_par2(par2)
+            , m_range(range), m_grids1(grids1), m_grids2(grids2)
+            , m_results(results)
+        {}
+
+        inline void operator()(std::size_t chunk, std::size_t first, std::size_t last) const
+        {
+            typedef typename boost::range_iterator<Range>::type iterator;
+            std::pair<iterator, iterator> sub_range(range::pos(m_range, first),
+                                                    range::pos(m_range, last));
+
+            bool res = true;
+            try
+            {
+                res = pj_transform(m_proj1, m_par1, m_proj2, m_par2, sub_range,
+                                   m_grids1, m_grids2);
+            }
+            catch (projection_exception const&)
+            {
+                res = false;
+            }
+            catch(...)
+            {
+                BOOST_RETHROW
+            }
+
+            m_results[chunk] = res ? 1 : 0;
+        }
+
+        Proj1 const& m_proj1;
+        Par1 const& m_par1;
+        Proj2 const& m_proj2;
+        Par2 const& m_par2;
+        Range & m_range;
+        Grids const& m_grids1;
+        Grids const& m_grids2;
+        std::vector<int> & m_results;
+    };
 };
 
 template <typename Policy>
@@ -346,13 +506,159 @@ struct transform_multi
         if (! same_object(in, out))
             range::resize(out, boost::size(in));
 
-        return apply(proj1, par1, proj2, par2,
-                     boost::begin(in), boost::end(in),
-                     boost::begin(out),
-                     grids1, grids2);
+        return apply_range(proj1, par1, proj2, par2,
+                           boost::begin(in), boost::end(in),
+                           boost::begin(out),
+                           grids1, grids2);
+    }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename MultiIn, typename MultiOut,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             MultiIn const& in, MultiOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             geometry::execution::sequenced_policy const& )
+    {
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2);
+    }
+
+    // Members containing at least 1/threads of all points are transformed
+    // one by one, each of them in parallel. The remaining members are
+    // distributed between threads and transformed sequentially.
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename MultiIn, typename MultiOut,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             MultiIn const& in, MultiOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             geometry::execution::parallel_policy const& policy)
+    {
+        if (! same_object(in, out))
+            range::resize(out, boost::size(in));
+
+        std::size_t const count = boost::size(in);
+
+        std::vector<std::size_t> points(count);
+        std::size_t total = 0;
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            points[i] = geometry::num_points(range::at(in, i));
+            total += points[i];
+        }
+
+        std::size_t const threads = policy.threads();
+        bool res = true;
+        std::vector<std::size_t> small;
+        std::size_t small_total = 0;
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            if (threads > 1 && points[i] * threads >= total
+                && points[i] >= policy.grain_size())
+            {
+                if ( ! Policy::apply(proj1, par1, proj2, par2,
+                                     range::at(in, i), range::at(out, i),
+                                     grids1, grids2, policy) )
+                {
+                    res = false;
+                }
+            }
+            else
+            {
+                small.push_back(i);
+                small_total += points[i];
+            }
+        }
+
+        if (! small.empty())
+        {
+            // The grain size expressed in members instead of points
+            std::size_t grain = small_total > 0
+                ? policy.grain_size() * small.size() / small_total
+                : small.size();
+            // A grain of 0 would be replaced by the default grain size
+            if (grain == 0)
+            {
+                grain = 1;
+            }
+
+            typedef chunk_policy<Proj1, Par1, Proj2, Par2, MultiIn, MultiOut, Grids> chunk_policy_type;
+
+            std::vector<int> results(geometry::detail::execution::chunk_count(
+                small.size(), geometry::execution::parallel_policy(threads, grain)), 1);
+            geometry::detail::execution::for_each_chunk(small.size(),
+                geometry::execution::parallel_policy(threads, grain),
+                chunk_policy_type(proj1, par1, proj2, par2, in, out,
+                                  grids1, grids2, small, results));
+
+            if (std::find(results.begin(), results.end(), 0) != results.end())
+            {
+                res = false;
+            }
+        }
+
+        return res;
     }
 
 private:
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename MultiIn, typename MultiOut,
+        typename Grids
+    >
+    struct chunk_policy
+    {
+        chunk_policy(Proj1 const& proj1, Par1 const& par1,
+                     Proj2 const& proj2, Par2 const& par2,
+                     MultiIn const& in, MultiOut & out,
+                     Grids const& grids1, Grids const& grids2,
+                     std::vector<std::size_t> const& indexes,
+                     std::vector<int> & results)
+            : m_proj1(proj1), m_par1(par1), m_proj2(proj2), m_par2(par2)
+            , m_in(in), m_out(out), m_grids1(grids1), m_grids2(grids2)
+            , m_indexes(indexes), m_results(results)
+        {}
+
+        inline void operator()(std::size_t chunk, std::size_t first, std::size_t last) const
+        {
+            int res = 1;
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                std::size_t const index = m_indexes[i];
+                if ( ! Policy::apply(m_proj1, m_par1, m_proj2, m_par2,
+                                     range::at(m_in, index), range::at(m_out, index),
+                                     m_grids1, m_grids2) )
+                {
+                    res = 0;
+                }
+            }
+            m_results[chunk] = res;
+        }
+
+        Proj1 const& m_proj1;
+        Par1 const& m_par1;
+        Proj2 const& m_proj2;
+        Par2 const& m_par2;
+        MultiIn const& m_in;
+        MultiOut & m_out;
+        Grids const& m_grids1;
+        Grids const& m_grids2;
+        std::vector<std::size_t> const& m_indexes;
+        std::vector<int> & m_results;
+    };
+
     template
     <
         typename Proj1, typename Par1,
@@ -360,7 +666,7 @@ private:
         typename InIt, typename OutIt,
         typename Grids
     >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+    static inline bool apply_range(Proj1 const& proj1, Par1 const& par1,
                              Proj2 const& proj2, Par2 const& par2,
                              InIt in_first, InIt in_last, OutIt out_first,
                              Grids const& grids1, Grids const& grids2)
@@ -390,6 +696,22 @@ struct transform
 template <typename Point, typename CT>
 struct transform<Point, CT, point_tag>
 {
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename PointIn, typename PointOut,
+        typename Grids, typename ExecutionPolicy
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             PointIn const& in, PointOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             ExecutionPolicy const& )
+    {
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2);
+    }
+
     template
     <
         typename Proj1, typename Par1,
@@ -440,6 +762,22 @@ struct transform<MultiPoint, CT, multi_point_tag>
 template <typename Segment, typename CT>
 struct transform<Segment, CT, segment_tag>
 {
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename SegmentIn, typename SegmentOut,
+        typename Grids, typename ExecutionPolicy
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             SegmentIn const& in, SegmentOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             ExecutionPolicy const& )
+    {
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2);
+    }
+
     template
     <
         typename Proj1, typename Par1,
@@ -538,6 +876,35 @@ struct transform<Polygon, CT, polygon_tag>
                               grids1, grids2);
         return r1 && r2;
     }
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename PolygonIn, typename PolygonOut,
+        typename Grids, typename ExecutionPolicy
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             PolygonIn const& in, PolygonOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             ExecutionPolicy const& policy)
+    {
+        bool r1 = transform_range
+                    <
+                        CT
+                    >::apply(proj1, par1, proj2, par2,
+                             geometry::exterior_ring(in),
+                             geometry::exterior_ring(out),
+                             grids1, grids2, policy);
+        bool r2 = transform_multi
+                    <
+                        transform_range<CT>
+                     >::apply(proj1, par1, proj2, par2,
+                              geometry::interior_rings(in),
+                              geometry::interior_rings(out),
+                              grids1, grids2, policy);
+        return r1 && r2;
+    }
 };
 
 template <typename MultiPolygon, typename CT>
@@ -697,6 +1064,99 @@ public:
                          grids.src_grids);
     }
 
+    template <typename ExecutionPolicy, typename GeometryIn, typename GeometryOut>
+    typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    forward(ExecutionPolicy const& policy,
+            GeometryIn const& in, GeometryOut & out) const
+    {
+        return forward(policy, in, out, transformation_grids<detail::empty_grids_storage>());
+    }
+
+    template <typename ExecutionPolicy, typename GeometryIn, typename GeometryOut>
+    typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    inverse(ExecutionPolicy const& policy,
+            GeometryIn const& in, GeometryOut & out) const
+    {
+        return inverse(policy, in, out, transformation_grids<detail::empty_grids_storage>());
+    }
+
+    /*!
+    \brief Transforms the geometry using execution policy
+    \details Ranges and multi-geometries are split into chunks which may be
+        transformed on several threads. The grids are used concurrently only if
+        they are empty or shared (e.g. shared_grids_std), otherwise the
+        geometry is transformed sequentially.
+    */
+    template <typename ExecutionPolicy, typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    forward(ExecutionPolicy const& policy,
+            GeometryIn const& in, GeometryOut & out,
+            transformation_grids<GridsStorage> const& grids) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (GeometryIn, GeometryOut));
+
+        typedef typename transformation_grids<GridsStorage>::projection_grids_type grids_type;
+
+        return projections::detail::transform
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj1.proj(), m_proj1.proj().params(),
+                         m_proj2.proj(), m_proj2.proj().params(),
+                         in, out,
+                         grids.src_grids,
+                         grids.dst_grids,
+                         projections::detail::grids_execution_policy
+                            <
+                                grids_type
+                            >::apply(policy));
+    }
+
+    template <typename ExecutionPolicy, typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    typename boost::enable_if_c
+        <
+            geometry::execution::is_execution_policy<ExecutionPolicy>::value,
+            bool
+        >::type
+    inverse(ExecutionPolicy const& policy,
+            GeometryIn const& in, GeometryOut & out,
+            transformation_grids<GridsStorage> const& grids) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (GeometryIn, GeometryOut));
+
+        typedef typename transformation_grids<GridsStorage>::projection_grids_type grids_type;
+
+        return projections::detail::transform
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj2.proj(), m_proj2.proj().params(),
+                         m_proj1.proj(), m_proj1.proj().params(),
+                         in, out,
+                         grids.dst_grids,
+                         grids.src_grids,
+                         projections::detail::grids_execution_policy
+                            <
+                                grids_type
+                            >::apply(policy));
+    }
+
     template <typename GridsStorage>
     inline transformation_grids<GridsStorage> initialize_grids(GridsStorage & grids_storage) const
     {
@@ -26,12 +26,17 @@
 #include <boost/range/end.hpp>
 
 #include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/algorithms/detail/numbered_ranges.hpp>
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/policies/compare.hpp>
 #include <boost/geometry/strategies/convex_hull.hpp>
 #include <boost/geometry/strategies/side.hpp>
+#include <boost/geometry/util/execution.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
 #include <boost/geometry/views/detail/range_type.hpp>
 
 
@@ -46,135 +51,99 @@ namespace detail
 {
 
 
-template
-<
-    typename InputRange,
-    typename RangeIterator,
-    typename StrategyLess,
-    typename StrategyGreater
->
-struct get_extremes
+/*!
+    \brief Extreme points in eight directions, of which points in the
+        interior of the octagon they form are not part of the hull
+    \details This is the filter of Akl and Toussaint. The directions are
+        ordered counter clockwise, starting at the bottom. Any choice of
+        extreme points gives an octagon within the hull, so points strictly
+        inside all its edges are never a vertex of the hull, and the
+        outcome does not depend on how ties are resolved.
+*/
+template <typename Point, typename SideStrategy>
+class octagon
 {
-    typedef typename point_type<InputRange>::type point_type;
-
-    point_type left, right;
-
-    bool first;
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
 
-    StrategyLess less;
-    StrategyGreater greater;
-
-    inline get_extremes()
-        : first(true)
+public :
+    inline octagon()
+        : m_empty(true)
     {}
 
-    inline void apply(InputRange const& range)
+    inline void apply(Point const& point)
     {
-        if (boost::size(range) == 0)
-        {
-            return;
-        }
-
-        // First iterate through this range
-        // (this two-stage approach avoids many point copies,
-        //  because iterators are kept in memory. Because iterators are
-        //  not persistent (in MSVC) this approach is not applicable
-        //  for more ranges together)
-
-        RangeIterator left_it = boost::begin(range);
-        RangeIterator right_it = boost::begin(range);
-
-        for (RangeIterator it = boost::begin(range) + 1;
-            it != boost::end(range);
-            ++it)
+        calculation_type const x = geometry::get<0>(point);
+        calculation_type const y = geometry::get<1>(point);
+        calculation_type const values[8]
+            = { -y, x - y, x, x + y, y, y - x, -x, -x - y };
+        for (int d = 0; d < 8; d++)
         {
-            if (less(*it, *left_it))
+            if (m_empty || values[d] > m_values[d])
             {
-                left_it = it;
-            }
-
-            if (greater(*it, *right_it))
-            {
-                right_it = it;
+                m_values[d] = values[d];
+                m_points[d] = point;
             }
         }
+        m_empty = false;
+    }
 
-        // Then compare with earlier
-        if (first)
+    template <typename Iterator>
+    inline void apply(Iterator first, Iterator last)
+    {
+        for (Iterator it = first; it != last; ++it)
         {
-            // First time, assign left/right
-            left = *left_it;
-            right = *right_it;
-            first = false;
+            apply(*it);
         }
-        else
-        {
-            // Next time, check if this range was left/right from
-            // the extremes already collected
-            if (less(*left_it, left))
-            {
-                left = *left_it;
-            }
+    }
 
-            if (greater(*right_it, right))
+    inline void merge(octagon const& other)
+    {
+        for (int d = 0; d < 8 && ! other.m_empty; d++)
+        {
+            if (m_empty || other.m_values[d] > m_values[d])
             {
-                right = *right_it;
+                m_values[d] = other.m_values[d];
+                m_points[d] = other.m_points[d];
             }
         }
+        m_empty = m_empty && other.m_empty;
     }
-};
-
-
-template
-<
-    typename InputRange,
-    typename RangeIterator,
-    typename Container,
-    typename SideStrategy
->
-struct assign_range
-{
-    Container lower_points, upper_points;
-
-    typedef typename point_type<InputRange>::type point_type;
-
-    point_type const& most_left;
-    point_type const& most_right;
-
-    inline assign_range(point_type const& left, point_type const& right)
-        : most_left(left)
-        , most_right(right)
-    {}
 
-    inline void apply(InputRange const& range)
+    inline bool is_interior(Point const& point) const
     {
-        typedef SideStrategy side;
-
-        // Put points in one of the two output sequences
-        for (RangeIterator it = boost::begin(range);
-            it != boost::end(range);
-            ++it)
+        bool result = false;
+        for (int d = 0; d < 8; d++)
         {
-            // check if it is lying most_left or most_right from the line
-
-            int dir = side::apply(most_left, most_right, *it);
-            switch(dir)
+            Point const& p1 = m_points[d];
+            Point const& p2 = m_points[(d + 1) % 8];
+            if (geometry::get<0>(p1) == geometry::get<0>(p2)
+                && geometry::get<1>(p1) == geometry::get<1>(p2))
             {
-                case 1 : // left side
-                    upper_points.push_back(*it);
-                    break;
-                case -1 : // right side
-                    lower_points.push_back(*it);
-                    break;
-
-                // 0: on line most_left-most_right,
-                //    or most_left, or most_right,
-                //    -> all never part of hull
+                // Coinciding extremes
+                continue;
             }
+            if (SideStrategy::apply(p1, p2, point) <= 0)
+            {
+                return false;
+            }
+            // With only two distinct extremes the point cannot be at the
+            // left of both edges between them
+            result = true;
         }
+        return result;
     }
+
+private :
+    Point m_points[8];
+    calculation_type m_values[8];
+    bool m_empty;
 };
 
+
 template <typename Range>
 static inline void sort(Range& range)
 {
@@ -207,6 +176,15 @@ private:
     typedef typename std::vector<point_type>::const_iterator iterator;
     typedef typename std::vector<point_type>::const_reverse_iterator rev_iterator;
 
+    typedef typename strategy::side::services::default_strategy
+        <
+            cs_tag
+        >::type side_strategy_type;
+
+    typedef typename geometry::detail::range_type<InputGeometry>::type range_type;
+    typedef geometry::detail::numbered_points<range_type> ranges_type;
+    typedef detail::octagon<point_type, side_strategy_type> octagon_type;
+
 
     class partitions
     {
@@ -217,67 +195,143 @@ private:
         container_type m_copied_input;
     };
 
+    // Collects the points which are not in the interior of the octagon
+    struct filter
+    {
+        inline filter(octagon_type const& octagon, container_type& points)
+            : m_octagon(octagon)
+            , m_points(points)
+        {}
 
-public:
-    typedef partitions state_type;
+        template <typename Iterator>
+        inline void apply(Iterator first, Iterator last)
+        {
+            for (Iterator it = first; it != last; ++it)
+            {
+                if (! m_octagon.is_interior(*it))
+                {
+                    m_points.push_back(*it);
+                }
+            }
+        }
 
+        octagon_type const& m_octagon;
+        container_type& m_points;
+    };
 
-    inline void apply(InputGeometry const& geometry, partitions& state) const
+    struct octagon_worker
     {
-        // First pass.
-        // Get min/max (in most cases left / right) points
-        // This makes use of the geometry::less/greater predicates
+        inline octagon_worker(ranges_type const& ranges,
+                              std::vector<octagon_type>& octagons)
+            : m_ranges(ranges)
+            , m_octagons(octagons)
+        {}
+
+        inline void operator()(std::size_t chunk,
+                               std::size_t first, std::size_t last) const
+        {
+            m_ranges.for_each_run(first, last, m_octagons[chunk]);
+        }
 
-        // For the left boundary it is important that multiple points
-        // are sorted from bottom to top. Therefore the less predicate
-        // does not take the x-only template parameter (this fixes ticket #6019.
-        // For the right boundary it is not necessary (though also not harmful),
-        // because points are sorted from bottom to top in a later stage.
-        // For symmetry and to get often more balanced lower/upper halves
-        // we keep it.
+        ranges_type const& m_ranges;
+        std::vector<octagon_type>& m_octagons;
+    };
 
-        typedef typename geometry::detail::range_type<InputGeometry>::type range_type;
+    // Calculates the hull of the filtered points of a chunk
+    struct hull_worker
+    {
+        inline hull_worker(ranges_type const& ranges,
+                           octagon_type const& octagon,
+                           std::vector<container_type>& hulls)
+            : m_ranges(ranges)
+            , m_octagon(octagon)
+            , m_hulls(hulls)
+        {}
+
+        inline void operator()(std::size_t chunk,
+                               std::size_t first, std::size_t last) const
+        {
+            container_type points;
+            filter f(m_octagon, points);
+            m_ranges.for_each_run(first, last, f);
 
-        typedef typename boost::range_iterator
-            <
-                range_type const
-            >::type range_iterator;
+            partitions state;
+            build_hull(points, state);
 
-        detail::get_extremes
-            <
-                range_type,
-                range_iterator,
-                geometry::less<point_type>,
-                geometry::greater<point_type>
-            > extremes;
-        geometry::detail::for_each_range(geometry, extremes);
+            container_type& hull = m_hulls[chunk];
+            hull.swap(state.m_lower_hull);
+            hull.insert(hull.end(), state.m_upper_hull.begin(),
+                        state.m_upper_hull.end());
+        }
 
-        // Bounding left/right points
-        // Second pass, now that extremes are found, assign all points
-        // in either lower, either upper
-        detail::assign_range
-            <
-                range_type,
-                range_iterator,
-                container_type,
-                typename strategy::side::services::default_strategy<cs_tag>::type
-            > assigner(extremes.left, extremes.right);
+        ranges_type const& m_ranges;
+        octagon_type const& m_octagon;
+        std::vector<container_type>& m_hulls;
+    };
 
-        geometry::detail::for_each_range(geometry, assigner);
 
+public:
+    typedef partitions state_type;
 
-        // Sort both collections, first on x(, then on y)
-        detail::sort(assigner.lower_points);
-        detail::sort(assigner.upper_points);
 
-        //std::cout << boost::size(assigner.lower_points) << std::endl;
-        //std::cout << boost::size(assigner.upper_points) << std::endl;
+    inline void apply(InputGeometry const& geometry, partitions& state) const
+    {
+        apply(geometry, state, geometry::execution::sequenced_policy());
+    }
 
-        // And decide which point should be in the final hull
-        build_half_hull<-1>(assigner.lower_points, state.m_lower_hull,
-                extremes.left, extremes.right);
-        build_half_hull<1>(assigner.upper_points, state.m_upper_hull,
-                extremes.left, extremes.right);
+    /*!
+    \brief Calculates the hull according to an execution policy
+    \details Points in the interior of the octagon of extreme points are
+        discarded first. With more than one chunk, the hulls of the
+        remaining points of each chunk are calculated (in parallel), and
+        the hull is calculated of their vertices. The result does not
+        depend on the policy.
+    */
+    template <typename ExecutionPolicy>
+    inline void apply(InputGeometry const& geometry, partitions& state,
+                      ExecutionPolicy const& policy) const
+    {
+        ranges_type ranges;
+        geometry::detail::for_each_range(geometry, ranges);
+
+        std::size_t const count = ranges.count();
+        std::size_t const chunks
+            = geometry::detail::execution::chunk_count(count, policy);
+        if (chunks == 0)
+        {
+            return;
+        }
+
+        // First pass, get the extremes in eight directions
+        std::vector<octagon_type> octagons(chunks);
+        geometry::detail::execution::for_each_chunk(count, policy,
+            octagon_worker(ranges, octagons));
+        octagon_type octagon;
+        for (std::size_t i = 0; i < chunks; ++i)
+        {
+            octagon.merge(octagons[i]);
+        }
+
+        // Second pass, collect the points which can be part of the hull,
+        // or the vertices of the hull of each chunk
+        container_type points;
+        if (chunks == 1)
+        {
+            filter f(octagon, points);
+            ranges.for_each_run(0, count, f);
+        }
+        else
+        {
+            std::vector<container_type> hulls(chunks);
+            geometry::detail::execution::for_each_chunk(count, policy,
+                hull_worker(ranges, octagon, hulls));
+            for (std::size_t i = 0; i < chunks; ++i)
+            {
+                points.insert(points.end(), hulls[i].begin(), hulls[i].end());
+            }
+        }
+
+        build_hull(points, state);
     }
 
 
@@ -287,6 +341,12 @@ public:
                        bool clockwise,
                        bool closed) const
     {
+        if (state.m_lower_hull.empty())
+        {
+            // Empty input
+            return;
+        }
+
         if (clockwise)
         {
             output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
@@ -300,6 +360,72 @@ public:
 
 private:
 
+    static inline void build_hull(container_type const& points,
+                                  partitions& state)
+    {
+        if (points.empty())
+        {
+            return;
+        }
+
+        // Get min/max (in most cases left / right) points
+        // This makes use of the geometry::less/greater predicates
+
+        // For the left boundary it is important that multiple points
+        // are sorted from bottom to top. Therefore the less predicate
+        // does not take the x-only template parameter (this fixes ticket #6019.
+        // For the right boundary it is not necessary (though also not harmful),
+        // because points are sorted from bottom to top in a later stage.
+        // For symmetry and to get often more balanced lower/upper halves
+        // we keep it.
+        geometry::less<point_type> const less;
+        geometry::greater<point_type> const greater;
+
+        iterator left_it = points.begin();
+        iterator right_it = points.begin();
+        for (iterator it = points.begin() + 1; it != points.end(); ++it)
+        {
+            if (less(*it, *left_it))
+            {
+                left_it = it;
+            }
+
+            if (greater(*it, *right_it))
+            {
+                right_it = it;
+            }
+        }
+
+        point_type const most_left = *left_it;
+        point_type const most_right = *right_it;
+
+        // Put points in lower or upper, depending on the side of the line
+        // most_left-most_right. Points on that line are never part of the hull
+        container_type lower_points, upper_points;
+        for (iterator it = points.begin(); it != points.end(); ++it)
+        {
+            int const dir = side_strategy_type::apply(most_left, most_right, *it);
+            if (dir == 1)
+            {
+                upper_points.push_back(*it);
+            }
+            else if (dir == -1)
+            {
+                lower_points.push_back(*it);
+            }
+        }
+
+        // Sort both collections, first on x(, then on y)
+        detail::sort(lower_points);
+        detail::sort(upper_points);
+
+        // And decide which point should be in the final hull
+        build_half_hull<-1>(lower_points, state.m_lower_hull,
+                most_left, most_right);
+        build_half_hull<1>(upper_points, state.m_upper_hull,
+                most_left, most_right);
+    }
+
     template <int Factor>
     static inline void build_half_hull(container_type const& input,
             container_type& output,
@@ -317,7 +443,7 @@ private:
     template <int Factor>
     static inline void add_to_hull(point_type const& p, container_type& output)
     {
-        typedef typename strategy::side::services::default_strategy<cs_tag>::type side;
+        typedef side_strategy_type side;
 
         output.push_back(p);
         std::size_t output_size = output.size();
@@ -23,6 +23,8 @@
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
 #include <iostream>
 #endif
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include <boost/range.hpp>
@@ -111,6 +113,15 @@ namespace detail
 
     private :
         typedef detail::douglas_peucker_point<Point> dp_point_type;
+
+        // Range between two points, and the importance of the point dividing it
+        struct part
+        {
+            std::size_t first;
+            std::size_t last;
+            distance_type limit;
+        };
+
         typedef typename std::vector<dp_point_type>::iterator iterator_type;
 
 
@@ -119,74 +130,96 @@ namespace detail
             return *this;
         }
 
+        // Finds the point farthest from the segment between the first and
+        // the last point, returns the last point if there is none in between
+        template <typename Iterator>
+        inline Iterator farthest(Iterator begin, Iterator last,
+                                 distance_type& md,
+                                 distance_strategy_type const& ps_distance_strategy) const
+        {
+            md = distance_type(-1.0); // any value < 0
+            Iterator candidate = last;
+            for (Iterator it = begin + 1; it != last; ++it)
+            {
+                distance_type dist = ps_distance_strategy.apply(point_of(*it),
+                                        point_of(*begin), point_of(*last));
+
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+                std::cout << "consider " << dsv(point_of(*it))
+                    << " at " << double(dist)
+                    << std::endl;
+#endif
+                if ( less()(md, dist) )
+                {
+                    md = dist;
+                    candidate = it;
+                }
+            }
+            return candidate;
+        }
+
+        static inline Point const& point_of(dp_point_type const& p)
+        {
+            return p.p;
+        }
+
+        template <typename P>
+        static inline P const& point_of(P const& p)
+        {
+            return p;
+        }
+
+        // Handles the sub-ranges with an explicit stack, instead of
+        // recursively, such that the depth is not limited by the call stack
         inline void consider(iterator_type begin,
                              iterator_type end,
                              distance_type const& max_dist,
                              int& n,
                              distance_strategy_type const& ps_distance_strategy) const
         {
-            std::size_t size = end - begin;
+            std::vector<std::pair<iterator_type, iterator_type> > stack;
+            stack.push_back(std::make_pair(begin, end));
 
-            // size must be at least 3
-            // because we want to consider a candidate point in between
-            if (size <= 2)
+            while (! stack.empty())
             {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                if (begin != end)
+                begin = stack.back().first;
+                end = stack.back().second;
+                stack.pop_back();
+
+                // size must be at least 3
+                // because we want to consider a candidate point in between
+                if (end - begin <= 2)
                 {
-                    std::cout << "ignore between " << dsv(begin->p)
-                        << " and " << dsv((end - 1)->p)
-                        << " size=" << size << std::endl;
+                    continue;
                 }
-                std::cout << "return because size=" << size << std::endl;
-#endif
-                return;
-            }
 
-            iterator_type last = end - 1;
+                iterator_type last = end - 1;
 
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "find between " << dsv(begin->p)
-                << " and " << dsv(last->p)
-                << " size=" << size << std::endl;
+                std::cout << "find between " << dsv(begin->p)
+                    << " and " << dsv(last->p)
+                    << " size=" << (end - begin) << std::endl;
 #endif
 
+                // Find most far point, compare to the current segment
+                distance_type md;
+                iterator_type candidate
+                    = farthest(begin, last, md, ps_distance_strategy);
 
-            // Find most far point, compare to the current segment
-            //geometry::segment<Point const> s(begin->p, last->p);
-            distance_type md(-1.0); // any value < 0
-            iterator_type candidate;
-            for(iterator_type it = begin + 1; it != last; ++it)
-            {
-                distance_type dist = ps_distance_strategy.apply(it->p, begin->p, last->p);
-
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "consider " << dsv(it->p)
-                    << " at " << double(dist)
-                    << ((dist > max_dist) ? " maybe" : " no")
-                    << std::endl;
-
-#endif
-                if ( less()(md, dist) )
+                // If a point is found, set the include flag
+                // and handle segments in between
+                if ( less()(max_dist, md) )
                 {
-                    md = dist;
-                    candidate = it;
-                }
-            }
-
-            // If a point is found, set the include flag
-            // and handle segments in between recursively
-            if ( less()(max_dist, md) )
-            {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "use " << dsv(candidate->p) << std::endl;
+                    std::cout << "use " << dsv(candidate->p) << std::endl;
 #endif
 
-                candidate->included = true;
-                n++;
+                    candidate->included = true;
+                    n++;
 
-                consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-                consider(candidate, end, max_dist, n, ps_distance_strategy);
+                    stack.push_back(std::make_pair(candidate, end));
+                    stack.push_back(std::make_pair(begin, candidate + 1));
+                }
             }
         }
 
@@ -236,6 +269,80 @@ namespace detail
             return out;
         }
 
+        //! Calculates, for each point, the largest distance for which it is
+        //! kept. The first and the last point are always kept.
+        template <typename Range, typename Importance>
+        inline void importance(Range const& range, Importance& result) const
+        {
+            typedef typename boost::range_iterator<Range const>::type iterator;
+            typedef typename boost::range_difference<Range const>::type difference;
+
+            distance_strategy_type strategy;
+
+            std::size_t const size = boost::size(range);
+            result.assign(size, (std::numeric_limits<distance_type>::max)());
+            if (size <= 2)
+            {
+                return;
+            }
+
+            // A point is kept if its distance and the distances of the points
+            // dividing the ranges it was found in are larger, so the smallest
+            // of them is passed on
+            std::vector<part> stack;
+            part const all = { 0, size - 1, (std::numeric_limits<distance_type>::max)() };
+            stack.push_back(all);
+
+            iterator const begin = boost::begin(range);
+            while (! stack.empty())
+            {
+                part const current = stack.back();
+                stack.pop_back();
+                if (current.last - current.first < 2)
+                {
+                    continue;
+                }
+
+                distance_type md;
+                iterator const candidate = farthest(
+                    begin + difference(current.first),
+                    begin + difference(current.last), md, strategy);
+                std::size_t const index = std::size_t(candidate - begin);
+
+                distance_type const limit
+                    = less()(md, current.limit) ? md : current.limit;
+                result[index] = limit;
+
+                part const first_part = { current.first, index, limit };
+                part const second_part = { index, current.last, limit };
+                stack.push_back(second_part);
+                stack.push_back(first_part);
+            }
+        }
+
+        //! Copies the points of which the importance is larger than the
+        //! specified distance, which is the output of apply for that distance
+        template <typename Range, typename Importance, typename OutputIterator>
+        inline OutputIterator extract(Range const& range,
+                                      Importance const& importance,
+                                      OutputIterator out,
+                                      distance_type const& max_distance) const
+        {
+            std::size_t const size = boost::size(range);
+            std::size_t i = 0;
+            for (typename boost::range_iterator<Range const>::type
+                    it = boost::begin(range); it != boost::end(range); ++it, ++i)
+            {
+                if (i == 0 || i + 1 == size
+                    || less()(max_distance, importance[i]))
+                {
+                    *out = *it;
+                    out++;
+                }
+            }
+            return out;
+        }
+
     };
 }
 #endif // DOXYGEN_NO_DETAIL
@@ -276,6 +383,18 @@ public :
             PointDistanceStrategy
         >::distance_type distance_type;
 
+    typedef typename strategy::distance::services::comparable_type
+        <
+            PointDistanceStrategy
+        >::type comparable_distance_strategy_type;
+
+    //! Type of the importance of a point, a comparable distance
+    typedef typename detail::douglas_peucker
+        <
+            Point,
+            comparable_distance_strategy_type
+        >::distance_type importance_type;
+
     template <typename Range, typename OutputIterator>
     static inline OutputIterator apply(Range const& range,
                                        OutputIterator out,
@@ -283,11 +402,6 @@ public :
     {
         namespace services = strategy::distance::services;
 
-        typedef typename services::comparable_type
-            <
-                PointDistanceStrategy
-            >::type comparable_distance_strategy_type;
-
         return detail::douglas_peucker
             <
                 Point, comparable_distance_strategy_type
@@ -300,6 +414,50 @@ public :
                       );
     }
 
+    /*!
+    \brief Calculates the importance of each point of a range: the distance
+        up to which the point is kept. The first and last point are always
+        kept, having the maximal value.
+    \details The points of the range are handled once, after which the
+        simplified range for any distance can be extracted in linear time
+        (see extract). The importance is expressed in the comparable
+        distance of the distance strategy.
+    */
+    template <typename Range>
+    static inline void importance(Range const& range,
+                                  std::vector<importance_type>& result)
+    {
+        detail::douglas_peucker
+            <
+                Point, comparable_distance_strategy_type
+            >().importance(range, result);
+    }
+
+    /*!
+    \brief Copies the points of a range which are kept for the specified
+        distance, using the importance calculated before, giving the same
+        output as apply
+    */
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator extract(Range const& range,
+                                         std::vector<importance_type> const& importance,
+                                         OutputIterator out,
+                                         distance_type const& max_distance)
+    {
+        namespace services = strategy::distance::services;
+
+        return detail::douglas_peucker
+            <
+                Point, comparable_distance_strategy_type
+            >().extract(range, importance, out,
+                        services::result_from_distance
+                            <
+                                comparable_distance_strategy_type, Point, Point
+                            >::apply(comparable_distance_strategy_type(),
+                                     max_distance)
+                        );
+    }
+
 };
 
 }} // namespace strategy::simplify
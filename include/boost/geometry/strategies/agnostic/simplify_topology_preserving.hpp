@@ -0,0 +1,269 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_TOPOLOGY_PRESERVING_HPP
+#define BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_TOPOLOGY_PRESERVING_HPP
+
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/strategies/agnostic/simplify_visvalingam_whyatt.hpp>
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace simplify
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+/*!
+    \brief Allows removing a vertex only if no other remaining vertex is
+        located in or on the triangle with its neighbours
+    \details If the chains do not intersect each other, a new segment
+        between the neighbours can only cross a segment with an end point in
+        that triangle. So the chains keep on not intersecting, and rings
+        keep their orientation. A ring is never reduced to three collinear
+        points. The vertices are found using a uniform grid.
+*/
+template <typename State, typename Calculation>
+class topology_constraint
+{
+    typedef strategy::side::side_by_triangle<> side_strategy;
+
+public :
+    explicit topology_constraint(State const& state)
+        : m_columns(1)
+        , m_rows(1)
+    {
+        std::size_t const n = state.size();
+        if (n == 0)
+        {
+            m_offsets.resize(2, 0);
+            return;
+        }
+
+        m_min_x = m_max_x = geometry::get<0>(state.point(0));
+        m_min_y = m_max_y = geometry::get<1>(state.point(0));
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            Calculation const x = geometry::get<0>(state.point(i));
+            Calculation const y = geometry::get<1>(state.point(i));
+            if (x < m_min_x) m_min_x = x;
+            if (x > m_max_x) m_max_x = x;
+            if (y < m_min_y) m_min_y = y;
+            if (y > m_max_y) m_max_y = y;
+        }
+
+        // About two vertices per cell
+        Calculation const width = m_max_x - m_min_x;
+        Calculation const height = m_max_y - m_min_y;
+        std::size_t const cells = n / 2 + 1;
+        if (width > 0 && height > 0)
+        {
+            m_columns = std::size_t(std::sqrt(double(cells) * double(width / height)));
+            m_columns = m_columns < 1 ? 1 : m_columns > cells ? cells : m_columns;
+            m_rows = cells / m_columns;
+        }
+        else if (width > 0)
+        {
+            m_columns = cells;
+        }
+        else if (height > 0)
+        {
+            m_rows = cells;
+        }
+        m_cell_width = width > 0 ? width / Calculation(m_columns) : Calculation(1);
+        m_cell_height = height > 0 ? height / Calculation(m_rows) : Calculation(1);
+
+        std::vector<std::size_t> cell_of(n);
+        m_offsets.resize(m_columns * m_rows + 1, 0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            cell_of[i] = column(geometry::get<0>(state.point(i))) * m_rows
+                       + row(geometry::get<1>(state.point(i)));
+            m_offsets[cell_of[i] + 1]++;
+        }
+        for (std::size_t c = 1; c < m_offsets.size(); ++c)
+        {
+            m_offsets[c] += m_offsets[c - 1];
+        }
+        std::vector<std::size_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+        m_ids.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_ids[fill[cell_of[i]]++] = i;
+        }
+    }
+
+    inline bool can_remove(State const& state, std::size_t i) const
+    {
+        std::size_t const p = state.prev(i);
+        std::size_t const n = state.next(i);
+        std::size_t const c = state.chain(i);
+
+        if (state.is_ring(c) && state.count(c) == 4
+            && side_strategy::apply(state.point(p), state.point(n),
+                                    state.point(state.next(n))) == 0)
+        {
+            // The remaining triangle would be degenerate
+            return false;
+        }
+
+        typedef typename State::point_type point_type;
+        point_type const& p1 = state.point(p);
+        point_type const& p2 = state.point(i);
+        point_type const& p3 = state.point(n);
+
+        Calculation min_x = geometry::get<0>(p1), max_x = min_x;
+        Calculation min_y = geometry::get<1>(p1), max_y = min_y;
+        expand(p2, min_x, min_y, max_x, max_y);
+        expand(p3, min_x, min_y, max_x, max_y);
+
+        std::size_t const c1 = column(min_x), c2 = column(max_x);
+        std::size_t const r1 = row(min_y), r2 = row(max_y);
+        for (std::size_t col = c1; col <= c2; ++col)
+        {
+            for (std::size_t r = r1; r <= r2; ++r)
+            {
+                std::size_t const cell = col * m_rows + r;
+                for (std::size_t k = m_offsets[cell]; k < m_offsets[cell + 1]; ++k)
+                {
+                    std::size_t const v = m_ids[k];
+                    if (v != p && v != i && v != n
+                        && state.is_alive(v)
+                        && in_triangle(p1, p2, p3, state.point(v)))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+private :
+
+    template <typename Point>
+    static inline void expand(Point const& point,
+                              Calculation& min_x, Calculation& min_y,
+                              Calculation& max_x, Calculation& max_y)
+    {
+        Calculation const x = geometry::get<0>(point);
+        Calculation const y = geometry::get<1>(point);
+        if (x < min_x) min_x = x;
+        if (x > max_x) max_x = x;
+        if (y < min_y) min_y = y;
+        if (y > max_y) max_y = y;
+    }
+
+    // In the interior or on the border
+    template <typename Point>
+    static inline bool in_triangle(Point const& p1, Point const& p2,
+                                   Point const& p3, Point const& point)
+    {
+        int const s1 = side_strategy::apply(p1, p2, point);
+        int const s2 = side_strategy::apply(p2, p3, point);
+        int const s3 = side_strategy::apply(p3, p1, point);
+        bool const has_left = s1 > 0 || s2 > 0 || s3 > 0;
+        bool const has_right = s1 < 0 || s2 < 0 || s3 < 0;
+        return ! (has_left && has_right);
+    }
+
+    inline std::size_t column(Calculation const& x) const
+    {
+        std::size_t const c = std::size_t((x - m_min_x) / m_cell_width);
+        return c < m_columns ? c : m_columns - 1;
+    }
+
+    inline std::size_t row(Calculation const& y) const
+    {
+        std::size_t const r = std::size_t((y - m_min_y) / m_cell_height);
+        return r < m_rows ? r : m_rows - 1;
+    }
+
+    Calculation m_min_x, m_min_y, m_max_x, m_max_y;
+    Calculation m_cell_width, m_cell_height;
+    std::size_t m_columns, m_rows;
+
+    // Vertex indexes per cell, the cells in order of column and row
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::size_t> m_ids;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Implements a simplify algorithm preserving the topology.
+\ingroup strategies
+\details The topology_preserving strategy removes points in the order of
+    Visvalingam and Whyatt (see visvalingam_whyatt), with the specified
+    value as the maximal effective area, but skips every removal which
+    would make the geometry intersect itself. All linestrings, or all rings,
+    of a geometry are simplified together, so rings of polygons and of
+    multi polygons do not cross each other, and none of them is removed.
+    A valid (multi) polygon stays valid. The calculations are cartesian.
+\tparam Point the point type
+\tparam PointDistanceStrategy point-segment distance strategy
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename Point,
+    typename PointDistanceStrategy,
+    typename CalculationType = void
+>
+class topology_preserving
+{
+public :
+
+    typedef PointDistanceStrategy distance_strategy_type;
+
+    typedef typename visvalingam_whyatt
+        <
+            Point, PointDistanceStrategy, CalculationType
+        >::distance_type distance_type;
+
+    typedef typename visvalingam_whyatt
+        <
+            Point, PointDistanceStrategy, CalculationType
+        >::area_type area_type;
+
+    typedef detail::visvalingam_whyatt_state<Point, area_type> state_type;
+    typedef detail::topology_constraint<state_type, area_type> constraint_type;
+
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       distance_type const& max_area)
+    {
+        state_type state;
+        state.add_chain(boost::begin(range), boost::end(range), false);
+        state.apply(area_type(max_area), constraint_type(state));
+        return state.copy_chain(0, out);
+    }
+
+};
+
+}} // namespace strategy::simplify
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_TOPOLOGY_PRESERVING_HPP
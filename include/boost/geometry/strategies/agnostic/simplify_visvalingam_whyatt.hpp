@@ -0,0 +1,320 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+#include <cstddef>
+#include <queue>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace simplify
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+struct visvalingam_whyatt_no_constraint
+{
+    template <typename State>
+    inline bool can_remove(State const& , std::size_t ) const
+    {
+        return true;
+    }
+};
+
+/*!
+    \brief Vertices of one or more chains, removed in order of their
+        effective area, using a heap
+    \details A chain is either open, of which the end points are always
+        kept, or a ring, of which at least three points are kept.
+        The effective area of a vertex is the area of the triangle with its
+        neighbours. After a removal the effective areas of the neighbours
+        are recalculated, and never get smaller than the removed area.
+*/
+template <typename Point, typename Area>
+class visvalingam_whyatt_state
+{
+    struct entry
+    {
+        entry(Area const& a, std::size_t i, std::size_t s)
+            : area(a), index(i), stamp(s)
+        {}
+
+        // Reversed, for a min-heap, ties are resolved by index
+        inline bool operator<(entry const& other) const
+        {
+            return area > other.area
+                || (area == other.area && index > other.index);
+        }
+
+        Area area;
+        std::size_t index;
+        std::size_t stamp;
+    };
+
+    struct chain_info
+    {
+        std::size_t first;
+        std::size_t count;
+        bool is_ring;
+    };
+
+public :
+    typedef Point point_type;
+
+    static const std::size_t none = std::size_t(-1);
+
+    //! Adds a chain, returns its index
+    template <typename Iterator>
+    inline std::size_t add_chain(Iterator begin, Iterator end, bool is_ring)
+    {
+        std::size_t const c = m_chains.size();
+        std::size_t const first = m_points.size();
+        for (Iterator it = begin; it != end; ++it)
+        {
+            m_points.push_back(*it);
+        }
+        std::size_t const last = m_points.size();
+
+        chain_info info;
+        info.first = first;
+        info.count = last - first;
+        info.is_ring = is_ring;
+        m_chains.push_back(info);
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            m_prev.push_back(i > first ? i - 1 : is_ring ? last - 1 : none);
+            m_next.push_back(i + 1 < last ? i + 1 : is_ring ? first : none);
+            m_chain.push_back(c);
+            m_stamp.push_back(0);
+        }
+        return c;
+    }
+
+    //! Removes vertices with an effective area below max_area, as long as
+    //! the constraint allows it
+    template <typename Constraint>
+    inline void apply(Area const& max_area, Constraint const& constraint)
+    {
+        std::priority_queue<entry> heap;
+        for (std::size_t i = 0; i < m_points.size(); ++i)
+        {
+            if (m_prev[i] != none && m_next[i] != none)
+            {
+                heap.push(entry(effective_area(i), i, 0));
+            }
+        }
+
+        while (! heap.empty())
+        {
+            entry const e = heap.top();
+            heap.pop();
+
+            std::size_t const i = e.index;
+            if (! is_alive(i) || e.stamp != m_stamp[i])
+            {
+                // Removed, or superseded by a recalculated area
+                continue;
+            }
+            if (! (e.area < max_area))
+            {
+                return;
+            }
+
+            chain_info const& info = m_chains[m_chain[i]];
+            if ((info.is_ring && info.count <= 3)
+                || ! constraint.can_remove(*this, i))
+            {
+                // Reconsidered if one of its neighbours is removed
+                continue;
+            }
+
+            std::size_t const p = m_prev[i];
+            std::size_t const n = m_next[i];
+            m_next[p] = n;
+            m_prev[n] = p;
+            m_prev[i] = none;
+            m_next[i] = none;
+            m_chains[m_chain[i]].count--;
+
+            update(p, e.area, heap);
+            update(n, e.area, heap);
+        }
+    }
+
+    //! Copies the remaining points of a chain, in order. For a ring the
+    //! closing point is not copied
+    template <typename OutputIterator>
+    inline OutputIterator copy_chain(std::size_t c, OutputIterator out) const
+    {
+        chain_info const& info = m_chains[c];
+        if (info.count == 0)
+        {
+            return out;
+        }
+
+        std::size_t i = info.first;
+        while (! is_alive(i))
+        {
+            ++i;
+        }
+        std::size_t const start = i;
+        do
+        {
+            *out = m_points[i];
+            ++out;
+            i = m_next[i];
+        } while (i != none && i != start);
+        return out;
+    }
+
+    inline std::size_t size() const { return m_points.size(); }
+    inline Point const& point(std::size_t i) const { return m_points[i]; }
+    inline std::size_t prev(std::size_t i) const { return m_prev[i]; }
+    inline std::size_t next(std::size_t i) const { return m_next[i]; }
+    inline std::size_t chain(std::size_t i) const { return m_chain[i]; }
+    inline bool is_ring(std::size_t c) const { return m_chains[c].is_ring; }
+    inline std::size_t count(std::size_t c) const { return m_chains[c].count; }
+
+    inline bool is_alive(std::size_t i) const
+    {
+        // The end points of open chains have one neighbour, and are never
+        // removed, other points are removed together with both neighbours
+        return m_prev[i] != none || m_next[i] != none
+            || m_chains[m_chain[i]].count == 1;
+    }
+
+    static inline Area triangle_area(Point const& p1, Point const& p2,
+                                     Point const& p3)
+    {
+        Area const x1 = geometry::get<0>(p1);
+        Area const y1 = geometry::get<1>(p1);
+        Area const cross
+            = (Area(geometry::get<0>(p2)) - x1) * (Area(geometry::get<1>(p3)) - y1)
+            - (Area(geometry::get<1>(p2)) - y1) * (Area(geometry::get<0>(p3)) - x1);
+        return geometry::math::abs(cross) / 2;
+    }
+
+private :
+
+    inline Area effective_area(std::size_t i) const
+    {
+        return triangle_area(m_points[m_prev[i]], m_points[i],
+                             m_points[m_next[i]]);
+    }
+
+    inline void update(std::size_t i, Area const& removed_area,
+                       std::priority_queue<entry>& heap)
+    {
+        if (m_prev[i] == none || m_next[i] == none)
+        {
+            return;
+        }
+        Area area = effective_area(i);
+        if (area < removed_area)
+        {
+            area = removed_area;
+        }
+        heap.push(entry(area, i, ++m_stamp[i]));
+    }
+
+    std::vector<Point> m_points;
+    std::vector<std::size_t> m_prev;
+    std::vector<std::size_t> m_next;
+    std::vector<std::size_t> m_chain;
+    std::vector<std::size_t> m_stamp;
+    std::vector<chain_info> m_chains;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Implements the simplify algorithm of Visvalingam and Whyatt.
+\ingroup strategies
+\details The visvalingam_whyatt strategy simplifies a linestring, ring or
+    vector of points by repeatedly removing the point with the smallest
+    effective area: the area of the triangle it forms with its neighbours.
+    Points are removed as long as their effective area is smaller than the
+    specified value, which is therefore an area (in squared units of the
+    input coordinates) and not a distance. The first and last point are
+    always kept. The points are kept in a heap, so the complexity is
+    O(n log n). The areas are calculated in cartesian coordinates.
+\tparam Point the point type
+\tparam PointDistanceStrategy point-segment distance strategy, used by the
+    simplify algorithm for rings
+\tparam CalculationType \tparam_calculation
+\note The output may self-intersect, see topology_preserving for a
+    strategy avoiding that
+*/
+
+/*
+For the algorithm, see:
+ - Visvalingam, M. and Whyatt, J.D. (1993): Line generalisation by repeated
+   elimination of points. The Cartographic Journal 30 (1), 46-51.
+*/
+template
+<
+    typename Point,
+    typename PointDistanceStrategy,
+    typename CalculationType = void
+>
+class visvalingam_whyatt
+{
+public :
+
+    typedef PointDistanceStrategy distance_strategy_type;
+
+    typedef typename strategy::distance::services::return_type
+        <
+            PointDistanceStrategy, Point, Point
+        >::type distance_type;
+
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            CalculationType,
+            double
+        >::type area_type;
+
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       distance_type const& max_area)
+    {
+        detail::visvalingam_whyatt_state<Point, area_type> state;
+        state.add_chain(boost::begin(range), boost::end(range), false);
+        state.apply(area_type(max_area),
+                    detail::visvalingam_whyatt_no_constraint());
+        return state.copy_chain(0, out);
+    }
+
+};
+
+}} // namespace strategy::simplify
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
@@ -88,6 +88,12 @@ public :
         return false;
     }
 
+    static inline void merge(sum& state, sum const& other)
+    {
+        add_point(state.centroid, other.centroid);
+        state.count += other.count;
+    }
+
 };
 
 
@@ -114,6 +120,11 @@ struct default_strategy
         > type;
 };
 
+template <typename PointCentroid, typename Point>
+struct is_mergeable<average<PointCentroid, Point> >
+    : boost::true_type
+{};
+
 } // namespace services
 
 #endif
@@ -225,6 +225,14 @@ public :
         return false;
     }
 
+    static inline void merge(sums& state, sums const& other)
+    {
+        state.count += other.count;
+        state.sum_a2 += other.sum_a2;
+        state.sum_x += other.sum_x;
+        state.sum_y += other.sum_y;
+    }
+
 };
 
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
@@ -243,6 +251,11 @@ struct default_strategy<cartesian_tag, areal_tag, 2, Point, Geometry>
         > type;
 };
 
+template <typename Point, typename PointOfSegment, typename CalculationType>
+struct is_mergeable<bashein_detmer<Point, PointOfSegment, CalculationType> >
+    : boost::true_type
+{};
+
 
 } // namespace services
 
@@ -113,6 +113,12 @@ public :
         return false;
     }
 
+    static inline void merge(state_type& state, state_type const& other)
+    {
+        state.length += other.length;
+        geometry::add_point(state.average_sum, other.average_sum);
+    }
+
     struct set_sum_div_length
     {
         state_type const& m_state;
@@ -158,6 +164,11 @@ struct default_strategy
         > type;
 };
 
+template <typename Point, typename PointOfSegment>
+struct is_mergeable<weighted_length<Point, PointOfSegment> >
+    : boost::true_type
+{};
+
 
 } // namespace services
 
@@ -18,6 +18,7 @@
 #include <cstddef>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/strategies/tags.hpp>
@@ -61,6 +62,20 @@ struct default_strategy
 };
 
 
+/*!
+    \brief Traits class indicating whether the states of a centroid strategy
+        can be merged, by a static member function merge(state, other)
+    \details States of parts of a geometry can then be calculated
+        independently, for example in parallel.
+    \ingroup centroid
+    \tparam Strategy the centroid strategy
+*/
+template <typename Strategy>
+struct is_mergeable
+    : boost::false_type
+{};
+
+
 } // namespace services
 
 
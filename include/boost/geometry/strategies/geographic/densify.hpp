@@ -87,13 +87,16 @@ public:
 
         calc_t step = inv_r.distance / (n + 1);
 
+        // The points are calculated along the geodesic line of the segment,
+        // the terms not depending on the distance are calculated once
+        typename direct_t::line const line(get_as_radian<0>(p0), get_as_radian<1>(p0),
+                                           inv_r.azimuth, m_spheroid);
+
         calc_t current = step;
         for (signed_size_type i = 0 ; i < n ; ++i, current += step)
         {
             typename direct_t::result_type
-                dir_r = direct_t::apply(get_as_radian<0>(p0), get_as_radian<1>(p0),
-                                        current, inv_r.azimuth,
-                                        m_spheroid);
+                dir_r = line.apply(current);
 
             out_point_t p;
             set_from_radian<0>(p, dir_r.lon2);
@@ -19,6 +19,7 @@
 #include <boost/config.hpp>
 #include <boost/concept_check.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/type_traits/is_void.hpp>
 
 #include <boost/geometry/core/cs.hpp>
@@ -146,6 +147,32 @@ public :
                                   m_spheroid)).distance;
     }
 
+    //! Calculates the distance, and the point of the segment closest to
+    //! the point. Only available if EnableClosestPoint is true
+    template <typename Point, typename PointOfSegment, typename ClosestPoint>
+    inline typename return_type<Point, PointOfSegment>::type
+    apply(Point const& p, PointOfSegment const& sp1, PointOfSegment const& sp2,
+          ClosestPoint& closest_point) const
+    {
+        BOOST_STATIC_ASSERT(EnableClosestPoint);
+
+        typedef typename geometry::detail::cs_angular_units<Point>::type units_type;
+        typedef typename return_type<Point, PointOfSegment>::type result_type;
+
+        result_distance_point_segment<result_type> const result
+            = apply<units_type>(result_type(get_as_radian<0>(sp1)),
+                                result_type(get_as_radian<1>(sp1)),
+                                result_type(get_as_radian<0>(sp2)),
+                                result_type(get_as_radian<1>(sp2)),
+                                result_type(get_as_radian<0>(p)),
+                                result_type(get_as_radian<1>(p)),
+                                m_spheroid);
+
+        set_from_radian<0>(closest_point, result.closest_point_lon);
+        set_from_radian<1>(closest_point, result.closest_point_lat);
+        return result.distance;
+    }
+
     // points on a meridian not crossing poles
     template <typename CT>
     inline CT vertical_or_meridian(CT const& lat1, CT const& lat2) const
@@ -321,6 +348,11 @@ private :
 #endif
 
             result.distance = new_distance;
+            if (EnableClosestPoint)
+            {
+                result.closest_point_lon = res14.lon2;
+                result.closest_point_lat = res14.lat2;
+            }
 
         } while (dist_improve
                  && counter++ < BOOST_GEOMETRY_DETAIL_POINT_SEGMENT_DISTANCE_MAX_STEPS);
@@ -385,6 +417,11 @@ private :
             {
                 result.distance = prev_distance;
             }
+            else if (EnableClosestPoint)
+            {
+                result.closest_point_lon = res14.lon2;
+                result.closest_point_lat = res14.lat2;
+            }
 
 #ifdef BOOST_GEOMETRY_DEBUG_GEOGRAPHIC_CROSS_TRACK
             std::cout << "p4=" << res14.lon2 * math::r2d<CT>() <<
@@ -14,9 +14,23 @@
 #ifndef BOOST_GEOMETRY_UTIL_COORDINATE_CAST_HPP
 #define BOOST_GEOMETRY_UTIL_COORDINATE_CAST_HPP
 
+#include <cfloat>
+#include <clocale>
+#include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <string>
+
+#include <boost/cstdint.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+
+#include <boost/geometry/util/condition.hpp>
 
 namespace boost { namespace geometry
 {
@@ -44,6 +58,330 @@ struct coordinate_cast
     }
 };
 
+namespace coordinate_cast_detail
+{
+
+inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Exactly representable powers of ten and mantissas, see Clinger,
+// "How to read floating point numbers accurately"
+template <typename T>
+struct exact_limits
+{
+    static const bool enabled = false;
+    static const int max_exponent = 0;
+    static const boost::uint64_t max_mantissa = 0;
+};
+
+// The fast path requires the operations to be performed in the precision
+// of the type
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+
+template <>
+struct exact_limits<double>
+{
+    static const bool enabled = true;
+    static const int max_exponent = 22;
+    static const boost::uint64_t max_mantissa = 9007199254740992ULL; // 2^53
+};
+
+template <>
+struct exact_limits<float>
+{
+    static const bool enabled = true;
+    static const int max_exponent = 10;
+    static const boost::uint64_t max_mantissa = 16777216ULL; // 2^24
+};
+
+#endif
+
+template <typename T>
+inline T power_of_ten(int exponent)
+{
+    static const T powers[] =
+    {
+        T(1e0), T(1e1), T(1e2), T(1e3), T(1e4), T(1e5), T(1e6), T(1e7),
+        T(1e8), T(1e9), T(1e10), T(1e11), T(1e12), T(1e13), T(1e14),
+        T(1e15), T(1e16), T(1e17), T(1e18), T(1e19), T(1e20), T(1e21),
+        T(1e22)
+    };
+    return powers[exponent];
+}
+
+// Parses [first, last) with the grammar [+-]digits[.digits][(e|E)[+-]digits]
+// Returns false if the input doesn't match it or if the result can't be
+// calculated exactly
+template <typename T>
+inline bool parse_exact(char const* first, char const* last, T& result)
+{
+    if (BOOST_GEOMETRY_CONDITION(! exact_limits<T>::enabled))
+    {
+        return false;
+    }
+
+    char const* it = first;
+    bool negative = false;
+    if (it != last && (*it == '-' || *it == '+'))
+    {
+        negative = *it == '-';
+        ++it;
+    }
+
+    boost::uint64_t mantissa = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool truncated = false;
+
+    for ( ; it != last && is_digit(*it) ; ++it)
+    {
+        has_digits = true;
+        if (mantissa < 1000000000000000000ULL)
+        {
+            mantissa = mantissa * 10 + (*it - '0');
+        }
+        else
+        {
+            ++exponent;
+            truncated = truncated || *it != '0';
+        }
+    }
+
+    if (it != last && *it == '.')
+    {
+        for (++it ; it != last && is_digit(*it) ; ++it)
+        {
+            has_digits = true;
+            if (mantissa < 1000000000000000000ULL)
+            {
+                mantissa = mantissa * 10 + (*it - '0');
+                --exponent;
+            }
+            else
+            {
+                truncated = truncated || *it != '0';
+            }
+        }
+    }
+
+    if (! has_digits)
+    {
+        return false;
+    }
+
+    if (it != last && (*it == 'e' || *it == 'E'))
+    {
+        ++it;
+        bool negative_exponent = false;
+        if (it != last && (*it == '-' || *it == '+'))
+        {
+            negative_exponent = *it == '-';
+            ++it;
+        }
+        if (it == last)
+        {
+            return false;
+        }
+        int e = 0;
+        for ( ; it != last && is_digit(*it) ; ++it)
+        {
+            if (e < 100000)
+            {
+                e = e * 10 + (*it - '0');
+            }
+        }
+        exponent += negative_exponent ? -e : e;
+    }
+
+    if (it != last
+        || truncated
+        || mantissa > exact_limits<T>::max_mantissa
+        || exponent > exact_limits<T>::max_exponent
+        || exponent < -exact_limits<T>::max_exponent)
+    {
+        return false;
+    }
+
+    // Both the mantissa and the power of ten are exact so the result of
+    // a single operation is correctly rounded
+    T value = T(mantissa);
+    if (exponent < 0)
+    {
+        value /= power_of_ten<T>(-exponent);
+    }
+    else if (exponent > 0)
+    {
+        value *= power_of_ten<T>(exponent);
+    }
+
+    result = negative ? -value : value;
+    return true;
+}
+
+// Correctly rounded conversion by the C library, the string is copied
+// into a buffer on the stack
+inline bool parse_strtod(char const* first, char const* last, double& result)
+{
+    std::size_t const max_length = 64;
+    std::size_t const length = static_cast<std::size_t>(last - first);
+    if (length == 0 || length >= max_length)
+    {
+        return false;
+    }
+
+    // WKT always uses '.', strtod uses the decimal point of the C locale
+    char const decimal_point = *std::localeconv()->decimal_point;
+
+    char buffer[max_length];
+    for (std::size_t i = 0 ; i < length ; ++i)
+    {
+        char const c = first[i];
+        // Only the characters of decimal numbers are passed, so e.g.
+        // hexadecimal numbers, infinity and nan use the fallback
+        if (! (is_digit(c) || c == '-' || c == '+' || c == 'e' || c == 'E'
+               || c == '.'))
+        {
+            return false;
+        }
+        buffer[i] = c == '.' ? decimal_point : c;
+    }
+    buffer[length] = '\0';
+
+    char* end = NULL;
+    double const value = std::strtod(buffer, &end);
+    if (end != buffer + length
+        || ! boost::math::isfinite(value)
+        || value == 0.0)
+    {
+        // Out of range values and zeros (possibly underflowing) are
+        // handled by the fallback
+        return false;
+    }
+
+    result = value;
+    return true;
+}
+
+template <typename T>
+inline bool parse_integer(char const* first, char const* last, T& result)
+{
+    char const* it = first;
+    bool negative = false;
+    if (it != last && (*it == '-' || *it == '+'))
+    {
+        negative = *it == '-';
+        ++it;
+    }
+
+    if (it == last || (negative && ! boost::is_signed<T>::value))
+    {
+        return false;
+    }
+
+    // Accumulated as a negative value for the range of signed types
+    T const min_value = boost::is_signed<T>::value
+                      ? (std::numeric_limits<T>::min)()
+                      : T(0);
+    T const max_value = (std::numeric_limits<T>::max)();
+    T value = 0;
+    for ( ; it != last ; ++it)
+    {
+        if (! is_digit(*it))
+        {
+            return false;
+        }
+        T const digit = T(*it - '0');
+        if (negative)
+        {
+            if (value < (min_value + digit) / 10)
+            {
+                return false;
+            }
+            value = value * 10 - digit;
+        }
+        else
+        {
+            if (value > (max_value - digit) / 10)
+            {
+                return false;
+            }
+            value = value * 10 + digit;
+        }
+    }
+
+    result = value;
+    return true;
+}
+
+template <typename CoordinateType>
+inline bool parse(char const* first, char const* last, CoordinateType& result,
+                  boost::true_type /*floating_point*/, boost::false_type)
+{
+    if (parse_exact(first, last, result))
+    {
+        return true;
+    }
+
+    double value = 0;
+    if (BOOST_GEOMETRY_CONDITION((boost::is_same<CoordinateType, double>::value))
+        && parse_strtod(first, last, value))
+    {
+        result = static_cast<CoordinateType>(value);
+        return true;
+    }
+
+    return false;
+}
+
+template <typename CoordinateType>
+inline bool parse(char const* first, char const* last, CoordinateType& result,
+                  boost::false_type, boost::true_type /*integral*/)
+{
+    return parse_integer(first, last, result);
+}
+
+template <typename CoordinateType>
+inline bool parse(char const* , char const* , CoordinateType& ,
+                  boost::false_type, boost::false_type)
+{
+    return false;
+}
+
+} // namespace coordinate_cast_detail
+
+
+/*!
+\brief cast coordinates from a range of characters to a coordinate type
+\detail Decimal numbers are converted to fundamental arithmetic types in place,
+    without creating a string. The result is the same as the result of
+    coordinate_cast which is used for other types and input.
+*/
+template <typename CoordinateType>
+struct coordinate_parser
+{
+    static inline CoordinateType apply(char const* first, char const* last)
+    {
+        typedef boost::integral_constant
+            <
+                bool,
+                boost::is_integral<CoordinateType>::value
+                && ! boost::is_same<CoordinateType, bool>::value
+                && ! boost::is_same<CoordinateType, char>::value
+            > is_integral;
+
+        CoordinateType result;
+        if (coordinate_cast_detail::parse(first, last, result,
+                boost::is_floating_point<CoordinateType>(), is_integral()))
+        {
+            return result;
+        }
+
+        return coordinate_cast<CoordinateType>::apply(std::string(first, last));
+    }
+};
+
 
 } // namespace detail
 #endif
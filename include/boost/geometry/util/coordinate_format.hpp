@@ -0,0 +1,633 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_COORDINATE_FORMAT_HPP
+#define BOOST_GEOMETRY_UTIL_COORDINATE_FORMAT_HPP
+
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/sign.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace coordinate_format
+{
+
+using coordinate_cast_detail::power_of_ten;
+
+template <typename Buffer>
+inline void append(Buffer& buffer, char const* first, char const* last)
+{
+    buffer.insert(buffer.end(), first, last);
+}
+
+inline void append(std::string& buffer, char const* first, char const* last)
+{
+    buffer.append(first, std::size_t(last - first));
+}
+
+// Writes the digits of value backwards, two at a time, returns the first
+// written character
+inline char* write_digits(boost::uint64_t value, char* last)
+{
+    static char const pairs[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    while (value >= 100)
+    {
+        std::size_t const i = std::size_t(value % 100) * 2;
+        value /= 100;
+        *--last = pairs[i + 1];
+        *--last = pairs[i];
+    }
+    if (value >= 10)
+    {
+        std::size_t const i = std::size_t(value) * 2;
+        *--last = pairs[i + 1];
+        *--last = pairs[i];
+    }
+    else
+    {
+        *--last = char('0' + value);
+    }
+    return last;
+}
+
+// Writes sign, integer and decimals digits of the integer mantissa * 10^-decimals
+// without trailing zeros of the fractional part
+template <typename Buffer>
+inline void append_decimal(Buffer& buffer, bool negative,
+                           boost::uint64_t mantissa, int decimals)
+{
+    // One position in front of the digits is kept for the sign
+    char result[56];
+    char* const last = result + sizeof(result);
+    char* first = write_digits(mantissa, last);
+
+    // leading zeros of the fractional part and "0."
+    while (last - first <= decimals)
+    {
+        *--first = '0';
+    }
+
+    char* end = last;
+    while (decimals > 0 && *(end - 1) == '0')
+    {
+        --end;
+        --decimals;
+    }
+
+    // The integer part is moved one position to the front to insert the
+    // decimal point
+    if (decimals > 0)
+    {
+        char* const point = end - decimals;
+        std::memmove(first - 1, first, std::size_t(point - first));
+        --first;
+        *(point - 1) = '.';
+    }
+    if (negative)
+    {
+        *--first = '-';
+    }
+    append(buffer, first, end);
+}
+
+template <typename Buffer, typename T>
+inline void append_integer(Buffer& buffer, T value, boost::true_type /*signed*/)
+{
+    char digits[24];
+    char* const last = digits + sizeof(digits);
+    char* first = NULL;
+    if (value < 0)
+    {
+        // -(value + 1) + 1 is representable also for the minimum value
+        first = write_digits(boost::uint64_t(-(value + 1)) + 1, last);
+        *--first = '-';
+    }
+    else
+    {
+        first = write_digits(boost::uint64_t(value), last);
+    }
+    append(buffer, first, last);
+}
+
+template <typename Buffer, typename T>
+inline void append_integer(Buffer& buffer, T value, boost::false_type /*signed*/)
+{
+    char digits[24];
+    char* const last = digits + sizeof(digits);
+    append(buffer, write_digits(boost::uint64_t(value), last), last);
+}
+
+template <typename Buffer, typename T>
+inline void append_integer(Buffer& buffer, T value)
+{
+    append_integer(buffer, value, boost::is_signed<T>());
+}
+
+// Silence warning C4996: 'sprintf': This function or variable may be unsafe
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+
+// Formatted by the C library, the decimal point of the C locale is replaced
+template <typename Buffer>
+inline bool append_printf(Buffer& buffer, double value, int precision,
+                          bool round_trip)
+{
+    if (precision > 100)
+    {
+        return false;
+    }
+
+    char result[128];
+    int const length = std::sprintf(result, "%.*g", precision, value);
+    if (length <= 0)
+    {
+        return false;
+    }
+
+    if (round_trip && std::strtod(result, NULL) != value)
+    {
+        return false;
+    }
+
+    char const decimal_point = *std::localeconv()->decimal_point;
+    if (decimal_point != '.')
+    {
+        for (int i = 0 ; i < length ; ++i)
+        {
+            if (result[i] == decimal_point)
+            {
+                result[i] = '.';
+            }
+        }
+    }
+
+    append(buffer, result, result + length);
+    return true;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+template <typename Buffer, typename T>
+inline void append_stream(Buffer& buffer, T const& value, int precision)
+{
+    std::ostringstream out;
+    out.precision(precision);
+    out << value;
+    std::string const str = out.str();
+    append(buffer, str.data(), str.data() + str.size());
+}
+
+// Unsigned 128-bit integer, the product of two 64-bit integers
+struct uint128
+{
+    boost::uint64_t hi, lo;
+};
+
+inline uint128 multiply(boost::uint64_t a, boost::uint64_t b)
+{
+    uint128 result;
+#if defined(BOOST_HAS_INT128)
+    boost::uint128_type const p = boost::uint128_type(a) * b;
+    result.lo = boost::uint64_t(p);
+    result.hi = boost::uint64_t(p >> 64);
+#else
+    boost::uint64_t const mask = 0xffffffffULL;
+    boost::uint64_t const p0 = (a & mask) * (b & mask);
+    boost::uint64_t const p1 = (a & mask) * (b >> 32);
+    boost::uint64_t const p2 = (a >> 32) * (b & mask);
+    boost::uint64_t const p3 = (a >> 32) * (b >> 32);
+    boost::uint64_t const middle = (p0 >> 32) + (p1 & mask) + (p2 & mask);
+    result.lo = (p0 & mask) | (middle << 32);
+    result.hi = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+#endif
+    return result;
+}
+
+// floor(x / 2^shift) for 0 < shift < 128, exact is set if there is no remainder,
+// the result has to fit in 64 bits
+inline boost::uint64_t shift_right(uint128 const& x, int shift, bool& exact)
+{
+    if (shift >= 64)
+    {
+        int const s = shift - 64;
+        boost::uint64_t const mask = s > 0 ? (boost::uint64_t(1) << s) - 1 : 0;
+        exact = x.lo == 0 && (x.hi & mask) == 0;
+        return x.hi >> s;
+    }
+    boost::uint64_t const mask = (boost::uint64_t(1) << shift) - 1;
+    exact = (x.lo & mask) == 0;
+    return (x.lo >> shift) | (x.hi << (64 - shift));
+}
+
+// Writes a double with the given number of decimals if a number with these
+// decimals is converted to it, the number nearest to the double is chosen.
+// The interval of numbers converted to the double is calculated exactly.
+template <typename Buffer>
+inline bool append_exact(Buffer& buffer, double value, int decimals)
+{
+    if (decimals < 0 || decimals > 19)
+    {
+        return false;
+    }
+
+    // value = mantissa * 2^exponent, taken from the representation if it is
+    // the IEEE 754 binary64 format
+    boost::uint64_t mantissa = 0;
+    int exponent = 0;
+    if (BOOST_GEOMETRY_CONDITION(std::numeric_limits<double>::is_iec559
+                                 && sizeof(double) == sizeof(boost::uint64_t)))
+    {
+        boost::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        int const biased = int((bits >> 52) & 0x7ff);
+        if (biased == 0 || biased == 0x7ff)
+        {
+            return false;
+        }
+        mantissa = (bits & ((boost::uint64_t(1) << 52) - 1))
+                 | (boost::uint64_t(1) << 52);
+        exponent = biased - 1075;
+    }
+    else
+    {
+        int e = 0;
+        double const f = std::frexp(value < 0 ? -value : value, &e);
+        mantissa = boost::uint64_t(std::ldexp(f, 53));
+        exponent = e - 53;
+    }
+
+    // The interval is [4m - 2, 4m + 2] / 4 * 2^exponent, [4m - 1, 4m + 2] for
+    // powers of two, including the bounds if the mantissa is even.
+    int const shift = 2 - exponent;
+    if (mantissa < (boost::uint64_t(1) << 52) || shift <= 0 || shift >= 128)
+    {
+        return false;
+    }
+
+    static boost::uint64_t const powers[] =
+    {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+        10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+        100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL,
+        10000000000000000000ULL
+    };
+    boost::uint64_t const power = powers[decimals];
+
+    bool const even = mantissa % 2 == 0;
+    bool const boundary = mantissa == (boost::uint64_t(1) << 52);
+
+    bool exact = false;
+    boost::uint64_t low = shift_right(multiply(4 * mantissa - (boundary ? 1 : 2), power),
+                                      shift, exact);
+    if (! exact || ! even)
+    {
+        ++low;
+    }
+    boost::uint64_t high = shift_right(multiply(4 * mantissa + 2, power),
+                                       shift, exact);
+    if (exact && ! even)
+    {
+        --high;
+    }
+    if (low > high)
+    {
+        return false;
+    }
+
+    // round(value * 10^decimals), limited to the interval
+    boost::uint64_t result = (shift_right(multiply(8 * mantissa, power),
+                                          shift, exact) + 1) / 2;
+    if (result < low)
+    {
+        result = low;
+    }
+    else if (result > high)
+    {
+        result = high;
+    }
+
+    append_decimal(buffer, value < 0, result, decimals);
+    return true;
+}
+
+template <typename T>
+struct is_integer
+    : boost::integral_constant
+        <
+            bool,
+            boost::is_integral<T>::value
+            && ! boost::is_same<T, bool>::value
+            && ! boost::is_same<T, char>::value
+            && ! boost::is_same<T, signed char>::value
+            && ! boost::is_same<T, unsigned char>::value
+            && sizeof(T) <= sizeof(boost::uint64_t)
+        >
+{};
+
+template <typename T>
+struct is_double
+    : boost::integral_constant
+        <
+            bool,
+            boost::is_same<T, double>::value
+            || boost::is_same<T, float>::value
+        >
+{};
+
+
+// Writes round(abs_v * 10^decimals) * 10^-decimals if this is converted back
+// to abs_v, the product has to be less than 2^53 (2^24 for floats)
+template <typename Buffer, typename T>
+inline bool append_quotient(Buffer& buffer, bool negative, T const& abs_v,
+                            int decimals)
+{
+    T const power = power_of_ten<T>(decimals);
+    // The conversion to a signed integer truncates as floor would, without
+    // a library call
+    boost::int64_t const r = boost::int64_t(abs_v * power + T(0.5));
+    if (T(r) / power != abs_v)
+    {
+        return false;
+    }
+    append_decimal(buffer, negative, boost::uint64_t(r), decimals);
+    return true;
+}
+
+
+/*!
+\brief Formats coordinates with the shortest representation which is
+    converted back to the same value (by e.g. strtod or read_wkt).
+\details Numbers which are the exact quotient of an integer and a power of ten
+    (up to 15 or 16 significant digits for doubles) are written in fixed
+    notation, the same quotient is calculated by coordinate_parser reading
+    them. Other numbers are written by the C library with the smallest number
+    of significant digits (at most 17, 9 for floats) read back as the same
+    value. Integers are written as integers.
+    Other types are written by lexical_cast.
+*/
+struct shortest
+{
+    template <typename Buffer, typename T>
+    inline void apply(Buffer& buffer, T const& value) const
+    {
+        apply(buffer, value, is_double<T>(), is_integer<T>());
+    }
+
+private:
+    template <typename Buffer, typename T>
+    static inline void apply(Buffer& buffer, T const& value,
+                             boost::true_type /*double*/, boost::false_type)
+    {
+        typedef coordinate_cast_detail::exact_limits<T> limits;
+
+        if (value == 0 || ! boost::math::isfinite(value))
+        {
+            append_printf(buffer, value, 1, false);
+            return;
+        }
+
+        T const abs_v = value < 0 ? -value : value;
+        if (BOOST_GEOMETRY_CONDITION(limits::enabled))
+        {
+            // The smallest number of decimals d for which the value is the
+            // quotient of round(value * 10^d) and 10^d is searched. If the
+            // integer is less than 2^53 / 8 the product is rounded to the
+            // exact integer for every d for which this is the case, so it
+            // is enough to check the largest such d, the trailing zeros of
+            // the integer are removed by append_decimal. Only the next d,
+            // with an integer up to 2^53, has to be checked separately.
+            T const max_mantissa = T(limits::max_mantissa);
+            T const threshold = max_mantissa / 8;
+            int decimals = 0;
+            if (abs_v < threshold)
+            {
+                while (decimals < limits::max_exponent
+                    && abs_v * power_of_ten<T>(decimals + 1) < threshold)
+                {
+                    ++decimals;
+                }
+                if (append_quotient(buffer, value < 0, abs_v, decimals))
+                {
+                    return;
+                }
+                ++decimals;
+            }
+            if (decimals <= limits::max_exponent
+                && abs_v * power_of_ten<T>(decimals) < max_mantissa
+                && append_quotient(buffer, value < 0, abs_v, decimals))
+            {
+                return;
+            }
+        }
+
+        if (BOOST_GEOMETRY_CONDITION((boost::is_same<T, float>::value)))
+        {
+            append_printf(buffer, value, 9, false);
+            return;
+        }
+
+        // 16 or 17 significant digits, the decimal exponent is possibly off
+        // by one in which case another number of decimals is tried
+        int exponent = int(std::floor(std::log10(double(abs_v))));
+        if (exponent >= 0 && exponent < 22
+            && double(abs_v) >= power_of_ten<double>(exponent + 1))
+        {
+            ++exponent;
+        }
+        if (append_exact(buffer, double(value), 15 - exponent)
+            || append_exact(buffer, double(value), 16 - exponent))
+        {
+            return;
+        }
+
+        // The smallest number of significant digits which is read back as
+        // the same value. A normal double with a shortest representation of
+        // up to 15 digits is written with 15 digits as this representation
+        // (without trailing zeros), so fewer digits are tried only for
+        // subnormal numbers, having lower precision.
+        int digits = abs_v < (std::numeric_limits<double>::min)() ? 1 : 15;
+        for ( ; digits < 17 ; ++digits)
+        {
+            if (append_printf(buffer, value, digits, true))
+            {
+                return;
+            }
+        }
+        append_printf(buffer, value, 17, false);
+    }
+
+    template <typename Buffer, typename T>
+    static inline void apply(Buffer& buffer, T const& value,
+                             boost::false_type, boost::true_type /*integer*/)
+    {
+        append_integer(buffer, value);
+    }
+
+    template <typename Buffer, typename T>
+    static inline void apply(Buffer& buffer, T const& value,
+                             boost::false_type, boost::false_type)
+    {
+        std::string const str = boost::lexical_cast<std::string>(value);
+        append(buffer, str.data(), str.data() + str.size());
+    }
+};
+
+
+/*!
+\brief Formats coordinates with a number of significant digits, the same
+    way as std::ostream with the default floatfield and the classic locale,
+    i.e. printf("%.*g").
+*/
+class precision
+{
+public:
+    explicit precision(int digits)
+        : m_digits(digits > 0 ? digits : 1)
+    {}
+
+    template <typename Buffer, typename T>
+    inline void apply(Buffer& buffer, T const& value) const
+    {
+        apply(buffer, value, is_double<T>(), is_integer<T>());
+    }
+
+private:
+    template <typename Buffer, typename T>
+    inline void apply(Buffer& buffer, T const& value,
+                      boost::true_type /*double*/, boost::false_type) const
+    {
+        double const v = value;
+        if (v == 0)
+        {
+            append_decimal(buffer, boost::math::signbit(v) != 0, 0, 0);
+            return;
+        }
+
+        if (! append_fixed(buffer, v)
+            && ! append_printf(buffer, v, m_digits, false))
+        {
+            append_stream(buffer, v, m_digits);
+        }
+    }
+
+    template <typename Buffer, typename T>
+    inline void apply(Buffer& buffer, T const& value,
+                      boost::false_type, boost::true_type /*integer*/) const
+    {
+        append_integer(buffer, value);
+    }
+
+    template <typename Buffer, typename T>
+    inline void apply(Buffer& buffer, T const& value,
+                      boost::false_type, boost::false_type) const
+    {
+        append_stream(buffer, value, m_digits);
+    }
+
+    // Rounds the number to the integer number of units of the last digit,
+    // if the rounding is certainly correct and the fixed notation is used
+    // by printf. Otherwise returns false.
+    template <typename Buffer>
+    inline bool append_fixed(Buffer& buffer, double v) const
+    {
+        if (m_digits > 15 || ! boost::math::isfinite(v))
+        {
+            return false;
+        }
+
+        double const abs_v = std::fabs(v);
+
+        // The decimal exponent, for numbers less than 1 possibly off by one,
+        // which is detected below
+        int exponent = 0;
+        if (abs_v >= 1)
+        {
+            while (exponent < m_digits && abs_v >= power_of_ten<double>(exponent + 1))
+            {
+                ++exponent;
+            }
+            if (exponent >= m_digits)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            double const limits[] = { 0.1, 0.01, 0.001, 0.0001 };
+            exponent = -1;
+            while (exponent >= -4 && abs_v < limits[-exponent - 1])
+            {
+                --exponent;
+            }
+            if (exponent < -4)
+            {
+                return false;
+            }
+        }
+
+        int const decimals = m_digits - 1 - exponent;
+        double const m = abs_v * power_of_ten<double>(decimals);
+        double const r = std::floor(m + 0.5);
+
+        // m differs from the exact product by at most half of its ulp
+        double const epsilon = std::numeric_limits<double>::epsilon();
+        if (std::fabs(m - r) >= 0.5 - m * epsilon
+            || r < power_of_ten<double>(m_digits - 1)
+            || r >= power_of_ten<double>(m_digits))
+        {
+            return false;
+        }
+
+        append_decimal(buffer, v < 0, boost::uint64_t(r), decimals);
+        return true;
+    }
+
+    int m_digits;
+};
+
+
+}} // namespace detail::coordinate_format
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_COORDINATE_FORMAT_HPP
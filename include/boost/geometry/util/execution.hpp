@@ -0,0 +1,263 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_EXECUTION_HPP
+#define BOOST_GEOMETRY_UTIL_EXECUTION_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/type_traits/integral_constant.hpp>
+
+#include <boost/geometry/core/config.hpp>
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+#include <exception>
+#include <thread>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+namespace execution
+{
+
+/*!
+\brief Execution policy requesting sequential processing.
+\ingroup execution
+*/
+struct sequenced_policy {};
+
+/*!
+\brief Execution policy requesting processing on multiple threads.
+\ingroup execution
+\details The input is split into at most \p threads contiguous chunks, each
+    containing at least \p grain_size elements. One chunk is processed by
+    the calling thread. If threads are not available (see
+    BOOST_GEOMETRY_USE_THREADS) the chunks are processed sequentially.
+\param threads the maximum number of threads, 0 means hardware concurrency
+\param grain_size the minimum number of elements in a chunk, 0 means default
+*/
+class parallel_policy
+{
+public:
+    enum { default_grain_size = 4096 };
+
+    explicit parallel_policy(std::size_t threads = 0,
+                             std::size_t grain_size = 0)
+        : m_threads(threads)
+        , m_grain_size(grain_size > 0 ? grain_size : std::size_t(default_grain_size))
+    {}
+
+    std::size_t threads() const
+    {
+        if (m_threads > 0)
+        {
+            return m_threads;
+        }
+#ifdef BOOST_GEOMETRY_USE_THREADS
+        std::size_t const hc = std::thread::hardware_concurrency();
+        return hc > 0 ? hc : 1;
+#else
+        return 1;
+#endif
+    }
+
+    std::size_t grain_size() const
+    {
+        return m_grain_size;
+    }
+
+private:
+    std::size_t m_threads;
+    std::size_t m_grain_size;
+};
+
+/*!
+\brief Metafunction defining value as true if T is an execution policy.
+\ingroup execution
+*/
+template <typename T>
+struct is_execution_policy
+    : boost::false_type
+{};
+
+template <>
+struct is_execution_policy<sequenced_policy>
+    : boost::true_type
+{};
+
+template <>
+struct is_execution_policy<parallel_policy>
+    : boost::true_type
+{};
+
+} // namespace execution
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace execution
+{
+
+// Number of chunks [0, count) is split into for a given policy.
+inline std::size_t chunk_count(std::size_t count,
+                               geometry::execution::sequenced_policy const& )
+{
+    return count > 0 ? 1 : 0;
+}
+
+inline std::size_t chunk_count(std::size_t count,
+                               geometry::execution::parallel_policy const& policy)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    std::size_t const grain = policy.grain_size();
+    std::size_t const max_chunks = (count + grain - 1) / grain;
+    std::size_t const threads = policy.threads();
+    return threads < max_chunks ? threads : max_chunks;
+}
+
+inline std::size_t chunk_begin(std::size_t count, std::size_t chunks,
+                               std::size_t chunk)
+{
+    // count * chunk could overflow for huge counts
+    return (count / chunks) * chunk + (count % chunks) * chunk / chunks;
+}
+
+template <typename Function>
+struct chunk_worker
+{
+    chunk_worker(Function const& f, std::size_t count, std::size_t chunks,
+                 std::size_t chunk)
+        : m_f(f), m_count(count), m_chunks(chunks), m_chunk(chunk)
+    {}
+
+    inline void operator()() const
+    {
+        m_f(m_chunk,
+            chunk_begin(m_count, m_chunks, m_chunk),
+            chunk_begin(m_count, m_chunks, m_chunk + 1));
+    }
+
+    Function const& m_f;
+    std::size_t m_count;
+    std::size_t m_chunks;
+    std::size_t m_chunk;
+};
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+template <typename Function>
+struct guarded_chunk_worker
+    : chunk_worker<Function>
+{
+    guarded_chunk_worker(Function const& f, std::size_t count,
+                         std::size_t chunks, std::size_t chunk,
+                         std::exception_ptr & error)
+        : chunk_worker<Function>(f, count, chunks, chunk)
+        , m_error(error)
+    {}
+
+    inline void operator()() const
+    {
+        try
+        {
+            chunk_worker<Function>::operator()();
+        }
+        catch (...)
+        {
+            m_error = std::current_exception();
+        }
+    }
+
+    std::exception_ptr & m_error;
+};
+#endif // BOOST_GEOMETRY_USE_THREADS
+
+// Calls f(chunk, first, last) for each of chunk_count(count, policy)
+// consecutive subranges [first, last) of [0, count). The calls may be
+// concurrent, so f has to be safe to call for different chunks at the same
+// time. If any call throws, the first exception (in chunk order) is rethrown
+// after all of the chunks were processed.
+template <typename Function>
+inline void for_each_chunk(std::size_t count,
+                           geometry::execution::sequenced_policy const& policy,
+                           Function const& f)
+{
+    if (chunk_count(count, policy) > 0)
+    {
+        f(std::size_t(0), std::size_t(0), count);
+    }
+}
+
+template <typename Function>
+inline void for_each_chunk(std::size_t count,
+                           geometry::execution::parallel_policy const& policy,
+                           Function const& f)
+{
+    std::size_t const chunks = chunk_count(count, policy);
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+    if (chunks > 1)
+    {
+        std::vector<std::exception_ptr> errors(chunks);
+        std::vector<std::thread> threads;
+        threads.reserve(chunks - 1);
+
+        try
+        {
+            for (std::size_t i = 1 ; i < chunks ; ++i)
+            {
+                threads.push_back(std::thread(guarded_chunk_worker<Function>(
+                                    f, count, chunks, i, errors[i])));
+            }
+        }
+        catch (...)
+        {
+            // Thread creation failed, wait for the already started ones
+            // and process the rest in this thread
+            for (std::size_t i = threads.size() + 1 ; i < chunks ; ++i)
+            {
+                guarded_chunk_worker<Function>(f, count, chunks, i, errors[i])();
+            }
+        }
+
+        guarded_chunk_worker<Function>(f, count, chunks, 0, errors[0])();
+
+        for (std::size_t i = 0 ; i < threads.size() ; ++i)
+        {
+            threads[i].join();
+        }
+
+        for (std::size_t i = 0 ; i < chunks ; ++i)
+        {
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+        }
+
+        return;
+    }
+#endif // BOOST_GEOMETRY_USE_THREADS
+
+    for (std::size_t i = 0 ; i < chunks ; ++i)
+    {
+        chunk_worker<Function>(f, count, chunks, i)();
+    }
+}
+
+}} // namespace detail::execution
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_EXECUTION_HPP
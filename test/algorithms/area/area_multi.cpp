@@ -14,6 +14,8 @@
 
 #include <algorithms/area/test_area.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
+
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/multi_polygon.hpp>
@@ -43,9 +45,69 @@ void test_all()
     test_geometry<mp_geo>(poly, 197018888665.8331);
 }
 
+// Wavy polygons with a hole, of which the rings span several blocks
+template <typename MultiPolygon>
+MultiPolygon wavy_polygons(int count, int points, double scale)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+    double const two_pi = 2.0 * bg::math::pi<double>();
+
+    MultiPolygon result;
+    for (int k = 0; k < count; ++k)
+    {
+        polygon_type polygon;
+        for (int i = 0; i <= points; ++i)
+        {
+            double const a = -i * two_pi / points;
+            double const r = scale * (1.0 + 0.3 * std::sin(a * 7 + k));
+            bg::append(polygon.outer(), point_type(scale * 3.0 * k + r * std::cos(a),
+                                                   r * std::sin(a)));
+        }
+        polygon.inners().resize(1);
+        for (int i = 0; i <= points / 4; ++i)
+        {
+            double const a = i * two_pi / (points / 4);
+            bg::append(polygon.inners().back(),
+                       point_type(scale * (3.0 * k + 0.2 * std::cos(a)),
+                                  scale * 0.2 * std::sin(a)));
+        }
+        bg::correct(polygon);
+        result.push_back(polygon);
+    }
+    return result;
+}
+
+template <typename MultiPolygon>
+void test_policies(MultiPolygon const& mp)
+{
+    bg::default_strategy const strategy;
+    double const expected = bg::area(mp);
+    double const sequenced = bg::area(mp, strategy,
+                                      bg::execution::sequenced_policy());
+    BOOST_CHECK_CLOSE(sequenced, expected, 1e-9);
+    BOOST_CHECK_EQUAL(bg::area(mp, strategy, bg::execution::parallel_policy(3, 100)),
+                      sequenced);
+    BOOST_CHECK_EQUAL(bg::area(mp, strategy, bg::execution::parallel_policy(8, 1)),
+                      sequenced);
+    BOOST_CHECK_CLOSE(bg::area(mp.front(), strategy, bg::execution::parallel_policy(2, 1)),
+                      bg::area(mp.front()), 1e-9);
+}
+
+void test_parallel()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> pt_crt;
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > pt_sph;
+
+    test_policies(wavy_polygons<bg::model::multi_polygon<bg::model::polygon<pt_crt> > >(20, 3000, 1.0));
+    test_policies(wavy_polygons<bg::model::multi_polygon<bg::model::polygon<pt_crt, false, false> > >(20, 3000, 1.0));
+    test_policies(wavy_polygons<bg::model::multi_polygon<bg::model::polygon<pt_sph> > >(10, 500, 0.1));
+}
+
 int test_main( int , char* [] )
 {
     test_all<double>();
+    test_parallel();
 
 #ifdef HAVE_TTMATH
     test_all<bg::model::d2::point_xy<ttmath_big> >();
@@ -18,6 +18,8 @@
 
 #include <boost/core/ignore_unused.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/core/point_order.hpp>
 #include <boost/geometry/strategies/cartesian/centroid_average.hpp>
 
@@ -178,6 +180,75 @@ void test_empty()
 
 
 
+template <typename Geometry>
+void test_centroid_policies(Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    point_type expected, sequenced, parallel;
+    bg::assign_zero(expected);
+    bg::assign_zero(sequenced);
+    bg::assign_zero(parallel);
+    bg::centroid(geometry, expected);
+    bg::centroid(geometry, sequenced, bg::default_strategy(),
+                 bg::execution::sequenced_policy());
+    bg::centroid(geometry, parallel, bg::default_strategy(),
+                 bg::execution::parallel_policy(3, 100));
+
+    BOOST_CHECK_CLOSE(bg::get<0>(sequenced), bg::get<0>(expected), 1e-8);
+    BOOST_CHECK_CLOSE(bg::get<1>(sequenced), bg::get<1>(expected), 1e-8);
+    BOOST_CHECK_EQUAL(bg::get<0>(parallel), bg::get<0>(sequenced));
+    BOOST_CHECK_EQUAL(bg::get<1>(parallel), bg::get<1>(sequenced));
+}
+
+template <typename P>
+void test_parallel()
+{
+    typedef bg::model::linestring<P> linestring_type;
+    typedef bg::model::polygon<P> polygon_type;
+    double const two_pi = 2.0 * bg::math::pi<double>();
+
+    // Wavy geometries, spanning several blocks
+    bg::model::multi_point<P> mpt;
+    bg::model::multi_linestring<linestring_type> mls;
+    bg::model::multi_polygon<polygon_type> mpg;
+    for (int k = 0; k < 10; ++k)
+    {
+        linestring_type ls;
+        polygon_type polygon;
+        int const n = 1000 + 300 * k;
+        for (int i = 0; i <= n; ++i)
+        {
+            double const a = -i * two_pi / n;
+            double const r = 1.0 + 0.3 * std::sin(a * 7 + k);
+            P const p(10.0 + 3.0 * k + r * std::cos(a), 5.0 + r * std::sin(a));
+            bg::append(mpt, p);
+            bg::append(ls, p);
+            bg::append(polygon.outer(), p);
+        }
+        polygon.outer().back() = polygon.outer().front();
+        mls.push_back(ls);
+        mpg.push_back(polygon);
+    }
+
+    test_centroid_policies(mpt);
+    test_centroid_policies(mls);
+    test_centroid_policies(mls.front());
+    test_centroid_policies(mpg);
+    test_centroid_policies(mpg.front());
+    test_centroid_policies(mpg.front().outer());
+
+    // Degenerate and empty geometries behave as without a policy
+    bg::model::multi_linestring<linestring_type> single_point;
+    single_point.resize(2);
+    bg::append(single_point.back(), P(1, 2));
+    test_centroid_policies(single_point);
+    BOOST_CHECK_THROW(bg::centroid(bg::model::multi_polygon<polygon_type>(), mpt.front(),
+                                   bg::default_strategy(),
+                                   bg::execution::parallel_policy(2, 1)),
+                      bg::centroid_exception);
+}
+
 int test_main(int, char* [])
 {
     test_2d<bg::model::d2::point_xy<float> >();
@@ -192,6 +263,7 @@ int test_main(int, char* [])
 
     test_exceptions<bg::model::d2::point_xy<double> >();
     test_empty<bg::model::d2::point_xy<double> >();
+    test_parallel<bg::model::d2::point_xy<double> >();
 
     return 0;
 }
@@ -17,9 +17,13 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <algorithms/test_convex_hull.hpp>
 
@@ -37,6 +41,8 @@
 #include <boost/geometry/geometries/multi_linestring.hpp>
 #include <boost/geometry/geometries/multi_polygon.hpp>
 
+#include <boost/geometry/util/execution.hpp>
+
 
 
 
@@ -77,11 +83,139 @@ void test_all()
 }
 
 
+// Graham/Andrew on all points, without discarding points first
+template <int Factor, typename Point>
+void reference_half_hull(std::vector<Point> const& points,
+                         std::vector<Point>& hull,
+                         Point const& left, Point const& right)
+{
+    typedef bg::strategy::side::side_by_triangle<> side;
+    hull.push_back(left);
+    for (std::size_t i = 0; i <= points.size(); ++i)
+    {
+        hull.push_back(i < points.size() ? points[i] : right);
+        while (hull.size() >= 3
+            && Factor * side::apply(hull[hull.size() - 3], hull.back(),
+                                    hull[hull.size() - 2]) <= 0)
+        {
+            hull.erase(hull.end() - 2);
+        }
+    }
+}
+
+template <typename Point>
+bg::model::ring<Point> reference_hull(std::vector<Point> const& points)
+{
+    typedef bg::strategy::side::side_by_triangle<> side;
+    Point left = points.front(), right = points.front();
+    for (std::size_t i = 1; i < points.size(); ++i)
+    {
+        if (bg::less<Point>()(points[i], left)) left = points[i];
+        if (bg::greater<Point>()(points[i], right)) right = points[i];
+    }
+    std::vector<Point> lower, upper;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        int const s = side::apply(left, right, points[i]);
+        if (s == 1) upper.push_back(points[i]);
+        if (s == -1) lower.push_back(points[i]);
+    }
+    std::sort(lower.begin(), lower.end(), bg::less<Point>());
+    std::sort(upper.begin(), upper.end(), bg::less<Point>());
+    std::vector<Point> lower_hull, upper_hull;
+    reference_half_hull<-1>(lower, lower_hull, left, right);
+    reference_half_hull<1>(upper, upper_hull, left, right);
+
+    // Clockwise, closed
+    bg::model::ring<Point> result(upper_hull.begin(), upper_hull.end());
+    result.insert(result.end(), lower_hull.rbegin() + 1, lower_hull.rend());
+    while (result.size() < 4)
+    {
+        result.push_back(result.front());
+    }
+    return result;
+}
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+void test_large_geometry(Geometry const& geometry,
+                         std::vector<typename bg::point_type<Geometry>::type> const& points)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::strategy::convex_hull::graham_andrew<Geometry, point_type> strategy_type;
+
+    std::string const expected = to_wkt(reference_hull(points));
+
+    bg::model::ring<point_type> hull;
+    bg::convex_hull(geometry, hull);
+    BOOST_CHECK_EQUAL(to_wkt(hull), expected);
+
+    std::size_t const threads[] = { 2, 3, 8 };
+    for (int i = 0; i < 3; i++)
+    {
+        bg::clear(hull);
+        bg::convex_hull(geometry, hull, strategy_type(),
+                        bg::execution::parallel_policy(threads[i], 100));
+        BOOST_CHECK_EQUAL(to_wkt(hull), expected);
+    }
+
+    bg::clear(hull);
+    bg::convex_hull(geometry, hull, bg::default_strategy(),
+                    bg::execution::sequenced_policy());
+    BOOST_CHECK_EQUAL(to_wkt(hull), expected);
+}
+
+template <typename P>
+void test_large()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::multi_linestring<ls> ml;
+
+    // Points in a disc, on a circle, and on a coarse grid with many
+    // duplicates and collinear points on the hull
+    std::vector<P> disc, circle, grid;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        double const r = std::sqrt((seed >> 8) / double(1 << 24));
+        seed = seed * 1103515245u + 12345u;
+        double const a = 2 * bg::math::pi<double>() * (seed >> 8) / double(1 << 24);
+        disc.push_back(P(100 * r * std::cos(a), 100 * r * std::sin(a)));
+        circle.push_back(P(std::cos(a), std::sin(a)));
+        grid.push_back(P(std::floor(10 * r * std::cos(a)),
+                         std::floor(10 * r * std::sin(a))));
+    }
+
+    test_large_geometry(mp(disc.begin(), disc.end()), disc);
+    test_large_geometry(mp(circle.begin(), circle.end()), circle);
+    test_large_geometry(mp(grid.begin(), grid.end()), grid);
+
+    // Linestrings of various sizes, covering chunks partially
+    ml lines;
+    for (std::size_t i = 0; i < disc.size(); i += 1 + i % 700)
+    {
+        std::size_t const end = (std::min)(disc.size(), i + 1 + i % 700);
+        lines.push_back(ls(disc.begin() + i, disc.begin() + end));
+    }
+    test_large_geometry(lines, disc);
+}
+
+
 int test_main(int, char* [])
 {
     //test_all<bg::model::d2::point_xy<int> >();
     //test_all<bg::model::d2::point_xy<float> >();
     test_all<bg::model::d2::point_xy<double> >();
+    test_large<bg::model::d2::point_xy<double> >();
 
 #ifdef HAVE_TTMATH
     test_all<bg::model::d2::point_xy<ttmath_big> >();
@@ -0,0 +1,222 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/variant/variant.hpp>
+
+#include <boost/geometry/algorithms/closest_points.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+Geometry from_wkt(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    return geometry;
+}
+
+// The length of the shortest segment is the distance, and its points are
+// on the geometries, within a tolerance in units of the distance
+template <typename Geometry1, typename Geometry2>
+void check(Geometry1 const& geometry1, Geometry2 const& geometry2,
+           double tolerance)
+{
+    typedef typename bg::point_type<Geometry1>::type point_type;
+    bg::model::segment<point_type> shortest;
+    bg::closest_points(geometry1, geometry2, shortest);
+
+    double const expected = bg::distance(geometry1, geometry2);
+    double const length = bg::distance(shortest.first, shortest.second);
+    BOOST_CHECK_MESSAGE(std::fabs(length - expected) <= tolerance,
+        "length: " << length << " expected: " << expected
+        << " " << bg::wkt(geometry1) << " " << bg::wkt(geometry2));
+    BOOST_CHECK_SMALL(bg::distance(shortest.first, geometry1), tolerance);
+    BOOST_CHECK_SMALL(bg::distance(shortest.second, geometry2), tolerance);
+}
+
+template <typename Geometry1, typename Geometry2>
+void check_wkt(std::string const& wkt1, std::string const& wkt2,
+               double tolerance = 1e-9)
+{
+    Geometry1 const geometry1 = from_wkt<Geometry1>(wkt1);
+    Geometry2 const geometry2 = from_wkt<Geometry2>(wkt2);
+    check(geometry1, geometry2, tolerance);
+    check(geometry2, geometry1, tolerance);
+}
+
+// A point of one geometry is covered by the other (areal) geometry, so the
+// shortest segment is degenerate, at that point. The distance algorithm is
+// not used as reference here, because for some combinations (geographic
+// multi-point/multi-polygon) it does not always return zero.
+template <typename Geometry1, typename Geometry2>
+void check_covered_wkt(std::string const& wkt1, std::string const& wkt2,
+                       std::string const& expected_wkt, double tolerance)
+{
+    typedef typename bg::point_type<Geometry1>::type point_type;
+
+    Geometry1 const geometry1 = from_wkt<Geometry1>(wkt1);
+    Geometry2 const geometry2 = from_wkt<Geometry2>(wkt2);
+    point_type const expected = from_wkt<point_type>(expected_wkt);
+
+    bg::model::segment<point_type> shortest;
+    bg::closest_points(geometry1, geometry2, shortest);
+    BOOST_CHECK_SMALL(bg::distance(shortest.first, expected), tolerance);
+    BOOST_CHECK_SMALL(bg::distance(shortest.second, expected), tolerance);
+
+    bg::closest_points(geometry2, geometry1, shortest);
+    BOOST_CHECK_SMALL(bg::distance(shortest.first, expected), tolerance);
+    BOOST_CHECK_SMALL(bg::distance(shortest.second, expected), tolerance);
+}
+
+template <typename Point>
+void test_all(double tolerance)
+{
+    typedef bg::model::segment<Point> segment_type;
+    typedef bg::model::linestring<Point> linestring_type;
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::multi_point<Point> multi_point_type;
+    typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    std::string const ls = "LINESTRING(0 0,10 10,20 0)";
+    std::string const mls = "MULTILINESTRING((0 0,10 10,20 0),(30 0,30 10))";
+    std::string const po = "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))";
+    std::string const mpo = "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+                            "((20 0,20 5,25 5,20 0)))";
+
+    check_wkt<Point, Point>("POINT(1 2)", "POINT(4 6)", tolerance);
+    check_wkt<Point, multi_point_type>("POINT(1 2)", "MULTIPOINT(4 6,1 3,9 9)", tolerance);
+    check_wkt<Point, segment_type>("POINT(5 7)", "SEGMENT(0 0,10 0)", tolerance);
+    check_wkt<Point, linestring_type>("POINT(10 5)", ls, tolerance);
+    check_wkt<Point, multi_linestring_type>("POINT(27 5)", mls, tolerance);
+    check_wkt<Point, polygon_type>("POINT(5 5)", po, tolerance);
+    check_covered_wkt<Point, polygon_type>("POINT(1 5)", po, "POINT(1 5)", tolerance);
+    check_wkt<Point, multi_polygon_type>("POINT(23 4)", mpo, tolerance);
+
+    check_wkt<multi_point_type, multi_point_type>("MULTIPOINT(0 0,5 5,10 0)",
+                                                  "MULTIPOINT(3 7,12 1,20 20)", tolerance);
+    check_wkt<multi_point_type, linestring_type>("MULTIPOINT(0 5,5 5,10 0)", ls, tolerance);
+    check_wkt<multi_point_type, multi_polygon_type>("MULTIPOINT(15 5,5 5)", mpo, tolerance);
+    check_covered_wkt<multi_point_type, multi_polygon_type>("MULTIPOINT(15 5,1 5)", mpo,
+                                                            "POINT(1 5)", tolerance);
+
+    check_wkt<segment_type, segment_type>("SEGMENT(0 0,10 0)", "SEGMENT(5 1,6 8)", tolerance);
+    check_wkt<segment_type, segment_type>("SEGMENT(0 0,10 0)", "SEGMENT(5 -1,6 8)", tolerance);
+    check_wkt<segment_type, linestring_type>("SEGMENT(0 5,3 4)", ls, tolerance);
+    check_wkt<segment_type, polygon_type>("SEGMENT(4 4,6 5)", po, tolerance);
+
+    check_wkt<linestring_type, linestring_type>("LINESTRING(0 5,5 12,15 12)", ls, tolerance);
+    check_wkt<linestring_type, linestring_type>("LINESTRING(0 5,5 2,15 12)", ls, tolerance);
+    check_wkt<linestring_type, polygon_type>("LINESTRING(3 3,7 7,3 6)", po, tolerance);
+    check_covered_wkt<linestring_type, polygon_type>("LINESTRING(1 1,1 9)", po,
+                                                     "POINT(1 1)", tolerance);
+    check_wkt<multi_linestring_type, multi_polygon_type>(mls, mpo, tolerance);
+    check_wkt<multi_linestring_type, multi_polygon_type>(
+        "MULTILINESTRING((12 12,15 15),(15 -1,26 -1))", mpo, tolerance);
+
+    check_wkt<polygon_type, polygon_type>(po, "POLYGON((3 3,3 7,7 7,7 3,3 3))", tolerance);
+    check_wkt<polygon_type, multi_polygon_type>("POLYGON((12 0,12 5,17 5,12 0))", mpo, tolerance);
+    check_wkt<multi_polygon_type, multi_polygon_type>(mpo,
+        "MULTIPOLYGON(((13 13,13 16,16 16,13 13)),((30 0,30 5,35 5,30 0)))", tolerance);
+}
+
+template <typename Point>
+void test_cartesian()
+{
+    typedef bg::model::segment<Point> segment_type;
+    typedef bg::model::linestring<Point> linestring_type;
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::box<Point> box_type;
+
+    test_all<Point>(1e-9);
+
+    check_wkt<Point, box_type>("POINT(12 5)", "BOX(0 0,10 10)");
+    check_wkt<box_type, polygon_type>("BOX(0 0,10 10)", "POLYGON((12 0,12 5,17 5,12 0))");
+    check_wkt<box_type, box_type>("BOX(0 0,10 10)", "BOX(12 14,20 20)");
+
+    // Exact points
+    segment_type shortest;
+    bg::closest_points(from_wkt<Point>("POINT(5 7)"),
+                       from_wkt<linestring_type>("LINESTRING(0 0,10 0)"), shortest);
+    BOOST_CHECK(bg::equals(shortest.first, Point(5, 7)));
+    BOOST_CHECK(bg::equals(shortest.second, Point(5, 0)));
+
+    // Crossing linestrings, intersection point
+    bg::closest_points(from_wkt<linestring_type>("LINESTRING(0 0,10 10)"),
+                       from_wkt<linestring_type>("LINESTRING(0 10,10 0)"), shortest);
+    BOOST_CHECK(bg::equals(shortest.first, Point(5, 5)));
+    BOOST_CHECK(bg::equals(shortest.second, Point(5, 5)));
+
+    // A linestring inside a polygon
+    bg::closest_points(from_wkt<linestring_type>("LINESTRING(1 1,1 9)"),
+                       from_wkt<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0))"), shortest);
+    BOOST_CHECK(bg::equals(shortest.first, Point(1, 1)));
+    BOOST_CHECK(bg::equals(shortest.second, Point(1, 1)));
+
+    // Large linestrings, searched using an rtree
+    linestring_type wave1, wave2;
+    for (int i = 0; i <= 2000; ++i)
+    {
+        double const x = i * 0.01;
+        wave1.push_back(Point(x, std::sin(x)));
+        wave2.push_back(Point(x + 0.005, 2.1 + std::sin(x + 0.3) + 0.001 * i));
+    }
+    check(wave1, wave2, 1e-9);
+    check(wave2, wave1, 1e-9);
+
+    // Variants
+    typedef boost::variant<Point, linestring_type, polygon_type> variant_type;
+    variant_type const v1 = from_wkt<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    variant_type const v2 = Point(13, 14);
+    bg::closest_points(v1, v2, shortest);
+    BOOST_CHECK(bg::equals(shortest.first, Point(10, 10)));
+    BOOST_CHECK(bg::equals(shortest.second, Point(13, 14)));
+    bg::closest_points(v1, Point(13, 14), shortest);
+    BOOST_CHECK(bg::equals(shortest.first, Point(10, 10)));
+    bg::closest_points(Point(13, 14), v1, shortest);
+    BOOST_CHECK(bg::equals(shortest.second, Point(10, 10)));
+
+    // Empty geometries
+    BOOST_CHECK_THROW(bg::closest_points(Point(1, 1), linestring_type(), shortest),
+                      bg::empty_input_exception);
+}
+
+template <typename Point>
+void test_geographic()
+{
+    typedef bg::model::segment<Point> segment_type;
+    typedef bg::model::linestring<Point> linestring_type;
+
+    // In meters, for geometries of about 1000 km, calculated with the
+    // approximations of the default (Andoyer) strategies
+    test_all<Point>(10.0);
+
+    // On the equator, and near a meridian
+    segment_type shortest;
+    bg::closest_points(from_wkt<Point>("POINT(5 3)"),
+                       from_wkt<linestring_type>("LINESTRING(0 0,10 0)"), shortest);
+    BOOST_CHECK_CLOSE(bg::get<0>(shortest.second), 5.0, 1e-9);
+    BOOST_CHECK_SMALL(bg::get<1>(shortest.second), 1e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_cartesian<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_all<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >(1e-9);
+    test_geographic<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/math/special_functions/next.hpp>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/distance_index.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::segment<point_type> segment_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+// Points on a grid, with some noise
+std::vector<point_type> query_points(int count)
+{
+    std::vector<point_type> result;
+    for (int i = 0; i < count; ++i)
+    {
+        result.push_back(point_type(-5.0 + (i % 37) * 0.9 + 0.1 * std::sin(i * 1.7),
+                                    -5.0 + (i / 37) * 0.8 + 0.1 * std::cos(i * 2.3)));
+    }
+    return result;
+}
+
+template <typename Geometry>
+void test_geometry(Geometry const& geometry)
+{
+    typedef bg::distance_index<Geometry> index_type;
+    index_type const index(geometry);
+
+    std::vector<point_type> const points = query_points(1000);
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        double const expected = bg::distance(points[i], geometry);
+        BOOST_CHECK_CLOSE(index.distance(points[i]), expected, 1e-9);
+        BOOST_CHECK_CLOSE(index.comparable_distance(points[i]),
+                          bg::comparable_distance(points[i], geometry), 1e-9);
+
+        segment_type shortest;
+        index.closest_points(points[i], shortest);
+        BOOST_CHECK(bg::equals(shortest.first, points[i]));
+        BOOST_CHECK_CLOSE(bg::length(shortest) + 1.0, expected + 1.0, 1e-9);
+        BOOST_CHECK_SMALL(bg::distance(shortest.second, geometry), 1e-9);
+    }
+
+    // Batches, sequenced and in parallel
+    std::vector<double> sequenced, parallel(points.size());
+    index.batch_distance(points, std::back_inserter(sequenced));
+    BOOST_CHECK(index.batch_distance(points, parallel.begin(),
+                    bg::execution::parallel_policy(4, 16)) == parallel.end());
+    BOOST_CHECK_EQUAL(sequenced.size(), points.size());
+    BOOST_CHECK(parallel == sequenced);
+    BOOST_CHECK_EQUAL(sequenced[10], index.distance(points[10]));
+
+    std::vector<double> comparable(points.size());
+    index.batch_comparable_distance(points, comparable.begin(),
+                                    bg::execution::parallel_policy(3, 1));
+    BOOST_CHECK_EQUAL(comparable[20], index.comparable_distance(points[20]));
+
+    std::vector<typename index_type::segment_type> segments(points.size());
+    index.batch_closest_points(points, segments.begin(),
+                               bg::execution::parallel_policy(2, 100));
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(bg::length(segments[i]), sequenced[i]);
+    }
+}
+
+void test_all()
+{
+    linestring_type ls;
+    for (int i = 0; i <= 500; ++i)
+    {
+        ls.push_back(point_type(i * 0.05, 10 * std::sin(i * 0.05)));
+    }
+    test_geometry(ls);
+
+    multi_linestring_type mls;
+    bg::read_wkt("MULTILINESTRING((0 0,10 0,10 10),(20 0,25 5,20 10,25 15),(3 3))",
+                 mls);
+    test_geometry(mls);
+
+    multi_polygon_type mpo;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+                 "((15 0,15 5,20 5,15 0)))", mpo);
+    test_geometry(mpo);
+    test_geometry(mpo.front());
+
+    multi_point_type mpt;
+    bg::read_wkt("MULTIPOINT(0 0,3 7,12 1,25 25,7 -2)", mpt);
+    test_geometry(mpt);
+
+    // Inside the polygon, or in the hole
+    bg::distance_index<multi_polygon_type> const index(mpo);
+    BOOST_CHECK_EQUAL(index.distance(point_type(1, 1)), 0.0);
+    BOOST_CHECK_CLOSE(index.distance(point_type(5, 3)), 1.0, 1e-9);
+    segment_type shortest;
+    index.closest_points(point_type(1, 1), shortest);
+    BOOST_CHECK(bg::equals(shortest.second, point_type(1, 1)));
+    index.closest_points(point_type(5, 4), shortest);
+    BOOST_CHECK(bg::equals(shortest.second, point_type(5, 2)));
+
+    // Empty geometries are not indexed
+    multi_point_type const empty;
+    BOOST_CHECK_THROW(bg::distance_index<multi_point_type> const empty_index(empty),
+                      bg::empty_input_exception);
+}
+
+// The points inside are found using the rtree, check them against the
+// covered_by algorithm, also for points with the coordinates of the vertices
+template <typename Geometry>
+void test_covered(Geometry const& geometry, std::vector<point_type> const& points)
+{
+    bg::distance_index<Geometry> const index(geometry);
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        bool const covered = bg::covered_by(points[i], geometry);
+        double const distance = index.distance(points[i]);
+        BOOST_CHECK_MESSAGE((distance == 0.0) == covered,
+                            "distance " << distance << " of "
+                            << bg::wkt(points[i]) << ", covered: " << covered);
+        BOOST_CHECK_CLOSE(distance + 1.0, bg::distance(points[i], geometry) + 1.0,
+                          1e-9);
+    }
+}
+
+void test_large_polygon()
+{
+    // A star with a hole, with concave vertices
+    polygon_type po;
+    for (int i = 0; i < 4000; ++i)
+    {
+        double const a = i * 2.0 * bg::math::pi<double>() / 4000;
+        double const r = i % 2 == 0 ? 10.0 : 7.0 + std::sin(i * 0.01);
+        bg::append(po, point_type(r * std::cos(a), r * std::sin(a)));
+    }
+    bg::append(po, bg::range::front(bg::exterior_ring(po)));
+    po.inners().resize(1);
+    for (int i = 0; i < 1000; ++i)
+    {
+        double const a = i * 2.0 * bg::math::pi<double>() / 1000;
+        bg::append(po, point_type(3 * std::cos(a), 3 * std::sin(a) + 1), 0);
+    }
+    bg::append(po, bg::range::front(po.inners()[0]), 0);
+    bg::correct(po);
+
+    std::vector<point_type> points = query_points(1000);
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        points[i].set<0>(points[i].get<0>() * 0.7 - 8);
+        points[i].set<1>(points[i].get<1>() * 0.7 - 8);
+    }
+    for (std::size_t i = 0; i < 4000; i += 7)
+    {
+        point_type const& v = bg::range::at(bg::exterior_ring(po), i);
+        points.push_back(v);
+        points.push_back(point_type(v.get<0>(), v.get<1>() * 0.5));
+        points.push_back(point_type(v.get<0>(), v.get<1>() + 0.1));
+    }
+    test_covered(po, points);
+
+    // Squares with vertical and horizontal segments at the coordinates of the
+    // points
+    multi_polygon_type mpo;
+    for (int i = 0; i < 30; ++i)
+    {
+        for (int j = 0; j < 30; ++j)
+        {
+            polygon_type square;
+            bg::append(square, point_type(i * 3, j * 3));
+            bg::append(square, point_type(i * 3, j * 3 + 2));
+            bg::append(square, point_type(i * 3 + 2, j * 3 + 2));
+            bg::append(square, point_type(i * 3 + 2, j * 3));
+            bg::append(square, point_type(i * 3, j * 3));
+            mpo.push_back(square);
+        }
+    }
+    points.clear();
+    for (int i = -2; i < 184; ++i)
+    {
+        for (int j = -2; j < 184; j += 5)
+        {
+            points.push_back(point_type(i * 0.5, j * 0.5));
+        }
+    }
+    test_covered(mpo, points);
+
+    // A vertex one ulp from the x of the point is counted by the strategy
+    polygon_type near;
+    bg::append(near, point_type(0, 0));
+    bg::append(near, point_type(0, 10));
+    bg::append(near, point_type(boost::math::nextafter(5.0, 6.0), 10));
+    bg::append(near, point_type(10, 10));
+    bg::append(near, point_type(10, 0));
+    bg::append(near, point_type(0, 0));
+    points.clear();
+    points.push_back(point_type(5, 20));
+    points.push_back(point_type(5, 10));
+    points.push_back(point_type(5, 5));
+    test_covered(near, points);
+    BOOST_CHECK_CLOSE(bg::distance_index<polygon_type>(near).distance(point_type(5, 20)),
+                      10.0, 1e-9);
+}
+
+void test_strategy()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > sph_point;
+    typedef bg::model::linestring<sph_point> sph_linestring;
+    typedef bg::strategy::distance::cross_track<> strategy_type;
+
+    sph_linestring ls;
+    bg::read_wkt("LINESTRING(0 0,10 10,20 0,30 10)", ls);
+    bg::distance_index<sph_linestring, strategy_type> const index(ls, strategy_type());
+
+    sph_point const p(12, 3);
+    BOOST_CHECK_CLOSE(index.distance(p), bg::distance(p, ls, strategy_type()), 1e-9);
+    BOOST_CHECK_CLOSE(index.comparable_distance(p),
+                      bg::comparable_distance(p, ls, strategy_type()), 1e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_all();
+    test_large_polygon();
+    test_strategy();
+
+    return 0;
+}
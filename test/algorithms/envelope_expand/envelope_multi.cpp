@@ -15,6 +15,8 @@
 
 #include "test_envelope.hpp"
 
+#include <boost/geometry/algorithms/append.hpp>
+
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/adapted/c_array.hpp>
@@ -45,12 +47,87 @@ void test_3d()
 }
 
 
+template <typename Box>
+void check_same_box(Box const& box, Box const& expected)
+{
+    // Minima and maxima are exact
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 0>(box)), (bg::get<bg::min_corner, 0>(expected)));
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 1>(box)), (bg::get<bg::min_corner, 1>(expected)));
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 0>(box)), (bg::get<bg::max_corner, 0>(expected)));
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(box)), (bg::get<bg::max_corner, 1>(expected)));
+}
+
+template <typename Geometry>
+void test_envelope_policies(Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+
+    box_type expected, sequenced, parallel;
+    bg::envelope(geometry, expected);
+    bg::envelope(geometry, sequenced, bg::default_strategy(),
+                 bg::execution::sequenced_policy());
+    bg::envelope(geometry, parallel, bg::default_strategy(),
+                 bg::execution::parallel_policy(3, 100));
+
+    check_same_box(sequenced, expected);
+    check_same_box(parallel, expected);
+}
+
+template <typename P>
+void test_parallel()
+{
+    typedef bg::model::linestring<P> linestring_type;
+    typedef bg::model::polygon<P> polygon_type;
+
+    bg::model::multi_point<P> mpt;
+    bg::model::multi_linestring<linestring_type> mls;
+    bg::model::multi_polygon<polygon_type> mpg;
+    for (int k = 0; k < 10; ++k)
+    {
+        linestring_type ls;
+        polygon_type polygon;
+        for (int i = 0; i < 1000 + 500 * k; ++i)
+        {
+            double const x = k + i * 0.001;
+            double const y = std::sin(x * 7) * std::cos(x * 3) + k;
+            bg::append(mpt, P(y, x));
+            bg::append(ls, P(x, y));
+            bg::append(polygon.outer(), P(x, y));
+        }
+        bg::append(polygon.outer(), polygon.outer().front());
+        // An interior ring, exceeding the exterior ring, is not considered
+        polygon.inners().resize(1);
+        bg::append(polygon.inners().back(), P(-100, -100));
+        mls.push_back(ls);
+        mpg.push_back(polygon);
+    }
+    mls.resize(mls.size() + 1);
+
+    // If the exterior ring is empty, the interior rings are considered
+    polygon_type hollow;
+    hollow.inners().push_back(mpg[3].outer());
+    hollow.inners().push_back(mpg[7].outer());
+    mpg.push_back(hollow);
+
+    test_envelope_policies(mpt);
+    test_envelope_policies(mls);
+    test_envelope_policies(mls.front());
+    test_envelope_policies(mpg);
+    test_envelope_policies(mpg.front());
+    test_envelope_policies(hollow);
+    test_envelope_policies(bg::model::multi_polygon<polygon_type>());
+}
+
+
 int test_main( int , char* [] )
 {
     test_2d<boost::tuple<float, float> >();
     test_2d<bg::model::d2::point_xy<float> >();
     test_2d<bg::model::d2::point_xy<double> >();
 
+    test_parallel<bg::model::d2::point_xy<double> >();
+
     test_3d<boost::tuple<float, float, float> >();
     test_3d<bg::model::point<double, 3, bg::cs::cartesian> >();
 
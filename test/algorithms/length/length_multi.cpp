@@ -8,6 +8,8 @@
 
 #include <algorithms/test_length.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
+
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 
@@ -18,6 +20,41 @@ void test_all()
         ("MULTILINESTRING((0 0,3 4,4 3))", 5 + sqrt(2.0));
 }
 
+template <typename P>
+void test_parallel()
+{
+    typedef bg::model::linestring<P> linestring_type;
+
+    // Wavy linestrings, spanning several blocks, and one without segments
+    bg::model::multi_linestring<linestring_type> mls;
+    mls.resize(21);
+    for (int k = 0; k < 20; ++k)
+    {
+        for (int i = 0; i < 1500 + 100 * k; ++i)
+        {
+            double const x = i * 0.01;
+            bg::append(mls[k], P(x, k + std::sin(x * (k + 1))));
+        }
+    }
+    bg::append(mls[20], P(1, 1));
+
+    typedef typename bg::default_length_result
+        <
+            bg::model::multi_linestring<linestring_type>
+        >::type length_type;
+
+    bg::default_strategy const strategy;
+    length_type const sequenced = bg::length(mls, strategy,
+                                             bg::execution::sequenced_policy());
+    BOOST_CHECK_CLOSE(sequenced, bg::length(mls), 1e-9);
+    BOOST_CHECK_EQUAL(bg::length(mls, strategy, bg::execution::parallel_policy(3, 100)),
+                      sequenced);
+    BOOST_CHECK_EQUAL(bg::length(mls, strategy, bg::execution::parallel_policy(8, 1)),
+                      sequenced);
+    BOOST_CHECK_CLOSE(bg::length(mls[5], strategy, bg::execution::parallel_policy(2, 1)),
+                      bg::length(mls[5]), 1e-9);
+}
+
 template <typename P>
 void test_empty_input()
 {
@@ -27,6 +64,7 @@ void test_empty_input()
 int test_main( int , char* [] )
 {
     test_all<bg::model::d2::point_xy<double> >();
+    test_parallel<bg::model::d2::point_xy<double> >();
 
 #ifdef HAVE_TTMATH
     test_all<bg::model::d2::point_xy<ttmath_big> >();
@@ -0,0 +1,171 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/algorithms/densify.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/line_interpolate.hpp>
+#include <boost/geometry/algorithms/measured_linestring.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+template <typename Point>
+void check_point(Point const& p, Point const& expected, double tolerance)
+{
+    BOOST_CHECK_MESSAGE(
+        std::fabs(bg::get<0>(p) - bg::get<0>(expected)) <= tolerance
+        && std::fabs(bg::get<1>(p) - bg::get<1>(expected)) <= tolerance,
+        bg::wkt(p) << " != " << bg::wkt(expected));
+}
+
+template <typename Linestring>
+void check_linestring(Linestring const& ls, std::string const& wkt)
+{
+    Linestring expected;
+    bg::read_wkt(wkt, expected);
+
+    BOOST_CHECK_MESSAGE(boost::size(ls) == boost::size(expected),
+                        bg::wkt(ls) << " != " << wkt);
+    if (boost::size(ls) == boost::size(expected))
+    {
+        for (std::size_t i = 0; i < boost::size(ls); i++)
+        {
+            check_point(bg::range::at(ls, i), bg::range::at(expected, i), 1e-9);
+        }
+    }
+}
+
+// The measured linestring gives the same points as line_interpolate and
+// densify, and locates its interpolated points at their fraction
+template <typename Point>
+void test_consistency(std::string const& wkt, double max_distance,
+                      double tolerance, double locate_tolerance)
+{
+    typedef bg::model::linestring<Point> linestring;
+
+    linestring ls;
+    bg::read_wkt(wkt, ls);
+
+    bg::measured_linestring<linestring> const measured(ls);
+    BOOST_CHECK_CLOSE(measured.length(), bg::length(ls), 1e-9);
+
+    for (int i = 0; i <= 10; i++)
+    {
+        double const fraction = i / 10.0;
+
+        Point p, expected;
+        measured.interpolate(fraction, p);
+        bg::line_interpolate(ls, fraction * bg::length(ls), expected);
+        check_point(p, expected, tolerance);
+
+        BOOST_CHECK_SMALL(measured.locate(p) - fraction, locate_tolerance);
+    }
+
+    linestring densified, expected;
+    measured.densify(densified, max_distance);
+    bg::densify(ls, expected, max_distance);
+    BOOST_CHECK_EQUAL(boost::size(densified), boost::size(expected));
+    if (boost::size(densified) == boost::size(expected))
+    {
+        for (std::size_t i = 0; i < boost::size(densified); i++)
+        {
+            check_point(bg::range::at(densified, i),
+                        bg::range::at(expected, i), tolerance);
+        }
+    }
+}
+
+void test_cartesian()
+{
+    typedef bg::model::d2::point_xy<double> P;
+    typedef bg::model::linestring<P> LS;
+
+    LS ls;
+    bg::read_wkt("LINESTRING(0 0,10 0,10 10)", ls);
+    bg::measured_linestring<LS> const measured(ls);
+
+    BOOST_CHECK_CLOSE(measured.length(), 20.0, 1e-9);
+
+    P p;
+    measured.interpolate(0.25, p);
+    check_point(p, P(5, 0), 1e-9);
+    measured.interpolate(0.5, p);
+    check_point(p, P(10, 0), 1e-9);
+    measured.interpolate(0.75, p);
+    check_point(p, P(10, 5), 1e-9);
+    measured.interpolate(-1.0, p);
+    check_point(p, P(0, 0), 1e-9);
+    measured.interpolate(2.0, p);
+    check_point(p, P(10, 10), 1e-9);
+
+    BOOST_CHECK_CLOSE(measured.locate(P(5, 1)), 0.25, 1e-9);
+    BOOST_CHECK_CLOSE(measured.locate(P(11, 5)), 0.75, 1e-9);
+    BOOST_CHECK_CLOSE(measured.locate(P(12, 12)), 1.0, 1e-9);
+    BOOST_CHECK_SMALL(measured.locate(P(-3, -3)), 1e-9);
+
+    LS sub;
+    measured.substring(0.25, 0.75, sub);
+    check_linestring(sub, "LINESTRING(5 0,10 0,10 5)");
+    measured.substring(0.75, 0.25, sub);
+    check_linestring(sub, "LINESTRING(10 5,10 0,5 0)");
+    measured.substring(0.1, 0.2, sub);
+    check_linestring(sub, "LINESTRING(2 0,4 0)");
+    measured.substring(0.0, 0.5, sub);
+    check_linestring(sub, "LINESTRING(0 0,10 0)");
+    measured.substring(-1.0, 2.0, sub);
+    check_linestring(sub, "LINESTRING(0 0,10 0,10 10)");
+
+    measured.densify(sub, 4.0);
+    check_linestring(sub, "LINESTRING(0 0,3.3333333333333335 0,6.666666666666667 0,10 0,"
+                          "10 3.3333333333333335,10 6.666666666666667,10 10)");
+
+    // Degenerate linestrings
+    LS single;
+    bg::read_wkt("LINESTRING(1 1)", single);
+    bg::measured_linestring<LS> const measured_single(single);
+    measured_single.interpolate(0.5, p);
+    check_point(p, P(1, 1), 1e-9);
+    BOOST_CHECK_SMALL(measured_single.locate(P(2, 2)), 1e-9);
+    measured_single.substring(0.0, 1.0, sub);
+    check_linestring(sub, "LINESTRING(1 1,1 1)");
+
+    LS same;
+    bg::read_wkt("LINESTRING(1 1,1 1)", same);
+    bg::measured_linestring<LS> const measured_same(same);
+    measured_same.interpolate(0.5, p);
+    check_point(p, P(1, 1), 1e-9);
+
+    LS empty;
+    BOOST_CHECK_THROW(bg::measured_linestring<LS> m(empty), bg::empty_input_exception);
+    BOOST_CHECK_THROW(measured.densify(sub, 0.0), bg::invalid_input_exception);
+
+    test_consistency<P>("LINESTRING(0 2,5 2,5 1,20 1)", 2.5, 1e-9, 1e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_cartesian();
+
+    std::string const route = "LINESTRING(1 1,20 3,25 -10,40 15,41 16)";
+    test_consistency<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >
+        (route, 0.05, 1e-9, 1e-9);
+    // The direct, inverse and closest point calculations of the default
+    // (Andoyer) strategies are approximations, line_interpolate does not
+    // reach the last point exactly
+    test_consistency<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >
+        (route, 500000.0, 1e-4, 1e-4);
+
+    return 0;
+}
@@ -7,6 +7,8 @@
 
 #include <geometry_test_common.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/perimeter.hpp>
 
 #include <boost/geometry/io/wkt/wkt.hpp>
@@ -25,10 +27,58 @@ void test_all()
             "MULTIPOLYGON(((0 0,0 1,1 0,0 0)))", 1.0 + 1.0 + sqrt(2.0));
 }
 
+template <typename MultiPolygon>
+void test_parallel()
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+    double const two_pi = 2.0 * bg::math::pi<double>();
+
+    // Wavy polygons with a hole, of which the rings span several blocks
+    MultiPolygon mp;
+    mp.resize(20);
+    for (int k = 0; k < 20; ++k)
+    {
+        polygon_type& polygon = mp[k];
+        for (int i = 0; i <= 3000; ++i)
+        {
+            double const a = -i * two_pi / 3000;
+            double const r = 1.0 + 0.3 * std::sin(a * 7 + k);
+            bg::append(polygon.outer(), point_type(3.0 * k + r * std::cos(a),
+                                                   r * std::sin(a)));
+        }
+        polygon.inners().resize(1);
+        for (int i = 0; i <= 700; ++i)
+        {
+            double const a = i * two_pi / 700;
+            bg::append(polygon.inners().back(),
+                       point_type(3.0 * k + 0.2 * std::cos(a), 0.2 * std::sin(a)));
+        }
+        bg::correct(polygon);
+    }
+
+    typedef typename bg::default_length_result<MultiPolygon>::type length_type;
+
+    bg::default_strategy const strategy;
+    length_type const sequenced = bg::perimeter(mp, strategy,
+                                                bg::execution::sequenced_policy());
+    BOOST_CHECK_CLOSE(sequenced, bg::perimeter(mp), 1e-9);
+    BOOST_CHECK_EQUAL(bg::perimeter(mp, strategy, bg::execution::parallel_policy(3, 100)),
+                      sequenced);
+    BOOST_CHECK_EQUAL(bg::perimeter(mp, strategy, bg::execution::parallel_policy(8, 1)),
+                      sequenced);
+    BOOST_CHECK_CLOSE(bg::perimeter(mp.front(), strategy, bg::execution::parallel_policy(2, 1)),
+                      bg::perimeter(mp.front()), 1e-9);
+}
+
 int test_main( int , char* [] )
 {
     test_all<bg::model::d2::point_xy<double> >();
 
+    typedef bg::model::d2::point_xy<double> pt;
+    test_parallel<bg::model::multi_polygon<bg::model::polygon<pt> > >();
+    test_parallel<bg::model::multi_polygon<bg::model::polygon<pt, false, false> > >();
+
 #ifdef HAVE_TTMATH
     test_all<bg::model::d2::point_xy<ttmath_big> >();
 #endif
@@ -0,0 +1,327 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/algorithms/point_source.hpp>
+#include <boost/geometry/io/wkb/point_source.hpp>
+#include <boost/geometry/io/wkb/write.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::wkb_point_source<point_type> source_type;
+
+
+template <typename Geometry>
+std::string wkb(Geometry const& geometry)
+{
+    std::string result;
+    bg::write_wkb(geometry, std::back_inserter(result));
+    return result;
+}
+
+template <typename Geometry>
+std::string wkt_string(Geometry const& geometry)
+{
+    std::string result;
+    bg::to_wkt(geometry, result);
+    return result;
+}
+
+template <typename Geometry>
+Geometry from_wkt(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    return geometry;
+}
+
+struct sum_points
+{
+    sum_points() : count(0), sum(0) {}
+
+    void operator()(point_type const& p)
+    {
+        ++count;
+        sum += bg::get<0>(p) + bg::get<1>(p);
+    }
+
+    std::size_t count;
+    double sum;
+};
+
+struct sum_segments
+{
+    sum_segments() : count(0), length(0) {}
+
+    template <typename Segment>
+    void operator()(Segment const& s)
+    {
+        ++count;
+        length += bg::length(s);
+    }
+
+    std::size_t count;
+    double length;
+};
+
+// A polygon with a hole, a (circular) polygon of many points, spanning
+// several chunks, and a small polygon
+multi_polygon_type polygons()
+{
+    multi_polygon_type result = from_wkt<multi_polygon_type>(
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2)),"
+        "((100 100,100 100.001,100.001 100.001,100 100)))");
+    polygon_type circle;
+    for (int i = 0; i <= 20000; ++i)
+    {
+        double const a = -i * 2 * bg::math::pi<double>() / 20000;
+        circle.outer().push_back(point_type(50 + 20 * std::cos(a), 20 * std::sin(a)));
+    }
+    circle.outer().back() = circle.outer().front();
+    result.insert(result.begin() + 1, circle);
+    return result;
+}
+
+void test_areal()
+{
+    multi_polygon_type const mp = polygons();
+    std::string const data = wkb(mp);
+
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        box_type box;
+        bg::envelope(source, box);
+        BOOST_CHECK_EQUAL(wkt_string(box), wkt_string(bg::return_envelope<box_type>(mp)));
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_CLOSE(bg::area(source), bg::area(mp), 1e-10);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_CLOSE(bg::perimeter(source), bg::perimeter(mp), 1e-10);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_EQUAL(bg::length(source), 0.0);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_EQUAL(bg::num_points(source), bg::num_points(mp));
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        point_type c, expected;
+        bg::centroid(source, c);
+        bg::centroid(mp, expected);
+        BOOST_CHECK_CLOSE(bg::get<0>(c), bg::get<0>(expected), 1e-8);
+        BOOST_CHECK_CLOSE(bg::get<1>(c), bg::get<1>(expected), 1e-8);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        sum_segments const s = bg::for_each_segment(source, sum_segments());
+        multi_polygon_type copy = mp;
+        sum_segments const expected = bg::for_each_segment(copy, sum_segments());
+        BOOST_CHECK_EQUAL(s.count, expected.count);
+        BOOST_CHECK_CLOSE(s.length, expected.length, 1e-10);
+    }
+
+    // The small polygon collapses, the hole and the circle are kept
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        multi_polygon_type simplified;
+        bg::simplify(source, simplified, 0.01);
+        BOOST_CHECK_EQUAL(simplified.size(), 2u);
+        BOOST_CHECK_EQUAL(simplified[0].inners().size(), 1u);
+        BOOST_CHECK_LT(bg::num_points(simplified), 1000u);
+        BOOST_CHECK_CLOSE(bg::area(simplified), bg::area(mp), 0.1);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        polygon_type simplified;
+        bg::simplify(source, simplified, 0.1);
+        BOOST_CHECK_EQUAL(wkt_string(simplified), wkt_string(mp[0]));
+    }
+    {
+        // Counter clockwise input gives a negative area
+        std::istringstream stream(wkb(from_wkt<polygon_type>(
+            "POLYGON((0 0,2 0,2 2,0 2,0 0))")));
+        source_type source(stream);
+        BOOST_CHECK_EQUAL(bg::area(source), -4.0);
+    }
+}
+
+void test_linear()
+{
+    multi_linestring_type mls = from_wkt<multi_linestring_type>(
+        "MULTILINESTRING((0 0,1 0,1 1,2 1.001,3 1),(5 5,5 5))");
+    linestring_type wavy;
+    for (int i = 0; i <= 100000; ++i)
+    {
+        double const x = i * 0.001;
+        wavy.push_back(point_type(x, std::sin(x)));
+    }
+    mls.push_back(wavy);
+    std::string const data = wkb(mls);
+
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_CLOSE(bg::length(source), bg::length(mls), 1e-10);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_EQUAL(bg::perimeter(source), 0.0);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        point_type c, expected;
+        bg::centroid(source, c);
+        bg::centroid(mls, expected);
+        BOOST_CHECK_CLOSE(bg::get<0>(c), bg::get<0>(expected), 1e-8);
+        BOOST_CHECK_CLOSE(bg::get<1>(c), bg::get<1>(expected), 1e-8);
+    }
+    {
+        // Short parts are simplified as a whole, long parts in blocks
+        std::istringstream stream(data);
+        source_type source(stream);
+        multi_linestring_type simplified, expected;
+        bg::simplify(source, simplified, 0.01);
+        bg::simplify(mls, expected, 0.01);
+        BOOST_CHECK_EQUAL(simplified.size(), 3u);
+        BOOST_CHECK_EQUAL(wkt_string(simplified[0]), wkt_string(expected[0]));
+        BOOST_CHECK_EQUAL(wkt_string(simplified[1]), "LINESTRING(5 5)");
+        BOOST_CHECK_GE(simplified[2].size() + 5, expected[2].size());
+        BOOST_CHECK_LE(simplified[2].size(), expected[2].size() + 5);
+        BOOST_CHECK_CLOSE(bg::length(simplified[2]), bg::length(expected[2]), 0.01);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        linestring_type simplified;
+        bg::simplify(source, simplified, 0.01);
+        BOOST_CHECK_EQUAL(wkt_string(simplified), "LINESTRING(0 0,1 0,1 1,3 1)");
+    }
+}
+
+void test_pointlike()
+{
+    multi_point_type const mp = from_wkt<multi_point_type>(
+        "MULTIPOINT((1 2),(3 4),(5 -6),(0 0))");
+    std::string const data = wkb(mp);
+
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        sum_points const s = bg::for_each_point(source, sum_points());
+        BOOST_CHECK_EQUAL(s.count, 4u);
+        BOOST_CHECK_EQUAL(s.sum, 9.0);
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        point_type c;
+        bg::centroid(source, c);
+        BOOST_CHECK_EQUAL(wkt_string(c), "POINT(2.25 0)");
+    }
+    {
+        std::istringstream stream(data);
+        source_type source(stream);
+        multi_point_type simplified;
+        bg::simplify(source, simplified, 1.0);
+        BOOST_CHECK_EQUAL(wkt_string(simplified), wkt_string(mp));
+    }
+    {
+        std::istringstream stream(wkb(point_type(3, 4)));
+        source_type source(stream);
+        box_type box;
+        bg::envelope(source, box);
+        BOOST_CHECK_EQUAL(wkt_string(box), "POLYGON((3 4,3 4,3 4,3 4,3 4))");
+    }
+}
+
+void test_source()
+{
+    // Parts which are not read are skipped
+    {
+        std::istringstream stream(wkb(polygons()));
+        source_type source(stream);
+        bg::point_source_part kind = bg::part_points;
+        std::size_t exteriors = 0, interiors = 0;
+        while (source.next_part(kind))
+        {
+            exteriors += kind == bg::part_exterior_ring ? 1 : 0;
+            interiors += kind == bg::part_interior_ring ? 1 : 0;
+        }
+        BOOST_CHECK_EQUAL(exteriors, 3u);
+        BOOST_CHECK_EQUAL(interiors, 1u);
+    }
+
+    // Empty
+    {
+        std::istringstream stream(wkb(multi_point_type()));
+        source_type source(stream);
+        BOOST_CHECK_EQUAL(bg::num_points(source), 0u);
+
+        std::istringstream again(wkb(multi_point_type()));
+        source_type empty(again);
+        point_type c;
+        BOOST_CHECK_THROW(bg::centroid(empty, c), bg::centroid_exception);
+    }
+
+    // Truncated, or of another dimension
+    {
+        std::string data = wkb(polygons());
+        data.erase(data.size() - 1);
+        std::istringstream stream(data);
+        source_type source(stream);
+        BOOST_CHECK_THROW(bg::num_points(source), bg::read_wkb_exception);
+
+        std::istringstream stream3d(wkb(point3d_type(1, 2, 3)));
+        source_type source3d(stream3d);
+        BOOST_CHECK_THROW(bg::num_points(source3d), bg::read_wkb_exception);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_areal();
+    test_linear();
+    test_pointlike();
+    test_source();
+
+    return 0;
+}
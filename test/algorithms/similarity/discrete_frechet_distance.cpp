@@ -8,6 +8,7 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <vector>
 
 #include <boost/geometry/geometries/linestring.hpp>
@@ -80,8 +81,113 @@ void test_all_spherical_equ()
 
 }
 
+// Straightforward calculation with the whole coupling matrix
+template <typename Linestring>
+double frechet_reference(Linestring const& ls1, Linestring const& ls2)
+{
+    std::size_t const a = ls1.size();
+    std::size_t const b = ls2.size();
+    std::vector<double> m(a * b);
+    for (std::size_t i = 0; i < a; i++)
+    {
+        for (std::size_t j = 0; j < b; j++)
+        {
+            double const d = bg::distance(ls1[i], ls2[j]);
+            double r = d;
+            if (i > 0 && j > 0)
+            {
+                r = (std::max)((std::min)((std::min)(m[(i - 1) * b + j], m[i * b + j - 1]),
+                                          m[(i - 1) * b + j - 1]), d);
+            }
+            else if (i > 0)
+            {
+                r = (std::max)(m[(i - 1) * b], d);
+            }
+            else if (j > 0)
+            {
+                r = (std::max)(m[j - 1], d);
+            }
+            m[i * b + j] = r;
+        }
+    }
+    return m[a * b - 1];
+}
+
+template <typename P>
+void test_long_cartesian()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+
+    // Two noisy tracks along a similar path, spanning several tiles
+    linestring_2d ls1, ls2;
+    for (int i = 0; i < 1500; i++)
+    {
+        double const t = i * 0.01;
+        ls1.push_back(P(t, std::sin(t) + 0.05 * std::sin(i * 7.1)));
+    }
+    for (int i = 0; i < 1300; i++)
+    {
+        double const t = i * 0.0115;
+        ls2.push_back(P(t + 0.03, std::sin(t) + 0.05 * std::cos(i * 3.3)));
+    }
+
+    double const expected = frechet_reference(ls1, ls2);
+    bg::strategy::distance::pythagoras<> const pythagoras;
+    BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls1, ls2), expected);
+    BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls1, ls2, pythagoras,
+                          bg::execution::parallel_policy(3)), expected);
+    BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls2, ls1, pythagoras,
+                          bg::execution::parallel_policy(2)), expected);
+
+    BOOST_CHECK(bg::frechet_distance_below(ls1, ls2, expected));
+    BOOST_CHECK(! bg::frechet_distance_below(ls1, ls2, expected * 0.999));
+    BOOST_CHECK(bg::frechet_distance_below(ls2, ls1, expected, pythagoras));
+    BOOST_CHECK(! bg::frechet_distance_below(ls2, ls1, expected * 0.999, pythagoras));
+}
+
+template <typename P>
+void test_below_cartesian()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+
+    std::string const wkts[] = {
+        "LINESTRING(3 0,2 1,3 2)", "LINESTRING(0 0,3 4,4 3)",
+        "LINESTRING(0 0, 1 0, 1 1, 0 1, 0 0)", "LINESTRING(1 1, 0 1, 0 0, 1 0, 1 1)",
+        "LINESTRING(0 0,3 4,4 3)", "LINESTRING(4 3,3 4,0 0)",
+        "LINESTRING(0 0,1 0,2 0,3 0)", "LINESTRING(0 0.5,3 0.5)",
+        "LINESTRING(0 0,10 0)", "LINESTRING(0 0,5 8,10 0)"
+    };
+    for (std::size_t k = 0; k < 10; k += 2)
+    {
+        linestring_2d ls1, ls2;
+        bg::read_wkt(wkts[k], ls1);
+        bg::read_wkt(wkts[k + 1], ls2);
+        double const d = bg::discrete_frechet_distance(ls1, ls2);
+        BOOST_CHECK_MESSAGE(bg::frechet_distance_below(ls1, ls2, d), wkts[k]);
+        BOOST_CHECK_MESSAGE(bg::frechet_distance_below(ls1, ls2, d + 0.1), wkts[k]);
+        BOOST_CHECK_MESSAGE(! bg::frechet_distance_below(ls1, ls2, d - 0.01), wkts[k]);
+
+        // Comparable distances, the bounding boxes are compared accordingly
+        bg::strategy::distance::comparable::pythagoras<> const comparable;
+        double const c = bg::discrete_frechet_distance(ls1, ls2, comparable);
+        BOOST_CHECK_MESSAGE(bg::frechet_distance_below(ls1, ls2, c, comparable), wkts[k]);
+        BOOST_CHECK_MESSAGE(! bg::frechet_distance_below(ls1, ls2, c * 0.99, comparable), wkts[k]);
+    }
+
+    linestring_2d ls1, ls2;
+    bg::read_wkt("LINESTRING(0 0,0.6 0)", ls1);
+    bg::read_wkt("LINESTRING(0 0,0 0)", ls2);
+    bg::strategy::distance::comparable::pythagoras<> const comparable;
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls1, ls2, comparable), 0.36, 1e-9);
+    BOOST_CHECK(bg::frechet_distance_below(ls1, ls2, 0.49, comparable));
+    BOOST_CHECK(! bg::frechet_distance_below(ls1, ls2, 0.35, comparable));
+}
+
 int test_main(int, char* [])
 {
+    test_long_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
+    test_below_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
+
     //Cartesian Coordinate System
     test_all_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
 
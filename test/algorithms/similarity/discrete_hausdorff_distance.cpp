@@ -13,6 +13,8 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
+#include <utility>
 #include <vector>
 
 #include <boost/geometry/geometries/linestring.hpp>
@@ -21,6 +23,8 @@
 #include <boost/geometry/geometries/multi_linestring.hpp>
 #include <boost/geometry/geometries/multi_point.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include "test_hausdorff_distance.hpp"
 
     template <typename P>
@@ -99,12 +103,110 @@ void test_all_spherical_equ()
     test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0,3 4,4 3)","LINESTRING(4 3,3 4,0 0)",0);
 }
 
+template <typename Range1, typename Range2>
+double hausdorff_reference(Range1 const& r1, Range2 const& r2)
+{
+    double result = 0;
+    for (std::size_t i = 0; i < r1.size(); ++i)
+    {
+        double nearest = bg::distance(r1[i], r2[0]);
+        for (std::size_t j = 1; j < r2.size(); ++j)
+        {
+            nearest = (std::min)(nearest, double(bg::distance(r1[i], r2[j])));
+        }
+        result = (std::max)(result, nearest);
+    }
+    return result;
+}
+
+// A wavy track and a reference track of scattered points along it
+template <typename P>
+void test_long_cartesian()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+    typedef bg::model::multi_point<P> mpoint_t;
+    typedef bg::model::multi_linestring<linestring_2d> mlinestring_t;
+    typedef bg::strategy::distance::pythagoras<> strategy_type;
+    namespace bgi = bg::index;
+
+    linestring_2d track;
+    for (int i = 0; i < 2000; ++i)
+    {
+        double const x = i * 0.05;
+        track.push_back(P(x, std::sin(x) + 0.01 * (i % 7)));
+    }
+    linestring_2d reference;
+    for (int i = 0; i < 1500; ++i)
+    {
+        double const x = (i * 37 % 1500) * 0.0667;
+        reference.push_back(P(x, std::cos(x) * 0.5 + 0.02 * (i % 5)));
+    }
+
+    double const expected = hausdorff_reference(track, reference);
+    strategy_type const strategy;
+
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(track, reference), expected);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(track, reference, strategy,
+                        bg::execution::parallel_policy(3, 100)), expected);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(reference, track, strategy,
+                        bg::execution::parallel_policy(4, 1)),
+                      hausdorff_reference(reference, track));
+
+    // Multi geometries pass the policy on
+    mlinestring_t tracks;
+    tracks.push_back(track);
+    tracks.push_back(reference);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(tracks, tracks, strategy,
+                        bg::execution::parallel_policy(2, 10)),
+                      bg::discrete_hausdorff_distance(tracks, tracks));
+
+    // A reference set indexed once, compared to several tracks
+    bgi::rtree<P, bgi::linear<4> > const rtree(reference);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(track, rtree), expected);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(track, rtree, strategy,
+                        bg::execution::parallel_policy(3, 100)), expected);
+    linestring_2d shifted = track;
+    for (std::size_t i = 0; i < shifted.size(); ++i)
+    {
+        bg::set<1>(shifted[i], bg::get<1>(shifted[i]) + 0.25);
+    }
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(shifted, rtree, strategy),
+                      hausdorff_reference(shifted, reference));
+
+    std::vector<std::pair<P, int> > values;
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        values.push_back(std::make_pair(reference[i], int(i)));
+    }
+    bgi::rtree<std::pair<P, int>, bgi::quadratic<16> > const pairs(values);
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(track, pairs), expected);
+
+    // Equal distances, on a grid
+    mpoint_t grid, centers;
+    for (int i = 0; i < 40; ++i)
+    {
+        for (int j = 0; j < 40; ++j)
+        {
+            grid.push_back(P(i, j));
+            centers.push_back(P(i + 0.5, j + 0.5));
+        }
+    }
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(centers, grid, strategy,
+                        bg::execution::parallel_policy(4, 50)),
+                      std::sqrt(0.5));
+
+    bgi::rtree<P, bgi::linear<4> > const empty;
+    BOOST_CHECK_THROW(bg::discrete_hausdorff_distance(track, empty),
+                      bg::empty_input_exception);
+}
+
 int test_main(int, char* [])
 {
     //Cartesian Coordinate System
     test_all_cartesian<bg::model::d2::point_xy<int,bg::cs::cartesian> >();
     test_all_cartesian<bg::model::d2::point_xy<float,bg::cs::cartesian> >();
     test_all_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
+    test_long_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
 
     //Geographic Coordinate System
     test_all_geographic<bg::model::d2::point_xy<float,bg::cs::geographic<bg::degree> > >();
@@ -0,0 +1,94 @@
+// Boost.Geometry
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/approximated_projection.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::box<point_ll> box_ll;
+typedef bg::model::multi_point<point_ll> mpoint_ll;
+typedef bg::model::multi_point<point_xy> mpoint_xy;
+
+typedef boost::chrono::steady_clock clock_type;
+typedef boost::chrono::duration<double> duration_type;
+
+template <typename Projection>
+double points_per_second(Projection const& prj, mpoint_ll const& in, mpoint_xy & out)
+{
+    clock_type::time_point start = clock_type::now();
+    prj.forward(in, out);
+    duration_type time = clock_type::now() - start;
+    return double(boost::size(in)) / time.count();
+}
+
+void benchmark(std::string const& name, std::string const& proj4,
+               box_ll const& box, double max_error, std::size_t count)
+{
+    typedef bg::srs::projection<> projection_type;
+    typedef bg::srs::approximated_projection<projection_type> approx_type;
+
+    projection_type prj = bg::srs::proj4(proj4);
+
+    boost::mt19937 rng(1);
+    boost::uniform_real<double> lon(bg::get<bg::min_corner, 0>(box), bg::get<bg::max_corner, 0>(box));
+    boost::uniform_real<double> lat(bg::get<bg::min_corner, 1>(box), bg::get<bg::max_corner, 1>(box));
+    mpoint_ll points;
+    points.reserve(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        points.push_back(point_ll(lon(rng), lat(rng)));
+    }
+
+    clock_type::time_point start = clock_type::now();
+    approx_type approx(prj, box, max_error);
+    duration_type build_time = clock_type::now() - start;
+
+    mpoint_xy exact, approximated;
+    double const exact_pps = points_per_second(prj, points, exact);
+    double const approx_pps = points_per_second(approx, points, approximated);
+
+    double max_diff = 0;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        max_diff = (std::max)(max_diff, bg::distance(exact[i], approximated[i]));
+    }
+
+    std::cout << name
+              << " nodes: " << approx.data().nodes.size()
+              << " build[s]: " << build_time.count()
+              << " exact[pt/s]: " << exact_pps
+              << " approximated[pt/s]: " << approx_pps
+              << " speedup: " << approx_pps / exact_pps
+              << " max error: " << max_diff
+              << std::endl;
+}
+
+int main()
+{
+    std::size_t const count = 1000000;
+
+    benchmark("etmerc", "+proj=etmerc +ellps=WGS84 +lon_0=15 +units=m",
+              box_ll(point_ll(12, 45), point_ll(18, 55)), 0.01, count);
+    benchmark("lcc", "+proj=lcc +ellps=GRS80 +lat_1=49 +lat_2=44 +lat_0=46.5 +lon_0=3 +x_0=700000 +y_0=6600000 +units=m",
+              box_ll(point_ll(-5, 41), point_ll(10, 52)), 0.01, count);
+    benchmark("omerc", "+proj=omerc +ellps=WGS84 +lat_0=4 +lonc=115 +alpha=53.31 +k=0.99984 +x_0=590476.87 +y_0=442857.65 +units=m",
+              box_ll(point_ll(109, 0), point_ll(120, 8)), 0.01, count);
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+// Boost.Geometry
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of writing points as CSV. The results are written
+// to the standard output as CSV:
+//
+//   writer,points/s,MB/s,speedup
+//
+// writer is one of:
+//   stream       - std::ostringstream with precision 17 and bg::dsv() per point
+//   stream_fixed - std::ostringstream with std::fixed and precision 7
+//   to_dsv       - bg::to_dsv() per point into one std::string
+//   to_dsv_rows  - bg::to_dsv_rows() of all points into one std::string
+//   to_dsv_rows_17 - bg::to_dsv_rows() with 17 significant digits
+// The suffix _rounded denotes coordinates rounded to 7 decimals. The speedup
+// is relative to the stream writer of the same coordinates.
+//
+// Usage:
+//   dsv_write [count]
+//
+// count is the number of points written in each run (default 1000000).
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+
+typedef boost::chrono::steady_clock clock_type;
+typedef boost::chrono::duration<double> duration_type;
+
+static const std::size_t runs = 3;
+
+std::vector<point_type> make_points(std::size_t count, bool rounded)
+{
+    boost::mt19937 rng(1);
+    boost::uniform_real<double> dist(-180.0, 180.0);
+    std::vector<point_type> result;
+    result.reserve(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double x = dist(rng), y = dist(rng) / 2.0;
+        if (rounded)
+        {
+            x = std::floor(x * 1e7 + 0.5) / 1e7;
+            y = std::floor(y * 1e7 + 0.5) / 1e7;
+        }
+        result.push_back(point_type(x, y));
+    }
+    return result;
+}
+
+struct stream_writer
+{
+    static std::size_t apply(std::vector<point_type> const& points)
+    {
+        std::ostringstream out;
+        out << std::setprecision(17);
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+        {
+            out << bg::dsv(points[i], ",", "", "", "", "", "", "") << '\n';
+        }
+        return out.str().size();
+    }
+};
+
+struct stream_fixed_writer
+{
+    static std::size_t apply(std::vector<point_type> const& points)
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(7);
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+        {
+            out << bg::dsv(points[i], ",", "", "", "", "", "", "") << '\n';
+        }
+        return out.str().size();
+    }
+};
+
+struct to_dsv_writer
+{
+    static std::size_t apply(std::vector<point_type> const& points)
+    {
+        std::string str;
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+        {
+            bg::to_dsv(points[i], str, ",", "", "", "", "", "", "");
+            str += '\n';
+        }
+        return str.size();
+    }
+};
+
+struct to_dsv_rows_writer
+{
+    static std::size_t apply(std::vector<point_type> const& points)
+    {
+        std::string str;
+        bg::to_dsv_rows(points, str);
+        return str.size();
+    }
+};
+
+struct to_dsv_rows_17_writer
+{
+    static std::size_t apply(std::vector<point_type> const& points)
+    {
+        std::string str;
+        bg::to_dsv_rows(points, str, 17);
+        return str.size();
+    }
+};
+
+// Returns the number of points per second
+template <typename Writer>
+double benchmark(std::string const& name, std::vector<point_type> const& points,
+                 double reference)
+{
+    double best = 0;
+    std::size_t bytes = 0;
+    for (std::size_t r = 0 ; r < runs ; ++r)
+    {
+        clock_type::time_point const start = clock_type::now();
+        bytes = Writer::apply(points);
+        double const time = duration_type(clock_type::now() - start).count();
+        if (r == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+
+    if (bytes == 0 || best <= 0)
+    {
+        std::cerr << "no results for " << name << std::endl;
+        return 0;
+    }
+
+    double const rate = double(points.size()) / best;
+    std::cout << name << ','
+              << rate << ','
+              << double(bytes) / best / 1e6 << ','
+              << (reference > 0 ? rate / reference : 1.0)
+              << std::endl;
+    return rate;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t const count = argc > 1 ? std::size_t(std::atol(argv[1])) : 1000000;
+
+    std::cout << "writer,points/s,MB/s,speedup" << std::endl;
+
+    std::vector<point_type> const points = make_points(count, false);
+    double const stream = benchmark<stream_writer>("stream", points, 0);
+    benchmark<to_dsv_writer>("to_dsv", points, stream);
+    benchmark<to_dsv_rows_writer>("to_dsv_rows", points, stream);
+    benchmark<to_dsv_rows_17_writer>("to_dsv_rows_17", points, stream);
+
+    std::vector<point_type> const rounded = make_points(count, true);
+    double const stream_rounded = benchmark<stream_writer>("stream_rounded", rounded, 0);
+    benchmark<stream_fixed_writer>("stream_fixed_rounded", rounded, stream_rounded);
+    benchmark<to_dsv_writer>("to_dsv_rounded", rounded, stream_rounded);
+    benchmark<to_dsv_rows_writer>("to_dsv_rows_rounded", rounded, stream_rounded);
+
+    return 0;
+}
@@ -0,0 +1,375 @@
+// Boost.Geometry
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of forward and inverse projections and of
+// transformations. The results are written to the standard output as CSV:
+//
+//   kind,name,direction,init[us],points/s
+//
+// kind is one of: proj4, dpar, spar, epsg, transformation, transformation_grids
+// init is the average time of construction of the projection or transformation.
+//
+// Usage:
+//   projections [count [grid_file]]
+//
+// count is the number of points projected in each run (default 100000).
+// If grid_file (e.g. conus or ntv1_can.dat) is passed, transformations using
+// this grid (+nadgrids) are also measured. The grid is searched relative to
+// the current directory.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+#include <srs/projection_selftest_cases.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::box<point_ll> box_ll;
+typedef bg::model::multi_point<point_ll> mpoint_ll;
+typedef bg::model::multi_point<point_xy> mpoint_xy;
+
+typedef boost::chrono::steady_clock clock_type;
+typedef boost::chrono::duration<double> duration_type;
+
+static const std::size_t runs = 3;
+static const std::size_t init_runs = 100;
+
+void print_result(std::string const& kind, std::string const& name,
+                  std::string const& direction, double init_time,
+                  double points_per_second)
+{
+    std::cout << kind << ','
+              << name << ','
+              << direction << ','
+              << init_time * 1e6 << ','
+              << points_per_second
+              << std::endl;
+}
+
+// Points generated by scaling the points in [first, last) by a random factor
+template <typename MultiPoint, typename Point>
+MultiPoint make_points(Point const* first, Point const* last, std::size_t count)
+{
+    typedef typename boost::range_value<MultiPoint>::type point_type;
+
+    boost::mt19937 rng(1);
+    boost::uniform_real<double> factor(0.5, 1.5);
+    std::size_t const n = std::size_t(last - first);
+
+    MultiPoint result;
+    result.reserve(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        Point const& p = first[i % n];
+        result.push_back(point_type(bg::get<0>(p) * factor(rng),
+                                    bg::get<1>(p) * factor(rng)));
+    }
+    return result;
+}
+
+mpoint_ll make_points(box_ll const& box, std::size_t count)
+{
+    boost::mt19937 rng(1);
+    boost::uniform_real<double> lon(bg::get<bg::min_corner, 0>(box), bg::get<bg::max_corner, 0>(box));
+    boost::uniform_real<double> lat(bg::get<bg::min_corner, 1>(box), bg::get<bg::max_corner, 1>(box));
+
+    mpoint_ll result;
+    result.reserve(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        result.push_back(point_ll(lon(rng), lat(rng)));
+    }
+    return result;
+}
+
+// Best throughput of several runs
+template <typename Projection, typename In, typename Out>
+double forward_points_per_second(Projection const& prj, In const& in, Out & out)
+{
+    double best = 0;
+    for (std::size_t i = 0 ; i < runs ; ++i)
+    {
+        clock_type::time_point start = clock_type::now();
+        prj.forward(in, out);
+        duration_type time = clock_type::now() - start;
+        best = (std::max)(best, double(boost::size(in)) / time.count());
+    }
+    return best;
+}
+
+template <typename Projection, typename In, typename Out>
+double inverse_points_per_second(Projection const& prj, In const& in, Out & out)
+{
+    double best = 0;
+    for (std::size_t i = 0 ; i < runs ; ++i)
+    {
+        clock_type::time_point start = clock_type::now();
+        prj.inverse(in, out);
+        duration_type time = clock_type::now() - start;
+        best = (std::max)(best, double(boost::size(in)) / time.count());
+    }
+    return best;
+}
+
+template <typename Projection, typename Parameters>
+double init_time(Parameters const& parameters)
+{
+    clock_type::time_point start = clock_type::now();
+    for (std::size_t i = 0 ; i < init_runs ; ++i)
+    {
+        Projection prj(parameters);
+        boost::ignore_unused(prj);
+    }
+    duration_type time = clock_type::now() - start;
+    return time.count() / double(init_runs);
+}
+
+template <typename Projection>
+double init_time()
+{
+    clock_type::time_point start = clock_type::now();
+    for (std::size_t i = 0 ; i < init_runs ; ++i)
+    {
+        Projection prj;
+        boost::ignore_unused(prj);
+    }
+    duration_type time = clock_type::now() - start;
+    return time.count() / double(init_runs);
+}
+
+template <typename Projection>
+void benchmark_projection(std::string const& kind, std::string const& name,
+                          Projection const& prj, double init,
+                          mpoint_ll const& points_ll)
+{
+    mpoint_xy points_xy;
+    print_result(kind, name, "forward", init,
+                 forward_points_per_second(prj, points_ll, points_xy));
+
+    mpoint_ll points_ll_out;
+    try
+    {
+        print_result(kind, name, "inverse", init,
+                     inverse_points_per_second(prj, points_xy, points_ll_out));
+    }
+    catch (bg::projection_not_invertible_exception const& )
+    {}
+}
+
+// All of the projections, with dynamic parameters defined by proj4 strings
+void benchmark_proj4(std::size_t count)
+{
+    std::size_t const n = sizeof(projection_cases) / sizeof(projection_case);
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        projection_case const& pc = projection_cases[i];
+
+        std::size_t fwd_n = 0, inv_n = 0;
+        while (fwd_n < 4 && bg::get<0>(pc.fwd_expect[fwd_n]) != HUGE_VAL)
+            ++fwd_n;
+        while (inv_n < 4 && bg::get<0>(pc.inv_expect[inv_n]) != HUGE_VAL)
+            ++inv_n;
+
+        try
+        {
+            bg::srs::proj4 const parameters(pc.args);
+            bg::srs::projection<> prj(parameters);
+            double const init = init_time<bg::srs::projection<> >(parameters);
+
+            if (fwd_n > 0)
+            {
+                mpoint_ll in = make_points<mpoint_ll>(pc.fwd_in, pc.fwd_in + fwd_n, count);
+                mpoint_xy out;
+                print_result("proj4", pc.id, "forward", init,
+                             forward_points_per_second(prj, in, out));
+            }
+
+            if (inv_n > 0)
+            {
+                mpoint_xy in = make_points<mpoint_xy>(pc.inv_in, pc.inv_in + inv_n, count);
+                mpoint_ll out;
+                print_result("proj4", pc.id, "inverse", init,
+                             inverse_points_per_second(prj, in, out));
+            }
+        }
+        catch (bg::projection_exception const& e)
+        {
+            std::cerr << pc.id << ": " << e.what() << std::endl;
+        }
+    }
+}
+
+// The same coordinate systems defined with static and dynamic parameters
+template <int Code>
+void benchmark_epsg(std::string const& proj4, box_ll const& box,
+                    std::size_t count)
+{
+    typedef bg::srs::projection<> dynamic_projection;
+    typedef bg::srs::projection<bg::srs::static_epsg<Code> > static_projection;
+
+    mpoint_ll const points = make_points(box, count);
+    std::string const name = "EPSG:" + boost::lexical_cast<std::string>(Code);
+
+    {
+        bg::srs::proj4 const parameters(proj4);
+        benchmark_projection("proj4", name, dynamic_projection(parameters),
+                             init_time<dynamic_projection>(parameters),
+                             points);
+    }
+    {
+        bg::srs::dpar::parameters<> const parameters
+            = bg::projections::detail::epsg_to_parameters(Code);
+        benchmark_projection("dpar", name, dynamic_projection(parameters),
+                             init_time<dynamic_projection>(parameters),
+                             points);
+    }
+    {
+        bg::srs::epsg const parameters(Code);
+        benchmark_projection("epsg", name, dynamic_projection(parameters),
+                             init_time<dynamic_projection>(parameters),
+                             points);
+    }
+    {
+        benchmark_projection("spar", name, static_projection(),
+                             init_time<static_projection>(),
+                             points);
+    }
+}
+
+template <typename MultiPointOut, typename Grids>
+void benchmark_transformation(std::string const& kind, std::string const& name,
+                              bg::srs::transformation<> const& tr,
+                              Grids const& grids, double init,
+                              mpoint_ll const& points)
+{
+    MultiPointOut out1;
+    mpoint_ll out2;
+
+    double best = 0;
+    for (std::size_t i = 0 ; i < runs ; ++i)
+    {
+        clock_type::time_point start = clock_type::now();
+        tr.forward(points, out1, grids);
+        duration_type time = clock_type::now() - start;
+        best = (std::max)(best, double(boost::size(points)) / time.count());
+    }
+    print_result(kind, name, "forward", init, best);
+
+    best = 0;
+    for (std::size_t i = 0 ; i < runs ; ++i)
+    {
+        clock_type::time_point start = clock_type::now();
+        tr.inverse(out1, out2, grids);
+        duration_type time = clock_type::now() - start;
+        best = (std::max)(best, double(boost::size(points)) / time.count());
+    }
+    print_result(kind, name, "inverse", init, best);
+}
+
+double transformation_init_time(bg::srs::proj4 const& from,
+                                bg::srs::proj4 const& to)
+{
+    clock_type::time_point start = clock_type::now();
+    for (std::size_t i = 0 ; i < init_runs ; ++i)
+    {
+        bg::srs::transformation<> tr(from, to);
+        boost::ignore_unused(tr);
+    }
+    duration_type time = clock_type::now() - start;
+    return time.count() / double(init_runs);
+}
+
+template <typename MultiPointOut>
+void benchmark_transformation(std::string const& name,
+                              std::string const& from, std::string const& to,
+                              box_ll const& box, std::size_t count)
+{
+    bg::srs::proj4 const from_par(from), to_par(to);
+    bg::srs::transformation<> tr(from_par, to_par);
+
+    benchmark_transformation<MultiPointOut>("transformation", name, tr,
+                             bg::srs::transformation_grids<bg::srs::detail::empty_grids_storage>(),
+                             transformation_init_time(from_par, to_par),
+                             make_points(box, count));
+}
+
+void benchmark_transformation_grids(std::string const& name,
+                                    std::string const& from, std::string const& to,
+                                    box_ll const& box, std::size_t count)
+{
+    bg::srs::proj4 const from_par(from), to_par(to);
+    bg::srs::transformation<> tr(from_par, to_par);
+
+    // The grids are loaded once, the initialization time doesn't include it
+    bg::srs::grids_storage<> storage;
+    bg::srs::transformation_grids<bg::srs::grids_storage<> > grids
+        = tr.initialize_grids(storage);
+
+    benchmark_transformation<mpoint_ll>("transformation_grids", name, tr, grids,
+                             transformation_init_time(from_par, to_par),
+                             make_points(box, count));
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t const count = argc > 1
+                            ? boost::lexical_cast<std::size_t>(argv[1])
+                            : 100000;
+
+    std::cout << "kind,name,direction,init[us],points/s" << std::endl;
+
+    benchmark_proj4(count);
+
+    benchmark_epsg<2180>("+proj=tmerc +lat_0=0 +lon_0=19 +k=0.9993 +x_0=500000 +y_0=-5300000 +ellps=GRS80 +units=m +no_defs",
+                         box_ll(point_ll(14, 49), point_ll(24, 55)), count);
+    benchmark_epsg<2154>("+proj=lcc +lat_1=49 +lat_2=44 +lat_0=46.5 +lon_0=3 +x_0=700000 +y_0=6600000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+                         box_ll(point_ll(-5, 41), point_ll(10, 52)), count);
+    benchmark_epsg<3035>("+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000 +ellps=GRS80 +units=m +no_defs",
+                         box_ll(point_ll(-10, 35), point_ll(30, 70)), count);
+    benchmark_epsg<32633>("+proj=utm +zone=33 +ellps=WGS84 +datum=WGS84 +units=m +no_defs",
+                          box_ll(point_ll(12, 0), point_ll(18, 80)), count);
+    benchmark_epsg<27700>("+proj=tmerc +lat_0=49 +lon_0=-2 +k=0.9996012717 +x_0=400000 +y_0=-100000 +ellps=airy +datum=OSGB36 +units=m +no_defs",
+                          box_ll(point_ll(-8, 50), point_ll(2, 60)), count);
+
+    benchmark_transformation<mpoint_ll>("WGS84>OSGB36",
+                             "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs",
+                             "+proj=longlat +ellps=airy +datum=OSGB36 +no_defs",
+                             box_ll(point_ll(-8, 50), point_ll(2, 60)), count);
+    benchmark_transformation<mpoint_xy>("WGS84>EPSG:27700",
+                             "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs",
+                             "+proj=tmerc +lat_0=49 +lon_0=-2 +k=0.9996012717 +x_0=400000 +y_0=-100000 +ellps=airy +datum=OSGB36 +units=m +no_defs",
+                             box_ll(point_ll(-8, 50), point_ll(2, 60)), count);
+
+    if (argc > 2)
+    {
+        std::string const grid = argv[2];
+        try
+        {
+            benchmark_transformation_grids("WGS84>" + grid,
+                                           "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs",
+                                           "+proj=longlat +ellps=clrk66 +nadgrids=" + grid + " +no_defs",
+                                           box_ll(point_ll(-120, 30), point_ll(-75, 48)), count);
+        }
+        catch (bg::projection_exception const& e)
+        {
+            std::cerr << grid << ": " << e.what() << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+// Boost.Geometry
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of read_wkt. The results are written to the
+// standard output as CSV:
+//
+//   geometry,reader,geometries/s,MB/s
+//
+// reader is one of:
+//   read_wkt  - the reader of Boost.Geometry
+//   tokenizer - splitting of the same strings with boost::tokenizer and
+//               conversion of the coordinates with lexical_cast, which was
+//               the way read_wkt worked before, without building geometries
+//
+// Usage:
+//   wkt_read [count]
+//
+// count is the number of WKT strings of each kind (default 10000).
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random.hpp>
+#include <boost/tokenizer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+typedef boost::chrono::steady_clock clock_type;
+typedef boost::chrono::duration<double> duration_type;
+
+static const std::size_t runs = 3;
+
+void print_result(std::string const& geometry, std::string const& reader,
+                  double geometries_per_second, double megabytes_per_second)
+{
+    std::cout << geometry << ','
+              << reader << ','
+              << geometries_per_second << ','
+              << megabytes_per_second
+              << std::endl;
+}
+
+// Coordinates written with full precision like in exported data
+class coordinate_generator
+{
+public:
+    coordinate_generator()
+        : m_rng(1), m_dist(-180.0, 180.0)
+    {}
+
+    void append(std::ostringstream& out, std::size_t count, bool closed)
+    {
+        double const x0 = m_dist(m_rng), y0 = m_dist(m_rng) / 2.0;
+        out << '(';
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            if (i > 0)
+            {
+                out << ',';
+            }
+            if (closed && i + 1 == count)
+            {
+                out << x0 << ' ' << y0;
+            }
+            else
+            {
+                out << x0 + m_dist(m_rng) / 1000.0 << ' '
+                    << y0 + m_dist(m_rng) / 1000.0;
+            }
+        }
+        out << ')';
+    }
+
+private:
+    boost::mt19937 m_rng;
+    boost::uniform_real<double> m_dist;
+};
+
+std::vector<std::string> make_wkts(std::string const& kind, std::size_t count)
+{
+    coordinate_generator generator;
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        std::ostringstream out;
+        out << std::setprecision(17);
+        if (kind == "point")
+        {
+            out << "POINT";
+            generator.append(out, 1, false);
+        }
+        else if (kind == "linestring")
+        {
+            out << "LINESTRING";
+            generator.append(out, 100, false);
+        }
+        else if (kind == "polygon")
+        {
+            out << "POLYGON(";
+            generator.append(out, 200, true);
+            out << ',';
+            generator.append(out, 20, true);
+            out << ')';
+        }
+        else
+        {
+            out << "MULTIPOLYGON(";
+            for (std::size_t j = 0 ; j < 10 ; ++j)
+            {
+                out << (j > 0 ? ",(" : "(");
+                generator.append(out, 50, true);
+                out << ')';
+            }
+            out << ')';
+        }
+        result.push_back(out.str());
+    }
+    return result;
+}
+
+template <typename Geometry>
+struct read_wkt_reader
+{
+    static std::size_t apply(std::string const& wkt)
+    {
+        Geometry geometry;
+        bg::read_wkt(wkt, geometry);
+        return bg::num_points(geometry);
+    }
+};
+
+struct tokenizer_reader
+{
+    static std::size_t apply(std::string const& wkt)
+    {
+        typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
+        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        std::size_t count = 0;
+        for (tokenizer::iterator it = tokens.begin() ; it != tokens.end() ; ++it)
+        {
+            char const c = (*it)[0];
+            if ((c >= '0' && c <= '9') || c == '-' || c == '.')
+            {
+                boost::lexical_cast<double>(*it);
+                ++count;
+            }
+        }
+        return count / 2;
+    }
+};
+
+template <typename Reader>
+void benchmark(std::string const& kind, std::string const& name,
+               std::vector<std::string> const& wkts)
+{
+    std::size_t bytes = 0;
+    for (std::size_t i = 0 ; i < wkts.size() ; ++i)
+    {
+        bytes += wkts[i].size();
+    }
+
+    double best = 0;
+    std::size_t points = 0;
+    for (std::size_t r = 0 ; r < runs ; ++r)
+    {
+        points = 0;
+        clock_type::time_point const start = clock_type::now();
+        for (std::size_t i = 0 ; i < wkts.size() ; ++i)
+        {
+            points += Reader::apply(wkts[i]);
+        }
+        double const time = duration_type(clock_type::now() - start).count();
+        if (r == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+
+    if (points == 0 || best <= 0)
+    {
+        std::cerr << "no results for " << kind << ',' << name << std::endl;
+        return;
+    }
+
+    print_result(kind, name, double(wkts.size()) / best,
+                 double(bytes) / best / 1e6);
+}
+
+template <typename Geometry>
+void benchmark(std::string const& kind, std::size_t count)
+{
+    std::vector<std::string> const wkts = make_wkts(kind, count);
+    benchmark<read_wkt_reader<Geometry> >(kind, "read_wkt", wkts);
+    benchmark<tokenizer_reader>(kind, "tokenizer", wkts);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t const count = argc > 1 ? std::size_t(std::atol(argv[1])) : 10000;
+
+    std::cout << "geometry,reader,geometries/s,MB/s" << std::endl;
+
+    benchmark<point_type>("point", count * 100);
+    benchmark<linestring_type>("linestring", count);
+    benchmark<polygon_type>("polygon", count);
+    benchmark<multi_polygon_type>("multipolygon", count);
+
+    return 0;
+}
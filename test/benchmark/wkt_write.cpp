@@ -0,0 +1,164 @@
+// Boost.Geometry
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of writing WKT. The results are written to the
+// standard output as CSV:
+//
+//   writer,geometries/s,MB/s
+//
+// writer is one of:
+//   stream       - std::ostringstream with precision 17 and bg::wkt()
+//   stream_fixed - std::ostringstream with std::fixed and precision 7, in which
+//                  case every coordinate is streamed
+//   to_wkt       - bg::to_wkt() with the shortest representation
+//   to_wkt_17    - bg::to_wkt() with 17 significant digits
+// The suffix _rounded denotes coordinates rounded to 7 decimals.
+//
+// Usage:
+//   wkt_write [count]
+//
+// count is the number of polygons written in each run (default 10000).
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+typedef boost::chrono::steady_clock clock_type;
+typedef boost::chrono::duration<double> duration_type;
+
+static const std::size_t runs = 3;
+
+// Polygons with coordinates rounded to 7 decimals (like degrees in
+// exported data) and not rounded
+std::vector<polygon_type> make_polygons(std::size_t count, bool rounded)
+{
+    boost::mt19937 rng(1);
+    boost::uniform_real<double> dist(-180.0, 180.0);
+    std::vector<polygon_type> result(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        bg::model::ring<point_type>& ring = bg::exterior_ring(result[i]);
+        for (std::size_t j = 0 ; j < 100 ; ++j)
+        {
+            double x = dist(rng), y = dist(rng) / 2.0;
+            if (rounded)
+            {
+                x = std::floor(x * 1e7 + 0.5) / 1e7;
+                y = std::floor(y * 1e7 + 0.5) / 1e7;
+            }
+            ring.push_back(point_type(x, y));
+        }
+        ring.push_back(ring.front());
+    }
+    return result;
+}
+
+struct stream_writer
+{
+    static std::size_t apply(polygon_type const& polygon)
+    {
+        std::ostringstream out;
+        out << std::setprecision(17) << bg::wkt(polygon);
+        return out.str().size();
+    }
+};
+
+struct stream_fixed_writer
+{
+    static std::size_t apply(polygon_type const& polygon)
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(7) << bg::wkt(polygon);
+        return out.str().size();
+    }
+};
+
+struct to_wkt_writer
+{
+    static std::size_t apply(polygon_type const& polygon)
+    {
+        std::string str;
+        bg::to_wkt(polygon, str);
+        return str.size();
+    }
+};
+
+struct to_wkt_17_writer
+{
+    static std::size_t apply(polygon_type const& polygon)
+    {
+        std::string str;
+        bg::to_wkt(polygon, str, 17);
+        return str.size();
+    }
+};
+
+template <typename Writer>
+void benchmark(std::string const& name, std::vector<polygon_type> const& polygons)
+{
+    double best = 0;
+    std::size_t bytes = 0;
+    for (std::size_t r = 0 ; r < runs ; ++r)
+    {
+        bytes = 0;
+        clock_type::time_point const start = clock_type::now();
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            bytes += Writer::apply(polygons[i]);
+        }
+        double const time = duration_type(clock_type::now() - start).count();
+        if (r == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+
+    if (bytes == 0 || best <= 0)
+    {
+        std::cerr << "no results for " << name << std::endl;
+        return;
+    }
+
+    std::cout << name << ','
+              << double(polygons.size()) / best << ','
+              << double(bytes) / best / 1e6
+              << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t const count = argc > 1 ? std::size_t(std::atol(argv[1])) : 10000;
+
+    std::cout << "writer,geometries/s,MB/s" << std::endl;
+
+    std::vector<polygon_type> const polygons = make_polygons(count, false);
+    benchmark<stream_writer>("stream", polygons);
+    benchmark<to_wkt_writer>("to_wkt", polygons);
+    benchmark<to_wkt_17_writer>("to_wkt_17", polygons);
+
+    std::vector<polygon_type> const rounded = make_polygons(count, true);
+    benchmark<stream_fixed_writer>("stream_fixed_rounded", rounded);
+    benchmark<stream_writer>("stream_rounded", rounded);
+    benchmark<to_wkt_writer>("to_wkt_rounded", rounded);
+
+    return 0;
+}
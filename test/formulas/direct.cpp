@@ -138,6 +138,53 @@ void test_all(expected_results const& results)
 #endif
 }
 
+template <typename Result>
+void check_same(Result const& result, Result const& expected)
+{
+    double const eps = 1e-12;
+    BOOST_CHECK_SMALL(result.lon2 - expected.lon2, eps);
+    BOOST_CHECK_SMALL(result.lat2 - expected.lat2, eps);
+    BOOST_CHECK_SMALL(result.reverse_azimuth - expected.reverse_azimuth, eps);
+    BOOST_CHECK_SMALL(result.reduced_length - expected.reduced_length,
+                      eps * (1 + bg::math::abs(expected.reduced_length)));
+    BOOST_CHECK_SMALL(result.geodesic_scale - expected.geodesic_scale, eps);
+}
+
+// Points calculated along a line, constructed once, are the same as the
+// solutions of the direct problem
+template <typename Formula, typename Spheroid>
+void test_line(double lon1, double lat1, double distance, double azi12,
+               Spheroid const& spheroid)
+{
+    typename Formula::line const line(lon1, lat1, azi12, spheroid);
+    for (int i = 0; i <= 4; ++i)
+    {
+        double const d = distance * i / 4;
+        check_same(line.apply(d), Formula::apply(lon1, lat1, d, azi12, spheroid));
+    }
+}
+
+void test_lines(expected_results const& results)
+{
+    double const d2r = bg::math::d2r<double>();
+
+    bg::srs::spheroid<double> spheroid(6378137.0, 6356752.3142451793);
+
+    double const lon1r = results.p1.lon * d2r;
+    double const lat1r = results.p1.lat * d2r;
+    double const azi12r = results.azimuth12 * d2r;
+
+    test_line<bg::formula::vincenty_direct<double, true, true, true, true> >
+        (lon1r, lat1r, results.distance, azi12r, spheroid);
+    test_line<bg::formula::thomas_direct<double, true, true, true, true, true> >
+        (lon1r, lat1r, results.distance, azi12r, spheroid);
+    test_line<bg::formula::thomas_direct<double, false, true, true, true, true> >
+        (lon1r, lat1r, results.distance, azi12r, spheroid);
+    test_line<bg::formula::karney_direct<double, true, true, true, true, 8> >
+        (results.p1.lon, results.p1.lat, results.distance, results.azimuth12,
+         spheroid);
+}
+
 void test_karney_antipodal(expected_results_antipodal const& results)
 {
     double lon1d = results.p1.lon;
@@ -160,6 +207,7 @@ int test_main(int, char*[])
     for (size_t i = 0; i < expected_size; ++i)
     {
         test_all(expected[i]);
+        test_lines(expected[i]);
 
         if (expected[i].p1.lon == 0 && expected[i].p1.lat == 0)
         {
@@ -0,0 +1,164 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <vector>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/inverse_batch.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+#include <boost/geometry/util/execution.hpp>
+
+
+template <typename Point>
+std::vector<Point> make_points(std::size_t count, int seed)
+{
+    std::vector<Point> result;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        // deterministic pseudo-random coordinates, including poles,
+        // antipodal and equal points
+        int const k = int(i) * 7919 + seed;
+        double lon = double(k % 361) - 180.0;
+        double lat = double((k / 361) % 181) - 90.0;
+        if (i % 17 == 0)
+        {
+            lat = 90.0;
+        }
+        result.push_back(Point(lon, lat));
+    }
+    return result;
+}
+
+template <typename Result>
+void check_equal(Result const& r1, Result const& r2)
+{
+    BOOST_CHECK_EQUAL(r1.distance, r2.distance);
+    BOOST_CHECK_EQUAL(r1.azimuth, r2.azimuth);
+    BOOST_CHECK_EQUAL(r1.reverse_azimuth, r2.reverse_azimuth);
+    BOOST_CHECK_EQUAL(r1.reduced_length, r2.reduced_length);
+    BOOST_CHECK_EQUAL(r1.geodesic_scale, r2.geodesic_scale);
+}
+
+template <typename Inverse, typename Point>
+typename Inverse::result_type single(Point const& p1, Point const& p2, bool degrees)
+{
+    bg::srs::spheroid<double> const spheroid;
+    double const d2r = bg::math::d2r<double>();
+    double const f = degrees ? 1.0 : d2r;
+    return Inverse::apply(bg::get<0>(p1) * f, bg::get<1>(p1) * f,
+                          bg::get<0>(p2) * f, bg::get<1>(p2) * f,
+                          spheroid);
+}
+
+template <typename Inverse, typename Point>
+void test_inverse(bool degrees)
+{
+    typedef bg::formula::inverse_batch<Inverse> batch;
+    typedef typename batch::result_type result_type;
+
+    bg::srs::spheroid<double> const spheroid;
+
+    std::vector<Point> const points1 = make_points<Point>(200, 1);
+    std::vector<Point> const points2 = make_points<Point>(150, 12345);
+
+    // pairs of points, the results are shortened to the shorter range
+    std::vector<result_type> results;
+    batch::apply(points1, points2, results, spheroid);
+    BOOST_CHECK_EQUAL(results.size(), points2.size());
+    for (std::size_t i = 0 ; i < results.size() ; ++i)
+    {
+        check_equal(results[i], single<Inverse>(points1[i], points2[i], degrees));
+    }
+
+    std::vector<result_type> results_par;
+    batch::apply(points1, points2, results_par, spheroid,
+                 bg::execution::parallel_policy(4, 10));
+    BOOST_CHECK_EQUAL(results_par.size(), results.size());
+    for (std::size_t i = 0 ; i < results.size() ; ++i)
+    {
+        check_equal(results[i], results_par[i]);
+    }
+
+    // distance matrix
+    std::vector<double> matrix;
+    batch::matrix(points1, points2, matrix, spheroid);
+    BOOST_CHECK_EQUAL(matrix.size(), points1.size() * points2.size());
+    for (std::size_t i = 0 ; i < points1.size() ; ++i)
+    {
+        for (std::size_t j = 0 ; j < points2.size() ; ++j)
+        {
+            BOOST_CHECK_EQUAL(matrix[i * points2.size() + j],
+                single<Inverse>(points1[i], points2[j], degrees).distance);
+        }
+    }
+
+    std::vector<double> matrix_par;
+    batch::matrix(points1, points2, matrix_par, spheroid,
+                  bg::execution::parallel_policy(3, 1000));
+    BOOST_CHECK(matrix_par == matrix);
+
+    std::vector<result_type> matrix_res;
+    batch::matrix(points2, points1, matrix_res, spheroid,
+                  bg::execution::parallel_policy(0, 1));
+    BOOST_CHECK_EQUAL(matrix_res.size(), points1.size() * points2.size());
+    check_equal(matrix_res[points1.size() + 3], single<Inverse>(points2[1], points1[3], degrees));
+
+    // empty ranges
+    std::vector<Point> const empty;
+    batch::matrix(empty, points2, matrix, spheroid);
+    BOOST_CHECK(matrix.empty());
+    batch::apply(points1, empty, results, spheroid,
+                 bg::execution::parallel_policy());
+    BOOST_CHECK(results.empty());
+}
+
+template <typename Inverse>
+void test_formula(bool degrees)
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_deg;
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::radian> > point_rad;
+
+    test_inverse<Inverse, point_deg>(degrees);
+
+    // the same results for points in radians
+    std::vector<point_deg> const pts_deg = make_points<point_deg>(50, 3);
+    std::vector<point_rad> pts_rad;
+    for (std::size_t i = 0 ; i < pts_deg.size() ; ++i)
+    {
+        pts_rad.push_back(point_rad(bg::get_as_radian<0>(pts_deg[i]),
+                                    bg::get_as_radian<1>(pts_deg[i])));
+    }
+
+    bg::srs::spheroid<double> const spheroid;
+    std::vector<double> m_deg, m_rad;
+    bg::formula::inverse_batch<Inverse>::matrix(pts_deg, pts_deg, m_deg, spheroid);
+    bg::formula::inverse_batch<Inverse>::matrix(pts_rad, pts_rad, m_rad, spheroid);
+    BOOST_CHECK_EQUAL(m_deg.size(), m_rad.size());
+    for (std::size_t i = 0 ; i < m_deg.size() ; ++i)
+    {
+        BOOST_CHECK_CLOSE(m_deg[i] + 1.0, m_rad[i] + 1.0, 0.0001);
+    }
+}
+
+int test_main(int, char*[])
+{
+    test_formula<bg::formula::andoyer_inverse<double, true, true, true, true, true> >(false);
+    test_formula<bg::formula::thomas_inverse<double, true, true, true, true, true> >(false);
+    test_formula<bg::formula::vincenty_inverse<double, true, true, true, true, true> >(false);
+    test_formula<bg::formula::karney_inverse<double, true, true, true, true, true> >(true);
+    test_formula<bg::formula::vincenty_inverse<double, true, false> >(false);
+
+    return 0;
+}
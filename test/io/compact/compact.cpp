@@ -0,0 +1,251 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/io/compact/compact.hpp>
+#include <boost/geometry/io/wkb/write.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::point<double, 4, bg::cs::cartesian> point4d_type;
+typedef bg::model::point<int, 2, bg::cs::cartesian> point_int_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::box<point_type> box_type;
+
+
+template <typename Geometry>
+std::string wkt_string(Geometry const& geometry)
+{
+    std::string result;
+    bg::to_wkt(geometry, result);
+    return result;
+}
+
+std::string hex(byte_vector const& bytes)
+{
+    static char const digits[] = "0123456789abcdef";
+    std::string result;
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+    {
+        result += digits[bytes[i] >> 4];
+        result += digits[bytes[i] & 0x0f];
+    }
+    return result;
+}
+
+byte_vector bytes(std::string const& hex)
+{
+    byte_vector result;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2)
+    {
+        result.push_back(boost::uint8_t(std::strtol(hex.substr(i, 2).c_str(), 0, 16)));
+    }
+    return result;
+}
+
+template <typename Geometry>
+byte_vector encode(Geometry const& geometry, int precision, bool bbox = false)
+{
+    byte_vector result;
+    BOOST_CHECK(bg::write_compact(geometry, std::back_inserter(result),
+                                  precision, bbox));
+    return result;
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt, int precision,
+                          std::string const& expected_wkt = "",
+                          std::string const& expected_hex = "")
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    byte_vector const result = encode(geometry, precision);
+    if (! expected_hex.empty())
+    {
+        BOOST_CHECK_EQUAL(hex(result), expected_hex);
+    }
+
+    Geometry decoded;
+    BOOST_CHECK(bg::read_compact(result.begin(), result.end(), decoded));
+    BOOST_CHECK_EQUAL(wkt_string(decoded),
+                      expected_wkt.empty() ? wkt_string(geometry) : expected_wkt);
+
+    // With a bounding box
+    byte_vector const with_bbox = encode(geometry, precision, true);
+    Geometry decoded_bbox;
+    BOOST_CHECK(bg::read_compact(with_bbox.begin(), with_bbox.end(), decoded_bbox));
+    BOOST_CHECK_EQUAL(wkt_string(decoded_bbox), wkt_string(decoded));
+
+    // Any truncation is invalid
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        Geometry truncated;
+        BOOST_CHECK(! bg::read_compact(&result[0], i, truncated));
+    }
+}
+
+void test_all()
+{
+    // Examples of the TWKB specification
+    test_geometry<point_type>("POINT(1 1)", 0, "", "01000202");
+    test_geometry<linestring_type>("LINESTRING(1 1,5 5)", 0, "", "02000202020808");
+    test_geometry<point_type>("POINT(1.5 -2.25)", 2, "POINT(1.5 -2.25)");
+
+    test_geometry<point_type>("POINT(1.23456 2)", 2, "POINT(1.23 2)");
+    test_geometry<point_type>("POINT(1234 5678)", -2, "POINT(1200 5700)");
+    test_geometry<point3d_type>("POINT(1.5 2.5 3.5)", 1);
+    test_geometry<point4d_type>("POINT(1.5 2.5 3.5 4.5)", 1);
+    test_geometry<point3d_type>("POINT(1 2 3.7)", -1, "POINT(0 0 4)");
+    test_geometry<point_int_type>("POINT(-3 8)", 0);
+    test_geometry<linestring_type>("LINESTRING(0 0,0.1 0.2,3 4)", 7);
+    test_geometry<linestring_type>("LINESTRING()", 7);
+    test_geometry<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))", 3);
+    test_geometry<polygon_type>("POLYGON(())", 3, "POLYGON(())");
+    test_geometry<multi_point_type>("MULTIPOINT((1 2),(3 4))", 1);
+    test_geometry<multi_point_type>("MULTIPOINT()", 1);
+    test_geometry<multi_linestring_type>("MULTILINESTRING((0 0,1 1),(2 2,3 3))", 5);
+    test_geometry<multi_polygon_type>("MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((5 5,5 6,6 6,5 5),(5 5,5 6,6 6,5 5)))", 0);
+    test_geometry<box_type>("BOX(-1 2,3.5 4)", 1);
+    test_geometry<bg::model::segment<point_type> >("SEGMENT(1 2,3 4)", 0);
+    test_geometry<bg::model::ring<point_type> >("POLYGON((0 0,0 1,1 1,0 0))", 0);
+
+    // Open rings are stored closed
+    {
+        typedef bg::model::polygon<point_type, false, false> open_polygon_type;
+        open_polygon_type open;
+        bg::read_wkt("POLYGON((0 0,1 0,1 1))", open);
+        polygon_type closed;
+        byte_vector const result = encode(open, 0);
+        BOOST_CHECK(bg::read_compact(result.begin(), result.end(), closed));
+        BOOST_CHECK_EQUAL(wkt_string(closed), "POLYGON((0 0,1 0,1 1,0 0))");
+
+        test_geometry<open_polygon_type>("POLYGON((0 0,1 0,1 1))", 0);
+    }
+
+    // 2D data read into 3D points, and the other way round
+    {
+        point3d_type p3;
+        byte_vector const result = encode(point_type(1, 2), 0);
+        BOOST_CHECK(bg::read_compact(result.begin(), result.end(), p3));
+        BOOST_CHECK_EQUAL(wkt_string(p3), "POINT(1 2 0)");
+
+        point_type p;
+        byte_vector const result3 = encode(point3d_type(1, 2, 3), 0);
+        BOOST_CHECK(bg::read_compact(result3.begin(), result3.end(), p));
+        BOOST_CHECK_EQUAL(wkt_string(p), "POINT(1 2)");
+    }
+
+    // Bounding box
+    {
+        linestring_type linestring;
+        bg::read_wkt("LINESTRING(3 -4,1.25 8,-2 0)", linestring);
+        byte_vector const result = encode(linestring, 2, true);
+        box_type box;
+        BOOST_CHECK(bg::read_compact_envelope(result.begin(), result.end(), box));
+        BOOST_CHECK_EQUAL(wkt_string(box), "POLYGON((-2 -4,-2 8,3 8,3 -4,-2 -4))");
+
+        byte_vector const without = encode(linestring, 2);
+        BOOST_CHECK(! bg::read_compact_envelope(without.begin(), without.end(), box));
+    }
+
+    // TWKB with size and identifiers: MULTIPOINT((0 1),(2 3)) with ids 5, 7
+    {
+        multi_point_type multi_point;
+        byte_vector const twkb = bytes("040607020a0e00020404");
+        BOOST_CHECK(bg::read_compact(twkb.begin(), twkb.end(), multi_point));
+        BOOST_CHECK_EQUAL(wkt_string(multi_point), "MULTIPOINT((0 1),(2 3))");
+
+        // Size larger than the data
+        byte_vector const wrong_size = bytes("040608020a0e00020404");
+        BOOST_CHECK(! bg::read_compact(wrong_size.begin(), wrong_size.end(), multi_point));
+    }
+
+    // Invalid
+    {
+        point_type p;
+        linestring_type linestring;
+        byte_vector const result = encode(point_type(1, 2), 0);
+        BOOST_CHECK(! bg::read_compact(result.begin(), result.end(), linestring));
+
+        byte_vector trailing = result;
+        trailing.push_back(0);
+        BOOST_CHECK(! bg::read_compact(trailing.begin(), trailing.end(), p));
+
+        // A count of more points than there are bytes
+        byte_vector const huge = bytes("0200ffffffff0f0202");
+        BOOST_CHECK(! bg::read_compact(huge.begin(), huge.end(), linestring));
+
+        byte_vector out;
+        BOOST_CHECK(! bg::write_compact(p, std::back_inserter(out), 8));
+        BOOST_CHECK(! bg::write_compact(p, std::back_inserter(out), -9));
+        BOOST_CHECK(out.empty());
+
+        double const inf = std::numeric_limits<double>::infinity();
+        BOOST_CHECK(! bg::write_compact(point_type(inf, 0), std::back_inserter(out), 0, true));
+        BOOST_CHECK(out.empty());
+        BOOST_CHECK(! bg::write_compact(point_type(1e15, 0), std::back_inserter(out), 7));
+    }
+}
+
+void test_size()
+{
+    // A polyline of many close points is much smaller than WKB
+    linestring_type linestring;
+    for (int i = 0; i < 1000; ++i)
+    {
+        linestring.push_back(point_type(4.9 + i * 0.00001, 52.3 + (i % 7) * 0.00001));
+    }
+
+    byte_vector compact = encode(linestring, 5);
+    byte_vector wkb;
+    bg::write_wkb(linestring, std::back_inserter(wkb));
+    BOOST_CHECK_LT(compact.size() * 7, wkb.size());
+
+    linestring_type decoded;
+    BOOST_CHECK(bg::read_compact(compact.begin(), compact.end(), decoded));
+    BOOST_CHECK_EQUAL(decoded.size(), linestring.size());
+    for (std::size_t i = 0; i < decoded.size(); ++i)
+    {
+        BOOST_CHECK_CLOSE(bg::get<0>(decoded[i]), bg::get<0>(linestring[i]), 1e-8);
+        BOOST_CHECK_CLOSE(bg::get<1>(decoded[i]), bg::get<1>(linestring[i]), 1e-8);
+    }
+
+    // Also in a std::string
+    std::string buffer;
+    BOOST_CHECK(bg::write_compact(linestring, std::back_inserter(buffer), 5));
+    BOOST_CHECK_EQUAL(buffer.size(), compact.size());
+    BOOST_CHECK(bg::read_compact(buffer.begin(), buffer.end(), decoded));
+}
+
+int test_main(int, char* [])
+{
+    test_all();
+    test_size();
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/dsv/write.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+template <typename Geometry>
+void test_dsv(std::string const& wkt, std::string const& expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::string buffer;
+    bg::to_dsv(geometry, buffer);
+    BOOST_CHECK_EQUAL(buffer, expected);
+
+    // The same as streamed
+    std::ostringstream out;
+    out << std::setprecision(17) << bg::dsv(geometry);
+    BOOST_CHECK_EQUAL(buffer, out.str());
+
+    std::vector<char> chars;
+    bg::to_dsv(geometry, chars, ";", "[", "]", ",", "[", "]", ",");
+    std::ostringstream json;
+    json << std::setprecision(17) << bg::dsv(geometry, ";", "[", "]", ",", "[", "]", ",");
+    BOOST_CHECK_EQUAL(std::string(chars.begin(), chars.end()), json.str());
+}
+
+template <typename T>
+void test_all()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> P;
+
+    test_dsv<P>("POINT(1 2)", "(1, 2)");
+    test_dsv<bg::model::linestring<P> >("LINESTRING(1 1,2 2,3 3)",
+        "((1, 1), (2, 2), (3, 3))");
+    test_dsv<bg::model::polygon<P> >("POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 1))",
+        "(((0, 0), (0, 4), (4, 4), (4, 0), (0, 0)), ((1, 1), (2, 1), (2, 2), (1, 1)))");
+    test_dsv<bg::model::ring<P> >("POLYGON((0 0,0 4,4 4,4 0,0 0))",
+        "((0, 0), (0, 4), (4, 4), (4, 0), (0, 0))");
+    test_dsv<bg::model::box<P> >("BOX(0 0,1 1)", "((0, 0), (1, 1))");
+    test_dsv<bg::model::segment<P> >("SEGMENT(0 0,1 1)", "((0, 0), (1, 1))");
+    test_dsv<bg::model::multi_point<P> >("MULTIPOINT((1 2),(3 4))",
+        "((1, 2), (3, 4))");
+}
+
+void test_precision()
+{
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point_type;
+    point_type const p(0.1, -2.25, 1.0 / 3.0);
+
+    std::string buffer;
+    bg::to_dsv(p, buffer);
+    BOOST_CHECK_EQUAL(buffer, "(0.1, -2.25, 0.3333333333333333)");
+    BOOST_CHECK_EQUAL(std::strtod(buffer.c_str() + buffer.rfind(' '), NULL), 1.0 / 3.0);
+
+    buffer.clear();
+    bg::to_dsv(p, buffer, 4, " ", "", "", "", "", "", "");
+    BOOST_CHECK_EQUAL(buffer, "0.1 -2.25 0.3333");
+
+    std::ostringstream out;
+    out << std::setprecision(4) << bg::dsv(p, " ", "", "", "", "", "", "");
+    BOOST_CHECK_EQUAL(buffer, out.str());
+}
+
+void test_rows()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+
+    std::vector<point_type> points;
+    points.push_back(point_type(4.9, 52.3));
+    points.push_back(point_type(-0.125, 1e-7));
+    points.push_back(point_type(180, -90));
+
+    std::string buffer = "x,y\n";
+    bg::to_dsv_rows(points, buffer);
+    BOOST_CHECK_EQUAL(buffer, "x,y\n4.9,52.3\n-0.125,0.0000001\n180,-90\n");
+
+    buffer.clear();
+    bg::to_dsv_rows(points, buffer, 2, "\t", "\r\n");
+    BOOST_CHECK_EQUAL(buffer, "4.9\t52\r\n-0.12\t1e-07\r\n1.8e+02\t-90\r\n");
+
+    buffer.clear();
+    bg::to_dsv_rows(std::vector<point_type>(), buffer);
+    BOOST_CHECK(buffer.empty());
+
+    // A linestring is a range of points as well
+    bg::model::linestring<point_type> linestring(points.begin(), points.end());
+    std::vector<char> chars;
+    bg::to_dsv_rows(linestring, chars, ";", "|");
+    BOOST_CHECK_EQUAL(std::string(chars.begin(), chars.end()),
+                      "4.9;52.3|-0.125;0.0000001|180;-90|");
+}
+
+int test_main(int, char* [])
+{
+    test_all<double>();
+    test_all<int>();
+    test_precision();
+    test_rows();
+
+    return 0;
+}
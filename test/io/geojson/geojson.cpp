@@ -0,0 +1,275 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/register/point.hpp>
+
+#include <boost/geometry/io/geojson/geojson.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+struct custom_point
+{
+    double x, y;
+};
+
+BOOST_GEOMETRY_REGISTER_POINT_2D(custom_point, double, cs::cartesian, x, y)
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+template <typename Geometry>
+std::string wkt_string(Geometry const& geometry)
+{
+    std::string result;
+    bg::to_wkt(geometry, result);
+    return result;
+}
+
+template <typename Geometry>
+std::string geojson_string(Geometry const& geometry)
+{
+    std::string result;
+    bg::to_geojson(geometry, result);
+    return result;
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt, std::string const& geojson)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    BOOST_CHECK_EQUAL(geojson_string(geometry), geojson);
+
+    Geometry copy;
+    BOOST_CHECK(bg::read_geojson(geojson, copy));
+    BOOST_CHECK_EQUAL(wkt_string(copy), wkt_string(geometry));
+}
+
+template <typename Geometry>
+void test_read(std::string const& geojson, std::string const& wkt,
+               bool expected_result = true)
+{
+    Geometry geometry;
+    BOOST_CHECK_EQUAL(bg::read_geojson(geojson, geometry), expected_result);
+    BOOST_CHECK_EQUAL(wkt_string(geometry), wkt);
+}
+
+template <typename Geometry>
+void test_read_failure(std::string const& geojson)
+{
+    Geometry geometry;
+    BOOST_CHECK_THROW(bg::read_geojson(geojson, geometry), bg::read_geojson_exception);
+}
+
+void test_all()
+{
+    test_geometry<point_type>("POINT(1 2.5)",
+        "{\"type\":\"Point\",\"coordinates\":[1,2.5]}");
+    test_geometry<point3d_type>("POINT(1 2 -3)",
+        "{\"type\":\"Point\",\"coordinates\":[1,2,-3]}");
+    test_geometry<linestring_type>("LINESTRING(0 0,0.1 0.2,3 4)",
+        "{\"type\":\"LineString\",\"coordinates\":[[0,0],[0.1,0.2],[3,4]]}");
+    test_geometry<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))",
+        "{\"type\":\"Polygon\",\"coordinates\":[[[0,0],[0,10],[10,10],[10,0],[0,0]],"
+        "[[2,2],[4,2],[4,4],[2,2]]]}");
+    test_geometry<multi_point_type>("MULTIPOINT((1 2),(3 4))",
+        "{\"type\":\"MultiPoint\",\"coordinates\":[[1,2],[3,4]]}");
+    test_geometry<multi_linestring_type>("MULTILINESTRING((0 0,1 1),(2 2,3 3))",
+        "{\"type\":\"MultiLineString\",\"coordinates\":[[[0,0],[1,1]],[[2,2],[3,3]]]}");
+    test_geometry<multi_polygon_type>("MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((5 5,5 6,6 6,5 5)))",
+        "{\"type\":\"MultiPolygon\",\"coordinates\":[[[[0,0],[0,1],[1,1],[0,0]]],"
+        "[[[5,5],[5,6],[6,6],[5,5]]]]}");
+    test_geometry<multi_point_type>("MULTIPOINT()",
+        "{\"type\":\"MultiPoint\",\"coordinates\":[]}");
+
+    // Full precision
+    test_geometry<point_type>("POINT(0.1 -123456.78901234567)",
+        "{\"type\":\"Point\",\"coordinates\":[0.1,-123456.78901234567]}");
+
+    // Written as Polygon and LineString
+    bg::model::box<point_type> const box(point_type(0, 1), point_type(2, 3));
+    BOOST_CHECK_EQUAL(geojson_string(box),
+        "{\"type\":\"Polygon\",\"coordinates\":[[[0,1],[0,3],[2,3],[2,1],[0,1]]]}");
+    bg::model::segment<point_type> const segment(point_type(0, 1), point_type(2, 3));
+    BOOST_CHECK_EQUAL(geojson_string(segment),
+        "{\"type\":\"LineString\",\"coordinates\":[[0,1],[2,3]]}");
+
+    // Open rings are closed in GeoJSON
+    {
+        typedef bg::model::polygon<point_type, false, false> open_polygon_type;
+        test_geometry<open_polygon_type>("POLYGON((0 0,1 0,1 1))",
+            "{\"type\":\"Polygon\",\"coordinates\":[[[0,0],[1,0],[1,1],[0,0]]]}");
+    }
+
+    // Precision
+    {
+        std::string result;
+        bg::to_geojson(point_type(1.0 / 3.0, 2), result, 3);
+        BOOST_CHECK_EQUAL(result, "{\"type\":\"Point\",\"coordinates\":[0.333,2]}");
+    }
+
+    // Registered point type
+    {
+        bg::model::linestring<custom_point> linestring;
+        BOOST_CHECK(bg::read_geojson(
+            "{\"coordinates\": [[1, 2], [3, 4.5e1]], \"type\": \"LineString\"}",
+            linestring));
+        BOOST_CHECK_EQUAL(linestring.size(), 2u);
+        BOOST_CHECK_EQUAL(linestring[1].y, 45.0);
+    }
+
+    // Members in any order, other members, whitespace, altitudes
+    test_read<polygon_type>(
+        " { \"bbox\" : [0, 0, 1, 1],\n\t\"coordinates\" : [ [ [0, 0, 7], [0, 1, 7], [1, 1, 7], [0, 0, 7] ] ],"
+        " \"crs\": {\"x\": [\"]\", {}]}, \"type\" : \"Polygon\" } ",
+        "POLYGON((0 0,0 1,1 1,0 0))");
+    test_read<point3d_type>("{\"type\":\"Point\",\"coordinates\":[1,2]}", "POINT(1 2 0)");
+
+    // Features
+    test_read<point_type>(
+        "{\"type\":\"Feature\",\"properties\":{\"name\":\"a\"},"
+        "\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"id\":3}",
+        "POINT(1 2)");
+    test_read<linestring_type>(
+        "{\"type\":\"Feature\",\"geometry\":null,\"properties\":null}",
+        "LINESTRING()", false);
+
+    test_read_failure<point_type>("{\"type\":\"LineString\",\"coordinates\":[[1,2]]}");
+    test_read_failure<point_type>("{\"type\":\"Point\"}");
+    test_read_failure<point_type>("{\"coordinates\":[1,2]}");
+    test_read_failure<point_type>("{\"type\":\"Point\",\"coordinates\":[1,2]");
+    test_read_failure<point_type>("{\"type\":\"Point\",\"coordinates\":[1,2]} x");
+    test_read_failure<point_type>("{\"type\":\"Point\",\"coordinates\":[1,x]}");
+    test_read_failure<point_type>("{\"type\":\"Point\",\"coordinates\":[1,--2]}");
+    test_read_failure<linestring_type>("{\"type\":\"LineString\",\"coordinates\":[[1,2],]}");
+    test_read_failure<polygon_type>("{\"type\":\"FeatureCollection\",\"features\":[]}");
+}
+
+
+struct collector
+{
+    void operator()(polygon_type const& polygon, std::string const& properties)
+    {
+        geometries.push_back(wkt_string(polygon));
+        this->properties.push_back(properties);
+    }
+
+    std::vector<std::string> geometries;
+    std::vector<std::string> properties;
+};
+
+void test_streaming()
+{
+    // A FeatureCollection, written one feature at a time
+    std::ostringstream out;
+    std::vector<std::string> expected;
+    {
+        bg::geojson_writer writer(out);
+        for (int i = 0; i < 100; ++i)
+        {
+            polygon_type polygon;
+            std::ostringstream wkt;
+            wkt << "POLYGON((0 0,0 " << i << "," << i << " " << i << ",0 0))";
+            bg::read_wkt(wkt.str(), polygon);
+            expected.push_back(wkt_string(polygon));
+
+            std::ostringstream properties;
+            properties << "{\"name\":\"feature \\\"" << i << "\\\" ]}\",\"n\":[" << i << "]}";
+            writer.add(polygon, i % 10 == 0 ? std::string() : properties.str());
+        }
+        writer.close();
+        BOOST_CHECK_EQUAL(writer.count(), 100u);
+    }
+
+    std::string const collection = "\n" + out.str() + "\n";
+    BOOST_CHECK_EQUAL(collection.substr(0, 45),
+        "\n{\"type\":\"FeatureCollection\",\"features\":[{\"ty");
+
+    // Read in chunks of several sizes
+    std::size_t const sizes[] = { 1, 7, 100, 100000 };
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        bg::geojson_reader<polygon_type, collector> reader;
+        for (std::size_t i = 0; i < collection.size(); i += sizes[s])
+        {
+            reader.feed(collection.substr(i, sizes[s]));
+        }
+        reader.finish();
+
+        collector const& result = reader.handler();
+        BOOST_CHECK(result.geometries == expected);
+        BOOST_CHECK_EQUAL(result.properties.size(), 100u);
+        BOOST_CHECK_EQUAL(result.properties[0], "null");
+        BOOST_CHECK_EQUAL(result.properties[1],
+                          "{\"name\":\"feature \\\"1\\\" ]}\",\"n\":[1]}");
+    }
+
+    // A single Feature or Geometry
+    {
+        bg::geojson_reader<polygon_type, collector> reader;
+        reader.feed("{\"type\":\"Polygon\",\"coordinates\":[[[0,0],[0,1],[1,1],[0,0]]]}");
+        reader.finish();
+        BOOST_CHECK_EQUAL(reader.handler().geometries.size(), 1u);
+    }
+
+    // Empty collection
+    {
+        std::ostringstream empty;
+        bg::geojson_writer writer(empty);
+        writer.close();
+        BOOST_CHECK_EQUAL(empty.str(), "{\"type\":\"FeatureCollection\",\"features\":[]}");
+
+        bg::geojson_reader<polygon_type, collector> reader;
+        reader.feed(empty.str());
+        reader.finish();
+        BOOST_CHECK(reader.handler().geometries.empty());
+    }
+
+    // Invalid
+    {
+        bg::geojson_reader<polygon_type, collector> reader;
+        reader.feed(collection.substr(0, 1000));
+        BOOST_CHECK_THROW(reader.finish(), bg::read_geojson_exception);
+    }
+    {
+        bg::geojson_reader<polygon_type, collector> reader;
+        BOOST_CHECK_THROW(reader.feed("{\"type\":\"FeatureCollection\",\"features\":[1]}"),
+                          bg::read_geojson_exception);
+    }
+    {
+        bg::geojson_reader<polygon_type, collector> reader;
+        reader.feed("{\"type\":\"Something\",\"features\":[]}");
+        BOOST_CHECK_THROW(reader.finish(), bg::read_geojson_exception);
+    }
+    {
+        bg::geojson_reader<polygon_type, collector> reader;
+        BOOST_CHECK_THROW(reader.feed("{}{}"), bg::read_geojson_exception);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all();
+    test_streaming();
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/io/records/read.hpp>
+#include <boost/geometry/io/wkb/write.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef std::pair<box_type, std::size_t> value_type;
+
+namespace bgi = bg::index;
+
+
+template <typename Geometry>
+std::string to_string(std::vector<Geometry> const& geometries)
+{
+    std::string result;
+    for (std::size_t i = 0; i < geometries.size(); ++i)
+    {
+        bg::to_wkt(geometries[i], result);
+        result += ";";
+    }
+    return result;
+}
+
+polygon_type square(int i)
+{
+    polygon_type result;
+    double const x = i % 100;
+    double const y = i / 100;
+    bg::append(result.outer(), point_type(x, y));
+    bg::append(result.outer(), point_type(x, y + 0.5));
+    bg::append(result.outer(), point_type(x + 0.5, y + 0.5));
+    bg::append(result.outer(), point_type(x + 0.5, y));
+    bg::append(result.outer(), point_type(x, y));
+    return result;
+}
+
+void test_wkt()
+{
+    std::vector<polygon_type> expected;
+    std::string text;
+    for (int i = 0; i < 5000; ++i)
+    {
+        expected.push_back(square(i));
+        bg::to_wkt(expected.back(), text);
+        text += i % 7 == 0 ? " \r\n" : "\n";
+        if (i % 11 == 0)
+        {
+            text += "\n \t\n";
+        }
+    }
+    // Last line without newline
+    text.erase(text.size() - 1);
+
+    std::vector<polygon_type> sequential;
+    bg::read_wkt_records(text.data(), text.data() + text.size(), sequential);
+    BOOST_CHECK_EQUAL(sequential.size(), expected.size());
+    BOOST_CHECK(to_string(sequential) == to_string(expected));
+
+    // Small chunks, ending anywhere in the lines
+    std::size_t const grains[] = { 1, 17, 1000, 100000 };
+    for (std::size_t g = 0; g < 4; ++g)
+    {
+        std::vector<polygon_type> parallel(1, square(-1));
+        std::vector<value_type> values;
+        bg::read_wkt_records(text.data(), text.data() + text.size(),
+                             parallel, values,
+                             bg::execution::parallel_policy(4, grains[g]));
+        BOOST_CHECK_EQUAL(parallel.size(), expected.size() + 1);
+        BOOST_CHECK_EQUAL(values.size(), expected.size());
+        parallel.erase(parallel.begin());
+        BOOST_CHECK(to_string(parallel) == to_string(expected));
+        BOOST_CHECK_EQUAL(values[10].second, 11u);
+        BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 0>(values[10].first)), 10.0);
+        BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(values[10].first)), 0.5);
+    }
+
+    // Errors report the record
+    std::string const invalid = "POINT(1 2)\n\nPOINT(3 4)\nPOINT(5 x)\nPOINT(6 7)";
+    std::vector<point_type> points;
+    try
+    {
+        bg::read_wkt_records(invalid.data(), invalid.data() + invalid.size(),
+                             points, bg::execution::parallel_policy(3, 1));
+        BOOST_CHECK_MESSAGE(false, "no exception");
+    }
+    catch (bg::read_records_exception const& e)
+    {
+        BOOST_CHECK_EQUAL(e.record(), 2u);
+    }
+
+    std::vector<point_type> empty;
+    bg::read_wkt_records(text.data(), text.data(), empty,
+                         bg::execution::parallel_policy(3, 1));
+    BOOST_CHECK(empty.empty());
+}
+
+void append_record(std::string& records, polygon_type const& polygon)
+{
+    std::string wkb;
+    bg::write_wkb(polygon, std::back_inserter(wkb));
+    boost::uint32_t const size = boost::uint32_t(wkb.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        records += char((size >> (8 * i)) & 0xff);
+    }
+    records += wkb;
+}
+
+void test_wkb()
+{
+    std::vector<polygon_type> expected;
+    std::string records;
+    for (int i = 0; i < 3000; ++i)
+    {
+        expected.push_back(square(i));
+        append_record(records, expected.back());
+    }
+
+    std::vector<polygon_type> sequential;
+    bg::read_wkb_records(records.data(), records.size(), sequential);
+    BOOST_CHECK(to_string(sequential) == to_string(expected));
+
+    std::vector<polygon_type> parallel;
+    std::vector<value_type> values;
+    bg::read_wkb_records(records.data(), records.size(), parallel, values,
+                         bg::execution::parallel_policy(4, 7));
+    BOOST_CHECK(to_string(parallel) == to_string(expected));
+
+    // Fed to the packing constructor
+    bgi::rtree<value_type, bgi::quadratic<16> > const rtree(values);
+    std::vector<value_type> found;
+    rtree.query(bgi::intersects(box_type(point_type(10.2, 0.2), point_type(11.2, 1.2))),
+                std::back_inserter(found));
+    BOOST_CHECK_EQUAL(found.size(), 4u);
+
+    // Truncated
+    std::vector<polygon_type> truncated;
+    try
+    {
+        bg::read_wkb_records(records.data(), records.size() - 1, truncated,
+                             bg::execution::parallel_policy(4, 7));
+        BOOST_CHECK_MESSAGE(false, "no exception");
+    }
+    catch (bg::read_records_exception const& e)
+    {
+        BOOST_CHECK_EQUAL(e.record(), 2999u);
+    }
+
+    // Wrong type
+    std::vector<point_type> points;
+    BOOST_CHECK_THROW(bg::read_wkb_records(records.data(), records.size(), points),
+                      bg::read_records_exception);
+}
+
+int test_main(int, char* [])
+{
+    test_wkt();
+    test_wkb();
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/io/svg/svg_stream_mapper.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+std::size_t count(std::string const& s, std::string const& what)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + 1))
+    {
+        ++result;
+    }
+    return result;
+}
+
+template <typename Geometry>
+std::string map(std::string const& wkt, double tolerance = 0.5)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::ostringstream out;
+    {
+        // One map unit is ten pixels, y is mirrored
+        bg::svg_stream_mapper<point_type> mapper(out,
+            box_type(point_type(0, 0), point_type(10, 10)), 100, 100,
+            tolerance);
+        mapper.map(geometry, "fill:red");
+    }
+
+    std::string const svg = out.str();
+    std::size_t const begin = svg.find("\n<", svg.find("<svg")) + 1;
+    std::size_t const end = svg.find("</svg>");
+    return begin < end ? svg.substr(begin, end - begin) : "";
+}
+
+void test_elements()
+{
+    BOOST_CHECK_EQUAL(map<point_type>("POINT(1 2)"),
+        "<circle cx=\"10\" cy=\"80\" r=\"5\" style=\"fill:red\"/>\n");
+    BOOST_CHECK_EQUAL(map<box_type>("BOX(1 2,3 4.55)"),
+        "<rect x=\"10\" y=\"54.5\" width=\"20\" height=\"25.5\" style=\"fill:red\"/>\n");
+    BOOST_CHECK_EQUAL(map<bg::model::segment<point_type> >("SEGMENT(1 2,3 4)"),
+        "<line x1=\"10\" y1=\"80\" x2=\"30\" y2=\"60\" style=\"fill:red\"/>\n");
+    BOOST_CHECK_EQUAL(map<linestring_type>("LINESTRING(0 0,1 1.01,2 2,3 2.5,-1 -1)"),
+        "<polyline points=\"0,100 20,80 30,75 -10,110\" style=\"fill:red;fill:none\"/>\n");
+    BOOST_CHECK_EQUAL(map<bg::model::ring<point_type> >("POLYGON((0 0,0 5,5 5,5 0,0 0))"),
+        "<polygon points=\"0,100 0,50 50,50 50,100\" style=\"fill:red\"/>\n");
+    BOOST_CHECK_EQUAL(map<polygon_type>("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1),(1 1,1.01 1,1 1.01,1 1))"),
+        "<path fill-rule=\"evenodd\" d=\"M0,100L0,50 50,50 50,100ZM10,90L20,90 20,80Z\" style=\"fill:red\"/>\n");
+
+    // Multi geometries are written per element, skipping those outside
+    BOOST_CHECK_EQUAL(map<multi_polygon_type>("MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((20 20,20 21,21 21,20 20)),((2 2,2 3,3 3,2 2)))"),
+        "<path fill-rule=\"evenodd\" d=\"M0,100L0,90 10,90Z\" style=\"fill:red\"/>\n"
+        "<path fill-rule=\"evenodd\" d=\"M20,80L20,70 30,70Z\" style=\"fill:red\"/>\n");
+
+    // Outside the viewport, or collapsing into less than three pixels
+    BOOST_CHECK_EQUAL(map<point_type>("POINT(11 2)"), "");
+    BOOST_CHECK_EQUAL(map<linestring_type>("LINESTRING(11 0,12 12)"), "");
+    BOOST_CHECK_EQUAL(map<polygon_type>("POLYGON((1 1,1.01 1,1 1.01,1 1))"), "");
+
+    // Pixels too large for one decimal are written in the shortest format
+    {
+        linestring_type line;
+        bg::read_wkt("LINESTRING(0 0,1e20 1e20)", line);
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<point_type> mapper(out,
+                box_type(point_type(0, 0), point_type(1e-9, 1e-9)), 100, 100);
+            mapper.map(line, "stroke:blue");
+        }
+        BOOST_CHECK(out.str().find("<polyline points=\"0,100 1e+31,-1e+31\"")
+                    != std::string::npos);
+    }
+
+    // Without tolerance, only points on a line and duplicates are skipped
+    BOOST_CHECK_EQUAL(map<linestring_type>("LINESTRING(0 0,1 1,1 1,2 2,3 2.01)", 0),
+        "<polyline points=\"0,100 20,80 30,79.9\" style=\"fill:red;fill:none\"/>\n");
+}
+
+void test_many()
+{
+    // A long wavy line, decimated into a few hundred points
+    linestring_type line;
+    for (int i = 0; i <= 100000; ++i)
+    {
+        double const x = i * 0.0001;
+        line.push_back(point_type(x, 5 + 2 * std::sin(x)));
+    }
+
+    std::ostringstream out;
+    std::size_t written = 0;
+    std::size_t skipped = 0;
+    {
+        bg::svg_stream_mapper<point_type> mapper(out,
+            box_type(point_type(0, 0), point_type(10, 10)), 100, 100,
+            0.5, "width=\"100\" height=\"100\"", 1024);
+        mapper.map(line, "stroke:blue");
+        for (int i = 0; i < 10000; ++i)
+        {
+            mapper.map(point_type(i % 100 * 0.1, i % 50 * 0.2), "fill:red", 1);
+        }
+        mapper.map(point_type(-5, -5), "fill:red", 1);
+        mapper.text(point_type(5, 5), "label", "font-size:8px");
+
+        // Written in blocks
+        BOOST_CHECK(! out.str().empty());
+
+        written = mapper.written_count();
+        skipped = mapper.skipped_count();
+    }
+
+    std::string const svg = out.str();
+    BOOST_CHECK_EQUAL(written, 1u + 10000u + 1u);
+    BOOST_CHECK_EQUAL(skipped, 1u);
+    BOOST_CHECK_EQUAL(count(svg, "<circle"), 10000u);
+    BOOST_CHECK_EQUAL(count(svg, "<text style=\"font-size:8px\" x=\"50\" y=\"50\">label</text>"), 1u);
+    BOOST_CHECK(svg.find("<svg width=\"100\" height=\"100\"") != std::string::npos);
+    BOOST_CHECK_EQUAL(svg.substr(svg.size() - 7), "</svg>\n");
+
+    std::size_t const begin = svg.find("<polyline points=\"");
+    std::size_t const end = svg.find("\"", begin + 18);
+    BOOST_CHECK(begin != std::string::npos);
+    std::size_t const points = count(svg.substr(begin, end - begin), ",");
+    BOOST_CHECK_GT(points, 5u);
+    BOOST_CHECK_LT(points, 100u);
+}
+
+int test_main(int, char* [])
+{
+    test_elements();
+    test_many();
+
+    return 0;
+}
@@ -0,0 +1,374 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <deque>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/io/wkb/wkb.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::box<point_type> box_type;
+
+// Polygon with a hole, big-endian (XDR)
+static std::string const polygon_xdr =
+    "000000000300000002000000050000000000000000000000000000000000000000000000"
+    "004024000000000000402400000000000040240000000000004024000000000000000000"
+    "000000000000000000000000000000000000000000000000054000000000000000400000"
+    "000000000040100000000000004000000000000000401000000000000040100000000000"
+    "004000000000000000401000000000000040000000000000004000000000000000";
+
+// MultiPolygon in XDR with a first polygon in NDR
+static std::string const multi_polygon_mixed =
+    "000000000600000002010300000001000000050000000000000000000000000000000000"
+    "000000000000000000000000000000002440000000000000244000000000000024400000"
+    "000000002440000000000000000000000000000000000000000000000000000000000300"
+    "00000100000004403400000000000040340000000000004034000000000000403E000000"
+    "000000403E000000000000403E00000000000040340000000000004034000000000000";
+
+// GeometryCollection of two polygons
+static std::string const collection =
+    "010700000002000000010300000001000000050000000000000000000000000000000000"
+    "000000000000000000000000000000002440000000000000244000000000000024400000"
+    "000000002440000000000000000000000000000000000000000000000000010300000001"
+    "000000040000000000000000003440000000000000344000000000000034400000000000"
+    "003E400000000000003E400000000000003E4000000000000034400000000000003440";
+
+template <typename Geometry>
+std::string wkt_string(Geometry const& geometry)
+{
+    std::string result;
+    bg::to_wkt(geometry, result);
+    return result;
+}
+
+byte_vector to_bytes(std::string const& hex)
+{
+    byte_vector result;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(result)));
+    return result;
+}
+
+template <typename Geometry>
+void test_round_trip(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    byte_vector wkb;
+    BOOST_CHECK(bg::write_wkb(geometry, std::back_inserter(wkb)));
+
+    Geometry result;
+    BOOST_CHECK_MESSAGE(bg::read_wkb(wkb.begin(), wkb.end(), result),
+                        "read_wkb failed for " << wkt);
+    BOOST_CHECK_EQUAL(wkt_string(result), wkt_string(geometry));
+
+    // The same through EWKB with an SRID and through a std::deque (which
+    // is not contiguous)
+    std::deque<char> ewkb;
+    BOOST_CHECK(bg::write_ewkb(geometry, std::back_inserter(ewkb), 4326));
+
+    boost::uint32_t srid = 0;
+    Geometry ewkb_result;
+    BOOST_CHECK_MESSAGE(bg::read_wkb(ewkb.begin(), ewkb.end(), ewkb_result, srid),
+                        "read_wkb of EWKB failed for " << wkt);
+    BOOST_CHECK_EQUAL(wkt_string(ewkb_result), wkt_string(geometry));
+    BOOST_CHECK_EQUAL(srid, 4326u);
+
+    // Truncated WKB is refused
+    for (std::size_t size = 0; size < wkb.size(); size += 3)
+    {
+        Geometry truncated;
+        BOOST_CHECK(! bg::read_wkb(&wkb[0], size, truncated));
+    }
+}
+
+template <typename Geometry>
+void test_read(std::string const& hex, std::string const& expected_wkt,
+               boost::uint32_t expected_srid = 0)
+{
+    byte_vector const wkb = to_bytes(hex);
+
+    Geometry geometry;
+    boost::uint32_t srid = 0;
+    BOOST_CHECK_MESSAGE(bg::read_wkb(wkb.begin(), wkb.end(), geometry, srid),
+                        "read_wkb failed for " << expected_wkt);
+    BOOST_CHECK_EQUAL(wkt_string(geometry), expected_wkt);
+    BOOST_CHECK_EQUAL(srid, expected_srid);
+}
+
+template <typename Geometry>
+void test_read_failure(std::string const& hex)
+{
+    byte_vector const wkb = to_bytes(hex);
+    Geometry geometry;
+    BOOST_CHECK_MESSAGE(! bg::read_wkb(wkb.begin(), wkb.end(), geometry),
+                        "read_wkb should fail for " << hex);
+}
+
+void test_write(std::string const& wkt, std::string const& expected_hex,
+                bool ewkb = false, boost::uint32_t srid = 0)
+{
+    bg::model::linestring<point3d_type> linestring;
+    bg::read_wkt(wkt, linestring);
+
+    std::string wkb;
+    if (ewkb)
+    {
+        bg::write_ewkb(linestring, std::back_inserter(wkb), srid);
+    }
+    else
+    {
+        bg::write_wkb(linestring, std::back_inserter(wkb));
+    }
+
+    std::string hex;
+    bg::wkb2hex(wkb.begin(), wkb.end(), hex);
+    BOOST_CHECK_EQUAL(hex, expected_hex);
+}
+
+void test_all()
+{
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::multi_point<point_type> multi_point_type;
+    typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+    typedef bg::model::polygon<point3d_type> polygon3d_type;
+    typedef bg::model::multi_polygon<polygon3d_type> multi_polygon3d_type;
+
+    test_round_trip<point_type>("POINT(1 2)");
+    test_round_trip<point3d_type>("POINT(1 2 3)");
+    test_round_trip<linestring_type>("LINESTRING(0 0,1 1,2.5 -3)");
+    test_round_trip<linestring_type>("LINESTRING()");
+    test_round_trip<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2))");
+    test_round_trip<multi_point_type>("MULTIPOINT((1 2),(3 4))");
+    test_round_trip<multi_linestring_type>("MULTILINESTRING((0 0,1 1),(2 2,3 3,4 5))");
+    test_round_trip<multi_polygon_type>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2)),((20 20,20 30,30 30,20 20)))");
+    test_round_trip<multi_polygon3d_type>("MULTIPOLYGON(((0 0 1,0 10 2,10 10 3,0 0 1)))");
+
+    // Points of other types than double, which are read one by one
+    test_round_trip<bg::model::linestring<bg::model::point<float, 2, bg::cs::cartesian> > >("LINESTRING(0 0,1.5 1,2 3)");
+    test_round_trip<bg::model::polygon<point_type, true, true, std::deque> >("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+
+    // Byte orders and types
+    test_read<point_type>("00000000013FF00000000000004000000000000000", "POINT(1 2)");
+    test_read<point_type>("0101000020E6100000000000000000F03F0000000000000040", "POINT(1 2)", 4326);
+    test_read<point3d_type>("01E9030000000000000000F03F00000000000000400000000000000840", "POINT(1 2 3)");
+    test_read<point3d_type>("0101000080000000000000F03F00000000000000400000000000000840", "POINT(1 2 3)");
+    // M (ISO 2001) is read as third coordinate
+    test_read<point3d_type>("01D1070000000000000000F03F00000000000000400000000000000840", "POINT(1 2 3)");
+    // ZM with SRID
+    test_read<bg::model::linestring<bg::model::point<double, 4, bg::cs::cartesian> > >(
+        "01020000E0E610000002000000000000000000F03F000000000000004000000000000008400000000000001040000000000000144000000000000018400000000000001C400000000000002040",
+        "LINESTRING(1 2 3 4,5 6 7 8)", 4326);
+    test_read<polygon_type>(polygon_xdr, "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2))");
+    test_read<multi_polygon_type>(multi_polygon_mixed, "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 20,20 30,30 30,20 20)))");
+    test_read<multi_polygon_type>(collection, "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 20,20 30,30 30,20 20)))");
+
+    // Other type
+    test_read_failure<linestring_type>("00000000013FF00000000000004000000000000000");
+    test_read_failure<multi_point_type>(collection);
+    // Other dimension
+    test_read_failure<point_type>("01E9030000000000000000F03F00000000000000400000000000000840");
+    test_read_failure<point3d_type>("00000000013FF00000000000004000000000000000");
+    // Invalid byte order, invalid type
+    test_read_failure<point_type>("02010000000000000000F03F0000000000000040");
+    test_read_failure<point_type>("01B90B0000000000000000F03F0000000000000040");
+    // Too many points
+    test_read_failure<linestring_type>("0102000000FFFFFFFF000000000000F03F0000000000000040");
+
+    // Writing
+    test_write("LINESTRING(1 2 3)", "01EA03000001000000000000000000F03F00000000000000400000000000000840");
+    test_write("LINESTRING(1 2 3)", "010200008001000000000000000000F03F00000000000000400000000000000840", true);
+    test_write("LINESTRING(1 2 3)", "01020000A0E610000001000000000000000000F03F00000000000000400000000000000840", true, 4326);
+}
+
+template <typename View, typename Geometry>
+void check_view(View const& view, Geometry const& geometry)
+{
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(geometry));
+    BOOST_CHECK_CLOSE(bg::area(view), bg::area(geometry), 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), bg::perimeter(geometry), 0.0001);
+
+    box_type const view_box = bg::return_envelope<box_type>(view);
+    box_type const box = bg::return_envelope<box_type>(geometry);
+    BOOST_CHECK(bg::equals(view_box, box));
+
+    point_type const view_centroid = bg::return_centroid<point_type>(view);
+    point_type const centroid = bg::return_centroid<point_type>(geometry);
+    BOOST_CHECK_CLOSE(bg::get<0>(view_centroid), bg::get<0>(centroid), 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<1>(view_centroid), bg::get<1>(centroid), 0.0001);
+
+    double const coordinates[] = { 1, 3, 5, 15, 22, 25 };
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            point_type const point(coordinates[i], coordinates[j]);
+            BOOST_CHECK_EQUAL(bg::within(point, view), bg::within(point, geometry));
+        }
+    }
+    BOOST_CHECK(bg::within(point_type(1, 1), view));
+
+    // Algorithms accessing the rings by index
+    BOOST_CHECK_EQUAL(bg::is_valid(view), bg::is_valid(geometry));
+    polygon_type polygon;
+    bg::read_wkt("POLYGON((2 2,2 3,3 3,3 2,2 2))", polygon);
+    BOOST_CHECK_EQUAL(bg::intersects(view, polygon), bg::intersects(geometry, polygon));
+    bg::read_wkt("POLYGON((1000 1000,1000 1001,1001 1001,1001 1000,1000 1000))", polygon);
+    BOOST_CHECK(! bg::intersects(view, polygon));
+    BOOST_CHECK(bg::intersects(view, geometry));
+    box_type const inside(point_type(0.5, 0.5), point_type(1.5, 1.5));
+    box_type const outside(point_type(1000, 1000), point_type(1001, 1001));
+    BOOST_CHECK(! bg::disjoint(inside, view));
+    BOOST_CHECK(bg::disjoint(outside, view));
+
+    // The view can be written as WKB
+    byte_vector wkb;
+    bg::write_wkb(view, std::back_inserter(wkb));
+    Geometry copy;
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), copy));
+    BOOST_CHECK_EQUAL(wkt_string(copy), wkt_string(geometry));
+}
+
+void test_views()
+{
+    typedef bg::wkb_polygon_view<point_type> polygon_view;
+    typedef bg::wkb_multi_polygon_view<point_type> multi_polygon_view;
+
+    {
+        polygon_type polygon;
+        byte_vector const xdr = to_bytes(polygon_xdr);
+        bg::read_wkb(xdr.begin(), xdr.end(), polygon);
+        byte_vector wkb;
+        bg::write_wkb(polygon, std::back_inserter(wkb));
+
+        polygon_view const view(&wkb[0], wkb.size());
+
+        BOOST_CHECK_CLOSE(bg::area(view), 96.0, 0.0001);
+        BOOST_CHECK_EQUAL(boost::size(bg::interior_rings(view)), 1u);
+        check_view(view, polygon);
+    }
+
+    {
+        polygon_type polygon;
+        bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2))", polygon);
+        byte_vector wkb;
+        bg::write_ewkb(polygon, std::back_inserter(wkb), 28992);
+
+        polygon_view const view(&wkb[0], wkb.size());
+        BOOST_CHECK_EQUAL(view.srid(), 28992u);
+        check_view(view, polygon);
+    }
+
+    {
+        multi_polygon_type multi_polygon;
+        byte_vector const mixed = to_bytes(multi_polygon_mixed);
+        bg::read_wkb(mixed.begin(), mixed.end(), multi_polygon);
+        byte_vector wkb;
+        bg::write_wkb(multi_polygon, std::back_inserter(wkb));
+
+        multi_polygon_view const view(&wkb[0], wkb.size());
+
+        BOOST_CHECK_EQUAL(boost::size(view), 2u);
+        BOOST_CHECK_CLOSE(bg::area(view), 150.0, 0.0001);
+        check_view(view, multi_polygon);
+
+        // A GeometryCollection of polygons in NDR
+        if (bg::detail::wkb::native_byte_order() == bg::detail::wkb::byte_order_type::ndr)
+        {
+            byte_vector const wkb = to_bytes(collection);
+            multi_polygon_view const view(&wkb[0], wkb.size());
+            BOOST_CHECK_EQUAL(boost::size(view), 2u);
+            check_view(view, multi_polygon);
+        }
+    }
+
+    {
+        typedef bg::model::linestring<point_type> linestring_type;
+        typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+        typedef bg::model::multi_point<point_type> multi_point_type;
+
+        multi_linestring_type multi_linestring;
+        bg::read_wkt("MULTILINESTRING((0 0,3 4),(1 1,1 2,2 2))", multi_linestring);
+        byte_vector wkb;
+        bg::write_wkb(multi_linestring, std::back_inserter(wkb));
+
+        bg::wkb_multi_linestring_view<point_type> const view(&wkb[0], wkb.size());
+        BOOST_CHECK_CLOSE(bg::length(view), 7.0, 0.0001);
+        BOOST_CHECK_EQUAL(bg::num_points(view), 5u);
+
+        // Linestring of the second element of the MultiLineString
+        std::size_t const offset = 9 + 9 + 2 * 16;
+        bg::wkb_linestring_view<point_type> const linestring(&wkb[offset], wkb.size() - offset);
+        BOOST_CHECK_CLOSE(bg::length(linestring), 2.0, 0.0001);
+
+        multi_point_type multi_point;
+        bg::read_wkt("MULTIPOINT((1 2),(3 4),(-5 6))", multi_point);
+        wkb.clear();
+        bg::write_wkb(multi_point, std::back_inserter(wkb));
+
+        bg::wkb_multi_point_view<point_type> const points(&wkb[0], wkb.size());
+        BOOST_CHECK_EQUAL(boost::size(points), 3u);
+        box_type const box = bg::return_envelope<box_type>(points);
+        BOOST_CHECK_EQUAL(wkt_string(box), "POLYGON((-5 2,-5 6,3 6,3 2,-5 2))");
+    }
+
+    // Invalid WKB, other type, other dimension, other byte order
+    {
+        polygon_type polygon;
+        bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", polygon);
+        byte_vector wkb;
+        bg::write_wkb(polygon, std::back_inserter(wkb));
+        BOOST_CHECK_THROW(polygon_view(&wkb[0], wkb.size() - 1), bg::read_wkb_exception);
+        BOOST_CHECK_THROW(multi_polygon_view(&wkb[0], wkb.size()), bg::read_wkb_exception);
+        BOOST_CHECK_THROW(bg::wkb_polygon_view<point3d_type>(&wkb[0], wkb.size()), bg::read_wkb_exception);
+
+        // Mixed byte orders can never be viewed, XDR not on little-endian
+        byte_vector const xdr = to_bytes(polygon_xdr);
+        byte_vector const mixed = to_bytes(multi_polygon_mixed);
+        BOOST_CHECK_THROW(multi_polygon_view(&mixed[0], mixed.size()), bg::read_wkb_exception);
+        if (bg::detail::wkb::native_byte_order() == bg::detail::wkb::byte_order_type::ndr)
+        {
+            BOOST_CHECK_THROW(polygon_view(&xdr[0], xdr.size()), bg::read_wkb_exception);
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all();
+    test_views();
+
+    return 0;
+}
@@ -17,8 +17,10 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <iomanip>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -27,6 +29,7 @@
 #include <boost/geometry/geometries/geometries.hpp>
 
 #include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/algorithms/length.hpp>
 #include <boost/geometry/algorithms/num_points.hpp>
 #include <boost/geometry/algorithms/perimeter.hpp>
@@ -256,10 +259,131 @@ void test_all()
 }
 #endif
 
+template <typename G>
+void test_offset(std::string const& wkt, std::size_t expected)
+{
+    std::size_t offset = 0;
+    try
+    {
+        G geometry;
+        bg::read_wkt(wkt, geometry);
+    }
+    catch(bg::read_wkt_exception const& ex)
+    {
+        offset = ex.offset();
+    }
+    BOOST_CHECK_MESSAGE(offset == expected, "  Expected offset:" << expected
+                        << " Got:" << offset << " with WKT: " << wkt);
+}
+
+void test_coordinates()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::polygon<P> polygon;
+
+    // Other white space than ' ' separates tokens
+    test_wkt<bg::model::linestring<P> >("LINESTRING(1\t2,\r\n3 4)", "linestring(1 2,3 4)", 2, sqrt(8.0));
+    test_wkt<polygon>("POLYGON(\n(0 0,0 4,4 4,4 0,0 0),\n(1 1,2 1,2 2,1 2,1 1)\n)",
+            "polygon((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1))", 10, 0, 15, 20);
+
+    // Coordinates are the same as converted by lexical_cast
+    std::string const values[] = { "0.1", "-12.5e-3", "1E5", "+3",
+        "3.14159265358979323846", "9007199254740993", "1e-320", "4.9e-324" };
+    for (std::size_t i = 0 ; i < sizeof(values) / sizeof(values[0]) ; ++i)
+    {
+        P p;
+        bg::read_wkt("POINT(" + values[i] + " 1)", p);
+        BOOST_CHECK_EQUAL(bg::get<0>(p), boost::lexical_cast<double>(values[i]));
+    }
+
+    bg::model::point<int, 2, bg::cs::cartesian> pi;
+    bg::read_wkt("POINT(-2147483648 2147483647)", pi);
+    BOOST_CHECK_EQUAL(bg::get<0>(pi), (std::numeric_limits<int>::min)());
+    BOOST_CHECK_EQUAL(bg::get<1>(pi), (std::numeric_limits<int>::max)());
+    test_wrong_wkt<bg::model::point<int, 2, bg::cs::cartesian> >("POINT(2147483648 1)", "bad lexical cast");
+
+    // The offset of the erroneous token
+    test_offset<P>("POINT(1 2", 9);
+    test_offset<P>("POINT(1 2) foo", 11);
+    test_offset<bg::model::linestring<P> >("LINESTRING(1 2,3 x)", 17);
+    test_offset<polygon>("POLYGON((0 0,0 1,1 1,0 0)", 25);
+    test_offset<P>("LINESTRING(1 2)", std::string::npos);
+}
+
+void test_to_wkt()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    multi_polygon mpoly;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1)),"
+                 "((5 5,5 6,6 6,6 5,5 5)))", mpoly);
+    bg::set<0>(bg::exterior_ring(mpoly[1])[1], 1.0 / 3.0);
+    bg::set<1>(bg::exterior_ring(mpoly[1])[2], -0.1);
+    bg::set<0>(bg::exterior_ring(mpoly[1])[2], 1.0e-30);
+    bg::set<1>(bg::exterior_ring(mpoly[1])[3], 123456.789);
+
+    // Shortest representation, read back as the same geometry
+    std::string str;
+    bg::to_wkt(mpoly, str);
+    BOOST_CHECK_EQUAL(str, "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1)),"
+                           "((5 5,0.3333333333333333 6,1e-30 -0.1,6 123456.789,5 5)))");
+    multi_polygon mpoly2;
+    bg::read_wkt(str, mpoly2);
+    BOOST_CHECK(bg::equals(mpoly, mpoly2));
+    BOOST_CHECK_EQUAL(bg::get<0>(bg::exterior_ring(mpoly2[1])[1]), 1.0 / 3.0);
+
+    // Subnormal numbers have fewer significant digits
+    P const subnormal(0.1, 1e-320);
+    str.clear();
+    bg::to_wkt(subnormal, str);
+    BOOST_CHECK_EQUAL(str, "POINT(0.1 1e-320)");
+    P subnormal2;
+    bg::read_wkt(str, subnormal2);
+    BOOST_CHECK_EQUAL(bg::get<1>(subnormal2), bg::get<1>(subnormal));
+    double const denorm_min = (std::numeric_limits<double>::denorm_min)();
+    str.clear();
+    bg::to_wkt(P(denorm_min, -3 * denorm_min), str);
+    bg::read_wkt(str, subnormal2);
+    BOOST_CHECK_EQUAL(bg::get<0>(subnormal2), denorm_min);
+    BOOST_CHECK_EQUAL(bg::get<1>(subnormal2), -3 * denorm_min);
+
+    // Appended to the buffer
+    std::vector<char> buffer(1, '*');
+    bg::to_wkt(P(1.5, -2), buffer);
+    BOOST_CHECK_EQUAL(std::string(buffer.begin(), buffer.end()), "*POINT(1.5 -2)");
+
+    // The same as streamed with the precision
+    for (int precision = 1 ; precision < 20 ; ++precision)
+    {
+        std::ostringstream out;
+        out.precision(precision);
+        out << bg::wkt(mpoly);
+        str.clear();
+        bg::to_wkt(mpoly, str, precision);
+        BOOST_CHECK_EQUAL(str, out.str());
+    }
+
+    // Formatted by the stream if it isn't in the default format
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << bg::wkt(P(1.0 / 3.0, 2));
+    BOOST_CHECK_EQUAL(out.str(), "POINT(0.33 2.00)");
+
+    // Rings aren't closed, like in the manipulator
+    bg::model::ring<P> ring;
+    bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0))", ring);
+    str.clear();
+    bg::to_wkt(ring, str);
+    BOOST_CHECK_EQUAL(str, "POLYGON((0 0,0 1,1 1,1 0))");
+}
+
 int test_main(int, char* [])
 {
     test_all<double>();
     test_all<int>();
+    test_coordinates();
+    test_to_wkt();
 
 #if defined(HAVE_TTMATH)
     test_all<ttmath_big>();
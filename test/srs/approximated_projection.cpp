@@ -0,0 +1,112 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/approximated_projection.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::box<point_ll> box_ll;
+
+template <typename Approx>
+void check_points(Approx const& approx, box_ll const& box, double max_error)
+{
+    double const lon0 = bg::get<bg::min_corner, 0>(box);
+    double const lat0 = bg::get<bg::min_corner, 1>(box);
+    double const lon1 = bg::get<bg::max_corner, 0>(box);
+    double const lat1 = bg::get<bg::max_corner, 1>(box);
+
+    // deterministic pseudo-random points, including the outside of the box
+    unsigned int seed = 12345;
+    for (int i = 0 ; i < 2000 ; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        double const fu = double(seed % 10007) / 10006.0;
+        seed = seed * 1103515245u + 12345u;
+        double const fv = double(seed % 10007) / 10006.0;
+        point_ll const ll(lon0 - 1 + (lon1 - lon0 + 2) * fu,
+                          lat0 - 1 + (lat1 - lat0 + 2) * fv);
+
+        point_xy exact, approximated;
+        bool const r1 = approx.exact().forward(ll, exact);
+        bool const r2 = approx.forward(ll, approximated);
+        BOOST_CHECK_EQUAL(r1, r2);
+        if (r1 && r2)
+        {
+            double const d = bg::distance(exact, approximated);
+            BOOST_CHECK_MESSAGE(d <= max_error,
+                                "error " << d << " at " << bg::wkt(ll));
+            if (! bg::within(ll, box))
+            {
+                BOOST_CHECK_EQUAL(d, 0.0);
+            }
+        }
+    }
+}
+
+void test_projection(std::string const& proj4, box_ll const& box, double max_error)
+{
+    typedef bg::srs::projection<> projection_type;
+    typedef bg::srs::approximated_projection<projection_type> approx_type;
+
+    projection_type prj = bg::srs::proj4(proj4);
+    approx_type approx(prj, box, max_error);
+
+    BOOST_CHECK(! approx.data().nodes.empty());
+    BOOST_CHECK(! approx.data().coefficients.empty());
+    check_points(approx, box, max_error);
+
+    // created from cached data
+    approx_type cached(prj, approx.data());
+    check_points(cached, box, max_error);
+
+    bg::model::linestring<point_ll> ls;
+    bg::read_wkt("LINESTRING(0 0,1 1,2 2)", ls);
+    bg::model::linestring<point_xy> ls1, ls2;
+    BOOST_CHECK(approx.forward(ls, ls1));
+    BOOST_CHECK(approx.forward(bg::execution::parallel_policy(2, 1), ls, ls2));
+    BOOST_CHECK(bg::equals(ls1, ls2));
+
+    point_ll ll;
+    BOOST_CHECK(approx.inverse(ls1[1], ll));
+
+    // inconsistent data isn't used
+    approx_type::data_type data = approx.data();
+    data.degree = 32;
+    BOOST_CHECK_THROW(approx_type a(prj, data), bg::projection_exception);
+    data = approx.data();
+    data.coefficients.pop_back();
+    BOOST_CHECK_THROW(approx_type a(prj, data), bg::projection_exception);
+    data = approx.data();
+    data.nodes.front().children = data.nodes.size();
+    BOOST_CHECK_THROW(approx_type a(prj, data), bg::projection_exception);
+    BOOST_CHECK_THROW(approx_type a(prj, box, max_error, 32),
+                      bg::projection_exception);
+}
+
+int test_main(int, char*[])
+{
+    test_projection("+proj=etmerc +ellps=WGS84 +lon_0=15 +units=m",
+                    box_ll(point_ll(12, 45), point_ll(18, 55)), 0.01);
+    test_projection("+proj=lcc +ellps=GRS80 +lat_1=49 +lat_2=44 +lat_0=46.5 +lon_0=3 +x_0=700000 +y_0=6600000 +units=m",
+                    box_ll(point_ll(-5, 41), point_ll(10, 52)), 0.001);
+    test_projection("+proj=omerc +ellps=WGS84 +lat_0=4 +lonc=115 +alpha=53.31 +k=0.99984 +x_0=590476.87 +y_0=442857.65 +units=m",
+                    box_ll(point_ll(109, 0), point_ll(120, 8)), 0.01);
+    // the poles can't be projected, these parts are projected exactly
+    test_projection("+proj=merc +ellps=WGS84 +units=m",
+                    box_ll(point_ll(-10, 60), point_ll(10, 90)), 0.01);
+
+    return 0;
+}
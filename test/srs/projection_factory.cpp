@@ -0,0 +1,77 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+namespace srs = bg::srs;
+
+template <typename Params>
+bool is_registered(Params const& params)
+{
+    try
+    {
+        srs::projection<> prj(params);
+    }
+    catch (bg::projection_unknown_id_exception const&)
+    {
+        return false;
+    }
+    catch (bg::projection_exception const&)
+    {
+        // registered but missing or invalid parameters
+    }
+    return true;
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+    // first, last and some other names in the sorted table
+    BOOST_CHECK(is_registered(srs::proj4("+proj=aea +lat_1=55 +lat_2=65")));
+    BOOST_CHECK(is_registered(srs::proj4("+proj=wink2")));
+    BOOST_CHECK(is_registered(srs::proj4("+proj=merc")));
+    BOOST_CHECK(is_registered(srs::proj4("+proj=utm +zone=32")));
+    BOOST_CHECK(is_registered(srs::proj4("+proj=leac")));
+
+    BOOST_CHECK(! is_registered(srs::proj4("+proj=a")));
+    BOOST_CHECK(! is_registered(srs::proj4("+proj=zzz")));
+    BOOST_CHECK(! is_registered(srs::proj4("+proj=merc2")));
+    BOOST_CHECK(! is_registered(srs::proj4("+proj=mer")));
+
+    BOOST_CHECK_THROW(srs::projection<>(srs::proj4("+ellps=WGS84")),
+                      bg::projection_not_named_exception);
+
+    // every identifier is registered
+    for (int id = srs::dpar::proj_aea ; id <= srs::dpar::proj_wink2 ; ++id)
+    {
+        srs::dpar::value_proj const proj = static_cast<srs::dpar::value_proj>(id);
+        BOOST_CHECK_MESSAGE(is_registered(srs::dpar::parameters<>(proj)),
+                            "projection id " << id << " not registered");
+    }
+
+    {
+        srs::projection<> prj1 = srs::proj4("+proj=tmerc +ellps=WGS84 +units=m");
+        srs::projection<> prj2 = srs::dpar::parameters<>(srs::dpar::proj_tmerc)
+                                    (srs::dpar::ellps_wgs84)(srs::dpar::units_m);
+        point_xy xy1, xy2;
+        prj1.forward(point_ll(1, 1), xy1);
+        prj2.forward(point_ll(1, 1), xy2);
+        BOOST_CHECK_CLOSE(bg::get<0>(xy1), 111308.33561309829, 0.001);
+        BOOST_CHECK_CLOSE(bg::get<0>(xy1), bg::get<0>(xy2), 0.001);
+        BOOST_CHECK_CLOSE(bg::get<1>(xy1), bg::get<1>(xy2), 0.001);
+    }
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <sstream>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/util/execution.hpp>
+
+
+namespace bg = boost::geometry;
+
+template <typename Geometry>
+std::string to_string(Geometry const& g)
+{
+    std::ostringstream out;
+    out << std::setprecision(17) << bg::wkt(g);
+    return out.str();
+}
+
+template <typename Ring>
+Ring make_ring(double x0, double y0, double r, std::size_t count)
+{
+    Ring ring;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const a = -2.0 * bg::math::pi<double>() * double(i) / double(count);
+        bg::range::push_back(ring, typename boost::range_value<Ring>::type(
+                                    x0 + r * cos(a), y0 + r * sin(a)));
+    }
+    if (bg::closure<Ring>::value == bg::closed)
+    {
+        bg::range::push_back(ring, bg::range::front(ring));
+    }
+    return ring;
+}
+
+template <typename Projection, typename G1, typename G2>
+void check_forward(Projection const& prj, G1 const& g1, G2 const& g2_proto)
+{
+    G2 serial = g2_proto;
+    bool const serial_res = prj.forward(g1, serial);
+
+    bg::execution::parallel_policy const policies[] = {
+        bg::execution::parallel_policy(1, 1),
+        bg::execution::parallel_policy(3, 1),
+        bg::execution::parallel_policy(4, 7),
+        bg::execution::parallel_policy()
+    };
+
+    for (std::size_t i = 0 ; i < sizeof(policies) / sizeof(policies[0]) ; ++i)
+    {
+        G2 parallel = g2_proto;
+        bool const parallel_res = prj.forward(policies[i], g1, parallel);
+        BOOST_CHECK_EQUAL(serial_res, parallel_res);
+        BOOST_CHECK_EQUAL(to_string(serial), to_string(parallel));
+    }
+
+    G2 sequenced = g2_proto;
+    BOOST_CHECK_EQUAL(serial_res, prj.forward(bg::execution::sequenced_policy(), g1, sequenced));
+    BOOST_CHECK_EQUAL(to_string(serial), to_string(sequenced));
+}
+
+template <typename Projection, typename G1, typename G2>
+void check_inverse(Projection const& prj, G1 const& g1, G2 const& g2_proto)
+{
+    G2 serial = g2_proto;
+    bool const serial_res = prj.inverse(g1, serial);
+
+    G2 parallel = g2_proto;
+    bool const parallel_res = prj.inverse(bg::execution::parallel_policy(4, 5), g1, parallel);
+    BOOST_CHECK_EQUAL(serial_res, parallel_res);
+    BOOST_CHECK_EQUAL(to_string(serial), to_string(parallel));
+}
+
+template <typename PointLL, typename PointXY>
+void test_projection()
+{
+    typedef bg::model::polygon<PointLL> polygon_ll;
+    typedef bg::model::multi_polygon<polygon_ll> mpolygon_ll;
+    typedef bg::model::linestring<PointLL> linestring_ll;
+    typedef bg::model::multi_point<PointLL> mpoint_ll;
+    typedef bg::model::ring<PointLL> ring_ll;
+    typedef bg::model::ring<PointLL, false, false> ring_ccw_open_ll;
+
+    typedef bg::model::polygon<PointXY> polygon_xy;
+    typedef bg::model::multi_polygon<polygon_xy> mpolygon_xy;
+    typedef bg::model::linestring<PointXY> linestring_xy;
+    typedef bg::model::multi_point<PointXY> mpoint_xy;
+    typedef bg::model::ring<PointXY> ring_xy;
+    typedef bg::model::ring<PointXY, true, false> ring_open_xy;
+    typedef bg::model::multi_linestring<linestring_xy> mlinestring_xy;
+    typedef bg::model::multi_linestring<linestring_ll> mlinestring_ll;
+
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=merc +ellps=WGS84 +units=m");
+
+    ring_ll ring = make_ring<ring_ll>(10, 50, 5, 1000);
+    ring_ccw_open_ll ring_ccw_open = make_ring<ring_ccw_open_ll>(10, 50, 5, 999);
+
+    check_forward(prj, ring, ring_xy());
+    check_forward(prj, ring, ring_open_xy());
+    check_forward(prj, ring_ccw_open, ring_xy());
+    check_forward(prj, ring_ccw_open, ring_open_xy());
+    check_forward(prj, ring_ll(), ring_open_xy());
+    check_forward(prj, ring_ccw_open_ll(), ring_xy());
+
+    // the latitude of the poles can't be projected using mercator
+    linestring_ll ls;
+    for (int i = 0 ; i < 500 ; ++i)
+    {
+        bg::range::push_back(ls, PointLL(i % 360 - 180, i % 37 == 0 ? 90 : i % 80 - 40));
+    }
+    check_forward(prj, ls, linestring_xy());
+
+    mpoint_ll mpt;
+    bg::assign_points(mpt, ls);
+    check_forward(prj, mpt, mpoint_xy());
+
+    polygon_ll poly;
+    bg::exterior_ring(poly) = ring;
+    for (int i = 0 ; i < 20 ; ++i)
+    {
+        bg::interior_rings(poly).push_back(make_ring<ring_ll>(10, 50, 0.1 * (i + 1), 10 + 10 * i));
+    }
+    check_forward(prj, poly, polygon_xy());
+
+    // one large member and many small ones, one of them invalid
+    mpolygon_ll mpoly;
+    mpoly.push_back(poly);
+    for (int i = 0 ; i < 30 ; ++i)
+    {
+        polygon_ll small;
+        bg::exterior_ring(small) = make_ring<ring_ll>(-20 + i, 10, 1, 10);
+        mpoly.push_back(small);
+    }
+    bg::set<1>(bg::range::at(bg::exterior_ring(mpoly[17]), 3), 90);
+    check_forward(prj, mpoly, mpolygon_xy());
+
+    mlinestring_ll mls;
+    for (int i = 0 ; i < 10 ; ++i)
+    {
+        mls.push_back(ls);
+    }
+    check_forward(prj, mls, mlinestring_xy());
+
+    mpolygon_xy mpoly_xy;
+    prj.forward(mpoly, mpoly_xy);
+    check_inverse(prj, mpoly_xy, mpolygon_ll());
+}
+
+template <typename Point>
+void test_transformation()
+{
+    typedef bg::model::linestring<Point> linestring;
+    typedef bg::model::multi_linestring<linestring> mlinestring;
+    typedef bg::model::polygon<Point> polygon;
+
+    bg::srs::transformation<> tr(bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+                                 bg::srs::proj4("+proj=longlat +ellps=airy +datum=OSGB36 +no_defs"));
+
+    linestring ls;
+    for (int i = 0 ; i < 1000 ; ++i)
+    {
+        bg::range::push_back(ls, Point(-5 + i * 0.01, 50 + i * 0.005));
+    }
+
+    linestring ls1, ls2;
+    bool r1 = tr.forward(ls, ls1);
+    bool r2 = tr.forward(bg::execution::parallel_policy(4, 10), ls, ls2);
+    BOOST_CHECK_EQUAL(r1, r2);
+    BOOST_CHECK_EQUAL(to_string(ls1), to_string(ls2));
+
+    r1 = tr.inverse(ls1, ls);
+    r2 = tr.inverse(bg::execution::parallel_policy(4, 10), ls2, ls2);
+    BOOST_CHECK_EQUAL(r1, r2);
+    BOOST_CHECK_EQUAL(to_string(ls), to_string(ls2));
+
+    mlinestring mls, mls1, mls2;
+    for (int i = 0 ; i < 20 ; ++i)
+    {
+        linestring l;
+        for (int j = 0 ; j <= i ; ++j)
+        {
+            bg::range::push_back(l, Point(-5 + i * 0.1, 50 + j * 0.05));
+        }
+        mls.push_back(l);
+    }
+    mls.push_back(ls);
+    r1 = tr.forward(mls, mls1);
+    r2 = tr.forward(bg::execution::parallel_policy(3, 10), mls, mls2);
+    BOOST_CHECK_EQUAL(r1, r2);
+    BOOST_CHECK_EQUAL(to_string(mls1), to_string(mls2));
+
+    polygon poly, poly1, poly2;
+    bg::exterior_ring(poly) = make_ring<typename bg::ring_type<polygon>::type>(0, 52, 1, 500);
+    r1 = tr.forward(poly, poly1);
+    r2 = tr.forward(bg::execution::sequenced_policy(), poly, poly2);
+    BOOST_CHECK_EQUAL(r1, r2);
+    BOOST_CHECK_EQUAL(to_string(poly1), to_string(poly2));
+
+    // grids which are not shared are used by one thread
+    bg::srs::grids_storage<> gs;
+    bg::srs::transformation_grids<bg::srs::grids_storage<> > grids = tr.initialize_grids(gs);
+    r2 = tr.forward(bg::execution::parallel_policy(4, 10), poly, poly2, grids);
+    BOOST_CHECK_EQUAL(r1, r2);
+    BOOST_CHECK_EQUAL(to_string(poly1), to_string(poly2));
+}
+
+int test_main(int, char*[])
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+    test_projection<point_ll, point_xy>();
+    test_transformation<point_ll>();
+
+    return 0;
+}
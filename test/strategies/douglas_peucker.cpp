@@ -18,10 +18,12 @@
 #endif
 #endif
 
+#include <cmath>
 #include <iostream>
 #include <iterator>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <boost/test/included/unit_test.hpp>
 
@@ -420,3 +422,59 @@ BOOST_AUTO_TEST_CASE( test_with_comparable_distance_strategy )
             simplify_comparable_distance_strategy<long double>::type
         >("ld");
 }
+
+template <typename Strategy>
+inline void test_importance(std::string const& label)
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef std::vector<point_type> range_type;
+
+    // A noisy wave, and an inward spiral on which the farthest point is
+    // mostly next to an end point
+    range_type wave, spiral;
+    for (int i = 0; i < 20000; ++i)
+    {
+        double const x = i * 0.001;
+        wave.push_back(point_type(x, std::sin(x) + 0.001 * std::sin(i * 7.3)));
+
+        double const a = i * 0.01;
+        double const r = 1.0 / (1.0 + i * 0.01);
+        spiral.push_back(point_type(r * std::cos(a), r * std::sin(a)));
+    }
+
+    range_type const* ranges[] = { &wave, &spiral };
+    for (int r = 0; r < 2; ++r)
+    {
+        std::vector<typename Strategy::importance_type> importance;
+        Strategy::importance(*ranges[r], importance);
+        BOOST_CHECK_EQUAL(importance.size(), ranges[r]->size());
+
+        // All zoom levels from one calculation
+        double max_distance = 1.0;
+        for (int level = 0; level < 20; ++level, max_distance /= 2)
+        {
+            range_type expected, extracted;
+            Strategy::apply(*ranges[r], std::back_inserter(expected), max_distance);
+            Strategy::extract(*ranges[r], importance,
+                              std::back_inserter(extracted), max_distance);
+            BOOST_CHECK_MESSAGE(equals::apply(extracted, expected),
+                                label << " range " << r << " level " << level
+                                << ": " << extracted.size() << " != "
+                                << expected.size());
+        }
+    }
+
+    range_type const two = ba::list_of(point_type(0, 0))(point_type(1, 1));
+    std::vector<typename Strategy::importance_type> importance;
+    Strategy::importance(two, importance);
+    range_type extracted;
+    Strategy::extract(two, importance, std::back_inserter(extracted), 1.0);
+    BOOST_CHECK(equals::apply(extracted, two));
+}
+
+BOOST_AUTO_TEST_CASE( test_importance_of_points )
+{
+    test_importance<default_simplify_strategy<double>::type>("default");
+    test_importance<simplify_regular_distance_strategy<double>::type>("regular");
+    test_importance<simplify_comparable_distance_strategy<double>::type>("comparable");
+}
@@ -0,0 +1,224 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+typedef bg::strategy::distance::projected_point<> distance_strategy_type;
+typedef bg::strategy::simplify::visvalingam_whyatt
+    <
+        point_type, distance_strategy_type
+    > vw_type;
+typedef bg::strategy::simplify::topology_preserving
+    <
+        point_type, distance_strategy_type
+    > topology_type;
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+Geometry from_wkt(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    return geometry;
+}
+
+double triangle_area(point_type const& p1, point_type const& p2, point_type const& p3)
+{
+    return std::fabs((bg::get<0>(p2) - bg::get<0>(p1)) * (bg::get<1>(p3) - bg::get<1>(p1))
+                   - (bg::get<1>(p2) - bg::get<1>(p1)) * (bg::get<0>(p3) - bg::get<0>(p1))) / 2;
+}
+
+// Quadratic version, recalculating the smallest area after each removal
+linestring_type vw_reference(linestring_type points, double max_area)
+{
+    std::vector<double> areas(points.size(), 0);
+    for (std::size_t i = 1; i + 1 < points.size(); ++i)
+    {
+        areas[i] = triangle_area(points[i - 1], points[i], points[i + 1]);
+    }
+    while (points.size() > 2)
+    {
+        std::size_t smallest = 1;
+        for (std::size_t i = 2; i + 1 < points.size(); ++i)
+        {
+            if (areas[i] < areas[smallest])
+            {
+                smallest = i;
+            }
+        }
+        double const removed = areas[smallest];
+        if (! (removed < max_area))
+        {
+            break;
+        }
+        points.erase(points.begin() + smallest);
+        areas.erase(areas.begin() + smallest);
+        for (std::size_t i = smallest - 1; i <= smallest; ++i)
+        {
+            if (i > 0 && i + 1 < points.size())
+            {
+                areas[i] = (std::max)(removed,
+                    triangle_area(points[i - 1], points[i], points[i + 1]));
+            }
+        }
+    }
+    return points;
+}
+
+void test_linestring()
+{
+    linestring_type const ls = from_wkt<linestring_type>(
+        "LINESTRING(0 0,1 0.1,2 0,3 5,4 0)");
+    linestring_type simplified;
+    bg::simplify(ls, simplified, 0.2, vw_type());
+    BOOST_CHECK_EQUAL(to_wkt(simplified), "LINESTRING(0 0,2 0,3 5,4 0)");
+    bg::simplify(ls, simplified, 100.0, vw_type());
+    BOOST_CHECK_EQUAL(to_wkt(simplified), "LINESTRING(0 0,4 0)");
+
+    // A wavy, noisy line, compared to the quadratic version
+    linestring_type wavy;
+    for (int i = 0; i < 3000; ++i)
+    {
+        double const x = i * 0.01;
+        wavy.push_back(point_type(x, std::sin(x) + 0.003 * std::sin(i * 7.3)));
+    }
+    double const thresholds[] = { 1e-6, 1e-4, 1e-2 };
+    for (int t = 0; t < 3; ++t)
+    {
+        bg::simplify(wavy, simplified, thresholds[t], vw_type());
+        BOOST_CHECK_EQUAL(to_wkt(simplified), to_wkt(vw_reference(wavy, thresholds[t])));
+    }
+}
+
+void test_topology()
+{
+    // The top of the exterior ring would cut the hole, which is removed
+    // without preserving the topology
+    polygon_type const polygon = from_wkt<polygon_type>(
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,5 -0.1,0 0),(4 10.5,6 10.5,5 11.5,4 10.5))");
+    polygon_type simplified;
+    bg::simplify(polygon, simplified, 20.0, vw_type());
+    BOOST_CHECK_EQUAL(to_wkt(simplified), "POLYGON((10 10,10 0,0 0,0 10,10 10))");
+
+    bg::simplify(polygon, simplified, 20.0, topology_type());
+    BOOST_CHECK_EQUAL(to_wkt(simplified),
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,0 0),(4 10.5,6 10.5,5 11.5,4 10.5))");
+
+    // Rings are never removed, nor reduced to less than a triangle
+    bg::simplify(polygon, simplified, 1000.0, topology_type());
+    BOOST_CHECK(bg::is_valid(simplified));
+    BOOST_CHECK_EQUAL(simplified.inners().size(), 1u);
+
+    // Linestrings do not cross each other
+    multi_linestring_type const mls = from_wkt<multi_linestring_type>(
+        "MULTILINESTRING((0 0,5 3,10 0),(4 1,6 1))");
+    multi_linestring_type mls_out;
+    bg::simplify(mls, mls_out, 100.0, vw_type());
+    BOOST_CHECK_EQUAL(to_wkt(mls_out), "MULTILINESTRING((0 0,10 0),(4 1,6 1))");
+    bg::simplify(mls, mls_out, 100.0, topology_type());
+    BOOST_CHECK_EQUAL(to_wkt(mls_out), to_wkt(mls));
+}
+
+// Gears with holes, meshing with their neighbours in the same row
+multi_polygon_type gears(int count)
+{
+    multi_polygon_type result;
+    for (int k = 0; k < count; ++k)
+    {
+        double const cx = (k % 10) * 10.2;
+        double const cy = (k / 10) * 12.0;
+        double const phase = k % 2 == 0 ? 0.9 : -0.9;
+        polygon_type polygon;
+        for (int i = 0; i <= 600; ++i)
+        {
+            double const a = -i * 2 * bg::math::pi<double>() / 600;
+            double const r = 5.0 + phase * std::cos(a * 12) + 0.03 * std::sin(a * 97 + k);
+            polygon.outer().push_back(point_type(cx + r * std::cos(a), cy + r * std::sin(a)));
+        }
+        polygon.outer().back() = polygon.outer().front();
+        polygon_type::ring_type hole;
+        for (int i = 0; i <= 100; ++i)
+        {
+            double const a = i * 2 * bg::math::pi<double>() / 100;
+            double const r = 2.0 + 0.3 * std::sin(a * 7);
+            hole.push_back(point_type(cx + r * std::cos(a), cy + r * std::sin(a)));
+        }
+        hole.back() = hole.front();
+        polygon.inners().push_back(hole);
+        result.push_back(polygon);
+    }
+    return result;
+}
+
+void test_multi_polygon()
+{
+    multi_polygon_type const mp = gears(40);
+    BOOST_CHECK(bg::is_valid(mp));
+
+    multi_polygon_type sequential, parallel;
+    bg::simplify(mp, sequential, 0.5, topology_type());
+    bg::simplify(mp, parallel, 0.5, topology_type(),
+                 bg::execution::parallel_policy(4, 1));
+    BOOST_CHECK(bg::is_valid(sequential));
+    BOOST_CHECK_EQUAL(sequential.size(), mp.size());
+    BOOST_CHECK_LT(bg::num_points(sequential), bg::num_points(mp) / 4);
+    BOOST_CHECK_EQUAL(to_wkt(parallel), to_wkt(sequential));
+
+    // Without preserving the topology, teeth of the gears start to overlap
+    bg::simplify(mp, sequential, 0.5, vw_type());
+    bg::simplify(mp, parallel, 0.5, vw_type(),
+                 bg::execution::parallel_policy(3, 2));
+    BOOST_CHECK(! bg::is_valid(sequential));
+    BOOST_CHECK_EQUAL(to_wkt(parallel), to_wkt(sequential));
+
+    // Default strategy
+    bg::simplify(mp, sequential, 0.1);
+    bg::simplify(mp, parallel, 0.1, bg::default_strategy(),
+                 bg::execution::parallel_policy(2, 1));
+    BOOST_CHECK_EQUAL(to_wkt(parallel), to_wkt(sequential));
+}
+
+int test_main(int, char* [])
+{
+    BOOST_CONCEPT_ASSERT( (bg::concepts::SimplifyStrategy<vw_type, point_type>) );
+    BOOST_CONCEPT_ASSERT( (bg::concepts::SimplifyStrategy<topology_type, point_type>) );
+
+    test_linestring();
+    test_topology();
+    test_multi_polygon();
+
+    return 0;
+}